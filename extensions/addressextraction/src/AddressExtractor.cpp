@@ -46,7 +46,10 @@ namespace catapult { namespace addressextraction {
 		if (transactionElement.OptionalExtractedAddresses)
 			return;
 
-		auto addresses = model::ExtractAddresses(transactionElement.Transaction, *m_pPublisher);
+		// reuse notifications recorded during dispatch when available
+		auto addresses = transactionElement.OptionalNotifications
+				? model::ExtractAddresses(transactionElement.Transaction, *transactionElement.OptionalNotifications)
+				: model::ExtractAddresses(transactionElement.Transaction, *m_pPublisher);
 		transactionElement.OptionalExtractedAddresses = std::make_shared<model::UnresolvedAddressSet>(std::move(addresses));
 	}
 
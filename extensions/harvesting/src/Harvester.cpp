@@ -79,11 +79,22 @@ namespace catapult { namespace harvesting {
 			const Address& beneficiary,
 			const UnlockedAccounts& unlockedAccounts,
 			const BlockGenerator& blockGenerator)
+			: Harvester(cache, config, beneficiary, unlockedAccounts, blockGenerator, BlockGeneratorPreparer())
+	{}
+
+	Harvester::Harvester(
+			const cache::CatapultCache& cache,
+			const model::BlockChainConfiguration& config,
+			const Address& beneficiary,
+			const UnlockedAccounts& unlockedAccounts,
+			const BlockGenerator& blockGenerator,
+			const BlockGeneratorPreparer& blockGeneratorPreparer)
 			: m_cache(cache)
 			, m_config(config)
 			, m_beneficiary(beneficiary)
 			, m_unlockedAccounts(unlockedAccounts)
 			, m_blockGenerator(blockGenerator)
+			, m_blockGeneratorPreparer(blockGeneratorPreparer)
 	{}
 
 	std::unique_ptr<model::Block> Harvester::harvest(const model::BlockElement& lastBlockElement, Timestamp timestamp) {
@@ -123,8 +134,13 @@ namespace catapult { namespace harvesting {
 			return true;
 		});
 
-		if (!pHarvesterKeyPair)
+		if (!pHarvesterKeyPair) {
+			// process transactions ahead of time so that the generator only needs to process changes after an account is eligible
+			if (m_blockGeneratorPreparer && 0 != unlockedAccountsView.size())
+				m_blockGeneratorPreparer(context.Height, context.Timestamp, m_config.MaxTransactionsPerBlock);
+
 			return nullptr;
+		}
 
 		utils::StackLogger stackLogger("generating candidate block", utils::LogLevel::debug);
 		auto pBlockHeader = CreateUnsignedBlockHeader(
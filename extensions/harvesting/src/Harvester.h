@@ -43,6 +43,17 @@ namespace catapult { namespace harvesting {
 				const UnlockedAccounts& unlockedAccounts,
 				const BlockGenerator& blockGenerator);
 
+		/// Creates a harvester around catapult \a cache, block chain \a config, \a beneficiary,
+		/// unlocked accounts set (\a unlockedAccounts), \a blockGenerator used to customize block generation
+		/// and \a blockGeneratorPreparer used to prepare block generation when no account is eligible to harvest.
+		Harvester(
+				const cache::CatapultCache& cache,
+				const model::BlockChainConfiguration& config,
+				const Address& beneficiary,
+				const UnlockedAccounts& unlockedAccounts,
+				const BlockGenerator& blockGenerator,
+				const BlockGeneratorPreparer& blockGeneratorPreparer);
+
 	public:
 		/// Creates the best block (if any) harvested by any unlocked account.
 		/// Created block will have \a lastBlockElement as parent and \a timestamp as timestamp.
@@ -54,5 +65,6 @@ namespace catapult { namespace harvesting {
 		const Address m_beneficiary;
 		const UnlockedAccounts& m_unlockedAccounts;
 		BlockGenerator m_blockGenerator;
+		BlockGeneratorPreparer m_blockGeneratorPreparer;
 	};
 }}
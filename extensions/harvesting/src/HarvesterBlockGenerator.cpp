@@ -40,6 +40,69 @@ namespace catapult { namespace harvesting {
 			// generate the block
 			return facade.commit(blockHeader);
 		}
+
+		// holds the facade used by the last preparation so that it can be resumed by the next preparation or generation
+		class PreparedUtFacadeHolder {
+		public:
+			explicit PreparedUtFacadeHolder(const HarvestingUtFacadeFactory& utFacadeFactory) : m_utFacadeFactory(utFacadeFactory)
+			{}
+
+		public:
+			std::unique_ptr<HarvestingUtFacade> acquire(Timestamp blockTime) {
+				auto pUtFacade = std::move(m_pUtFacade);
+				if (pUtFacade && pUtFacade->tryResume(blockTime))
+					return pUtFacade;
+
+				return m_utFacadeFactory.create(blockTime);
+			}
+
+			void release(std::unique_ptr<HarvestingUtFacade>&& pUtFacade) {
+				pUtFacade->release();
+				m_pUtFacade = std::move(pUtFacade);
+			}
+
+		private:
+			HarvestingUtFacadeFactory m_utFacadeFactory;
+			std::unique_ptr<HarvestingUtFacade> m_pUtFacade;
+		};
+
+		auto CreateDefaultTransactionsInfoSupplier(
+				model::TransactionSelectionStrategy strategy,
+				const model::TransactionRegistry& transactionRegistry,
+				const cache::ReadWriteUtCache& utCache) {
+			auto countRetriever = [&transactionRegistry](const auto& transaction) {
+				return 1 + transactionRegistry.findPlugin(transaction.Type)->embeddedCount(transaction);
+			};
+
+			return CreateTransactionsInfoSupplier(strategy, countRetriever, utCache);
+		}
+
+		BlockGenerator CreateBlockGenerator(
+				const TransactionsInfoSupplier& transactionsInfoSupplier,
+				const std::shared_ptr<PreparedUtFacadeHolder>& pUtFacadeHolder) {
+			return [transactionsInfoSupplier, pUtFacadeHolder](const auto& blockHeader, auto maxTransactionsPerBlock) {
+				// 1. check height consistency
+				auto pUtFacade = pUtFacadeHolder->acquire(blockHeader.Timestamp);
+				if (blockHeader.Height != pUtFacade->height()) {
+					CATAPULT_LOG(debug)
+							<< "bypassing state hash calculation because cache height (" << pUtFacade->height() - Height(1)
+							<< ") is inconsistent with block height (" << blockHeader.Height << ")";
+					return std::unique_ptr<model::Block>();
+				}
+
+				// 2. select transactions
+				auto transactionsInfo = transactionsInfoSupplier(*pUtFacade, maxTransactionsPerBlock);
+
+				// 3. build a block
+				auto pBlock = GenerateBlock(*pUtFacade, blockHeader, transactionsInfo);
+				if (!pBlock) {
+					CATAPULT_LOG(warning) << "failed to generate harvested block";
+					return std::unique_ptr<model::Block>();
+				}
+
+				return pBlock;
+			};
+		}
 	}
 
 	BlockGenerator CreateHarvesterBlockGenerator(
@@ -47,32 +110,28 @@ namespace catapult { namespace harvesting {
 			const model::TransactionRegistry& transactionRegistry,
 			const HarvestingUtFacadeFactory& utFacadeFactory,
 			const cache::ReadWriteUtCache& utCache) {
-		auto countRetriever = [&transactionRegistry](const auto& transaction) {
-			return 1 + transactionRegistry.findPlugin(transaction.Type)->embeddedCount(transaction);
-		};
-
-		auto transactionsInfoSupplier = CreateTransactionsInfoSupplier(strategy, countRetriever, utCache);
-		return [utFacadeFactory, transactionsInfoSupplier](const auto& blockHeader, auto maxTransactionsPerBlock) {
-			// 1. check height consistency
-			auto pUtFacade = utFacadeFactory.create(blockHeader.Timestamp);
-			if (blockHeader.Height != pUtFacade->height()) {
-				CATAPULT_LOG(debug)
-						<< "bypassing state hash calculation because cache height (" << pUtFacade->height() - Height(1)
-						<< ") is inconsistent with block height (" << blockHeader.Height << ")";
-				return std::unique_ptr<model::Block>();
-			}
-
-			// 2. select transactions
-			auto transactionsInfo = transactionsInfoSupplier(*pUtFacade, maxTransactionsPerBlock);
+		auto transactionsInfoSupplier = CreateDefaultTransactionsInfoSupplier(strategy, transactionRegistry, utCache);
+		return CreateBlockGenerator(transactionsInfoSupplier, std::make_shared<PreparedUtFacadeHolder>(utFacadeFactory));
+	}
 
-			// 3. build a block
-			auto pBlock = GenerateBlock(*pUtFacade, blockHeader, transactionsInfo);
-			if (!pBlock) {
-				CATAPULT_LOG(warning) << "failed to generate harvested block";
-				return std::unique_ptr<model::Block>();
-			}
+	BlockGenerator CreateHarvesterBlockGenerator(
+			model::TransactionSelectionStrategy strategy,
+			const model::TransactionRegistry& transactionRegistry,
+			const HarvestingUtFacadeFactory& utFacadeFactory,
+			const cache::ReadWriteUtCache& utCache,
+			BlockGeneratorPreparer& blockGeneratorPreparer) {
+		auto transactionsInfoSupplier = CreateDefaultTransactionsInfoSupplier(strategy, transactionRegistry, utCache);
+		auto pUtFacadeHolder = std::make_shared<PreparedUtFacadeHolder>(utFacadeFactory);
+		blockGeneratorPreparer = [transactionsInfoSupplier, pUtFacadeHolder](auto height, auto timestamp, auto maxTransactionsPerBlock) {
+			auto pUtFacade = pUtFacadeHolder->acquire(timestamp);
+			if (height != pUtFacade->height())
+				return;
 
-			return pBlock;
+			// apply transactions (but do not commit them) and retain them for reuse
+			transactionsInfoSupplier(*pUtFacade, maxTransactionsPerBlock);
+			pUtFacadeHolder->release(std::move(pUtFacade));
 		};
+
+		return CreateBlockGenerator(transactionsInfoSupplier, pUtFacadeHolder);
 	}
 }}
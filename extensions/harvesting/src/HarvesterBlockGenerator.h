@@ -33,6 +33,9 @@ namespace catapult { namespace harvesting {
 	/// Generates a block from a seed block header given a maximum number of transactions.
 	using BlockGenerator = std::function<std::unique_ptr<model::Block> (const model::BlockHeader&, uint32_t)>;
 
+	/// Prepares a block generator for generating a block at a height with a timestamp given a maximum number of transactions.
+	using BlockGeneratorPreparer = std::function<void (Height, Timestamp, uint32_t)>;
+
 	/// Creates a default block generator around \a transactionRegistry, \a utFacadeFactory and \a utCache
 	/// for specified transaction \a strategy.
 	BlockGenerator CreateHarvesterBlockGenerator(
@@ -40,4 +43,14 @@ namespace catapult { namespace harvesting {
 			const model::TransactionRegistry& transactionRegistry,
 			const HarvestingUtFacadeFactory& utFacadeFactory,
 			const cache::ReadWriteUtCache& utCache);
+
+	/// Creates a default block generator around \a transactionRegistry, \a utFacadeFactory and \a utCache
+	/// for specified transaction \a strategy and sets \a blockGeneratorPreparer to a preparer that applies transactions ahead of
+	/// block generation so that the generator only needs to process transactions that changed in the interim.
+	BlockGenerator CreateHarvesterBlockGenerator(
+			model::TransactionSelectionStrategy strategy,
+			const model::TransactionRegistry& transactionRegistry,
+			const HarvestingUtFacadeFactory& utFacadeFactory,
+			const cache::ReadWriteUtCache& utCache,
+			BlockGeneratorPreparer& blockGeneratorPreparer);
 }}
@@ -101,10 +101,21 @@ namespace catapult { namespace harvesting {
 				return *hashRange.cbegin();
 			});
 
-			auto blockGenerator = CreateHarvesterBlockGenerator(strategy, transactionRegistry, utFacadeFactory, utCache);
-			auto pHarvesterTask = std::make_shared<ScheduledHarvesterTask>(
-					CreateHarvesterTaskOptions(state),
-					std::make_unique<Harvester>(cache, blockChainConfig, beneficiaryAddress, unlockedAccounts, blockGenerator));
+			BlockGeneratorPreparer blockGeneratorPreparer;
+			auto blockGenerator = CreateHarvesterBlockGenerator(
+					strategy,
+					transactionRegistry,
+					utFacadeFactory,
+					utCache,
+					blockGeneratorPreparer);
+			auto pHarvester = std::make_unique<Harvester>(
+					cache,
+					blockChainConfig,
+					beneficiaryAddress,
+					unlockedAccounts,
+					blockGenerator,
+					blockGeneratorPreparer);
+			auto pHarvesterTask = std::make_shared<ScheduledHarvesterTask>(CreateHarvesterTaskOptions(state), std::move(pHarvester));
 
 			auto pUnlockedAccountsUpdater = std::make_shared<UnlockedAccountsUpdater>(
 					cache,
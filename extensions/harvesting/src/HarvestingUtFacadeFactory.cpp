@@ -93,8 +93,9 @@ namespace catapult { namespace harvesting {
 				, m_blockChainConfig(blockChainConfig)
 				, m_executionConfig(executionConfig)
 				, m_importanceBlockHashSupplier(importanceBlockHashSupplier)
-				, m_cacheDetachableDelta(cache.createDetachableDelta())
-				, m_cacheDetachedDelta(m_cacheDetachableDelta.detach())
+				, m_pCacheDetachableDelta(std::make_unique<cache::CatapultCacheDetachableDelta>(cache.createDetachableDelta()))
+				, m_cacheHeight(m_pCacheDetachableDelta->height())
+				, m_cacheDetachedDelta(m_pCacheDetachableDelta->detach())
 				, m_pCacheDelta(m_cacheDetachedDelta.tryLock()) {
 			// add additional observers to monitor accounts
 			observers::DemuxObserverBuilder observerBuilder;
@@ -106,7 +107,41 @@ namespace catapult { namespace harvesting {
 
 	public:
 		Height height() const {
-			return m_cacheDetachableDelta.height() + Height(1);
+			return m_cacheHeight + Height(1);
+		}
+
+		bool isReusable(const ApplyAttempt& applyAttempt) const {
+			// block time is the only validation input that changes when a facade is resumed
+			// - applied transactions become invalid when their deadlines pass
+			// - rejected transactions can become valid when their deadlines were too far in the future
+			return applyAttempt.IsApplied
+					? applyAttempt.Deadline >= m_blockTime
+					: applyAttempt.Deadline <= applyAttempt.BlockTime + m_blockChainConfig.MaxTransactionLifetime;
+		}
+
+		ApplyAttempt createApplyAttempt(const model::TransactionInfo& transactionInfo, bool isApplied) const {
+			return { transactionInfo.EntityHash, transactionInfo.pEntity->Deadline, m_blockTime, isApplied };
+		}
+
+	public:
+		void release() {
+			// destroy the locked delta before the detachable delta in order to release the sub cache locks before the height lock
+			m_pCacheDelta.reset();
+			m_pCacheDetachableDelta.reset();
+		}
+
+		bool tryResume(Timestamp blockTime) {
+			if (blockTime < m_blockTime)
+				return false;
+
+			if (!m_pCacheDelta) {
+				m_pCacheDelta = m_cacheDetachedDelta.tryLock();
+				if (!m_pCacheDelta)
+					return false;
+			}
+
+			m_blockTime = blockTime;
+			return true;
 		}
 
 	public:
@@ -185,6 +220,9 @@ namespace catapult { namespace harvesting {
 			observers::ObserverContext&>;
 
 		bool process(const Processor& processor) {
+			if (!m_pCacheDelta)
+				CATAPULT_THROW_RUNTIME_ERROR("cannot process entities after facade has been released");
+
 			// prepare state and contexts
 			chain::ProcessContextsBuilder contextBuilder(height(), m_blockTime, m_executionConfig);
 			contextBuilder.setCache(*m_pCacheDelta);
@@ -248,7 +286,8 @@ namespace catapult { namespace harvesting {
 		chain::ExecutionConfiguration m_executionConfig;
 		ImportanceBlockHashSupplier m_importanceBlockHashSupplier;
 
-		cache::CatapultCacheDetachableDelta m_cacheDetachableDelta;
+		std::unique_ptr<cache::CatapultCacheDetachableDelta> m_pCacheDetachableDelta;
+		Height m_cacheHeight;
 		cache::CatapultCacheDetachedDelta m_cacheDetachedDelta;
 		std::unique_ptr<cache::CatapultCacheDelta> m_pCacheDelta;
 
@@ -266,7 +305,10 @@ namespace catapult { namespace harvesting {
 			const model::BlockChainConfiguration& blockChainConfig,
 			const chain::ExecutionConfiguration& executionConfig,
 			const ImportanceBlockHashSupplier& importanceBlockHashSupplier)
-			: m_pImpl(std::make_unique<Impl>(blockTime, cache, blockChainConfig, executionConfig, importanceBlockHashSupplier))
+			: m_numReusedTransactionInfos(0)
+			, m_numReusedApplyAttempts(0)
+			, m_isCommitted(false)
+			, m_pImpl(std::make_unique<Impl>(blockTime, cache, blockChainConfig, executionConfig, importanceBlockHashSupplier))
 	{}
 
 	HarvestingUtFacade::~HarvestingUtFacade() = default;
@@ -284,7 +326,13 @@ namespace catapult { namespace harvesting {
 	}
 
 	bool HarvestingUtFacade::apply(const model::TransactionInfo& transactionInfo) {
-		if (!m_pImpl->apply(transactionInfo))
+		bool isApplied;
+		if (tryReuse(transactionInfo, isApplied))
+			return isApplied;
+
+		isApplied = m_pImpl->apply(transactionInfo);
+		m_applyAttempts.push_back(m_pImpl->createApplyAttempt(transactionInfo, isApplied));
+		if (!isApplied)
 			return false;
 
 		m_transactionInfos.push_back(transactionInfo.copy());
@@ -292,26 +340,94 @@ namespace catapult { namespace harvesting {
 	}
 
 	void HarvestingUtFacade::unapply() {
+		unapplyReusable();
+
 		if (m_transactionInfos.empty())
 			CATAPULT_THROW_OUT_OF_RANGE("cannot call unapply when no transactions have been applied");
 
 		m_pImpl->unapply(m_transactionInfos.back());
 		m_transactionInfos.pop_back();
+
+		// forget all attempts starting with the unapplied transaction because they were made against a different state
+		auto applyAttemptIter = std::find_if(m_applyAttempts.crbegin(), m_applyAttempts.crend(), [](const auto& applyAttempt) {
+			return applyAttempt.IsApplied;
+		});
+		m_applyAttempts.erase(std::prev(applyAttemptIter.base()), m_applyAttempts.cend());
 	}
 
 	std::unique_ptr<model::Block> HarvestingUtFacade::commit(const model::BlockHeader& blockHeader) {
 		if (height() != blockHeader.Height)
 			CATAPULT_THROW_RUNTIME_ERROR("commit block header is inconsistent with facade state");
 
+		unapplyReusable();
+
 		model::Transactions transactions;
 		for (const auto& transactionInfo : m_transactionInfos)
 			transactions.push_back(transactionInfo.pEntity);
 
 		auto pBlock = m_pImpl->commit(blockHeader, transactions);
 		m_transactionInfos.clear();
+		m_applyAttempts.clear();
+		m_isCommitted = true;
 		return pBlock;
 	}
 
+	void HarvestingUtFacade::release() {
+		m_pImpl->release();
+	}
+
+	bool HarvestingUtFacade::tryResume(Timestamp blockTime) {
+		if (m_isCommitted || !m_pImpl->tryResume(blockTime))
+			return false;
+
+		// all transactions that are still applied become reusable in their original order
+		auto transactionInfosIter = m_reusableTransactionInfos.begin() + static_cast<std::ptrdiff_t>(m_numReusedTransactionInfos);
+		std::move(transactionInfosIter, m_reusableTransactionInfos.end(), std::back_inserter(m_transactionInfos));
+		m_reusableTransactionInfos = std::move(m_transactionInfos);
+		m_transactionInfos.clear();
+		m_numReusedTransactionInfos = 0;
+
+		auto applyAttemptsIter = m_reusableApplyAttempts.cbegin() + static_cast<std::ptrdiff_t>(m_numReusedApplyAttempts);
+		m_applyAttempts.insert(m_applyAttempts.cend(), applyAttemptsIter, m_reusableApplyAttempts.cend());
+		m_reusableApplyAttempts = std::move(m_applyAttempts);
+		m_applyAttempts.clear();
+		m_numReusedApplyAttempts = 0;
+		return true;
+	}
+
+	bool HarvestingUtFacade::tryReuse(const model::TransactionInfo& transactionInfo, bool& isApplied) {
+		if (m_numReusedApplyAttempts == m_reusableApplyAttempts.size())
+			return false;
+
+		const auto& applyAttempt = m_reusableApplyAttempts[m_numReusedApplyAttempts];
+		if (applyAttempt.EntityHash != transactionInfo.EntityHash || !m_pImpl->isReusable(applyAttempt)) {
+			// transactions are being applied in a different order, so roll back to the last reused transaction
+			unapplyReusable();
+			return false;
+		}
+
+		++m_numReusedApplyAttempts;
+		m_applyAttempts.push_back(applyAttempt);
+
+		isApplied = applyAttempt.IsApplied;
+		if (isApplied)
+			m_transactionInfos.push_back(std::move(m_reusableTransactionInfos[m_numReusedTransactionInfos++]));
+
+		return true;
+	}
+
+	void HarvestingUtFacade::unapplyReusable() {
+		while (m_reusableTransactionInfos.size() > m_numReusedTransactionInfos) {
+			m_pImpl->unapply(m_reusableTransactionInfos.back());
+			m_reusableTransactionInfos.pop_back();
+		}
+
+		m_reusableTransactionInfos.clear();
+		m_reusableApplyAttempts.clear();
+		m_numReusedTransactionInfos = 0;
+		m_numReusedApplyAttempts = 0;
+	}
+
 	// endregion
 
 	// region HarvestingUtFacadeFactory
@@ -31,6 +31,8 @@ namespace catapult { namespace harvesting {
 	using ImportanceBlockHashSupplier = std::function<Hash256 (Height)>;
 
 	/// Facade around unconfirmed transactions cache and updater.
+	/// \note After being released, a facade can be resumed at a later block time. Afterwards, it reuses the results of previous
+	///       apply attempts as long as transactions are applied in the same order and only processes the differences.
 	class HarvestingUtFacade {
 	public:
 		/// Creates a facade around \a blockTime, \a cache, \a blockChainConfig, \a executionConfig and \a importanceBlockHashSupplier.
@@ -64,11 +66,41 @@ namespace catapult { namespace harvesting {
 		/// Commits all transactions into a block with specified seed header (\a blockHeader).
 		std::unique_ptr<model::Block> commit(const model::BlockHeader& blockHeader);
 
+	public:
+		/// Releases all cache locks held by the facade without discarding any applied transactions.
+		void release();
+
+		/// Attempts to resume the facade at a block time (\a blockTime) that is no earlier than the current block time.
+		/// \note This will fail if the underlying cache has changed or the facade has been committed.
+		bool tryResume(Timestamp blockTime);
+
+	private:
+		struct ApplyAttempt {
+			Hash256 EntityHash;
+			Timestamp Deadline;
+			Timestamp BlockTime;
+			bool IsApplied;
+		};
+
+	private:
+		bool tryReuse(const model::TransactionInfo& transactionInfo, bool& isApplied);
+
+		void unapplyReusable();
+
 	private:
 		class Impl;
 
 	private:
 		std::vector<model::TransactionInfo> m_transactionInfos;
+		std::vector<ApplyAttempt> m_applyAttempts;
+
+		// transactions applied by a previous attempt that are still applied to the cache after m_transactionInfos
+		std::vector<model::TransactionInfo> m_reusableTransactionInfos;
+		std::vector<ApplyAttempt> m_reusableApplyAttempts;
+		size_t m_numReusedTransactionInfos;
+		size_t m_numReusedApplyAttempts;
+
+		bool m_isCommitted;
 		std::unique_ptr<Impl> m_pImpl;
 	};
 
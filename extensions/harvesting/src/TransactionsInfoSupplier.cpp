@@ -83,13 +83,13 @@ namespace catapult { namespace harvesting {
 
 		auto GetFirstTransactionInfoPointers(
 				const SupplyInput& input,
-				const predicate<const model::TransactionInfo*, const model::TransactionInfo*>& sortComparer,
+				cache::FeeMultiplierOrder order,
 				const predicate<const model::TransactionInfo&>& filter) {
 			return cache::GetFirstTransactionInfoPointers(
 					input.UtCacheView,
 					input.TransactionLimit,
 					input.EmbeddedCountRetriever,
-					sortComparer,
+					order,
 					filter);
 		}
 
@@ -111,9 +111,9 @@ namespace catapult { namespace harvesting {
 		}
 
 		TransactionsInfo SupplyMinimumFee(const SupplyInput& input) {
-			// 1. get all transactions from the ut cache
-			auto comparer = MaxFeeMultiplierComparer<SortDirection::Ascending>();
-			auto candidates = GetFirstTransactionInfoPointers(input, comparer, [&utFacade = input.UtFacade](const auto& transactionInfo) {
+			// 1. get transactions with lowest fee multipliers from the ut cache
+			auto order = cache::FeeMultiplierOrder::Ascending;
+			auto candidates = GetFirstTransactionInfoPointers(input, order, [&utFacade = input.UtFacade](const auto& transactionInfo) {
 				return utFacade.apply(transactionInfo);
 			});
 
@@ -126,10 +126,10 @@ namespace catapult { namespace harvesting {
 		}
 
 		TransactionsInfo SupplyMaximumFee(const SupplyInput& input) {
-			// 1. get all transactions from the ut cache
-			auto comparer = MaxFeeMultiplierComparer<SortDirection::Descending>();
+			// 1. get transactions with highest fee multipliers from the ut cache
+			auto order = cache::FeeMultiplierOrder::Descending;
 			auto maximizer = TransactionFeeMaximizer();
-			auto candidates = GetFirstTransactionInfoPointers(input, comparer, [&utFacade = input.UtFacade, &maximizer](
+			auto candidates = GetFirstTransactionInfoPointers(input, order, [&utFacade = input.UtFacade, &maximizer](
 					const auto& transactionInfo) {
 				if (!utFacade.apply(transactionInfo))
 					return false;
@@ -48,13 +48,22 @@ namespace catapult { namespace harvesting {
 					, m_transactionRegistry(mocks::CreateDefaultTransactionRegistry(mocks::PluginOptionFlags::Contains_Embeddings))
 					, m_utFacadeFactory(m_catapultCache, m_config, m_executionConfig.Config, [](auto) { return Hash256(); })
 					, m_pUtCache(test::CreateSeededMemoryUtCache(0))
-					, m_generator(CreateHarvesterBlockGenerator(strategy, m_transactionRegistry, m_utFacadeFactory, *m_pUtCache)) {
+					, m_generator(CreateHarvesterBlockGenerator(strategy, m_transactionRegistry, m_utFacadeFactory, *m_pUtCache))
+					, m_preparedGenerator(CreateHarvesterBlockGenerator(
+							strategy,
+							m_transactionRegistry,
+							m_utFacadeFactory,
+							*m_pUtCache,
+							m_generatorPreparer)) {
 				// add 5 transaction infos to UT cache with multipliers alternating between 10 and 20
 				m_transactionInfos = test::CreateTransactionInfosFromSizeMultiplierPairs({
 					{ 201, 200 }, { 202, 100 }, { 203, 200 }, { 204, 100 }, { 205, 200 }
 				});
-				for (auto& transactionInfo : m_transactionInfos)
-					const_cast<model::Transaction&>(*transactionInfo.pEntity).Type = mocks::MockTransaction::Entity_Type;
+				for (auto& transactionInfo : m_transactionInfos) {
+					auto& transaction = const_cast<model::Transaction&>(*transactionInfo.pEntity);
+					transaction.Type = mocks::MockTransaction::Entity_Type;
+					transaction.Deadline = Timestamp(1000);
+				}
 
 				test::AddAll(*m_pUtCache, m_transactionInfos);
 
@@ -99,11 +108,26 @@ namespace catapult { namespace harvesting {
 				return m_generator(blockHeader, maxTransactionsPerBlock);
 			}
 
+			void prepare(Height blockHeight, Timestamp blockTimestamp, uint32_t maxTransactionsPerBlock) {
+				m_generatorPreparer(blockHeight, blockTimestamp, maxTransactionsPerBlock);
+			}
+
+			auto generatePrepared(Height blockHeight, Timestamp blockTimestamp, uint32_t maxTransactionsPerBlock) {
+				model::BlockHeader blockHeader;
+				blockHeader.Height = blockHeight;
+				blockHeader.Timestamp = blockTimestamp;
+				return m_preparedGenerator(blockHeader, maxTransactionsPerBlock);
+			}
+
 		public:
 			void setValidationFailure() {
 				m_executionConfig.pValidator->setResult(validators::ValidationResult::Failure);
 			}
 
+			size_t numValidatorCalls() const {
+				return m_executionConfig.pValidator->params().size();
+			}
+
 		private:
 			static model::BlockChainConfiguration CreateBlockChainConfiguration() {
 				auto config = model::BlockChainConfiguration::Uninitialized();
@@ -127,6 +151,8 @@ namespace catapult { namespace harvesting {
 			HarvestingUtFacadeFactory m_utFacadeFactory;
 			std::unique_ptr<cache::MemoryUtCache> m_pUtCache;
 			BlockGenerator m_generator;
+			BlockGeneratorPreparer m_generatorPreparer;
+			BlockGenerator m_preparedGenerator;
 
 			std::vector<model::TransactionInfo> m_transactionInfos;
 			Hash256 m_initialStateHash;
@@ -219,4 +245,84 @@ namespace catapult { namespace harvesting {
 	}
 
 	// endregion
+
+	// region generation with preparation
+
+	namespace {
+		void AssertBlockWithFourTransactions(const TestContext& context, const model::Block& block) {
+			EXPECT_EQ(4u, model::CalculateBlockTransactionsInfo(block).Count);
+
+			auto i = 0u;
+			for (const auto& transaction : block.Transactions()) {
+				// - transactions are uniquely identified in this test by size
+				EXPECT_EQ(201u + i, transaction.Size) << "transaction at " << i;
+				++i;
+			}
+
+			EXPECT_EQ(BlockFeeMultiplier(10), block.FeeMultiplier);
+
+			std::vector<Amount> expectedSurpluses{ Amount(201 * 10), Amount(0), Amount(203 * 10), Amount(0), Amount(0) };
+			EXPECT_EQ(context.calculateExpectedStateHash(expectedSurpluses), block.StateHash);
+		}
+	}
+
+	TEST(TEST_CLASS, PreparationIsBypassedWhenBlockHeightMismatchDetected) {
+		// Arrange:
+		TestContext context(model::TransactionSelectionStrategy::Oldest);
+
+		// Act: use mismatched height
+		context.prepare(Cache_Height, Timestamp(100), 16);
+
+		// Assert: no transactions were processed
+		EXPECT_EQ(0u, context.numValidatorCalls());
+	}
+
+	TEST(TEST_CLASS, CanGenerateBlockWithTransactionsWithoutPreparation) {
+		// Arrange:
+		TestContext context(model::TransactionSelectionStrategy::Oldest);
+
+		// Act:
+		auto pBlock = context.generatePrepared(Cache_Height + Height(1), Timestamp(100), 16);
+
+		// Assert:
+		ASSERT_TRUE(!!pBlock);
+		AssertBlockWithFourTransactions(context, *pBlock);
+	}
+
+	TEST(TEST_CLASS, CanGenerateBlockWithTransactionsAfterPreparation) {
+		// Arrange: prepare the generator at an earlier time
+		TestContext context(model::TransactionSelectionStrategy::Oldest);
+		context.prepare(Cache_Height + Height(1), Timestamp(100), 16);
+		auto numValidatorCallsAfterPreparation = context.numValidatorCalls();
+
+		// Act:
+		auto pBlock = context.generatePrepared(Cache_Height + Height(1), Timestamp(200), 16);
+
+		// Assert: only the block was processed by the generator
+		ASSERT_TRUE(!!pBlock);
+		AssertBlockWithFourTransactions(context, *pBlock);
+
+		EXPECT_NE(0u, numValidatorCallsAfterPreparation);
+		EXPECT_EQ(numValidatorCallsAfterPreparation + 2, context.numValidatorCalls());
+	}
+
+	TEST(TEST_CLASS, CanGenerateBlockWithTransactionsAfterMultiplePreparations) {
+		// Arrange: prepare the generator multiple times at increasing times
+		TestContext context(model::TransactionSelectionStrategy::Oldest);
+		context.prepare(Cache_Height + Height(1), Timestamp(100), 16);
+		auto numValidatorCallsAfterPreparation = context.numValidatorCalls();
+
+		context.prepare(Cache_Height + Height(1), Timestamp(150), 16);
+
+		// Act:
+		auto pBlock = context.generatePrepared(Cache_Height + Height(1), Timestamp(200), 16);
+
+		// Assert: only the block was processed after the first preparation
+		ASSERT_TRUE(!!pBlock);
+		AssertBlockWithFourTransactions(context, *pBlock);
+
+		EXPECT_EQ(numValidatorCallsAfterPreparation + 2, context.numValidatorCalls());
+	}
+
+	// endregion
 }}
@@ -145,6 +145,13 @@ namespace catapult { namespace harvesting {
 				return std::make_unique<Harvester>(Cache, config, Beneficiary, *pUnlockedAccounts, blockGenerator);
 			}
 
+			std::unique_ptr<Harvester> CreateHarvester(
+					const model::BlockChainConfiguration& config,
+					const BlockGenerator& blockGenerator,
+					const BlockGeneratorPreparer& blockGeneratorPreparer) {
+				return std::make_unique<Harvester>(Cache, config, Beneficiary, *pUnlockedAccounts, blockGenerator, blockGeneratorPreparer);
+			}
+
 			HarvesterDescriptor BestHarvester() const {
 				crypto::VrfProof bestVrfProof;
 				uint64_t bestHit = std::numeric_limits<uint64_t>::max();
@@ -611,4 +618,94 @@ namespace catapult { namespace harvesting {
 	}
 
 	// endregion
+
+	// region block generator preparer
+
+	namespace {
+		struct PreparerParams {
+			catapult::Height Height;
+			catapult::Timestamp Timestamp;
+			uint32_t MaxTransactionsPerBlock;
+		};
+
+		std::unique_ptr<Harvester> CreateHarvesterWithPreparer(
+				HarvesterContext& context,
+				size_t& numGeneratorCalls,
+				std::vector<PreparerParams>& preparerParams) {
+			auto config = CreateConfiguration();
+			config.MaxTransactionsPerBlock = 123;
+			return context.CreateHarvester(config, [&numGeneratorCalls](const auto& blockHeader, auto) {
+				++numGeneratorCalls;
+				auto pBlock = test::GenerateEmptyRandomBlock();
+				pBlock->SignerPublicKey = blockHeader.SignerPublicKey;
+				return pBlock;
+			}, [&preparerParams](auto height, auto timestamp, auto maxTransactionsPerBlock) {
+				preparerParams.push_back({ height, timestamp, maxTransactionsPerBlock });
+			});
+		}
+	}
+
+	TEST(TEST_CLASS, HarvestDelegatesToBlockGeneratorPreparerWhenNoHarvesterHasHit) {
+		// Arrange:
+		HarvesterContext context;
+		auto timestamp = context.CalculateBlockGenerationTime(context.BestHarvester());
+		auto tooEarly = Timestamp(timestamp.unwrap() - 1000);
+
+		size_t numGeneratorCalls = 0;
+		std::vector<PreparerParams> preparerParams;
+		auto pHarvester = CreateHarvesterWithPreparer(context, numGeneratorCalls, preparerParams);
+
+		// Act:
+		auto pBlock = pHarvester->harvest(context.LastBlockElement, tooEarly);
+
+		// Assert: preparer was called with expected params
+		EXPECT_FALSE(!!pBlock);
+		EXPECT_EQ(0u, numGeneratorCalls);
+
+		ASSERT_EQ(1u, preparerParams.size());
+		EXPECT_EQ(Height(2), preparerParams[0].Height);
+		EXPECT_EQ(tooEarly, preparerParams[0].Timestamp);
+		EXPECT_EQ(123u, preparerParams[0].MaxTransactionsPerBlock);
+	}
+
+	TEST(TEST_CLASS, HarvestDoesNotDelegateToBlockGeneratorPreparerWhenHarvesterHasHit) {
+		// Arrange:
+		HarvesterContext context;
+
+		size_t numGeneratorCalls = 0;
+		std::vector<PreparerParams> preparerParams;
+		auto pHarvester = CreateHarvesterWithPreparer(context, numGeneratorCalls, preparerParams);
+
+		// Act:
+		auto pBlock = pHarvester->harvest(context.LastBlockElement, Max_Time);
+
+		// Assert:
+		EXPECT_TRUE(!!pBlock);
+		EXPECT_EQ(1u, numGeneratorCalls);
+		EXPECT_TRUE(preparerParams.empty());
+	}
+
+	TEST(TEST_CLASS, HarvestDoesNotDelegateToBlockGeneratorPreparerWhenNoAccountIsUnlocked) {
+		// Arrange:
+		HarvesterContext context;
+		{
+			auto modifier = context.pUnlockedAccounts->modifier();
+			for (const auto& keyPair : context.SigningKeyPairs)
+				modifier.remove(keyPair.publicKey());
+		}
+
+		size_t numGeneratorCalls = 0;
+		std::vector<PreparerParams> preparerParams;
+		auto pHarvester = CreateHarvesterWithPreparer(context, numGeneratorCalls, preparerParams);
+
+		// Act:
+		auto pBlock = pHarvester->harvest(context.LastBlockElement, Max_Time);
+
+		// Assert:
+		EXPECT_FALSE(!!pBlock);
+		EXPECT_EQ(0u, numGeneratorCalls);
+		EXPECT_TRUE(preparerParams.empty());
+	}
+
+	// endregion
 }}
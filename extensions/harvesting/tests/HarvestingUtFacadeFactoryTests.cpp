@@ -754,6 +754,333 @@ namespace catapult { namespace harvesting {
 
 	// endregion
 
+	// region release / tryResume
+
+	namespace {
+		std::vector<model::TransactionInfo> CreateTransactionInfosWithDeadlines(const std::vector<Timestamp>& deadlines) {
+			// use zero max fees so that none have a surplus when block fee multiplier is zero
+			auto transactionInfos = test::CreateTransactionInfos(deadlines.size(), [&deadlines](auto i) { return deadlines[i]; });
+			for (auto& transactionInfo : transactionInfos)
+				const_cast<Amount&>(transactionInfo.pEntity->MaxFee) = Amount();
+
+			return transactionInfos;
+		}
+
+		std::vector<model::TransactionInfo> CreateTransactionInfosWithFutureDeadlines(size_t count) {
+			std::vector<Timestamp> deadlines;
+			for (auto i = 0u; i < count; ++i)
+				deadlines.push_back(Default_Time + utils::TimeSpan::FromHours(1 + i));
+
+			return CreateTransactionInfosWithDeadlines(deadlines);
+		}
+
+		std::vector<bool> ApplySelected(
+				HarvestingUtFacade& facade,
+				const std::vector<const model::TransactionInfo*>& transactionInfoPointers) {
+			std::vector<bool> applyResults;
+			for (const auto* pTransactionInfo : transactionInfoPointers)
+				applyResults.push_back(facade.apply(*pTransactionInfo));
+
+			return applyResults;
+		}
+
+		std::vector<bool> ApplyAll(HarvestingUtFacade& facade, const std::vector<model::TransactionInfo>& transactionInfos) {
+			std::vector<const model::TransactionInfo*> transactionInfoPointers;
+			for (const auto& transactionInfo : transactionInfos)
+				transactionInfoPointers.push_back(&transactionInfo);
+
+			return ApplySelected(facade, transactionInfoPointers);
+		}
+
+		template<typename TAction>
+		void RunResumableUtFacadeTest(TAction action) {
+			// Arrange: create factory and facade
+			auto catapultCache = test::CreateCatapultCacheWithMarkerAccount(Default_Height);
+			SetDependentState(catapultCache);
+
+			test::MockExecutionConfiguration executionConfig;
+			HarvestingUtFacadeFactory factory(catapultCache, CreateBlockChainConfiguration(), executionConfig.Config, EmptyHashSupplier);
+
+			auto pFacade = factory.create(Default_Time);
+			ASSERT_TRUE(!!pFacade);
+
+			// Act + Assert:
+			action(*pFacade, catapultCache, executionConfig);
+		}
+	}
+
+	TEST(TEST_CLASS, CanResumeReleasedFacade) {
+		// Arrange:
+		RunResumableUtFacadeTest([](auto& facade, const auto&, const auto&) {
+			ApplyAll(facade, CreateTransactionInfosWithFutureDeadlines(4));
+			facade.release();
+
+			// Act:
+			auto isResumed = facade.tryResume(Default_Time + Timestamp(1));
+
+			// Assert: no transactions have been applied by the resumed attempt
+			EXPECT_TRUE(isResumed);
+			AssertEmpty(facade);
+		});
+	}
+
+	TEST(TEST_CLASS, CanResumeFacadeThatHasNotBeenReleased) {
+		// Arrange:
+		RunResumableUtFacadeTest([](auto& facade, const auto&, const auto&) {
+			ApplyAll(facade, CreateTransactionInfosWithFutureDeadlines(4));
+
+			// Act:
+			auto isResumed = facade.tryResume(Default_Time + Timestamp(1));
+
+			// Assert:
+			EXPECT_TRUE(isResumed);
+			AssertEmpty(facade);
+		});
+	}
+
+	TEST(TEST_CLASS, CannotApplyTransactionsToReleasedFacade) {
+		// Arrange:
+		RunResumableUtFacadeTest([](auto& facade, const auto&, const auto&) {
+			auto transactionInfos = CreateTransactionInfosWithFutureDeadlines(2);
+			facade.apply(transactionInfos[0]);
+			facade.release();
+
+			// Act + Assert:
+			EXPECT_THROW(facade.apply(transactionInfos[1]), catapult_runtime_error);
+		});
+	}
+
+	TEST(TEST_CLASS, CannotResumeFacadeAtEarlierBlockTime) {
+		// Arrange:
+		RunResumableUtFacadeTest([](auto& facade, const auto&, const auto&) {
+			facade.release();
+
+			// Act + Assert:
+			EXPECT_FALSE(facade.tryResume(Default_Time - Timestamp(1)));
+		});
+	}
+
+	TEST(TEST_CLASS, CannotResumeFacadeAfterCacheIsCommitted) {
+		// Arrange:
+		RunResumableUtFacadeTest([](auto& facade, auto& catapultCache, const auto&) {
+			ApplyAll(facade, CreateTransactionInfosWithFutureDeadlines(4));
+			facade.release();
+
+			// - commit the cache (this would deadlock if the facade did not release its locks)
+			{
+				auto delta = catapultCache.createDelta();
+				catapultCache.commit(Default_Height + Height(1));
+			}
+
+			// Act + Assert:
+			EXPECT_FALSE(facade.tryResume(Default_Time + Timestamp(1)));
+		});
+	}
+
+	TEST(TEST_CLASS, CannotResumeFacadeAfterCommit) {
+		// Arrange:
+		RunResumableUtFacadeTest([](auto& facade, const auto&, const auto&) {
+			auto pBlockHeader = CreateBlockHeaderWithHeight(Default_Height + Height(1));
+			facade.commit(*pBlockHeader);
+			facade.release();
+
+			// Act + Assert:
+			EXPECT_FALSE(facade.tryResume(Default_Time + Timestamp(1)));
+		});
+	}
+
+	TEST(TEST_CLASS, ResumedFacadeReusesTransactionsAppliedInSameOrder) {
+		// Arrange:
+		RunResumableUtFacadeTest([](auto& facade, const auto&, const auto& executionConfig) {
+			auto transactionInfos = CreateTransactionInfosWithFutureDeadlines(4);
+			ApplyAll(facade, transactionInfos);
+			facade.release();
+			facade.tryResume(Default_Time + Timestamp(1));
+
+			// Act:
+			auto applyResults = ApplyAll(facade, transactionInfos);
+
+			// Assert: all transactions were reused without being processed again
+			EXPECT_EQ(std::vector<bool>(4, true), applyResults);
+			EXPECT_EQ(4u, facade.size());
+			test::AssertEquivalent(transactionInfos, facade.transactionInfos());
+
+			EXPECT_EQ(8u, executionConfig.pValidator->params().size());
+			EXPECT_EQ(8u, executionConfig.pObserver->params().size());
+		});
+	}
+
+	TEST(TEST_CLASS, ResumedFacadeReusesRejectedTransactionsAppliedInSameOrder) {
+		// Arrange:
+		RunResumableUtFacadeTest([](auto& facade, const auto&, const auto& executionConfig) {
+			auto transactionInfos = CreateTransactionInfosWithFutureDeadlines(4);
+			executionConfig.pValidator->setResult(validators::ValidationResult::Failure, transactionInfos[1].EntityHash, 1);
+			ApplyAll(facade, transactionInfos);
+			facade.release();
+			facade.tryResume(Default_Time + Timestamp(1));
+
+			// Act:
+			auto applyResults = ApplyAll(facade, transactionInfos);
+
+			// Assert: rejected transaction was not processed again
+			EXPECT_EQ(std::vector<bool>({ true, false, true, true }), applyResults);
+			EXPECT_EQ(3u, facade.size());
+
+			EXPECT_EQ(7u, executionConfig.pValidator->params().size());
+			EXPECT_EQ(6u, executionConfig.pObserver->params().size());
+		});
+	}
+
+	TEST(TEST_CLASS, ResumedFacadeRollsBackToFirstDifferenceWhenTransactionsAreAppliedInDifferentOrder) {
+		// Arrange:
+		RunResumableUtFacadeTest([](auto& facade, const auto&, const auto& executionConfig) {
+			auto transactionInfos = CreateTransactionInfosWithFutureDeadlines(5);
+			auto transactionHashes = test::ExtractHashes(transactionInfos);
+			ApplySelected(facade, { &transactionInfos[0], &transactionInfos[1], &transactionInfos[2], &transactionInfos[3] });
+			facade.release();
+			facade.tryResume(Default_Time + Timestamp(1));
+
+			// Act: insert new transaction after first transaction
+			auto applyResults = ApplySelected(facade, { &transactionInfos[0], &transactionInfos[4], &transactionInfos[1] });
+
+			// Assert:
+			EXPECT_EQ(std::vector<bool>(3, true), applyResults);
+			EXPECT_EQ(3u, facade.size());
+
+			std::vector<model::TransactionInfo> expectedTransactionInfos;
+			for (auto index : { 0u, 4u, 1u })
+				expectedTransactionInfos.push_back(transactionInfos[index].copy());
+
+			test::AssertEquivalent(expectedTransactionInfos, facade.transactionInfos());
+
+			// - first transaction was reused, all others were undone and new transaction and second transaction were processed
+			AssertEntityInfos("validator", executionConfig.pValidator->params(), transactionHashes, {
+				{ 0, 1 }, { 0, 2 }, { 1, 1 }, { 1, 2 }, { 2, 1 }, { 2, 2 }, { 3, 1 }, { 3, 2 },
+				{ 4, 1 }, { 4, 2 }, { 1, 1 }, { 1, 2 }
+			});
+			AssertEntityInfos("observer", executionConfig.pObserver->params(), transactionHashes, {
+				{ 0, 1 }, { 0, 2 }, { 1, 1 }, { 1, 2 }, { 2, 1 }, { 2, 2 }, { 3, 1 }, { 3, 2 },
+				{ 3, 2 }, { 3, 1 }, { 2, 2 }, { 2, 1 }, { 1, 2 }, { 1, 1 },
+				{ 4, 1 }, { 4, 2 }, { 1, 1 }, { 1, 2 }
+			});
+		});
+	}
+
+	TEST(TEST_CLASS, ResumedFacadeReprocessesTransactionsWithPassedDeadlines) {
+		// Arrange: second transaction expires before the resumed block time
+		RunResumableUtFacadeTest([](auto& facade, const auto&, const auto& executionConfig) {
+			auto resumeTime = Default_Time + Timestamp(100);
+			auto transactionInfos = CreateTransactionInfosWithDeadlines({ resumeTime, resumeTime - Timestamp(1), resumeTime });
+			ApplyAll(facade, transactionInfos);
+			facade.release();
+			facade.tryResume(resumeTime);
+
+			// Act:
+			auto applyResults = ApplyAll(facade, transactionInfos);
+
+			// Assert: first transaction was reused, all others were processed again
+			EXPECT_EQ(std::vector<bool>(3, true), applyResults);
+			EXPECT_EQ(10u, executionConfig.pValidator->params().size());
+			EXPECT_EQ(14u, executionConfig.pObserver->params().size());
+		});
+	}
+
+	TEST(TEST_CLASS, ResumedFacadeReprocessesRejectedTransactionsWithFarFutureDeadlines) {
+		// Arrange: second transaction could have been rejected because its deadline was too far in the future
+		RunResumableUtFacadeTest([](auto& facade, const auto&, const auto& executionConfig) {
+			auto farFutureTime = Default_Time + utils::TimeSpan::FromHours(25);
+			auto transactionInfos = CreateTransactionInfosWithDeadlines({ farFutureTime, farFutureTime, farFutureTime });
+			executionConfig.pValidator->setResult(validators::ValidationResult::Failure, transactionInfos[1].EntityHash, 1);
+			ApplyAll(facade, transactionInfos);
+			facade.release();
+			facade.tryResume(Default_Time + Timestamp(1));
+
+			// Act:
+			auto applyResults = ApplyAll(facade, transactionInfos);
+
+			// Assert: first transaction was reused, all others were processed again
+			EXPECT_EQ(std::vector<bool>({ true, false, true }), applyResults);
+			EXPECT_EQ(8u, executionConfig.pValidator->params().size());
+			EXPECT_EQ(8u, executionConfig.pObserver->params().size());
+		});
+	}
+
+	TEST(TEST_CLASS, ResumedFacadeUnappliesUnusedTransactionsBeforeUnapply) {
+		// Arrange:
+		RunResumableUtFacadeTest([](auto& facade, const auto&, const auto& executionConfig) {
+			auto transactionInfos = CreateTransactionInfosWithFutureDeadlines(4);
+			auto transactionHashes = test::ExtractHashes(transactionInfos);
+			ApplyAll(facade, transactionInfos);
+			facade.release();
+			facade.tryResume(Default_Time + Timestamp(1));
+			ApplySelected(facade, { &transactionInfos[0], &transactionInfos[1] });
+
+			// Act:
+			facade.unapply();
+
+			// Assert: unused transactions were unapplied before second transaction
+			EXPECT_EQ(1u, facade.size());
+			AssertEntityInfos("observer", executionConfig.pObserver->params(), transactionHashes, {
+				{ 0, 1 }, { 0, 2 }, { 1, 1 }, { 1, 2 }, { 2, 1 }, { 2, 2 }, { 3, 1 }, { 3, 2 },
+				{ 3, 2 }, { 3, 1 }, { 2, 2 }, { 2, 1 }, { 1, 2 }, { 1, 1 }
+			});
+		});
+	}
+
+	TEST(TEST_CLASS, ResumedFacadeUnappliesUnusedTransactionsBeforeCommit) {
+		// Arrange:
+		RunResumableUtFacadeTest([](auto& facade, const auto&, const auto&) {
+			auto transactionInfos = CreateTransactionInfosWithFutureDeadlines(4);
+			ApplyAll(facade, transactionInfos);
+			facade.release();
+			facade.tryResume(Default_Time + Timestamp(1));
+			ApplySelected(facade, { &transactionInfos[0], &transactionInfos[1] });
+
+			// Act:
+			auto pBlockHeader = CreateBlockHeaderWithHeight(Default_Height + Height(1));
+			pBlockHeader->Size += transactionInfos[0].pEntity->Size + transactionInfos[1].pEntity->Size;
+			auto pBlock = facade.commit(*pBlockHeader);
+
+			// Assert: only reused transactions are in the block
+			ASSERT_TRUE(!!pBlock);
+			EXPECT_EQ(2u, model::CalculateBlockTransactionsInfo(*pBlock).Count);
+
+			auto i = 0u;
+			for (const auto& transaction : pBlock->Transactions()) {
+				EXPECT_EQ(*transactionInfos[i].pEntity, transaction) << "transaction at " << i;
+				++i;
+			}
+		});
+	}
+
+	TEST(TEST_CLASS, ResumedFacadeCanReuseTransactionsAcrossMultipleResumes) {
+		// Arrange:
+		RunResumableUtFacadeTest([](auto& facade, const auto&, const auto& executionConfig) {
+			auto transactionInfos = CreateTransactionInfosWithFutureDeadlines(4);
+			ApplyAll(facade, transactionInfos);
+			facade.release();
+
+			// - only reapply a prefix of transactions
+			facade.tryResume(Default_Time + Timestamp(1));
+			ApplySelected(facade, { &transactionInfos[0], &transactionInfos[1] });
+			facade.release();
+
+			// Act: reapply all transactions
+			facade.tryResume(Default_Time + Timestamp(2));
+			auto applyResults = ApplyAll(facade, transactionInfos);
+
+			// Assert: all transactions (including ones not reapplied by intermediate attempt) were reused
+			EXPECT_EQ(std::vector<bool>(4, true), applyResults);
+			EXPECT_EQ(4u, facade.size());
+			test::AssertEquivalent(transactionInfos, facade.transactionInfos());
+
+			EXPECT_EQ(8u, executionConfig.pValidator->params().size());
+			EXPECT_EQ(8u, executionConfig.pObserver->params().size());
+		});
+	}
+
+	// endregion
+
 	// region FacadeTestContext
 
 	namespace {
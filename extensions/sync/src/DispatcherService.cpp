@@ -147,7 +147,8 @@ namespace catapult { namespace sync {
 
 		BlockChainProcessor CreateSyncProcessor(
 				const model::BlockChainConfiguration& blockChainConfig,
-				const chain::ExecutionConfiguration& executionConfig) {
+				const chain::ExecutionConfiguration& executionConfig,
+				thread::IoThreadPool* pValidatorPool) {
 			BlockHitPredicateFactory blockHitPredicateFactory = [&blockChainConfig](const cache::ReadOnlyCatapultCache& cache) {
 				cache::ImportanceView view(cache.sub<cache::AccountStateCache>());
 				return chain::BlockHitPredicate(blockChainConfig, [view](const auto& publicKey, auto height) {
@@ -156,11 +157,16 @@ namespace catapult { namespace sync {
 			};
 			return CreateBlockChainProcessor(
 					blockHitPredicateFactory,
-					chain::CreateBatchEntityProcessor(executionConfig),
+					pValidatorPool
+							? chain::CreateParallelBatchEntityProcessor(executionConfig, *pValidatorPool)
+							: chain::CreateBatchEntityProcessor(executionConfig),
 					GetReceiptValidationMode(blockChainConfig));
 		}
 
-		BlockChainSyncHandlers CreateBlockChainSyncHandlers(extensions::ServiceState& state, RollbackInfo& rollbackInfo) {
+		BlockChainSyncHandlers CreateBlockChainSyncHandlers(
+				extensions::ServiceState& state,
+				thread::IoThreadPool& validatorPool,
+				RollbackInfo& rollbackInfo) {
 			const auto& blockChainConfig = state.config().BlockChain;
 			const auto& pluginManager = state.pluginManager();
 
@@ -184,7 +190,10 @@ namespace catapult { namespace sync {
 				auto resolverContext = pluginManager.createResolverContext(readOnlyCache);
 				UndoBlock(blockElement, { *pUndoObserver, resolverContext, observerState }, undoBlockType);
 			};
-			syncHandlers.Processor = CreateSyncProcessor(blockChainConfig, extensions::CreateExecutionConfiguration(pluginManager));
+			syncHandlers.Processor = CreateSyncProcessor(
+					blockChainConfig,
+					extensions::CreateExecutionConfiguration(pluginManager),
+					state.config().Node.EnableParallelBlockValidation ? &validatorPool : nullptr);
 
 			syncHandlers.StateChange = [&rollbackInfo, &localScore = state.score(), &subscriber = state.stateChangeSubscriber()](
 					const auto& changeInfo) {
@@ -232,6 +241,9 @@ namespace catapult { namespace sync {
 						m_nodeConfig.MaxBlocksPerSyncAttempt,
 						m_state.config().BlockChain.MaxBlockFutureTime,
 						m_state.timeSupplier()));
+				m_consumers.push_back(CreateBlockNotificationRecordingConsumer(
+						m_state.pluginManager().createNotificationPublisher(),
+						validatorPool));
 				m_consumers.push_back(CreateBlockStatelessValidationConsumer(
 						CreateParallelValidationPolicy(validatorPool, m_state.pluginManager()),
 						requiresValidationPredicate));
@@ -247,7 +259,7 @@ namespace catapult { namespace sync {
 						m_state.config().BlockChain.ImportanceGrouping,
 						m_state.cache(),
 						m_state.storage(),
-						CreateBlockChainSyncHandlers(m_state, rollbackInfo)));
+						CreateBlockChainSyncHandlers(m_state, validatorPool, rollbackInfo)));
 
 				if (m_state.config().Node.EnableAutoSyncCleanup)
 					disruptorConsumers.push_back(CreateBlockChainSyncCleanupConsumer(m_state.config().User.DataDirectory));
@@ -318,6 +330,9 @@ namespace catapult { namespace sync {
 
 			std::shared_ptr<ConsumerDispatcher> build(thread::IoThreadPool& validatorPool, chain::UtUpdater& utUpdater) {
 				auto failedTransactionSink = extensions::SubscriberToSink(m_state.transactionStatusSubscriber());
+				m_consumers.push_back(CreateTransactionNotificationRecordingConsumer(
+						m_state.pluginManager().createNotificationPublisher(),
+						validatorPool));
 				m_consumers.push_back(CreateTransactionStatelessValidationConsumer(
 						CreateParallelValidationPolicy(validatorPool, m_state.pluginManager()),
 						failedTransactionSink));
@@ -389,7 +404,12 @@ namespace catapult { namespace sync {
 
 			auto& utUpdater = *pUtUpdater;
 			state.hooks().addTransactionsChangeHandler([&utUpdater](const auto& changeInfo) {
-				utUpdater.update(changeInfo.AddedTransactionHashes, changeInfo.RevertedTransactionInfos);
+				const auto& addedTransactionHashes = changeInfo.AddedTransactionHashes;
+				const auto& revertedTransactionInfos = changeInfo.RevertedTransactionInfos;
+				if (changeInfo.pAffectedAddresses)
+					utUpdater.update(addedTransactionHashes, revertedTransactionInfos, *changeInfo.pAffectedAddresses);
+				else
+					utUpdater.update(addedTransactionHashes, revertedTransactionInfos);
 			});
 
 			return utUpdater;
@@ -431,6 +451,13 @@ namespace catapult { namespace sync {
 				AddRollbackCounter(locator, "RB COMMIT RCT", RollbackResult::Committed, RollbackCounterType::Recent);
 				AddRollbackCounter(locator, "RB IGNORE ALL", RollbackResult::Ignored, RollbackCounterType::All);
 				AddRollbackCounter(locator, "RB IGNORE RCT", RollbackResult::Ignored, RollbackCounterType::Recent);
+
+				locator.registerServiceCounter<chain::UtUpdater>("dispatcher.utUpdater", "UT REVALID", [](const auto& utUpdater) {
+					return utUpdater.statistics().NumRevalidated;
+				});
+				locator.registerServiceCounter<chain::UtUpdater>("dispatcher.utUpdater", "UT SKIPPED", [](const auto& utUpdater) {
+					return utUpdater.statistics().NumSkipped;
+				});
 			}
 
 			void registerServices(extensions::ServiceLocator& locator, extensions::ServiceState& state) override {
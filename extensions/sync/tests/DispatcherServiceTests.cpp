@@ -48,7 +48,7 @@ namespace catapult { namespace sync {
 
 	namespace {
 		constexpr auto Num_Expected_Services = 5u;
-		constexpr auto Num_Expected_Counters = 8u;
+		constexpr auto Num_Expected_Counters = 10u;
 		constexpr auto Num_Expected_Tasks = 1u;
 
 		constexpr auto Block_Elements_Counter_Name = "BLK ELEM TOT";
@@ -59,6 +59,8 @@ namespace catapult { namespace sync {
 		constexpr auto Rollback_Elements_Committed_Recent = "RB COMMIT RCT";
 		constexpr auto Rollback_Elements_Ignored_All = "RB IGNORE ALL";
 		constexpr auto Rollback_Elements_Ignored_Recent = "RB IGNORE RCT";
+		constexpr auto Ut_Revalidated_Counter_Name = "UT REVALID";
+		constexpr auto Ut_Skipped_Counter_Name = "UT SKIPPED";
 		constexpr auto Sentinel_Counter_Value = extensions::ServiceLocator::Sentinel_Counter_Value;
 
 		// region utils
@@ -363,6 +365,8 @@ namespace catapult { namespace sync {
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Committed_Recent));
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Ignored_All));
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Ignored_Recent));
+		EXPECT_EQ(0u, context.counter(Ut_Revalidated_Counter_Name));
+		EXPECT_EQ(0u, context.counter(Ut_Skipped_Counter_Name));
 
 		// - block dispatcher should be initialized
 		auto blockDispatcherStatus = GetBlockDispatcherStatus(context.locator());
@@ -445,6 +449,8 @@ namespace catapult { namespace sync {
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Committed_Recent));
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Ignored_All));
 		EXPECT_EQ(0u, context.counter(Rollback_Elements_Ignored_Recent));
+		EXPECT_EQ(0u, context.counter(Ut_Revalidated_Counter_Name));
+		EXPECT_EQ(0u, context.counter(Ut_Skipped_Counter_Name));
 	}
 
 	TEST(TEST_CLASS, TasksAreRegistered) {
@@ -248,22 +248,27 @@ ge25519_unpack_negative_vartime(ge25519 *r, const unsigned char p[32]) {
 #define S2_SWINDOWSIZE 7
 #define S2_TABLE_SIZE (1<<(S2_SWINDOWSIZE-2))
 
-/* computes [s1]p1 + [s2]basepoint */
+/* computes the odd multiples of p1 used by ge25519_double_scalarmult_vartime_precomputed */
 static void
-ge25519_double_scalarmult_vartime(ge25519 *r, const ge25519 *p1, const bignum256modm s1, const bignum256modm s2) {
-	signed char slide1[256], slide2[256];
-	ge25519_pniels pre1[S1_TABLE_SIZE];
+ge25519_double_scalarmult_precompute(ge25519_pniels pre1[S1_TABLE_SIZE], const ge25519 *p1) {
 	ge25519 d1;
-	ge25519_p1p1 t;
 	int32_t i;
 
-	contract256_slidingwindow_modm(slide1, s1, S1_SWINDOWSIZE);
-	contract256_slidingwindow_modm(slide2, s2, S2_SWINDOWSIZE);
-
 	ge25519_double(&d1, p1);
 	ge25519_full_to_pniels(pre1, p1);
 	for (i = 0; i < S1_TABLE_SIZE - 1; i++)
 		ge25519_pnielsadd(&pre1[i+1], &d1, &pre1[i]);
+}
+
+/* computes [s1]p1 + [s2]basepoint given the odd multiples of p1 (pre1) */
+static void
+ge25519_double_scalarmult_vartime_precomputed(ge25519 *r, const ge25519_pniels pre1[S1_TABLE_SIZE], const bignum256modm s1, const bignum256modm s2) {
+	signed char slide1[256], slide2[256];
+	ge25519_p1p1 t;
+	int32_t i;
+
+	contract256_slidingwindow_modm(slide1, s1, S1_SWINDOWSIZE);
+	contract256_slidingwindow_modm(slide2, s2, S2_SWINDOWSIZE);
 
 	/* set neutral */
 	memset(r, 0, sizeof(ge25519));
@@ -291,6 +296,15 @@ ge25519_double_scalarmult_vartime(ge25519 *r, const ge25519 *p1, const bignum256
 	}
 }
 
+/* computes [s1]p1 + [s2]basepoint */
+static void
+ge25519_double_scalarmult_vartime(ge25519 *r, const ge25519 *p1, const bignum256modm s1, const bignum256modm s2) {
+	ge25519_pniels pre1[S1_TABLE_SIZE];
+
+	ge25519_double_scalarmult_precompute(pre1, p1);
+	ge25519_double_scalarmult_vartime_precomputed(r, pre1, s1, s2);
+}
+
 
 
 #if !defined(HAVE_GE25519_SCALARMULT_BASE_CHOOSE_NIELS)
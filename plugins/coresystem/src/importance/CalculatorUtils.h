@@ -67,6 +67,15 @@ namespace catapult { namespace importance {
 		Importance ActivityImportance;
 	};
 
+	/// Stake and activity importances of an account.
+	struct AccountImportances {
+		/// Importance due to account stake.
+		Importance StakeImportance;
+
+		/// Importance due to account activity.
+		Importance ActivityImportance;
+	};
+
 	/// Context for importance calculation.
 	struct ImportanceCalculationContext {
 	public:
@@ -93,6 +102,14 @@ namespace catapult { namespace importance {
 	/// Finalizes account activity information contained in \a buckets at \a height with specified \a importance.
 	void FinalizeAccountActivity(model::ImportanceHeight height, Importance importance, state::AccountActivityBuckets& buckets);
 
+	/// Calculates stake and activity importances of an account with harvesting mosaic \a balance and \a activitySummary
+	/// using \a context and \a config.
+	AccountImportances CalculateImportances(
+			Amount balance,
+			const AccountActivitySummary& activitySummary,
+			const ImportanceCalculationContext& context,
+			const model::BlockChainConfiguration& config);
+
 	/// Calculates stake and activity importances using \a context and \a config and stores resulting importances in \a accountSummary.
 	void CalculateImportances(
 			AccountSummary& accountSummary,
@@ -28,11 +28,54 @@
 #include "catapult/utils/StackLogger.h"
 #include <boost/multiprecision/cpp_int.hpp>
 #include <memory>
+#include <numeric>
 #include <vector>
 
 namespace catapult { namespace importance {
 
 	namespace {
+		// dense (structure of arrays) working set of high value accounts
+		// balances and activities are read from the account index maintained by the account state cache,
+		// so accounts are only looked up when their importances are finalized
+		// (the per account importance pass still uses scalar uint128 arithmetic and is not vectorized)
+		struct HighValueAccountColumns {
+		public:
+			explicit HighValueAccountColumns(size_t capacity) {
+				TotalFeesPaid.reserve(capacity);
+				BeneficiaryCounts.reserve(capacity);
+				PreviousImportances.reserve(capacity);
+				StakeImportances.resize(capacity);
+				ActivityImportances.resize(capacity);
+			}
+
+		public:
+			AccountActivitySummary activitySummary(size_t index) const {
+				AccountActivitySummary summary;
+				summary.TotalFeesPaid = Amount(TotalFeesPaid[index]);
+				summary.BeneficiaryCount = BeneficiaryCounts[index];
+				summary.PreviousImportance = Importance(PreviousImportances[index]);
+				return summary;
+			}
+
+			void push_back(const AccountActivitySummary& summary) {
+				TotalFeesPaid.push_back(summary.TotalFeesPaid.unwrap());
+				BeneficiaryCounts.push_back(summary.BeneficiaryCount);
+				PreviousImportances.push_back(summary.PreviousImportance.unwrap());
+			}
+
+		public:
+			std::vector<Amount::ValueType> TotalFeesPaid;
+			std::vector<uint32_t> BeneficiaryCounts;
+			std::vector<Importance::ValueType> PreviousImportances;
+			std::vector<Importance::ValueType> StakeImportances;
+			std::vector<Importance::ValueType> ActivityImportances;
+		};
+
+		template<typename TValue>
+		uint64_t Sum(const std::vector<TValue>& values) {
+			return std::accumulate(values.cbegin(), values.cend(), static_cast<uint64_t>(0));
+		}
+
 		class PosImportanceCalculator final : public ImportanceCalculator {
 		public:
 			explicit PosImportanceCalculator(const model::BlockChainConfiguration& config) : m_config(config)
@@ -45,48 +88,50 @@ namespace catapult { namespace importance {
 					cache::AccountStateCacheDelta& cache) const override {
 				utils::StackLogger stopwatch("PosImportanceCalculator::recalculate", utils::LogLevel::debug);
 
-				// 1. get high value accounts (notice two step lookup because only const iteration is supported)
+				// 1. gather high value accounts
 				const auto& highValueAccounts = cache.highValueAccounts();
-				const auto& highValueAddresses = highValueAccounts.addresses();
-				std::vector<AccountSummary> accountSummaries;
-				accountSummaries.reserve(highValueAddresses.size());
+				const auto& accountIndex = highValueAccounts.accountIndex();
+				const auto& balances = accountIndex.balances();
+				HighValueAccountColumns columns(accountIndex.size());
 
-				// 2. calculate sums
 				auto importanceGrouping = m_config.ImportanceGrouping;
+				for (const auto& accountActivityBuckets : accountIndex.activityBuckets())
+					columns.push_back(SummarizeAccountActivity(importanceHeight, importanceGrouping, accountActivityBuckets));
+
+				// 2. calculate sums
 				ImportanceCalculationContext context;
-				auto mosaicId = m_config.HarvestingMosaicId;
-				for (const auto& address : highValueAddresses) {
-					auto accountStateIter = cache.find(address);
-					auto& accountState = accountStateIter.get();
-					const auto& activityBuckets = accountState.ActivityBuckets;
-					auto accountActivitySummary = SummarizeAccountActivity(importanceHeight, importanceGrouping, activityBuckets);
-					accountSummaries.push_back(AccountSummary(accountActivitySummary, accountState));
-					context.ActiveHarvestingMosaics = context.ActiveHarvestingMosaics + accountState.Balances.get(mosaicId);
-					context.TotalBeneficiaryCount += accountActivitySummary.BeneficiaryCount;
-					context.TotalFeesPaid = context.TotalFeesPaid + accountActivitySummary.TotalFeesPaid;
-				}
+				context.ActiveHarvestingMosaics = std::accumulate(balances.cbegin(), balances.cend(), Amount());
+				context.TotalBeneficiaryCount = Sum(columns.BeneficiaryCounts);
+				context.TotalFeesPaid = Amount(Sum(columns.TotalFeesPaid));
 
 				// 3. calculate importance parts
-				Importance totalActivityImportance;
-				for (auto& accountSummary : accountSummaries) {
-					CalculateImportances(accountSummary, context, m_config);
-					totalActivityImportance = totalActivityImportance + accountSummary.ActivityImportance;
+				for (auto i = 0u; i < accountIndex.size(); ++i) {
+					auto importances = CalculateImportances(balances[i], columns.activitySummary(i), context, m_config);
+					columns.StakeImportances[i] = importances.StakeImportance.unwrap();
+					columns.ActivityImportances[i] = importances.ActivityImportance.unwrap();
 				}
 
+				auto totalActivityImportance = Importance(Sum(columns.ActivityImportances));
+
 				// 4. calculate the final importance
 				auto targetActivityImportanceRaw = m_config.TotalChainImportance.unwrap() * m_config.ImportanceActivityPercentage / 100;
-				for (auto& accountSummary : accountSummaries) {
-					auto importance = calculateFinalImportance(accountSummary, totalActivityImportance, targetActivityImportanceRaw);
-					auto& accountState = *accountSummary.pAccountState;
+				for (auto i = 0u; i < accountIndex.size(); ++i) {
+					auto importance = calculateFinalImportance(
+							Importance(columns.StakeImportances[i]),
+							Importance(columns.ActivityImportances[i]),
+							totalActivityImportance,
+							targetActivityImportanceRaw);
+					auto accountStateIter = cache.find(accountIndex.addresses()[i]);
+					auto& accountState = accountStateIter.get();
 					FinalizeAccountActivity(importanceHeight, importance, accountState.ActivityBuckets);
 					auto effectiveImportance = model::ImportanceHeight(1) == importanceHeight
 							? importance
-							: Importance(std::min(importance.unwrap(), accountSummary.ActivitySummary.PreviousImportance.unwrap()));
-					accountSummary.pAccountState->ImportanceSnapshots.set(effectiveImportance, importanceHeight);
+							: Importance(std::min(importance.unwrap(), columns.PreviousImportances[i]));
+					accountState.ImportanceSnapshots.set(effectiveImportance, importanceHeight);
 				}
 
 				CATAPULT_LOG(debug)
-						<< "recalculated importances (" << highValueAddresses.size() << " / " << cache.size() << " eligible)"
+						<< "recalculated importances (" << accountIndex.size() << " / " << cache.size() << " eligible)"
 						<< " at height " << importanceHeight;
 
 				// 5. disable collection of activity for the removed accounts
@@ -106,17 +151,18 @@ namespace catapult { namespace importance {
 
 		private:
 			Importance calculateFinalImportance(
-					const AccountSummary& accountSummary,
+					Importance stakeImportance,
+					Importance activityImportance,
 					Importance totalActivityImportance,
 					Importance::ValueType targetActivityImportanceRaw) const {
 				if (Importance() == totalActivityImportance) {
 					return 0 < m_config.ImportanceActivityPercentage
-							? Importance(accountSummary.StakeImportance.unwrap() * 100 / (100 - m_config.ImportanceActivityPercentage))
-							: accountSummary.StakeImportance;
+							? Importance(stakeImportance.unwrap() * 100 / (100 - m_config.ImportanceActivityPercentage))
+							: stakeImportance;
 				}
 
-				auto numerator = accountSummary.ActivityImportance.unwrap() * targetActivityImportanceRaw;
-				return accountSummary.StakeImportance + Importance(numerator / totalActivityImportance.unwrap());
+				auto numerator = activityImportance.unwrap() * targetActivityImportanceRaw;
+				return stakeImportance + Importance(numerator / totalActivityImportance.unwrap());
 			}
 
 		private:
@@ -20,6 +20,7 @@
 **/
 
 #pragma once
+#include "TimestampedHashSet.h"
 #include "catapult/cache/CacheDescriptorAdapters.h"
 #include "catapult/cache/SingleSetCacheTypesAdapter.h"
 #include "catapult/state/TimestampedHash.h"
@@ -65,7 +66,9 @@ namespace catapult { namespace cache {
 	};
 
 	/// Hash cache types.
-	struct HashCacheTypes : public SingleSetCacheTypesAdapter<ImmutableOrderedSetAdapter<HashCacheDescriptor>, std::true_type> {
+	/// \note Hashes are stored in a compact timestamp bucketed set because the cache can contain tens of millions of entries.
+	struct HashCacheTypes
+			: public SingleSetCacheTypesAdapter<ImmutableOrderedSetAdapter<HashCacheDescriptor, TimestampedHashSet>, std::true_type> {
 		using CacheReadOnlyType = ReadOnlySimpleCache<BasicHashCacheView, BasicHashCacheDelta, state::TimestampedHash>;
 
 		/// Custom sub view options.
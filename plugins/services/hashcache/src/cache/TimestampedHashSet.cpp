@@ -0,0 +1,202 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "TimestampedHashSet.h"
+#include <algorithm>
+
+namespace catapult { namespace cache {
+
+	TimestampedHashSet::TimestampedHashSet() : m_size(0)
+	{}
+
+	bool TimestampedHashSet::empty() const {
+		return 0 == m_size;
+	}
+
+	size_t TimestampedHashSet::size() const {
+		return m_size;
+	}
+
+	size_t TimestampedHashSet::bucketCount() const {
+		return m_buckets.size();
+	}
+
+	TimestampedHashSet::const_iterator TimestampedHashSet::begin() const {
+		return const_iterator(m_buckets.cbegin(), 0);
+	}
+
+	TimestampedHashSet::const_iterator TimestampedHashSet::end() const {
+		return const_iterator(m_buckets.cend(), 0);
+	}
+
+	TimestampedHashSet::const_iterator TimestampedHashSet::cbegin() const {
+		return begin();
+	}
+
+	TimestampedHashSet::const_iterator TimestampedHashSet::cend() const {
+		return end();
+	}
+
+	TimestampedHashSet::const_iterator TimestampedHashSet::find(const key_type& key) const {
+		auto iter = lower_bound(key);
+		return cend() != iter && key == *iter ? iter : cend();
+	}
+
+	TimestampedHashSet::const_iterator TimestampedHashSet::lower_bound(const key_type& key) const {
+		// only the last bucket with a key not greater than key can contain the lower bound
+		auto bucketIter = m_buckets.upper_bound(key);
+		if (m_buckets.cbegin() != bucketIter)
+			--bucketIter;
+
+		if (m_buckets.cend() == bucketIter)
+			return cend();
+
+		const auto& bucket = bucketIter->second;
+		auto index = static_cast<size_t>(std::lower_bound(bucket.cbegin(), bucket.cend(), key) - bucket.cbegin());
+		if (bucket.size() == index) {
+			// all elements in the bucket are less than key, so the first element of the next bucket is the lower bound
+			++bucketIter;
+			index = 0;
+		}
+
+		return const_iterator(bucketIter, index);
+	}
+
+	std::pair<TimestampedHashSet::iterator, bool> TimestampedHashSet::insert(const value_type& value) {
+		auto bucketIter = findInsertBucket(value);
+		const auto& bucket = bucketIter->second;
+		auto iter = std::lower_bound(bucket.cbegin(), bucket.cend(), value);
+		auto index = static_cast<size_t>(iter - bucket.cbegin());
+		if (bucket.cend() != iter && value == *iter)
+			return std::make_pair(const_iterator(bucketIter, index), false);
+
+		++m_size;
+		return std::make_pair(insertAt(bucketIter, index, value), true);
+	}
+
+	TimestampedHashSet::iterator TimestampedHashSet::insert(const_iterator, const value_type& value) {
+		return insert(value).first;
+	}
+
+	TimestampedHashSet::iterator TimestampedHashSet::erase(const_iterator position) {
+		auto nextIter = position;
+		return erase(position, ++nextIter);
+	}
+
+	TimestampedHashSet::iterator TimestampedHashSet::erase(const_iterator first, const_iterator last) {
+		if (first == last)
+			return first;
+
+		// convert first bucket iterator into a mutable iterator
+		auto bucketIter = m_buckets.erase(first.m_bucketIter, first.m_bucketIter);
+		auto startIndex = first.m_index;
+
+		// erase all elements in buckets preceding the last bucket; only the first one of these can be partially erased
+		while (last.m_bucketIter != bucketIter) {
+			auto& bucket = bucketIter->second;
+			m_size -= bucket.size() - startIndex;
+			if (0 == startIndex) {
+				bucketIter = m_buckets.erase(bucketIter);
+			} else {
+				bucket.erase(bucket.cbegin() + static_cast<std::ptrdiff_t>(startIndex), bucket.cend());
+				++bucketIter;
+				startIndex = 0;
+			}
+		}
+
+		// erase leading elements of the last bucket
+		if (m_buckets.end() != bucketIter) {
+			auto& bucket = bucketIter->second;
+			m_size -= last.m_index - startIndex;
+			bucket.erase(
+					bucket.cbegin() + static_cast<std::ptrdiff_t>(startIndex),
+					bucket.cbegin() + static_cast<std::ptrdiff_t>(last.m_index));
+		}
+
+		return const_iterator(bucketIter, startIndex);
+	}
+
+	size_t TimestampedHashSet::erase(const key_type& key) {
+		auto iter = find(key);
+		if (cend() == iter)
+			return 0;
+
+		erase(iter);
+		return 1;
+	}
+
+	void TimestampedHashSet::clear() {
+		m_buckets.clear();
+		m_size = 0;
+	}
+
+	uint64_t TimestampedHashSet::GetWindowId(const value_type& value) {
+		return value.Time.unwrap() >> Bucket_Shift;
+	}
+
+	void TimestampedHashSet::Reserve(Bucket& bucket) {
+		if (bucket.capacity() > bucket.size())
+			return;
+
+		bucket.reserve(std::min(std::max<size_t>(2 * bucket.capacity(), 8), Max_Bucket_Size));
+	}
+
+	TimestampedHashSet::Buckets::iterator TimestampedHashSet::findInsertBucket(const value_type& value) {
+		// bucket keys are never greater than any of their elements and always belong to the same window as the elements
+		auto windowId = GetWindowId(value);
+		auto nextBucketIter = m_buckets.upper_bound(value);
+		if (m_buckets.begin() != nextBucketIter) {
+			auto bucketIter = std::prev(nextBucketIter);
+			if (windowId == GetWindowId(bucketIter->first))
+				return bucketIter;
+		}
+
+		if (m_buckets.end() == nextBucketIter || windowId != GetWindowId(nextBucketIter->first))
+			return m_buckets.emplace_hint(nextBucketIter, value, Bucket());
+
+		// value precedes all elements in its window, so it becomes the new key of the first bucket in that window
+		auto node = m_buckets.extract(nextBucketIter);
+		node.key() = value;
+		return m_buckets.insert(std::move(node)).position;
+	}
+
+	TimestampedHashSet::const_iterator TimestampedHashSet::insertAt(Buckets::iterator bucketIter, size_t index, const value_type& value) {
+		auto& bucket = bucketIter->second;
+		if (Max_Bucket_Size == bucket.size()) {
+			// appending is the common case because timestamps mostly increase, so leave the full bucket intact in that case
+			auto splitIndex = bucket.size() == index ? index : bucket.size() / 2;
+			auto splitIter = bucket.begin() + static_cast<std::ptrdiff_t>(splitIndex);
+			const auto& splitKey = splitIndex == index ? value : *splitIter;
+			auto splitBucketIter = m_buckets.emplace_hint(std::next(bucketIter), splitKey, Bucket(splitIter, bucket.end()));
+			bucket.erase(splitIter, bucket.end());
+
+			if (index >= splitIndex) {
+				bucketIter = splitBucketIter;
+				index -= splitIndex;
+			}
+		}
+
+		auto& targetBucket = bucketIter->second;
+		Reserve(targetBucket);
+		targetBucket.insert(targetBucket.cbegin() + static_cast<std::ptrdiff_t>(index), value);
+		return const_iterator(bucketIter, index);
+	}
+}}
@@ -0,0 +1,198 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/state/TimestampedHash.h"
+#include <map>
+#include <vector>
+
+namespace catapult { namespace cache {
+
+	/// Ordered set of timestamped hashes that stores elements in bounded sorted arrays (buckets).
+	/// \note This is a drop-in replacement for std::set<state::TimestampedHash> that only requires slightly more than
+	///       sizeof(state::TimestampedHash) bytes per element. A bucket never spans more than one timestamp window and never
+	///       contains more than Max_Bucket_Size elements, so an insert costs a logarithmic bucket lookup plus a bounded shift.
+	///       Removal of all elements prior to a timestamp drops whole buckets and only partially erases a single one.
+	/// \note Inserting or erasing elements invalidates all iterators pointing into the modified bucket(s).
+	class TimestampedHashSet {
+	private:
+		using Bucket = std::vector<state::TimestampedHash>;
+		using Buckets = std::map<state::TimestampedHash, Bucket>;
+
+	public:
+		using key_type = state::TimestampedHash;
+		using value_type = state::TimestampedHash;
+		using key_compare = std::less<state::TimestampedHash>;
+		using size_type = size_t;
+
+	public:
+		/// Number of bits of the (raw) timestamp that are ignored when assigning elements to timestamp windows.
+		/// \note Each window spans approximately 65 seconds.
+		static constexpr uint32_t Bucket_Shift = 16;
+
+		/// Maximum number of elements in a bucket before it is split.
+		static constexpr size_t Max_Bucket_Size = 256;
+
+	public:
+		/// Const iterator.
+		class const_iterator {
+		public:
+			using difference_type = std::ptrdiff_t;
+			using value_type = const state::TimestampedHash;
+			using pointer = value_type*;
+			using reference = value_type&;
+			using iterator_category = std::forward_iterator_tag;
+
+		public:
+			/// Creates an uninitialized iterator.
+			const_iterator() : m_index(0)
+			{}
+
+			/// Creates an iterator pointing to the element at \a index in the bucket pointed to by \a bucketIter.
+			const_iterator(Buckets::const_iterator bucketIter, size_t index)
+					: m_bucketIter(bucketIter)
+					, m_index(index)
+			{}
+
+		public:
+			/// Returns \c true if this iterator is equal to \a rhs.
+			bool operator==(const const_iterator& rhs) const {
+				return m_bucketIter == rhs.m_bucketIter && m_index == rhs.m_index;
+			}
+
+			/// Returns \c true if this iterator is not equal to \a rhs.
+			bool operator!=(const const_iterator& rhs) const {
+				return !(*this == rhs);
+			}
+
+		public:
+			/// Advances the iterator to the next position.
+			const_iterator& operator++() {
+				if (++m_index == m_bucketIter->second.size()) {
+					++m_bucketIter;
+					m_index = 0;
+				}
+
+				return *this;
+			}
+
+			/// Advances the iterator to the next position.
+			const_iterator operator++(int) {
+				auto copy = *this;
+				++*this;
+				return copy;
+			}
+
+		public:
+			/// Gets a reference to the current element.
+			reference operator*() const {
+				return m_bucketIter->second[m_index];
+			}
+
+			/// Gets a pointer to the current element.
+			pointer operator->() const {
+				return &m_bucketIter->second[m_index];
+			}
+
+		private:
+			Buckets::const_iterator m_bucketIter;
+			size_t m_index;
+
+		private:
+			friend class TimestampedHashSet;
+		};
+
+		using iterator = const_iterator;
+
+	public:
+		/// Creates an empty set.
+		TimestampedHashSet();
+
+	public:
+		/// Returns \c true if this set is empty.
+		bool empty() const;
+
+		/// Gets the number of elements in this set.
+		size_t size() const;
+
+		/// Gets the number of buckets in this set.
+		size_t bucketCount() const;
+
+	public:
+		/// Gets a const iterator to the first element.
+		const_iterator begin() const;
+
+		/// Gets a const iterator to the element following the last element.
+		const_iterator end() const;
+
+		/// Gets a const iterator to the first element.
+		const_iterator cbegin() const;
+
+		/// Gets a const iterator to the element following the last element.
+		const_iterator cend() const;
+
+	public:
+		/// Searches for \a key in this set.
+		const_iterator find(const key_type& key) const;
+
+		/// Gets an iterator to the first element that is not less than \a key.
+		const_iterator lower_bound(const key_type& key) const;
+
+	public:
+		/// Inserts \a value into this set.
+		std::pair<iterator, bool> insert(const value_type& value);
+
+		/// Inserts \a value into this set ignoring \a hint.
+		iterator insert(const_iterator hint, const value_type& value);
+
+		/// Inserts all elements in the range [\a first, \a last) into this set.
+		template<typename TInputIterator>
+		void insert(TInputIterator first, TInputIterator last) {
+			for (; first != last; ++first)
+				insert(*first);
+		}
+
+		/// Erases the element pointed to by \a position.
+		iterator erase(const_iterator position);
+
+		/// Erases all elements in the range [\a first, \a last).
+		iterator erase(const_iterator first, const_iterator last);
+
+		/// Erases the element equal to \a key, if present.
+		size_t erase(const key_type& key);
+
+		/// Removes all elements.
+		void clear();
+
+	private:
+		static uint64_t GetWindowId(const value_type& value);
+
+		static void Reserve(Bucket& bucket);
+
+		Buckets::iterator findInsertBucket(const value_type& value);
+
+		const_iterator insertAt(Buckets::iterator bucketIter, size_t index, const value_type& value);
+
+	private:
+		Buckets m_buckets;
+		size_t m_size;
+	};
+}}
@@ -0,0 +1,393 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "src/cache/TimestampedHashSet.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+#include <algorithm>
+#include <set>
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS TimestampedHashSetTests
+
+	namespace {
+		constexpr uint64_t Bucket_Span = 1ull << TimestampedHashSet::Bucket_Shift;
+
+		state::TimestampedHash CreateTimestampedHash(uint64_t timestamp, uint8_t hashSeed = 0) {
+			state::TimestampedHash timestampedHash((Timestamp(timestamp)));
+			timestampedHash.Hash[0] = hashSeed;
+			return timestampedHash;
+		}
+
+		std::vector<state::TimestampedHash> CreateTimestampedHashesSpanningBuckets() {
+			// three buckets with two, three and one element(s)
+			return {
+				CreateTimestampedHash(0, 1),
+				CreateTimestampedHash(Bucket_Span - 1, 0),
+				CreateTimestampedHash(Bucket_Span, 0),
+				CreateTimestampedHash(Bucket_Span, 7),
+				CreateTimestampedHash(Bucket_Span + 100, 0),
+				CreateTimestampedHash(5 * Bucket_Span, 0)
+			};
+		}
+
+		TimestampedHashSet CreateSet(const std::vector<state::TimestampedHash>& timestampedHashes) {
+			TimestampedHashSet set;
+			for (const auto& timestampedHash : timestampedHashes)
+				set.insert(timestampedHash);
+
+			return set;
+		}
+
+		std::vector<state::TimestampedHash> ToVector(const TimestampedHashSet& set) {
+			return std::vector<state::TimestampedHash>(set.cbegin(), set.cend());
+		}
+	}
+
+	// region ctor
+
+	TEST(TEST_CLASS, CanCreateEmptySet) {
+		// Act:
+		TimestampedHashSet set;
+
+		// Assert:
+		EXPECT_TRUE(set.empty());
+		EXPECT_EQ(0u, set.size());
+		EXPECT_EQ(0u, set.bucketCount());
+		EXPECT_EQ(set.cend(), set.cbegin());
+	}
+
+	// endregion
+
+	// region insert
+
+	TEST(TEST_CLASS, CanInsertElementsIntoMultipleBuckets) {
+		// Arrange:
+		auto timestampedHashes = CreateTimestampedHashesSpanningBuckets();
+
+		// Act: insert in reverse order
+		TimestampedHashSet set;
+		for (auto iter = timestampedHashes.crbegin(); timestampedHashes.crend() != iter; ++iter) {
+			auto result = set.insert(*iter);
+
+			// Assert:
+			EXPECT_TRUE(result.second);
+			EXPECT_EQ(*iter, *result.first);
+		}
+
+		// Assert: elements are sorted
+		EXPECT_EQ(6u, set.size());
+		EXPECT_EQ(3u, set.bucketCount());
+		EXPECT_EQ(timestampedHashes, ToVector(set));
+	}
+
+	TEST(TEST_CLASS, CannotInsertDuplicateElement) {
+		// Arrange:
+		auto set = CreateSet(CreateTimestampedHashesSpanningBuckets());
+
+		// Act:
+		auto result = set.insert(CreateTimestampedHash(Bucket_Span, 7));
+
+		// Assert:
+		EXPECT_FALSE(result.second);
+		EXPECT_EQ(CreateTimestampedHash(Bucket_Span, 7), *result.first);
+		EXPECT_EQ(6u, set.size());
+		EXPECT_EQ(CreateTimestampedHashesSpanningBuckets(), ToVector(set));
+	}
+
+	TEST(TEST_CLASS, InsertingIntoFullBucketSplitsBucket) {
+		// Arrange: fill a single bucket with odd timestamps
+		TimestampedHashSet set;
+		for (auto i = 0u; i < TimestampedHashSet::Max_Bucket_Size; ++i)
+			set.insert(CreateTimestampedHash(2 * i + 1));
+
+		// Sanity:
+		EXPECT_EQ(1u, set.bucketCount());
+
+		// Act: insert an element into the middle of the full bucket
+		auto result = set.insert(CreateTimestampedHash(100));
+
+		// Assert:
+		EXPECT_TRUE(result.second);
+		EXPECT_EQ(CreateTimestampedHash(100), *result.first);
+		EXPECT_EQ(TimestampedHashSet::Max_Bucket_Size + 1, set.size());
+		EXPECT_EQ(2u, set.bucketCount());
+
+		auto timestampedHashes = ToVector(set);
+		EXPECT_TRUE(std::is_sorted(timestampedHashes.cbegin(), timestampedHashes.cend()));
+	}
+
+	TEST(TEST_CLASS, AppendingToFullBucketStartsNewBucket) {
+		// Act: insert increasing elements (the common case) into a single timestamp window
+		TimestampedHashSet set;
+		for (auto i = 0u; i < 2 * TimestampedHashSet::Max_Bucket_Size + 1; ++i)
+			set.insert(CreateTimestampedHash(i));
+
+		// Assert: all buckets except for the last one are full
+		EXPECT_EQ(2 * TimestampedHashSet::Max_Bucket_Size + 1, set.size());
+		EXPECT_EQ(3u, set.bucketCount());
+		EXPECT_EQ(CreateTimestampedHash(0), *set.cbegin());
+		EXPECT_EQ(CreateTimestampedHash(2 * TimestampedHashSet::Max_Bucket_Size), ToVector(set).back());
+	}
+
+	TEST(TEST_CLASS, CanInsertElementPrecedingAllElementsInTimestampWindow) {
+		// Arrange: create two buckets in the same window and erase the first one
+		constexpr auto Last_Timestamp = Bucket_Span + TimestampedHashSet::Max_Bucket_Size;
+		TimestampedHashSet set;
+		for (auto timestamp = Bucket_Span; timestamp <= Last_Timestamp; ++timestamp)
+			set.insert(CreateTimestampedHash(timestamp));
+
+		set.insert(CreateTimestampedHash(0));
+		set.erase(set.find(CreateTimestampedHash(Bucket_Span)), set.find(CreateTimestampedHash(Last_Timestamp)));
+
+		// Sanity:
+		EXPECT_EQ(2u, set.size());
+		EXPECT_EQ(2u, set.bucketCount());
+
+		// Act: insert an element preceding the (only) remaining bucket in the window
+		auto result = set.insert(CreateTimestampedHash(Bucket_Span + 1));
+
+		// Assert: the element is added to the existing bucket
+		EXPECT_TRUE(result.second);
+		EXPECT_EQ(3u, set.size());
+		EXPECT_EQ(2u, set.bucketCount());
+
+		std::vector<state::TimestampedHash> expectedTimestampedHashes{
+			CreateTimestampedHash(0),
+			CreateTimestampedHash(Bucket_Span + 1),
+			CreateTimestampedHash(Last_Timestamp)
+		};
+		EXPECT_EQ(expectedTimestampedHashes, ToVector(set));
+		EXPECT_EQ(CreateTimestampedHash(Bucket_Span + 1), *set.lower_bound(CreateTimestampedHash(Bucket_Span)));
+	}
+
+	TEST(TEST_CLASS, CanInsertRangeOfElements) {
+		// Arrange: range is unsorted and contains both duplicates and elements already in the set
+		auto set = CreateSet({ CreateTimestampedHash(Bucket_Span, 0), CreateTimestampedHash(5 * Bucket_Span, 0) });
+		std::vector<state::TimestampedHash> timestampedHashes{
+			CreateTimestampedHash(Bucket_Span + 100, 0),
+			CreateTimestampedHash(Bucket_Span, 7),
+			CreateTimestampedHash(Bucket_Span, 0),
+			CreateTimestampedHash(Bucket_Span - 1, 0),
+			CreateTimestampedHash(0, 1),
+			CreateTimestampedHash(Bucket_Span, 7)
+		};
+
+		// Act:
+		set.insert(timestampedHashes.cbegin(), timestampedHashes.cend());
+
+		// Assert:
+		EXPECT_EQ(6u, set.size());
+		EXPECT_EQ(3u, set.bucketCount());
+		EXPECT_EQ(CreateTimestampedHashesSpanningBuckets(), ToVector(set));
+	}
+
+	// endregion
+
+	// region find / lower_bound
+
+	TEST(TEST_CLASS, FindReturnsIteratorToMatchingElement) {
+		// Arrange:
+		auto timestampedHashes = CreateTimestampedHashesSpanningBuckets();
+		auto set = CreateSet(timestampedHashes);
+
+		// Act + Assert:
+		for (const auto& timestampedHash : timestampedHashes) {
+			auto iter = set.find(timestampedHash);
+			ASSERT_NE(set.cend(), iter) << timestampedHash;
+			EXPECT_EQ(timestampedHash, *iter) << timestampedHash;
+		}
+	}
+
+	TEST(TEST_CLASS, FindReturnsEndWhenNoElementMatches) {
+		// Arrange:
+		auto set = CreateSet(CreateTimestampedHashesSpanningBuckets());
+
+		// Act + Assert:
+		EXPECT_EQ(set.cend(), set.find(CreateTimestampedHash(0, 0)));
+		EXPECT_EQ(set.cend(), set.find(CreateTimestampedHash(Bucket_Span, 3)));
+		EXPECT_EQ(set.cend(), set.find(CreateTimestampedHash(3 * Bucket_Span, 0)));
+		EXPECT_EQ(set.cend(), set.find(CreateTimestampedHash(6 * Bucket_Span, 0)));
+	}
+
+	TEST(TEST_CLASS, LowerBoundReturnsFirstElementNotLessThanKey) {
+		// Arrange:
+		auto set = CreateSet(CreateTimestampedHashesSpanningBuckets());
+
+		// Act + Assert:
+		EXPECT_EQ(CreateTimestampedHash(0, 1), *set.lower_bound(CreateTimestampedHash(0, 0)));
+		EXPECT_EQ(CreateTimestampedHash(Bucket_Span, 7), *set.lower_bound(CreateTimestampedHash(Bucket_Span, 3)));
+		EXPECT_EQ(CreateTimestampedHash(5 * Bucket_Span, 0), *set.lower_bound(CreateTimestampedHash(Bucket_Span + 101, 0)));
+		EXPECT_EQ(CreateTimestampedHash(5 * Bucket_Span, 0), *set.lower_bound(CreateTimestampedHash(3 * Bucket_Span, 0)));
+		EXPECT_EQ(set.cend(), set.lower_bound(CreateTimestampedHash(5 * Bucket_Span, 1)));
+	}
+
+	// endregion
+
+	// region erase
+
+	TEST(TEST_CLASS, CanEraseElementByKey) {
+		// Arrange:
+		auto set = CreateSet(CreateTimestampedHashesSpanningBuckets());
+
+		// Act:
+		auto numErased1 = set.erase(CreateTimestampedHash(Bucket_Span, 7));
+		auto numErased2 = set.erase(CreateTimestampedHash(Bucket_Span, 7));
+
+		// Assert:
+		EXPECT_EQ(1u, numErased1);
+		EXPECT_EQ(0u, numErased2);
+		EXPECT_EQ(5u, set.size());
+		EXPECT_EQ(set.cend(), set.find(CreateTimestampedHash(Bucket_Span, 7)));
+	}
+
+	TEST(TEST_CLASS, ErasingLastElementInBucketRemovesBucket) {
+		// Arrange:
+		auto set = CreateSet(CreateTimestampedHashesSpanningBuckets());
+
+		// Act:
+		auto iter = set.erase(set.find(CreateTimestampedHash(Bucket_Span - 1, 0)));
+		set.erase(set.find(CreateTimestampedHash(0, 1)));
+
+		// Assert:
+		EXPECT_EQ(CreateTimestampedHash(Bucket_Span, 0), *iter);
+		EXPECT_EQ(4u, set.size());
+		EXPECT_EQ(2u, set.bucketCount());
+		EXPECT_EQ(CreateTimestampedHash(Bucket_Span, 0), *set.cbegin());
+	}
+
+	TEST(TEST_CLASS, CanEraseRangeWithinSingleBucket) {
+		// Arrange:
+		auto set = CreateSet(CreateTimestampedHashesSpanningBuckets());
+
+		// Act:
+		auto iter = set.erase(set.find(CreateTimestampedHash(Bucket_Span, 0)), set.find(CreateTimestampedHash(Bucket_Span + 100, 0)));
+
+		// Assert:
+		EXPECT_EQ(CreateTimestampedHash(Bucket_Span + 100, 0), *iter);
+		EXPECT_EQ(4u, set.size());
+		EXPECT_EQ(3u, set.bucketCount());
+	}
+
+	TEST(TEST_CLASS, CanEraseRangeSpanningBuckets) {
+		// Arrange:
+		auto set = CreateSet(CreateTimestampedHashesSpanningBuckets());
+
+		// Act:
+		auto iter = set.erase(set.find(CreateTimestampedHash(Bucket_Span - 1, 0)), set.find(CreateTimestampedHash(5 * Bucket_Span, 0)));
+
+		// Assert:
+		EXPECT_EQ(CreateTimestampedHash(5 * Bucket_Span, 0), *iter);
+		EXPECT_EQ(2u, set.size());
+		EXPECT_EQ(2u, set.bucketCount());
+
+		std::vector<state::TimestampedHash> expectedTimestampedHashes{
+			CreateTimestampedHash(0, 1),
+			CreateTimestampedHash(5 * Bucket_Span, 0)
+		};
+		EXPECT_EQ(expectedTimestampedHashes, ToVector(set));
+	}
+
+	TEST(TEST_CLASS, CanErasePrefixUpToLowerBound) {
+		// Arrange: this is how pruning removes elements
+		auto set = CreateSet(CreateTimestampedHashesSpanningBuckets());
+
+		// Act:
+		auto iter = set.erase(set.cbegin(), set.lower_bound(CreateTimestampedHash(Bucket_Span, 1)));
+
+		// Assert:
+		EXPECT_EQ(CreateTimestampedHash(Bucket_Span, 7), *iter);
+		EXPECT_EQ(3u, set.size());
+		EXPECT_EQ(2u, set.bucketCount());
+		EXPECT_EQ(iter, set.cbegin());
+	}
+
+	TEST(TEST_CLASS, CanEraseAllElements) {
+		// Arrange:
+		auto set = CreateSet(CreateTimestampedHashesSpanningBuckets());
+
+		// Act:
+		auto iter = set.erase(set.cbegin(), set.cend());
+
+		// Assert:
+		EXPECT_EQ(set.cend(), iter);
+		EXPECT_TRUE(set.empty());
+		EXPECT_EQ(0u, set.bucketCount());
+	}
+
+	TEST(TEST_CLASS, CanClear) {
+		// Arrange:
+		auto set = CreateSet(CreateTimestampedHashesSpanningBuckets());
+
+		// Act:
+		set.clear();
+
+		// Assert:
+		EXPECT_TRUE(set.empty());
+		EXPECT_EQ(0u, set.bucketCount());
+		EXPECT_EQ(set.cend(), set.cbegin());
+	}
+
+	// endregion
+
+	// region std::set equivalence
+
+	namespace {
+		void AssertRandomOperationsHaveSameResultAsStdSet(uint64_t numWindows, uint32_t numOperations, uint32_t pruneWeight) {
+			// Arrange:
+			TimestampedHashSet set;
+			std::set<state::TimestampedHash> expectedSet;
+			auto createRandomTimestampedHash = [numWindows]() {
+				return CreateTimestampedHash(test::Random() % (numWindows * Bucket_Span), static_cast<uint8_t>(test::Random() % 4));
+			};
+
+			// Act:
+			for (auto i = 0u; i < numOperations; ++i) {
+				auto timestampedHash = createRandomTimestampedHash();
+				auto operation = test::Random() % (3 + pruneWeight);
+				if (operation < 2) {
+					EXPECT_EQ(expectedSet.insert(timestampedHash).second, set.insert(timestampedHash).second);
+				} else if (operation < 3) {
+					EXPECT_EQ(expectedSet.erase(timestampedHash), set.erase(timestampedHash));
+				} else {
+					expectedSet.erase(expectedSet.cbegin(), expectedSet.lower_bound(timestampedHash));
+					set.erase(set.cbegin(), set.lower_bound(timestampedHash));
+				}
+			}
+
+			// Assert:
+			EXPECT_EQ(expectedSet.size(), set.size());
+			EXPECT_EQ(std::vector<state::TimestampedHash>(expectedSet.cbegin(), expectedSet.cend()), ToVector(set));
+		}
+	}
+
+	TEST(TEST_CLASS, RandomOperationsHaveSameResultAsStdSet) {
+		AssertRandomOperationsHaveSameResultAsStdSet(20, 5000, 1);
+	}
+
+	TEST(TEST_CLASS, RandomOperationsWithFullBucketsHaveSameResultAsStdSet) {
+		// Assert: do not prune in order to fill (and split) buckets
+		AssertRandomOperationsHaveSameResultAsStdSet(3, 20000, 0);
+	}
+
+	// endregion
+}}
@@ -40,7 +40,7 @@ namespace catapult { namespace cache {
 								config.CacheDatabaseDirectory,
 								config.CacheDatabaseConfig,
 								GetAdjustedColumnFamilyNames(config, columnFamilyNames),
-								pruningMode))
+								GetAdjustedPruningMode(config, pruningMode)))
 						: std::make_unique<CacheDatabase>())
 				, m_containerMode(GetContainerMode(config))
 				, m_hasPatriciaTreeSupport(config.ShouldStorePatriciaTrees)
@@ -72,6 +72,12 @@ namespace catapult { namespace cache {
 		}
 
 	private:
+		static FilterPruningMode GetAdjustedPruningMode(const CacheConfiguration& config, FilterPruningMode pruningMode) {
+			// patricia tree garbage collection removes unreachable nodes with the pruning filter
+			auto garbageCollectionDelay = config.CacheDatabaseConfig.PatriciaTreeGarbageCollectionDelay;
+			return config.ShouldStorePatriciaTrees && 0 != garbageCollectionDelay ? FilterPruningMode::Enabled : pruningMode;
+		}
+
 		static std::vector<std::string> GetAdjustedColumnFamilyNames(
 				const CacheConfiguration& config,
 				const std::vector<std::string>& columnFamilyNames) {
@@ -26,13 +26,14 @@
 #include "catapult/deltaset/BaseSet.h"
 #include "catapult/deltaset/ConditionalContainer.h"
 #include "catapult/deltaset/OrderedSet.h"
+#include "catapult/utils/FlatHashMap.h"
 #include <unordered_map>
 
 namespace catapult { namespace cache {
 
 	namespace detail {
-		/// Defines cache types for an unordered map based cache.
-		template<typename TElementTraits, typename TDescriptor, typename TValueHasher>
+		/// Defines cache types for an unordered map based cache with memory map \a TMemoryMap.
+		template<typename TElementTraits, typename TDescriptor, typename TMemoryMap>
 		struct UnorderedMapAdapter {
 		private:
 			struct DescriptorAdapter {
@@ -58,7 +59,7 @@ namespace catapult { namespace cache {
 			};
 
 			using StorageMapType = CacheContainerView<DescriptorAdapter>;
-			using MemoryMapType = std::unordered_map<typename TDescriptor::KeyType, typename TDescriptor::ValueType, TValueHasher>;
+			using MemoryMapType = TMemoryMap;
 
 			struct Converter {
 				static constexpr auto ToKey = TDescriptor::GetKeyFromValue;
@@ -94,14 +95,29 @@ namespace catapult { namespace cache {
 	using MutableUnorderedMapAdapter = detail::UnorderedMapAdapter<
 		deltaset::MutableTypeTraits<typename TDescriptor::ValueType>,
 		TDescriptor,
-		TValueHasher>;
+		std::unordered_map<typename TDescriptor::KeyType, typename TDescriptor::ValueType, TValueHasher>>;
 
 	/// Defines cache types for an unordered immutable map based cache.
 	template<typename TDescriptor, typename TValueHasher = std::hash<typename TDescriptor::KeyType>>
 	using ImmutableUnorderedMapAdapter = detail::UnorderedMapAdapter<
 		deltaset::ImmutableTypeTraits<typename TDescriptor::ValueType>,
 		TDescriptor,
-		TValueHasher>;
+		std::unordered_map<typename TDescriptor::KeyType, typename TDescriptor::ValueType, TValueHasher>>;
+
+	/// Defines cache types for an unordered mutable map based cache that uses an open-addressing map in memory.
+	/// \note This is preferred for large caches because lookups do not need to chase bucket lists.
+	template<typename TDescriptor, typename TValueHasher = std::hash<typename TDescriptor::KeyType>>
+	using MutableFlatMapAdapter = detail::UnorderedMapAdapter<
+		deltaset::MutableTypeTraits<typename TDescriptor::ValueType>,
+		TDescriptor,
+		utils::FlatHashMap<typename TDescriptor::KeyType, typename TDescriptor::ValueType, TValueHasher>>;
+
+	/// Defines cache types for an unordered immutable map based cache that uses an open-addressing map in memory.
+	template<typename TDescriptor, typename TValueHasher = std::hash<typename TDescriptor::KeyType>>
+	using ImmutableFlatMapAdapter = detail::UnorderedMapAdapter<
+		deltaset::ImmutableTypeTraits<typename TDescriptor::ValueType>,
+		TDescriptor,
+		utils::FlatHashMap<typename TDescriptor::KeyType, typename TDescriptor::ValueType, TValueHasher>>;
 
 	namespace detail {
 		/// Defines cache types for an ordered, memory backed set based cache.
@@ -153,8 +169,8 @@ namespace catapult { namespace cache {
 		deltaset::ImmutableTypeTraits<typename TDescriptor::ValueType>>;
 
 	namespace detail {
-		/// Defines cache types for an ordered set based cache.
-		template<typename TElementTraits, typename TDescriptor>
+		/// Defines cache types for an ordered set based cache with memory set \a TMemorySet.
+		template<typename TElementTraits, typename TDescriptor, typename TMemorySet>
 		struct OrderedSetAdapter {
 		private:
 			struct DescriptorAdapter {
@@ -179,9 +195,8 @@ namespace catapult { namespace cache {
 				}
 			};
 
-			using ElementType = std::remove_const_t<typename TElementTraits::ElementType>;
 			using StorageSetType = CacheContainerView<DescriptorAdapter>;
-			using MemorySetType = std::set<ElementType>;
+			using MemorySetType = TMemorySet;
 
 			// workaround for VS truncation
 			using SetStorageTraits = deltaset::SetStorageTraits<
@@ -211,11 +226,14 @@ namespace catapult { namespace cache {
 	template<typename TDescriptor>
 	using MutableOrderedSetAdapter = detail::OrderedSetAdapter<
 		deltaset::MutableTypeTraits<typename TDescriptor::ValueType>,
-		TDescriptor>;
+		TDescriptor,
+		std::set<typename TDescriptor::ValueType>>;
 
 	/// Defines cache types for an ordered immutable set based cache.
-	template<typename TDescriptor>
+	/// \note \a TMemorySet can be customized when a more compact ordered container is available for the value type.
+	template<typename TDescriptor, typename TMemorySet = std::set<typename TDescriptor::ValueType>>
 	using ImmutableOrderedSetAdapter = detail::OrderedSetAdapter<
 		deltaset::ImmutableTypeTraits<typename TDescriptor::ValueType>,
-		TDescriptor>;
+		TDescriptor,
+		TMemorySet>;
 }}
@@ -21,6 +21,7 @@
 
 #pragma once
 #include "catapult/cache_db/CacheDatabase.h"
+#include "catapult/cache_db/PatriciaTreeGarbageCollector.h"
 #include "catapult/cache_db/PatriciaTreeRdbDataSource.h"
 #include <memory>
 
@@ -64,16 +65,20 @@ namespace catapult { namespace cache {
 		public:
 			Impl(CacheDatabase& database, size_t columnId)
 					: m_container(database, columnId)
-					, m_dataSource(m_container)
+					, m_dataSource(m_container, database.config().PatriciaTreeNodeCacheSize)
 					, m_pTree(std::make_unique<TTree>(m_dataSource)) {
-				Hash256 rootHash;
-				if (!m_container.prop("root", rootHash))
-					return;
+				// garbage collection relies on the pruning filter, which is only available when pruning is enabled
+				auto garbageCollectionDelay = database.config().PatriciaTreeGarbageCollectionDelay;
+				if (0 != garbageCollectionDelay && database.canPrune())
+					m_pGarbageCollector = std::make_unique<PatriciaTreeGarbageCollector>(m_container, columnId, garbageCollectionDelay);
 
-				if (Hash256() == rootHash)
-					return;
+				Hash256 rootHash;
+				if (m_container.prop("root", rootHash) && Hash256() != rootHash)
+					m_pTree = std::make_unique<TTree>(m_dataSource, rootHash);
 
-				m_pTree = std::make_unique<TTree>(m_dataSource, rootHash);
+				// link counts are unknown when the tree was changed without garbage collection, so they need to be recalculated
+				if (m_pGarbageCollector && !m_pGarbageCollector->isTracking(m_pTree->root()))
+					m_pGarbageCollector->reset(m_pTree->root(), m_pTree->findSharedLinkCounts());
 			}
 
 		public:
@@ -87,7 +92,18 @@ namespace catapult { namespace cache {
 
 		public:
 			void commit() {
-				m_pTree->commit();
+				if (!m_pGarbageCollector) {
+					m_pTree->commit();
+				} else {
+					const auto& garbageCollector = *m_pGarbageCollector;
+					auto isUnreachable = [&garbageCollector](const auto& hash) {
+						return garbageCollector.isUnreachable(hash);
+					};
+
+					tree::CommittedNodeHashes committedNodeHashes;
+					m_pTree->commit(garbageCollector.sharedLinkCounts(), isUnreachable, committedNodeHashes);
+					m_pGarbageCollector->commit(committedNodeHashes, m_pTree->root());
+				}
 
 				// skip setProp if hash did not change
 				Hash256 rootHash;
@@ -101,6 +117,7 @@ namespace catapult { namespace cache {
 			PatriciaTreeContainer m_container;
 			PatriciaTreeRdbDataSource m_dataSource;
 			std::unique_ptr<TTree> m_pTree;
+			std::unique_ptr<PatriciaTreeGarbageCollector> m_pGarbageCollector;
 		};
 
 		std::unique_ptr<Impl> m_pImpl;
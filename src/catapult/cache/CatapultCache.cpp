@@ -28,6 +28,8 @@
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/model/NetworkIdentifier.h"
 #include "catapult/state/CatapultState.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 #include "catapult/utils/StackLogger.h"
 
 namespace catapult { namespace cache {
@@ -48,15 +50,14 @@ namespace catapult { namespace cache {
 			return readOnlyViews;
 		}
 
-		template<typename TSubCacheViews, typename TUpdateMerkleRoot>
-		std::vector<Hash256> CollectSubCacheMerkleRoots(TSubCacheViews& subViews, TUpdateMerkleRoot updateMerkleRoot) {
+		template<typename TSubCacheViews>
+		std::vector<Hash256> CollectSubCacheMerkleRoots(TSubCacheViews& subViews) {
 			std::vector<Hash256> merkleRoots;
 			for (const auto& pSubView : subViews) {
 				Hash256 merkleRoot;
 				if (!pSubView)
 					continue;
 
-				updateMerkleRoot(*pSubView);
 				if (pSubView->tryGetMerkleRoot(merkleRoot))
 					merkleRoots.push_back(merkleRoot);
 			}
@@ -79,15 +80,41 @@ namespace catapult { namespace cache {
 			return stateHash;
 		}
 
-		template<typename TSubCacheViews, typename TUpdateMerkleRoot>
-		StateHashInfo CalculateStateHashInfo(const TSubCacheViews& subViews, TUpdateMerkleRoot updateMerkleRoot) {
+		template<typename TSubCacheViews, typename TUpdateMerkleRoots>
+		StateHashInfo CalculateStateHashInfo(const TSubCacheViews& subViews, TUpdateMerkleRoots updateMerkleRoots) {
 			utils::SlowOperationLogger logger("CalculateStateHashInfo", utils::LogLevel::warning);
 
+			updateMerkleRoots();
+
+			// merkle roots are always collected in sub cache order, so the state hash does not depend on the update order
 			StateHashInfo stateHashInfo;
-			stateHashInfo.SubCacheMerkleRoots = CollectSubCacheMerkleRoots(subViews, updateMerkleRoot);
+			stateHashInfo.SubCacheMerkleRoots = CollectSubCacheMerkleRoots(subViews);
 			stateHashInfo.StateHash = CalculateStateHash(stateHashInfo.SubCacheMerkleRoots);
 			return stateHashInfo;
 		}
+
+		template<typename TSubCacheViews>
+		void UpdateMerkleRoots(const TSubCacheViews& subViews, Height height) {
+			for (const auto& pSubView : subViews) {
+				if (pSubView)
+					pSubView->updateMerkleRoot(height);
+			}
+		}
+
+		template<typename TSubCacheViews>
+		void UpdateMerkleRootsParallel(const TSubCacheViews& subViews, Height height, thread::IoThreadPool& pool) {
+			std::vector<SubCacheView*> merkleSubViews;
+			for (const auto& pSubView : subViews) {
+				if (pSubView && pSubView->supportsMerkleRoot())
+					merkleSubViews.push_back(pSubView.get());
+			}
+
+			// each sub cache owns an independent patricia tree, so all trees can be updated concurrently (one tree per partition)
+			auto updateMerkleRoot = [height](auto* pSubView, auto) {
+				pSubView->updateMerkleRoot(height);
+			};
+			thread::ParallelForRethrowFirstException(pool.ioContext(), merkleSubViews, merkleSubViews.size(), updateMerkleRoot);
+		}
 	}
 
 	// region CatapultCacheView
@@ -116,7 +143,7 @@ namespace catapult { namespace cache {
 	}
 
 	StateHashInfo CatapultCacheView::calculateStateHash() const {
-		return CalculateStateHashInfo(m_subViews, [](const auto&) {});
+		return CalculateStateHashInfo(m_subViews, []() {});
 	}
 
 	ReadOnlyCatapultCache CatapultCacheView::toReadOnly() const {
@@ -155,7 +182,11 @@ namespace catapult { namespace cache {
 	}
 
 	StateHashInfo CatapultCacheDelta::calculateStateHash(Height height) const {
-		return CalculateStateHashInfo(m_subViews, [height](auto& subView) { subView.updateMerkleRoot(height); });
+		return CalculateStateHashInfo(m_subViews, [this, height]() { UpdateMerkleRoots(m_subViews, height); });
+	}
+
+	StateHashInfo CatapultCacheDelta::calculateStateHash(Height height, thread::IoThreadPool& pool) const {
+		return CalculateStateHashInfo(m_subViews, [this, height, &pool]() { UpdateMerkleRootsParallel(m_subViews, height, pool); });
 	}
 
 	void CatapultCacheDelta::setSubCacheMerkleRoots(const std::vector<Hash256>& subCacheMerkleRoots) {
@@ -179,6 +210,18 @@ namespace catapult { namespace cache {
 		}
 	}
 
+	std::vector<size_t> CatapultCacheDelta::changedSubCacheIds() const {
+		std::vector<size_t> subCacheIds;
+		for (const auto& pSubView : m_subViews) {
+			if (!pSubView || !pSubView->hasChanges())
+				continue;
+
+			subCacheIds.push_back(pSubView->id().CacheId);
+		}
+
+		return subCacheIds;
+	}
+
 	void CatapultCacheDelta::prune(Height height) {
 		for (const auto& pSubView : m_subViews) {
 			if (!pSubView)
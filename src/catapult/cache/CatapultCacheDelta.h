@@ -27,6 +27,7 @@
 namespace catapult {
 	namespace cache { class ReadOnlyCatapultCache; }
 	namespace state { struct CatapultState; }
+	namespace thread { class IoThreadPool; }
 }
 
 namespace catapult { namespace cache {
@@ -84,9 +85,16 @@ namespace catapult { namespace cache {
 		/// Calculates the cache state hash given \a height.
 		StateHashInfo calculateStateHash(Height height) const;
 
+		/// Calculates the cache state hash given \a height by updating all sub cache merkle roots in parallel on \a pool.
+		/// \note This blocks until all sub caches are updated, so it must not be called from a \a pool thread.
+		StateHashInfo calculateStateHash(Height height, thread::IoThreadPool& pool) const;
+
 		/// Sets the merkle roots for all sub caches (\a subCacheMerkleRoots).
 		void setSubCacheMerkleRoots(const std::vector<Hash256>& subCacheMerkleRoots);
 
+		/// Gets the ids of all sub caches with added, modified or removed elements.
+		std::vector<size_t> changedSubCacheIds() const;
+
 		/// Prunes the cache at \a height.
 		void prune(Height height);
 
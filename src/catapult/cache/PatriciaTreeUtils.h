@@ -23,6 +23,7 @@
 #include "catapult/deltaset/DeltaElements.h"
 #include "catapult/tree/PatriciaTree.h"
 #include "catapult/exceptions.h"
+#include <vector>
 
 namespace catapult { namespace cache {
 
@@ -84,6 +85,21 @@ namespace catapult { namespace cache {
 		};
 
 		auto deltas = set.deltas();
+
+		// load all nodes along the modified paths in batches before walking them one at a time
+		std::vector<typename TTree::KeyType> modifiedKeys;
+		auto addModifiedKeys = [&needsApplication, &modifiedKeys](const auto& elements) {
+			for (const auto& pair : elements) {
+				if (needsApplication(pair.first))
+					modifiedKeys.push_back(pair.first);
+			}
+		};
+
+		addModifiedKeys(deltas.Added);
+		addModifiedKeys(deltas.Copied);
+		addModifiedKeys(deltas.Removed);
+		tree.prefetch(modifiedKeys);
+
 		for (const auto& pair : deltas.Added) {
 			if (needsApplication(pair.first)) {
 				// a value can be added and deactivated during the processing of a single chain part
@@ -93,6 +93,10 @@ namespace catapult { namespace cache {
 		/// Recalculates the merkle root given the specified chain \a height if supported.
 		virtual void updateMerkleRoot(Height height) = 0;
 
+		/// Returns \c true if the view has any added, modified or removed elements.
+		/// \note This is always \c false for views that do not track element changes.
+		virtual bool hasChanges() const = 0;
+
 		/// Prunes the cache at \a height.
 		virtual void prune(Height height) = 0;
 
@@ -131,6 +131,12 @@ namespace catapult { namespace cache {
 				return MerkleRootMutator<UnderlyingViewType>();
 			}
 
+			auto deltaElementsAccessor() const {
+				// need to dereference to get underlying view type from LockedCacheView
+				using UnderlyingViewType = std::remove_reference_t<decltype(*m_view)>;
+				return DeltaElementsAccessor<UnderlyingViewType>();
+			}
+
 			template<typename TPruneValue>
 			auto pruneMutator() {
 				// need to dereference to get underlying view type from LockedCacheView
@@ -167,6 +173,10 @@ namespace catapult { namespace cache {
 				UpdateMerkleRoot(m_view, height, merkleRootMutator());
 			}
 
+			bool hasChanges() const override {
+				return HasChanges(m_view, deltaElementsAccessor());
+			}
+
 			void prune(Height height) override {
 				Prune(m_view, height, pruneMutator<Height>());
 			}
@@ -204,6 +214,16 @@ namespace catapult { namespace cache {
 					: public SupportedFeatureFlag
 			{};
 
+			template<typename T, typename = void>
+			struct DeltaElementsAccessor : public UnsupportedFeatureFlag {};
+
+			template<typename T>
+			struct DeltaElementsAccessor<
+					T,
+					utils::traits::is_type_expression_t<decltype(reinterpret_cast<const T*>(0)->addedElements())>>
+					: public SupportedFeatureFlag
+			{};
+
 			template<typename TPruneValue, typename T, typename = void>
 			struct PruneMutator : public UnsupportedFeatureFlag {};
 
@@ -252,6 +272,14 @@ namespace catapult { namespace cache {
 				view->updateMerkleRoot(height);
 			}
 
+			static bool HasChanges(const TView&, UnsupportedFeatureFlag) {
+				return false;
+			}
+
+			static bool HasChanges(const TView& view, SupportedFeatureFlag) {
+				return !view->addedElements().empty() || !view->modifiedElements().empty() || !view->removedElements().empty();
+			}
+
 			template<typename TPruneValue>
 			static void Prune(TView&, TPruneValue, UnsupportedFeatureFlag)
 			{}
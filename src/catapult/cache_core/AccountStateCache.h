@@ -53,6 +53,8 @@ namespace catapult { namespace cache {
 		/// Initializes the cache with \a highValueAccounts.
 		void init(HighValueAccounts&& highValueAccounts) {
 			*m_pHighValueAccounts = std::move(highValueAccounts);
+
+			m_pHighValueAccounts->rebuildAccountIndex(createView());
 		}
 
 		/// Commits all pending changes to the underlying storage.
@@ -79,16 +79,27 @@ namespace catapult { namespace cache {
 
 		// region serialization utils (read)
 
-		model::AddressSet ReadAddresses(io::InputStream& input) {
-			model::AddressSet addresses;
+		// input streams do not expose their remaining size, so counts read from them are untrusted;
+		// allocations based on them are done in bounded steps so that a corrupt count fails reading instead of allocating
+		constexpr uint64_t Max_Elements_Per_Allocation = 64 * 1024;
 
+		model::AddressSet ReadAddresses(io::InputStream& input) {
+			// addresses are stored contiguously, so read them in bulk (each chunk is allocated after the previous one was read)
 			auto numAddresses = io::Read64(input);
-			for (auto i = 0u; i < numAddresses; ++i) {
-				Address address;
-				input.read(address);
-				addresses.insert(address);
+			std::vector<Address> addressesBuffer;
+			while (addressesBuffer.size() < numAddresses) {
+				auto numReadAddresses = addressesBuffer.size();
+				auto numChunkAddresses = std::min<uint64_t>(numAddresses - numReadAddresses, Max_Elements_Per_Allocation);
+				addressesBuffer.resize(numReadAddresses + numChunkAddresses);
+				input.read({ reinterpret_cast<uint8_t*>(addressesBuffer.data() + numReadAddresses), numChunkAddresses * Address::Size });
 			}
 
+			model::AddressSet addresses;
+			addresses.reserve(addressesBuffer.size());
+			addresses.insert(addressesBuffer.cbegin(), addressesBuffer.cend());
+			if (addresses.size() != addressesBuffer.size())
+				CATAPULT_THROW_RUNTIME_ERROR("high value accounts contain duplicate addresses");
+
 			return addresses;
 		}
 
@@ -124,15 +135,20 @@ namespace catapult { namespace cache {
 			AddressAccountHistoryMap accountHistories;
 
 			auto numAccountHistories = io::Read64(input);
+			accountHistories.reserve(std::min<uint64_t>(numAccountHistories, Max_Elements_Per_Allocation));
 			for (auto i = 0u; i < numAccountHistories; ++i) {
 				Address address;
 				input.read(address);
 
-				state::AccountHistory accountHistory;
+				// construct each history in place instead of copying a temporary into the map
+				auto emplaceResult = accountHistories.try_emplace(address);
+				if (!emplaceResult.second)
+					CATAPULT_THROW_RUNTIME_ERROR_1("high value accounts contain duplicate account history", address);
+
+				auto& accountHistory = emplaceResult.first->second;
 				ReadHistoryMap<Amount>(input, accountHistory);
 				ReadHistoryMap<Key>(input, accountHistory);
 				ReadHistoryMap<std::vector<model::PinnedVotingKey>>(input, accountHistory);
-				accountHistories.emplace(address, accountHistory);
 			}
 
 			return accountHistories;
@@ -172,8 +172,8 @@ namespace catapult { namespace cache {
 	// endregion
 
 	public:
-		using PrimaryTypes = MutableUnorderedMapAdapter<AccountStateCacheDescriptor, utils::ArrayHasher<Address>>;
-		using KeyLookupMapTypes = ImmutableUnorderedMapAdapter<KeyLookupMapTypesDescriptor, utils::ArrayHasher<Key>>;
+		using PrimaryTypes = MutableFlatMapAdapter<AccountStateCacheDescriptor, utils::ArrayHasher<Address>>;
+		using KeyLookupMapTypes = ImmutableFlatMapAdapter<KeyLookupMapTypesDescriptor, utils::ArrayHasher<Key>>;
 
 	public:
 		// workaround for VS truncation
@@ -24,6 +24,62 @@
 
 namespace catapult { namespace cache {
 
+	// region HighValueAccountIndex
+
+	size_t HighValueAccountIndex::size() const {
+		return m_addresses.size();
+	}
+
+	const std::vector<Address>& HighValueAccountIndex::addresses() const {
+		return m_addresses;
+	}
+
+	const std::vector<Amount>& HighValueAccountIndex::balances() const {
+		return m_balances;
+	}
+
+	const std::vector<state::AccountActivityBuckets>& HighValueAccountIndex::activityBuckets() const {
+		return m_activityBuckets;
+	}
+
+	void HighValueAccountIndex::set(const state::AccountState& accountState, Amount balance) {
+		auto emplaceResult = m_rowIndexes.emplace(accountState.Address, m_addresses.size());
+		if (emplaceResult.second) {
+			m_addresses.push_back(accountState.Address);
+			m_balances.push_back(balance);
+			m_activityBuckets.push_back(accountState.ActivityBuckets);
+			return;
+		}
+
+		auto row = emplaceResult.first->second;
+		m_balances[row] = balance;
+		m_activityBuckets[row] = accountState.ActivityBuckets;
+	}
+
+	void HighValueAccountIndex::remove(const Address& address) {
+		auto rowIndexIter = m_rowIndexes.find(address);
+		if (m_rowIndexes.cend() == rowIndexIter)
+			return;
+
+		// move last row into the removed row
+		auto row = rowIndexIter->second;
+		m_rowIndexes.erase(rowIndexIter);
+
+		auto lastRow = m_addresses.size() - 1;
+		if (row != lastRow) {
+			m_addresses[row] = m_addresses[lastRow];
+			m_balances[row] = m_balances[lastRow];
+			m_activityBuckets[row] = m_activityBuckets[lastRow];
+			m_rowIndexes[m_addresses[row]] = row;
+		}
+
+		m_addresses.pop_back();
+		m_balances.pop_back();
+		m_activityBuckets.pop_back();
+	}
+
+	// endregion
+
 	// region HighValueAccounts
 
 	HighValueAccounts::HighValueAccounts()
@@ -39,10 +95,23 @@ namespace catapult { namespace cache {
 			, m_accountHistories(std::move(accountHistories))
 	{}
 
+	HighValueAccounts::HighValueAccounts(
+			model::AddressSet&& addresses,
+			HighValueAccountIndex&& accountIndex,
+			AddressAccountHistoryMap&& accountHistories)
+			: m_addresses(std::move(addresses))
+			, m_accountIndex(std::move(accountIndex))
+			, m_accountHistories(std::move(accountHistories))
+	{}
+
 	const model::AddressSet& HighValueAccounts::addresses() const {
 		return m_addresses;
 	}
 
+	const HighValueAccountIndex& HighValueAccounts::accountIndex() const {
+		return m_accountIndex;
+	}
+
 	const AddressAccountHistoryMap& HighValueAccounts::accountHistories() const {
 		return m_accountHistories;
 	}
@@ -58,29 +127,36 @@ namespace catapult { namespace cache {
 
 		public:
 			HighValueAddressesUpdater(
+					MosaicId harvestingMosaicId,
 					const model::AddressSet& originalAddresses,
 					model::AddressSet& currentAddresses,
-					model::AddressSet& removedAddresses)
-					: m_original(originalAddresses)
+					model::AddressSet& removedAddresses,
+					HighValueAccountIndex& accountIndex)
+					: m_harvestingMosaicId(harvestingMosaicId)
+					, m_original(originalAddresses)
 					, m_current(currentAddresses)
 					, m_removed(removedAddresses)
+					, m_accountIndex(accountIndex)
 			{}
 
 		public:
 			void update(const MemorySetType& source, const predicate<const state::AccountState&>& include) {
 				for (const auto& pair : source)
-					updateOne(pair.second.Address, include(pair.second));
+					updateOne(pair.second, include(pair.second));
 			}
 
 		private:
-			void updateOne(const Address& address, bool shouldInclude) {
+			void updateOne(const state::AccountState& accountState, bool shouldInclude) {
+				const auto& address = accountState.Address;
 				if (shouldInclude) {
 					m_current.insert(address);
+					m_accountIndex.set(accountState, accountState.Balances.get(m_harvestingMosaicId));
 
 					// needed for multiblock syncs when original account is removed and then readded
 					m_removed.erase(address);
 				} else {
 					m_current.erase(address);
+					m_accountIndex.remove(address);
 
 					if (m_original.cend() != m_original.find(address))
 						m_removed.insert(address);
@@ -88,9 +164,11 @@ namespace catapult { namespace cache {
 			}
 
 		private:
+			MosaicId m_harvestingMosaicId;
 			const model::AddressSet& m_original;
 			model::AddressSet& m_current;
 			model::AddressSet& m_removed;
+			HighValueAccountIndex& m_accountIndex;
 		};
 	}
 
@@ -153,6 +231,7 @@ namespace catapult { namespace cache {
 			: m_options(options)
 			, m_original(accounts.addresses())
 			, m_current(accounts.addresses())
+			, m_accountIndex(accounts.accountIndex())
 			, m_accountHistories(accounts.accountHistories())
 			, m_height(Height(1))
 	{}
@@ -169,6 +248,10 @@ namespace catapult { namespace cache {
 		return m_removed;
 	}
 
+	const HighValueAccountIndex& HighValueAccountsUpdater::accountIndex() const {
+		return m_accountIndex;
+	}
+
 	const AddressAccountHistoryMap& HighValueAccountsUpdater::accountHistories() const {
 		return m_accountHistories;
 	}
@@ -190,10 +273,11 @@ namespace catapult { namespace cache {
 	}
 
 	HighValueAccounts HighValueAccountsUpdater::detachAccounts() {
-		auto accounts = HighValueAccounts(std::move(m_current), std::move(m_accountHistories));
+		auto accounts = HighValueAccounts(std::move(m_current), std::move(m_accountIndex), std::move(m_accountHistories));
 
 		m_current.clear();
 		m_removed.clear();
+		m_accountIndex = HighValueAccountIndex();
 		m_accountHistories.clear();
 
 		return accounts;
@@ -214,7 +298,7 @@ namespace catapult { namespace cache {
 			return EffectiveBalanceRetriever(accountState, options.HarvestingMosaicId, options.MinHarvesterBalance).second;
 		};
 
-		HighValueAddressesUpdater updater(m_original, m_current, m_removed);
+		HighValueAddressesUpdater updater(m_options.HarvestingMosaicId, m_original, m_current, m_removed, m_accountIndex);
 		updater.update(deltas.Added, hasHighValue);
 		updater.update(deltas.Copied, hasHighValue);
 		updater.update(deltas.Removed, [](const auto&) { return false; });
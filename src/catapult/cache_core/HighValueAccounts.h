@@ -23,12 +23,43 @@
 #include "AccountStateCacheTypes.h"
 #include "catapult/model/ContainerTypes.h"
 #include "catapult/state/AccountHistory.h"
+#include <vector>
 
 namespace catapult { namespace cache {
 
 	/// Map of addresses to account histories.
 	using AddressAccountHistoryMap = std::unordered_map<Address, state::AccountHistory, utils::ArrayHasher<Address>>;
 
+	/// Dense index of high value (harvester eligible) accounts composed of address, balance and activity columns.
+	/// \note Removing an account moves the last row into its place, so row order is unspecified.
+	class HighValueAccountIndex {
+	public:
+		/// Gets the number of indexed accounts.
+		size_t size() const;
+
+		/// Gets the address column.
+		const std::vector<Address>& addresses() const;
+
+		/// Gets the (harvesting mosaic) balance column.
+		const std::vector<Amount>& balances() const;
+
+		/// Gets the activity column.
+		const std::vector<state::AccountActivityBuckets>& activityBuckets() const;
+
+	public:
+		/// Adds or updates the row for \a accountState with harvesting mosaic \a balance.
+		void set(const state::AccountState& accountState, Amount balance);
+
+		/// Removes the row for \a address, if present.
+		void remove(const Address& address);
+
+	private:
+		std::vector<Address> m_addresses;
+		std::vector<Amount> m_balances;
+		std::vector<state::AccountActivityBuckets> m_activityBuckets;
+		std::unordered_map<Address, size_t, utils::ArrayHasher<Address>> m_rowIndexes;
+	};
+
 	/// High value accounts container.
 	class HighValueAccounts {
 	public:
@@ -41,15 +72,39 @@ namespace catapult { namespace cache {
 		/// Creates a container around \a addresses and \a accountHistories.
 		HighValueAccounts(model::AddressSet&& addresses, AddressAccountHistoryMap&& accountHistories);
 
+		/// Creates a container around \a addresses, \a accountIndex and \a accountHistories.
+		HighValueAccounts(
+				model::AddressSet&& addresses,
+				HighValueAccountIndex&& accountIndex,
+				AddressAccountHistoryMap&& accountHistories);
+
 	public:
 		/// Gets the high value (harvester eligible) addresses.
 		const model::AddressSet& addresses() const;
 
+		/// Gets the dense index of high value (harvester eligible) accounts.
+		const HighValueAccountIndex& accountIndex() const;
+
 		/// Gets the high value (voter eligible) account histories.
 		const AddressAccountHistoryMap& accountHistories() const;
 
+	public:
+		/// Rebuilds the account index from the account states in \a view.
+		/// \note This is required after loading because the account index is not serialized.
+		template<typename TAccountStateCacheView>
+		void rebuildAccountIndex(const TAccountStateCacheView& view) {
+			m_accountIndex = HighValueAccountIndex();
+			for (const auto& address : m_addresses) {
+				auto accountStateIter = view.find(address);
+				const auto* pAccountState = accountStateIter.tryGet();
+				if (pAccountState)
+					m_accountIndex.set(*pAccountState, pAccountState->Balances.get(view.harvestingMosaicId()));
+			}
+		}
+
 	private:
 		model::AddressSet m_addresses;
+		HighValueAccountIndex m_accountIndex;
 		AddressAccountHistoryMap m_accountHistories;
 	};
 
@@ -72,6 +127,9 @@ namespace catapult { namespace cache {
 		/// Gets the (removed) high value (harvester eligible) addresses relative to the initial addresses.
 		const model::AddressSet& removedAddresses() const;
 
+		/// Gets the (current) dense index of high value (harvester eligible) accounts.
+		const HighValueAccountIndex& accountIndex() const;
+
 		/// Gets the high value (voter eligible) account histories.
 		const AddressAccountHistoryMap& accountHistories() const;
 
@@ -98,6 +156,7 @@ namespace catapult { namespace cache {
 		const model::AddressSet& m_original;
 		model::AddressSet m_current;
 		model::AddressSet m_removed;
+		HighValueAccountIndex m_accountIndex;
 		AddressAccountHistoryMap m_accountHistories;
 		Height m_height;
 	};
@@ -0,0 +1,295 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "PatriciaTreeGarbageCollector.h"
+#include "RocksDatabase.h"
+#include "RocksInclude.h"
+#include "catapult/utils/Logging.h"
+#include <atomic>
+#include <cstring>
+#include <limits>
+
+namespace catapult { namespace cache {
+
+	namespace {
+		constexpr auto Generation_Property_Name = "gc_next";
+		constexpr auto Collected_Generation_Property_Name = "gc_done";
+		constexpr auto Root_Hash_Property_Name = "gc_root";
+
+		// journal keys are prefixed with max uint64_t so that they are never below any pruning boundary
+		constexpr auto Journal_Key_Size = 2 * sizeof(uint64_t);
+
+		// shared link counts are stored in a journal entry that is never reached by any generation
+		constexpr auto Shared_Link_Counts_Generation = std::numeric_limits<uint64_t>::max();
+
+		std::atomic<uint64_t> g_numCollections(0);
+		std::atomic<uint64_t> g_numRemoved(0);
+		std::atomic<uint64_t> g_numRemovedBytes(0);
+
+		std::string CreateJournalKey(uint64_t generation) {
+			std::string key(Journal_Key_Size, static_cast<char>(0xFF));
+			std::memcpy(&key[sizeof(uint64_t)], &generation, sizeof(uint64_t));
+			return key;
+		}
+
+		std::string ToString(const Hash256& hash) {
+			return std::string(reinterpret_cast<const char*>(hash.data()), hash.size());
+		}
+
+		void AppendHashes(std::string& buffer, const std::vector<Hash256>& hashes) {
+			auto count = static_cast<uint32_t>(hashes.size());
+			buffer.append(reinterpret_cast<const char*>(&count), sizeof(uint32_t));
+			for (const auto& hash : hashes)
+				buffer.append(reinterpret_cast<const char*>(hash.data()), hash.size());
+		}
+
+		template<typename TConsumer>
+		const uint8_t* ReadHashes(const uint8_t* pData, const uint8_t* pDataEnd, TConsumer consumer) {
+			uint32_t count;
+			if (pDataEnd - pData < static_cast<ptrdiff_t>(sizeof(uint32_t)))
+				CATAPULT_THROW_RUNTIME_ERROR("patricia tree garbage collection journal entry is truncated");
+
+			std::memcpy(&count, pData, sizeof(uint32_t));
+			pData += sizeof(uint32_t);
+			if (static_cast<uint64_t>(pDataEnd - pData) < static_cast<uint64_t>(count) * Hash256::Size)
+				CATAPULT_THROW_RUNTIME_ERROR("patricia tree garbage collection journal entry is truncated");
+
+			for (auto i = 0u; i < count; ++i) {
+				Hash256 hash;
+				std::memcpy(hash.data(), pData, Hash256::Size);
+				consumer(hash);
+				pData += Hash256::Size;
+			}
+
+			return pData;
+		}
+
+		template<typename TConsumer>
+		void ReadLinkCounts(const uint8_t* pData, const uint8_t* pDataEnd, TConsumer consumer) {
+			constexpr auto Entry_Size = Hash256::Size + sizeof(uint32_t);
+
+			uint32_t count;
+			if (pDataEnd - pData < static_cast<ptrdiff_t>(sizeof(uint32_t)))
+				CATAPULT_THROW_RUNTIME_ERROR("patricia tree shared link counts are truncated");
+
+			std::memcpy(&count, pData, sizeof(uint32_t));
+			pData += sizeof(uint32_t);
+			if (static_cast<uint64_t>(pDataEnd - pData) < static_cast<uint64_t>(count) * Entry_Size)
+				CATAPULT_THROW_RUNTIME_ERROR("patricia tree shared link counts are truncated");
+
+			for (auto i = 0u; i < count; ++i) {
+				Hash256 hash;
+				uint32_t linkCount;
+				std::memcpy(hash.data(), pData, Hash256::Size);
+				std::memcpy(&linkCount, pData + Hash256::Size, sizeof(uint32_t));
+				consumer(hash, linkCount);
+				pData += Entry_Size;
+			}
+		}
+	}
+
+	PatriciaTreeGarbageCollectionStatistics GetPatriciaTreeGarbageCollectionStatistics() {
+		return { g_numCollections.load(), g_numRemoved.load(), g_numRemovedBytes.load() };
+	}
+
+	PatriciaTreeGarbageCollector::PatriciaTreeGarbageCollector(
+			PatriciaTreeContainer& container,
+			size_t columnId,
+			uint32_t collectionDelay)
+			: m_container(container)
+			, m_columnId(columnId)
+			, m_collectionDelay(collectionDelay)
+			, m_generation(0)
+			, m_collectedGeneration(0)
+			, m_hasRootHash(false) {
+		load();
+	}
+
+	uint64_t PatriciaTreeGarbageCollector::generation() const {
+		return m_generation;
+	}
+
+	uint64_t PatriciaTreeGarbageCollector::collectedGeneration() const {
+		return m_collectedGeneration;
+	}
+
+	size_t PatriciaTreeGarbageCollector::numUnreachableNodes() const {
+		return m_unreachableNodeGenerations.size();
+	}
+
+	const tree::NodeLinkCounts& PatriciaTreeGarbageCollector::sharedLinkCounts() const {
+		return m_sharedLinkCounts;
+	}
+
+	bool PatriciaTreeGarbageCollector::isUnreachable(const Hash256& hash) const {
+		return m_unreachableNodeGenerations.cend() != m_unreachableNodeGenerations.find(hash);
+	}
+
+	bool PatriciaTreeGarbageCollector::isTracking(const Hash256& rootHash) const {
+		return m_hasRootHash && m_rootHash == rootHash;
+	}
+
+	void PatriciaTreeGarbageCollector::reset(const Hash256& rootHash, tree::NodeLinkCounts&& sharedLinkCounts) {
+		// drop all uncollected journal entries because their nodes might be reachable from the current tree
+		auto& database = m_container.database();
+		for (auto generation = m_collectedGeneration; generation < m_generation; ++generation)
+			database.del(m_columnId, CreateJournalKey(generation));
+
+		m_unreachableNodeGenerations.clear();
+		m_collectedGeneration = m_generation;
+		m_container.setProp(Collected_Generation_Property_Name, m_collectedGeneration);
+
+		m_sharedLinkCounts = std::move(sharedLinkCounts);
+		saveSharedLinkCounts();
+		saveRootHash(rootHash);
+	}
+
+	void PatriciaTreeGarbageCollector::commit(const tree::CommittedNodeHashes& committedNodeHashes, const Hash256& rootHash) {
+		// nodes that were unreachable and are reachable again (e.g. because a value was restored) must not be collected
+		std::vector<Hash256> revivedHashes;
+		for (const auto& hash : committedNodeHashes.Reachable) {
+			if (m_unreachableNodeGenerations.erase(hash))
+				revivedHashes.push_back(hash);
+		}
+
+		// if a node was already unreachable, it is assigned the newer generation because it was recreated by an intermediate root
+		for (const auto& hash : committedNodeHashes.Unreachable)
+			m_unreachableNodeGenerations[hash] = m_generation;
+
+		for (const auto& pair : committedNodeHashes.SharedLinkCounts) {
+			if (pair.second < 2)
+				m_sharedLinkCounts.erase(pair.first);
+			else
+				m_sharedLinkCounts[pair.first] = pair.second;
+		}
+
+		if (!committedNodeHashes.SharedLinkCounts.empty())
+			saveSharedLinkCounts();
+
+		saveRootHash(rootHash);
+
+		if (committedNodeHashes.Unreachable.empty() && revivedHashes.empty())
+			return;
+
+		save(committedNodeHashes, revivedHashes);
+
+		// collect once expired generations span a full delay in order to amortize the cost of compacting the column
+		if (m_generation >= m_collectedGeneration + 2 * static_cast<uint64_t>(m_collectionDelay))
+			collect(m_generation - m_collectionDelay);
+	}
+
+	void PatriciaTreeGarbageCollector::load() {
+		m_container.prop(Generation_Property_Name, m_generation);
+		m_container.prop(Collected_Generation_Property_Name, m_collectedGeneration);
+		m_hasRootHash = m_container.prop(Root_Hash_Property_Name, m_rootHash);
+
+		auto& database = m_container.database();
+		RdbDataIterator sharedLinkCountsIter;
+		database.get(m_columnId, CreateJournalKey(Shared_Link_Counts_Generation), sharedLinkCountsIter);
+		if (RdbDataIterator::End() != sharedLinkCountsIter) {
+			auto buffer = sharedLinkCountsIter.buffer();
+			ReadLinkCounts(buffer.pData, buffer.pData + buffer.Size, [this](const auto& hash, auto linkCount) {
+				m_sharedLinkCounts.emplace(hash, linkCount);
+			});
+		}
+
+		// replay all journal entries that have not been collected
+		for (auto generation = m_collectedGeneration; generation < m_generation; ++generation) {
+			RdbDataIterator iter;
+			database.get(m_columnId, CreateJournalKey(generation), iter);
+			if (RdbDataIterator::End() == iter)
+				continue;
+
+			auto buffer = iter.buffer();
+			const auto* pDataEnd = buffer.pData + buffer.Size;
+			auto* pData = ReadHashes(buffer.pData, pDataEnd, [this, generation](const auto& hash) {
+				m_unreachableNodeGenerations[hash] = generation;
+			});
+			ReadHashes(pData, pDataEnd, [this](const auto& hash) {
+				m_unreachableNodeGenerations.erase(hash);
+			});
+		}
+	}
+
+	void PatriciaTreeGarbageCollector::save(
+			const tree::CommittedNodeHashes& committedNodeHashes,
+			const std::vector<Hash256>& revivedHashes) {
+		std::string journalEntry;
+		journalEntry.reserve(2 * sizeof(uint32_t) + (committedNodeHashes.Unreachable.size() + revivedHashes.size()) * Hash256::Size);
+		AppendHashes(journalEntry, committedNodeHashes.Unreachable);
+		AppendHashes(journalEntry, revivedHashes);
+		m_container.database().put(m_columnId, CreateJournalKey(m_generation), journalEntry);
+
+		++m_generation;
+		m_container.setProp(Generation_Property_Name, m_generation);
+	}
+
+	void PatriciaTreeGarbageCollector::saveSharedLinkCounts() {
+		auto count = static_cast<uint32_t>(m_sharedLinkCounts.size());
+		std::string buffer;
+		buffer.reserve(sizeof(uint32_t) + count * (Hash256::Size + sizeof(uint32_t)));
+		buffer.append(reinterpret_cast<const char*>(&count), sizeof(uint32_t));
+		for (const auto& pair : m_sharedLinkCounts) {
+			buffer.append(reinterpret_cast<const char*>(pair.first.data()), pair.first.size());
+			buffer.append(reinterpret_cast<const char*>(&pair.second), sizeof(uint32_t));
+		}
+
+		m_container.database().put(m_columnId, CreateJournalKey(Shared_Link_Counts_Generation), buffer);
+	}
+
+	void PatriciaTreeGarbageCollector::saveRootHash(const Hash256& rootHash) {
+		if (isTracking(rootHash))
+			return;
+
+		m_hasRootHash = true;
+		m_rootHash = rootHash;
+		m_container.setProp(Root_Hash_Property_Name, m_rootHash);
+	}
+
+	void PatriciaTreeGarbageCollector::collect(uint64_t expiryGeneration) {
+		std::unordered_set<std::string> expiredKeys;
+		for (auto generation = m_collectedGeneration; generation < expiryGeneration; ++generation)
+			expiredKeys.insert(CreateJournalKey(generation));
+
+		for (auto iter = m_unreachableNodeGenerations.begin(); m_unreachableNodeGenerations.end() != iter;) {
+			if (iter->second < expiryGeneration) {
+				expiredKeys.insert(ToString(iter->first));
+				iter = m_unreachableNodeGenerations.erase(iter);
+			} else {
+				++iter;
+			}
+		}
+
+		auto numExpiredKeys = expiredKeys.size();
+		auto statistics = m_container.database().prune(m_columnId, std::move(expiredKeys));
+
+		m_collectedGeneration = expiryGeneration;
+		m_container.setProp(Collected_Generation_Property_Name, m_collectedGeneration);
+
+		++g_numCollections;
+		g_numRemoved += statistics.NumRemoved;
+		g_numRemovedBytes += statistics.NumRemovedBytes;
+
+		CATAPULT_LOG(debug)
+				<< "collected " << statistics.NumRemoved << " of " << numExpiredKeys << " expired patricia tree entries ("
+				<< statistics.NumRemovedBytes << " bytes) before generation " << expiryGeneration;
+	}
+}}
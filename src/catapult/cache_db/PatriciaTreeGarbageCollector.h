@@ -0,0 +1,109 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "PatriciaTreeContainer.h"
+#include "catapult/tree/BasePatriciaTreeDelta.h"
+#include "catapult/utils/Hashers.h"
+#include <unordered_map>
+
+namespace catapult { namespace cache {
+
+	/// Patricia tree garbage collection statistics.
+	struct PatriciaTreeGarbageCollectionStatistics {
+		/// Number of garbage collections.
+		uint64_t NumCollections;
+
+		/// Number of removed entries (unreachable nodes and journal entries).
+		uint64_t NumRemoved;
+
+		/// Total size of keys and values of removed entries.
+		uint64_t NumRemovedBytes;
+	};
+
+	/// Gets the process-wide patricia tree garbage collection statistics.
+	PatriciaTreeGarbageCollectionStatistics GetPatriciaTreeGarbageCollectionStatistics();
+
+	/// Garbage collector that removes patricia tree nodes after they have been unreachable for a number of commits.
+	/// \note Each commit with unreachable or revived nodes is a generation. Unreachable nodes are journaled per generation,
+	///       so they are collected even after a restart. Nodes linked at more than one position are reference counted.
+	class PatriciaTreeGarbageCollector {
+	public:
+		/// Creates a collector around \a container, which stores its nodes in database column \a columnId,
+		/// that removes unreachable nodes \a collectionDelay generations after they became unreachable.
+		PatriciaTreeGarbageCollector(PatriciaTreeContainer& container, size_t columnId, uint32_t collectionDelay);
+
+	public:
+		/// Gets the generation of the next commit.
+		uint64_t generation() const;
+
+		/// Gets the first generation with unreachable nodes that have not been collected.
+		uint64_t collectedGeneration() const;
+
+		/// Gets the number of unreachable nodes that have not been collected.
+		size_t numUnreachableNodes() const;
+
+		/// Gets the link counts of all nodes linked at more than one position.
+		const tree::NodeLinkCounts& sharedLinkCounts() const;
+
+		/// Returns \c true if the node with \a hash is unreachable but has not been collected.
+		bool isUnreachable(const Hash256& hash) const;
+
+		/// Returns \c true if the collector state corresponds to the tree with root hash \a rootHash.
+		bool isTracking(const Hash256& rootHash) const;
+
+	public:
+		/// Starts tracking the tree with root hash \a rootHash and link counts of all nodes linked at more than one position
+		/// (\a sharedLinkCounts).
+		/// \note Nodes that are unreachable but have not been collected are never collected because the tree might have been
+		///       changed without the collector.
+		void reset(const Hash256& rootHash, tree::NodeLinkCounts&& sharedLinkCounts);
+
+		/// Journals the nodes affected by a tree commit (\a committedNodeHashes) with new root hash \a rootHash
+		/// and collects all expired unreachable nodes.
+		/// \note Unreachable nodes are collected in batches of \a collectionDelay generations to amortize compactions.
+		void commit(const tree::CommittedNodeHashes& committedNodeHashes, const Hash256& rootHash);
+
+	private:
+		void load();
+
+		void save(const tree::CommittedNodeHashes& committedNodeHashes, const std::vector<Hash256>& revivedHashes);
+
+		void saveSharedLinkCounts();
+
+		void saveRootHash(const Hash256& rootHash);
+
+		void collect(uint64_t expiryGeneration);
+
+	private:
+		PatriciaTreeContainer& m_container;
+		size_t m_columnId;
+		uint32_t m_collectionDelay;
+
+		uint64_t m_generation;
+		uint64_t m_collectedGeneration;
+		std::unordered_map<Hash256, uint64_t, utils::ArrayHasher<Hash256>> m_unreachableNodeGenerations;
+		tree::NodeLinkCounts m_sharedLinkCounts;
+
+		bool m_hasRootHash;
+		Hash256 m_rootHash;
+	};
+}}
@@ -0,0 +1,113 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "PatriciaTreeNodeCache.h"
+
+namespace catapult { namespace cache {
+
+	namespace {
+		uint64_t EstimateSize(const tree::TreeNode& node) {
+			// each nibble pair of the path is stored in a single byte
+			return sizeof(tree::TreeNode) + Hash256::Size + (node.path().size() + 1) / 2;
+		}
+	}
+
+	PatriciaTreeNodeCache::PatriciaTreeNodeCache(utils::FileSize maxSize)
+			: m_maxSize(maxSize.bytes())
+			, m_size(0)
+			, m_numHits(0)
+			, m_numMisses(0)
+	{}
+
+	bool PatriciaTreeNodeCache::enabled() const {
+		return 0 != m_maxSize;
+	}
+
+	PatriciaTreeNodeCacheStatistics PatriciaTreeNodeCache::statistics() const {
+		utils::SpinLockGuard guard(m_lock);
+		return { m_numHits, m_numMisses, m_entries.size(), utils::FileSize::FromBytes(m_size) };
+	}
+
+	bool PatriciaTreeNodeCache::contains(const Hash256& hash) const {
+		if (!enabled())
+			return false;
+
+		utils::SpinLockGuard guard(m_lock);
+		return m_entries.cend() != m_entries.find(hash);
+	}
+
+	tree::TreeNode PatriciaTreeNodeCache::tryGet(const Hash256& hash) const {
+		if (!enabled())
+			return tree::TreeNode();
+
+		utils::SpinLockGuard guard(m_lock);
+		auto iter = m_entries.find(hash);
+		if (m_entries.cend() == iter) {
+			++m_numMisses;
+			return tree::TreeNode();
+		}
+
+		m_recentHashes.splice(m_recentHashes.begin(), m_recentHashes, iter->second.RecentHashesIter);
+		++m_numHits;
+		return iter->second.Node.copy();
+	}
+
+	void PatriciaTreeNodeCache::add(const tree::TreeNode& node) const {
+		if (node.empty())
+			return;
+
+		auto size = EstimateSize(node);
+		if (size > m_maxSize)
+			return;
+
+		// copy outside of the lock because copying a branch node is relatively expensive
+		auto nodeCopy = node.copy();
+
+		utils::SpinLockGuard guard(m_lock);
+		auto hash = nodeCopy.hash();
+		auto iter = m_entries.find(hash);
+		if (m_entries.end() != iter) {
+			m_recentHashes.splice(m_recentHashes.begin(), m_recentHashes, iter->second.RecentHashesIter);
+			return;
+		}
+
+		m_recentHashes.push_front(hash);
+		m_entries.emplace(hash, Entry{ std::move(nodeCopy), size, m_recentHashes.begin() });
+		m_size += size;
+
+		// evict least recently used nodes
+		while (m_size > m_maxSize)
+			remove(m_entries.find(m_recentHashes.back()));
+	}
+
+	void PatriciaTreeNodeCache::remove(const Hash256& hash) const {
+		utils::SpinLockGuard guard(m_lock);
+		auto iter = m_entries.find(hash);
+		if (m_entries.end() != iter)
+			remove(iter);
+	}
+
+	void PatriciaTreeNodeCache::remove(EntryMap::iterator iter) const {
+		m_size -= iter->second.Size;
+		m_recentHashes.erase(iter->second.RecentHashesIter);
+		m_entries.erase(iter);
+	}
+}}
@@ -0,0 +1,96 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/tree/TreeNode.h"
+#include "catapult/utils/FileSize.h"
+#include "catapult/utils/Hashers.h"
+#include "catapult/utils/SpinLock.h"
+#include <list>
+#include <unordered_map>
+
+namespace catapult { namespace cache {
+
+	/// Patricia tree node cache statistics.
+	struct PatriciaTreeNodeCacheStatistics {
+		/// Number of node loads served from the cache.
+		uint64_t NumHits;
+
+		/// Number of node loads that were not found in the cache.
+		uint64_t NumMisses;
+
+		/// Number of cached nodes.
+		size_t NumNodes;
+
+		/// Estimated size of cached nodes.
+		utils::FileSize Size;
+	};
+
+	/// Bounded cache of decoded patricia tree nodes that evicts least recently used nodes first.
+	/// \note Nodes are keyed by their hashes, so a cached node can never become stale.
+	class PatriciaTreeNodeCache {
+	public:
+		/// Creates a cache that holds at most \a maxSize bytes of nodes.
+		explicit PatriciaTreeNodeCache(utils::FileSize maxSize);
+
+	public:
+		/// Returns \c true if the cache can hold any nodes.
+		bool enabled() const;
+
+		/// Gets the cache statistics.
+		PatriciaTreeNodeCacheStatistics statistics() const;
+
+	public:
+		/// Returns \c true if the node with \a hash is cached.
+		bool contains(const Hash256& hash) const;
+
+		/// Gets a copy of the node with \a hash or an empty node if it is not cached.
+		tree::TreeNode tryGet(const Hash256& hash) const;
+
+		/// Adds a copy of \a node to the cache.
+		void add(const tree::TreeNode& node) const;
+
+		/// Removes the node with \a hash from the cache.
+		void remove(const Hash256& hash) const;
+
+	private:
+		struct Entry {
+			tree::TreeNode Node;
+			uint64_t Size;
+			std::list<Hash256>::iterator RecentHashesIter;
+		};
+
+		using EntryMap = std::unordered_map<Hash256, Entry, utils::ArrayHasher<Hash256>>;
+
+		void remove(EntryMap::iterator iter) const;
+
+	private:
+		uint64_t m_maxSize;
+
+		// nodes are added by (const) data source reads, so all cache state is mutable and protected by m_lock
+		mutable EntryMap m_entries;
+		mutable std::list<Hash256> m_recentHashes; // most recently used hash is first
+		mutable uint64_t m_size;
+		mutable uint64_t m_numHits;
+		mutable uint64_t m_numMisses;
+		mutable utils::SpinLock m_lock;
+	};
+}}
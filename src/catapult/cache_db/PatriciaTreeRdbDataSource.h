@@ -21,6 +21,7 @@
 
 #pragma once
 #include "PatriciaTreeContainer.h"
+#include "PatriciaTreeNodeCache.h"
 #include "catapult/types.h"
 
 namespace catapult { namespace cache {
@@ -28,8 +29,10 @@ namespace catapult { namespace cache {
 	/// Patricia tree rocksdb-based data source.
 	class PatriciaTreeRdbDataSource {
 	public:
-		/// Creates data source around \a container.
-		explicit PatriciaTreeRdbDataSource(PatriciaTreeContainer& container) : m_container(container)
+		/// Creates data source around \a container that caches at most \a nodeCacheSize bytes of decoded nodes.
+		explicit PatriciaTreeRdbDataSource(PatriciaTreeContainer& container, utils::FileSize nodeCacheSize = utils::FileSize())
+				: m_container(container)
+				, m_nodeCache(nodeCacheSize)
 		{}
 
 	public:
@@ -38,16 +41,50 @@ namespace catapult { namespace cache {
 			return m_container.size();
 		}
 
+		/// Gets the node cache statistics.
+		PatriciaTreeNodeCacheStatistics nodeCacheStatistics() const {
+			return m_nodeCache.statistics();
+		}
+
 		/// Gets the tree node associated with \a hash.
 		tree::TreeNode get(const Hash256& hash) const {
+			auto node = m_nodeCache.tryGet(hash);
+			if (!node.empty())
+				return node;
+
 			auto iter = m_container.find(hash);
 			if (m_container.cend() == iter)
 				return tree::TreeNode();
 
+			// only branch nodes are cached because upper branch nodes are visited by every path walk
 			const auto& pair = *iter;
+			if (pair.second.isBranch())
+				m_nodeCache.add(pair.second);
+
 			return pair.second.copy();
 		}
 
+		/// Loads all nodes with \a hashes that are not cached into the node cache with a single batched read.
+		/// \note This is a no-op when the node cache is disabled.
+		void prefetch(const std::vector<Hash256>& hashes) const {
+			if (!m_nodeCache.enabled())
+				return;
+
+			std::vector<Hash256> uncachedHashes;
+			for (const auto& hash : hashes) {
+				if (!m_nodeCache.contains(hash))
+					uncachedHashes.push_back(hash);
+			}
+
+			if (uncachedHashes.empty())
+				return;
+
+			for (const auto& iter : m_container.findAll(uncachedHashes)) {
+				if (m_container.cend() != iter)
+					m_nodeCache.add(iter->second);
+			}
+		}
+
 	public:
 		/// Saves a leaf tree \a node.
 		void set(const tree::LeafTreeNode& node) {
@@ -56,7 +93,13 @@ namespace catapult { namespace cache {
 
 		/// Saves a branch tree \a node.
 		void set(const tree::BranchTreeNode& node) {
-			set(tree::TreeNode(node));
+			// newly saved branch nodes are cached because they are the upper nodes of the most recent tree
+			auto compactedNode = node;
+			compactedNode.compactLinks();
+
+			auto treeNode = tree::TreeNode(compactedNode);
+			set(treeNode);
+			m_nodeCache.add(treeNode);
 		}
 
 	private:
@@ -66,5 +109,6 @@ namespace catapult { namespace cache {
 
 	private:
 		PatriciaTreeContainer& m_container;
+		PatriciaTreeNodeCache m_nodeCache;
 	};
 }}
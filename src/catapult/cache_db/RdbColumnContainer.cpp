@@ -75,6 +75,15 @@ namespace catapult { namespace cache {
 		m_database.get(m_columnId, ToSlice(key), iterator);
 	}
 
+	void RdbColumnContainer::findAll(const std::vector<RawBuffer>& keys, std::vector<RdbDataIterator>& iterators) const {
+		std::vector<rocksdb::Slice> slices;
+		slices.reserve(keys.size());
+		for (const auto& key : keys)
+			slices.push_back(ToSlice(key));
+
+		m_database.getAll(m_columnId, slices, iterators);
+	}
+
 	void RdbColumnContainer::insert(const RawBuffer& key, const std::string& value) {
 		m_database.put(m_columnId, ToSlice(key), value);
 	}
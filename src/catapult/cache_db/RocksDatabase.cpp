@@ -149,17 +149,24 @@ namespace catapult { namespace cache {
 
 	RocksDatabase::RocksDatabase(const RocksDatabaseSettings& settings)
 			: m_settings(settings)
-			, m_pruningFilter(m_settings.PruningMode)
 			, m_pWriteBatch(std::make_unique<rocksdb::WriteBatch>()) {
 		if (m_settings.ColumnFamilyNames.empty())
 			CATAPULT_THROW_INVALID_ARGUMENT("missing column family names");
 
 		config::CatapultDirectory(m_settings.DatabaseDirectory).createAll();
 
-		auto columnFamilyOptions = CreateColumnFamilyOptions(m_settings.DatabaseConfig, m_pruningFilter.compactionFilter());
+		// use a separate filter for each column so that pruning one column does not affect compactions of other columns
 		std::vector<rocksdb::ColumnFamilyDescriptor> columnFamilies;
-		for (const auto& columnFamilyName : m_settings.ColumnFamilyNames)
+		for (const auto& columnFamilyName : m_settings.ColumnFamilyNames) {
+			rocksdb::CompactionFilter* pCompactionFilter = nullptr;
+			if (FilterPruningMode::Enabled == m_settings.PruningMode) {
+				m_pruningFilters.push_back(std::make_unique<RocksPruningFilter>(FilterPruningMode::Enabled));
+				pCompactionFilter = m_pruningFilters.back()->compactionFilter();
+			}
+
+			auto columnFamilyOptions = CreateColumnFamilyOptions(m_settings.DatabaseConfig, pCompactionFilter);
 			columnFamilies.push_back(rocksdb::ColumnFamilyDescriptor(columnFamilyName, columnFamilyOptions));
+		}
 
 		rocksdb::DB* pDb;
 		auto dbOptions = CreateDatabaseOptions(m_settings.DatabaseConfig);
@@ -182,6 +189,10 @@ namespace catapult { namespace cache {
 		return FilterPruningMode::Enabled == m_settings.PruningMode;
 	}
 
+	const config::NodeConfiguration::CacheDatabaseSubConfiguration& RocksDatabase::config() const {
+		return m_settings.DatabaseConfig;
+	}
+
 	namespace {
 		[[noreturn]]
 		void ThrowError(const std::string& message, const std::string& columnName, const rocksdb::Slice& key) {
@@ -207,6 +218,36 @@ namespace catapult { namespace cache {
 			CATAPULT_THROW_DB_KEY_ERROR("could not retrieve value");
 	}
 
+	void RocksDatabase::getAll(size_t columnId, const std::vector<rocksdb::Slice>& keys, std::vector<RdbDataIterator>& results) {
+		if (!m_pDb)
+			CATAPULT_THROW_INVALID_ARGUMENT("RocksDatabase has not been initialized");
+
+		std::vector<std::string> values;
+		std::vector<rocksdb::ColumnFamilyHandle*> handles(keys.size(), m_handles[columnId]);
+		auto statuses = m_pDb->MultiGet(rocksdb::ReadOptions(), handles, keys, &values);
+
+		results.clear();
+		results.resize(keys.size());
+		for (auto i = 0u; i < keys.size(); ++i) {
+			const auto& status = statuses[i];
+			auto& result = results[i];
+			result.setFound(status.ok());
+
+			if (status.ok()) {
+				// move the value into the pinnable slice to avoid copying it
+				*result.storage().GetSelf() = std::move(values[i]);
+				result.storage().PinSelf();
+				continue;
+			}
+
+			// note: this is intentional, in case of not found status will be set via `setFound` above
+			if (!status.IsNotFound()) {
+				const auto& key = keys[i];
+				CATAPULT_THROW_DB_KEY_ERROR("could not retrieve value");
+			}
+		}
+	}
+
 	void RocksDatabase::put(size_t columnId, const rocksdb::Slice& key, const std::string& value) {
 		if (!m_pDb)
 			CATAPULT_THROW_INVALID_ARGUMENT("RocksDatabase has not been initialized");
@@ -232,12 +273,26 @@ namespace catapult { namespace cache {
 	}
 
 	size_t RocksDatabase::prune(size_t columnId, uint64_t boundary) {
-		if (!m_pruningFilter.compactionFilter())
+		if (m_pruningFilters.empty())
 			return 0;
 
-		m_pruningFilter.setPruningBoundary(boundary);
+		auto& pruningFilter = *m_pruningFilters[columnId];
+		pruningFilter.setPruningBoundary(boundary);
 		m_pDb->CompactRange({}, m_handles[columnId], nullptr, nullptr);
-		return m_pruningFilter.numRemoved();
+		return pruningFilter.numRemoved();
+	}
+
+	RocksPruningStatistics RocksDatabase::prune(size_t columnId, std::unordered_set<std::string>&& keys) {
+		if (m_pruningFilters.empty() || keys.empty())
+			return RocksPruningStatistics();
+
+		auto& pruningFilter = *m_pruningFilters[columnId];
+		pruningFilter.setExpiredKeys(std::move(keys));
+		m_pDb->CompactRange({}, m_handles[columnId], nullptr, nullptr);
+
+		RocksPruningStatistics statistics{ pruningFilter.numRemoved(), pruningFilter.numRemovedBytes() };
+		pruningFilter.setExpiredKeys({});
+		return statistics;
 	}
 
 	void RocksDatabase::flush() {
@@ -26,6 +26,7 @@
 #include "catapult/types.h"
 #include <memory>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 namespace rocksdb {
@@ -149,10 +150,16 @@ namespace catapult { namespace cache {
 		/// Returns \c true if pruning is enabled.
 		bool canPrune() const;
 
+		/// Gets the database configuration.
+		const config::NodeConfiguration::CacheDatabaseSubConfiguration& config() const;
+
 	public:
 		/// Gets the value associated with \a key from \a columnId and sets \a result.
 		void get(size_t columnId, const rocksdb::Slice& key, RdbDataIterator& result);
 
+		/// Gets the values associated with \a keys from \a columnId in a single batch and sets \a results.
+		void getAll(size_t columnId, const std::vector<rocksdb::Slice>& keys, std::vector<RdbDataIterator>& results);
+
 		/// Puts the \a value associated with \a key in \a columnId.
 		void put(size_t columnId, const rocksdb::Slice& key, const std::string& value);
 
@@ -162,6 +169,9 @@ namespace catapult { namespace cache {
 		/// Prunes elements from \a columnId below \a boundary. Returns number of pruned elements.
 		size_t prune(size_t columnId, uint64_t boundary);
 
+		/// Prunes elements with \a keys from \a columnId irrespective of any boundary. Returns pruning statistics.
+		RocksPruningStatistics prune(size_t columnId, std::unordered_set<std::string>&& keys);
+
 		/// Finalize batched operations.
 		void flush();
 
@@ -170,7 +180,7 @@ namespace catapult { namespace cache {
 
 	private:
 		const RocksDatabaseSettings m_settings;
-		RocksPruningFilter m_pruningFilter;
+		std::vector<std::unique_ptr<RocksPruningFilter>> m_pruningFilters; // one filter per column, empty when pruning is disabled
 		std::unique_ptr<rocksdb::WriteBatch> m_pWriteBatch;
 
 		std::unique_ptr<rocksdb::DB> m_pDb;
@@ -22,6 +22,9 @@
 #include "RocksPruningFilter.h"
 #include "RocksInclude.h"
 #include <cstring>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
 
 namespace catapult { namespace cache {
 
@@ -30,6 +33,8 @@ namespace catapult { namespace cache {
 		RocksPruningFilterImpl()
 				: m_compactionBoundary(0)
 				, m_numRemoved(0)
+				, m_numRemovedBytes(0)
+				, m_hasExpiredKeys(false)
 		{}
 
 	public:
@@ -38,18 +43,23 @@ namespace catapult { namespace cache {
 		}
 
 		// must be thread-safe if compaction_filter is used
-		bool Filter(int, const rocksdb::Slice& key, const rocksdb::Slice&, std::string*, bool*) const override {
+		bool Filter(int, const rocksdb::Slice& key, const rocksdb::Slice& value, std::string*, bool*) const override {
+			if (isExpired(key)) {
+				markRemoved(key, value);
+				return true;
+			}
+
 			// 1. assume that key is prepended by filter uint64_t (do not assume specific key type to allow maximum reusability)
 			// 2. skip keys too small to contain filter value (e.g. special 'size' key)
 			if (key.size() < Special_Key_Max_Length)
 				return false;
 
 			// due to short std::string optimization, std::string data is not guaranteed to be aligned
-			uint64_t value;
-			std::memcpy(&value, key.data(), sizeof(uint64_t));
+			uint64_t keyBoundary;
+			std::memcpy(&keyBoundary, key.data(), sizeof(uint64_t));
 
-			if (value < m_compactionBoundary) {
-				++m_numRemoved;
+			if (keyBoundary < m_compactionBoundary) {
+				markRemoved(key, value);
 				return true;
 			}
 
@@ -69,15 +79,62 @@ namespace catapult { namespace cache {
 			return m_numRemoved.load();
 		}
 
+		uint64_t numRemovedBytes() const {
+			return m_numRemovedBytes.load();
+		}
+
 	public:
 		void setPruningBoundary(uint64_t compactionBoundary) {
 			m_compactionBoundary = compactionBoundary;
+			resetCounters();
+		}
+
+		void setExpiredKeys(std::unordered_set<std::string>&& expiredKeys) {
+			// index views of the (node based and stable) owned keys so that lookups do not need to allocate strings
+			std::unordered_set<std::string_view> expiredKeyViews(expiredKeys.size());
+			for (const auto& expiredKey : expiredKeys)
+				expiredKeyViews.insert(expiredKey);
+
+			{
+				std::unique_lock<std::shared_mutex> guard(m_expiredKeysMutex);
+				m_expiredKeys = std::move(expiredKeys);
+				m_expiredKeyViews = std::move(expiredKeyViews);
+				m_hasExpiredKeys = !m_expiredKeys.empty();
+			}
+
+			resetCounters();
+		}
+
+	private:
+		bool isExpired(const rocksdb::Slice& key) const {
+			// avoid locking when there are no expired keys, which is the common case
+			if (!m_hasExpiredKeys)
+				return false;
+
+			// compaction threads only read, so they can look up keys concurrently
+			std::shared_lock<std::shared_mutex> guard(m_expiredKeysMutex);
+			return m_expiredKeyViews.cend() != m_expiredKeyViews.find(std::string_view(key.data(), key.size()));
+		}
+
+		void markRemoved(const rocksdb::Slice& key, const rocksdb::Slice& value) const {
+			++m_numRemoved;
+			m_numRemovedBytes += key.size() + value.size();
+		}
+
+		void resetCounters() {
 			m_numRemoved = 0;
+			m_numRemovedBytes = 0;
 		}
 
 	private:
 		std::atomic<uint64_t> m_compactionBoundary;
 		mutable std::atomic<size_t> m_numRemoved;
+		mutable std::atomic<uint64_t> m_numRemovedBytes;
+
+		std::atomic<bool> m_hasExpiredKeys;
+		std::unordered_set<std::string> m_expiredKeys;
+		std::unordered_set<std::string_view> m_expiredKeyViews;
+		mutable std::shared_mutex m_expiredKeysMutex;
 	};
 
 	RocksPruningFilter::RocksPruningFilter(FilterPruningMode mode) {
@@ -99,8 +156,17 @@ namespace catapult { namespace cache {
 		return m_pImpl ? m_pImpl->numRemoved() : 0;
 	}
 
+	uint64_t RocksPruningFilter::numRemovedBytes() const {
+		return m_pImpl ? m_pImpl->numRemovedBytes() : 0;
+	}
+
 	void RocksPruningFilter::setPruningBoundary(uint64_t compactionBoundary) {
 		if (m_pImpl)
 			m_pImpl->setPruningBoundary(compactionBoundary);
 	}
+
+	void RocksPruningFilter::setExpiredKeys(std::unordered_set<std::string>&& expiredKeys) {
+		if (m_pImpl)
+			m_pImpl->setExpiredKeys(std::move(expiredKeys));
+	}
 }}
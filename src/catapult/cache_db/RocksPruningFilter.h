@@ -21,6 +21,8 @@
 
 #pragma once
 #include <memory>
+#include <string>
+#include <unordered_set>
 
 namespace rocksdb { class CompactionFilter; }
 
@@ -35,6 +37,15 @@ namespace catapult { namespace cache {
 		Enabled
 	};
 
+	/// Rocks pruning statistics.
+	struct RocksPruningStatistics {
+		/// Number of pruned entries.
+		size_t NumRemoved;
+
+		/// Total size of keys and values of pruned entries.
+		uint64_t NumRemovedBytes;
+	};
+
 	/// Rocks pruning filter.
 	class RocksPruningFilter final {
 	public:
@@ -54,10 +65,16 @@ namespace catapult { namespace cache {
 		/// Gets the number of pruned entries since last prune.
 		size_t numRemoved() const;
 
+		/// Gets the total size of keys and values of pruned entries since last prune.
+		uint64_t numRemovedBytes() const;
+
 	public:
 		/// Sets the pruning boundary.
 		void setPruningBoundary(uint64_t pruningBoundary);
 
+		/// Sets the keys (\a expiredKeys) that should be pruned irrespective of the pruning boundary.
+		void setExpiredKeys(std::unordered_set<std::string>&& expiredKeys);
+
 	private:
 		class RocksPruningFilterImpl;
 		std::unique_ptr<RocksPruningFilterImpl> m_pImpl;
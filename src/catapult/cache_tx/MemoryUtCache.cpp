@@ -48,15 +48,40 @@ namespace catapult { namespace cache {
 		size_t Id;
 	};
 
+	struct TransactionFeeIndexEntry {
+	public:
+		TransactionFeeIndexEntry(BlockFeeMultiplier maxFeeMultiplier, size_t id, const TransactionData* pTransactionData = nullptr)
+				: MaxFeeMultiplier(maxFeeMultiplier)
+				, Id(id)
+				, pData(pTransactionData)
+		{}
+
+		explicit TransactionFeeIndexEntry(const TransactionData& data)
+				: TransactionFeeIndexEntry(model::CalculateTransactionMaxFeeMultiplier(*data.pEntity), data.Id, &data)
+		{}
+
+	public:
+		bool operator<(const TransactionFeeIndexEntry& rhs) const {
+			return MaxFeeMultiplier != rhs.MaxFeeMultiplier ? MaxFeeMultiplier < rhs.MaxFeeMultiplier : Id < rhs.Id;
+		}
+
+	public:
+		BlockFeeMultiplier MaxFeeMultiplier;
+		size_t Id;
+		const TransactionData* pData;
+	};
+
 	// region MemoryUtCacheView
 
 	MemoryUtCacheView::MemoryUtCacheView(
 			uint64_t maxResponseSize,
 			const TransactionDataContainer& transactionDataContainer,
+			const TransactionFeeIndex& feeIndex,
 			const IdLookup& idLookup,
 			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
 			: m_maxResponseSize(maxResponseSize)
 			, m_transactionDataContainer(transactionDataContainer)
+			, m_feeIndex(feeIndex)
 			, m_idLookup(idLookup)
 			, m_readLock(std::move(readLock))
 	{}
@@ -76,6 +101,30 @@ namespace catapult { namespace cache {
 		}
 	}
 
+	void MemoryUtCacheView::forEach(FeeMultiplierOrder order, const TransactionInfoConsumer& consumer) const {
+		if (FeeMultiplierOrder::Ascending == order) {
+			for (const auto& entry : m_feeIndex) {
+				if (!consumer(*entry.pData))
+					return;
+			}
+
+			return;
+		}
+
+		// visit groups of equal max fee multipliers from highest to lowest but visit each group from oldest to newest
+		// (ids start at one, so zero id is always before the first entry in a group)
+		auto groupEnd = m_feeIndex.cend();
+		while (m_feeIndex.cbegin() != groupEnd) {
+			auto groupBegin = m_feeIndex.lower_bound(TransactionFeeIndexEntry(std::prev(groupEnd)->MaxFeeMultiplier, 0));
+			for (auto iter = groupBegin; groupEnd != iter; ++iter) {
+				if (!consumer(*iter->pData))
+					return;
+			}
+
+			groupEnd = groupBegin;
+		}
+	}
+
 	model::ShortHashRange MemoryUtCacheView::shortHashes() const {
 		auto shortHashes = model::EntityRange<utils::ShortHash>::PrepareFixed(m_transactionDataContainer.size());
 		auto shortHashesIter = shortHashes.begin();
@@ -123,12 +172,14 @@ namespace catapult { namespace cache {
 					uint64_t maxCacheSize,
 					size_t& idSequence,
 					TransactionDataContainer& transactionDataContainer,
+					TransactionFeeIndex& feeIndex,
 					IdLookup& idLookup,
 					AccountCounters& counters,
 					utils::SpinReaderWriterLock::WriterLockGuard&& writeLock)
 					: m_maxCacheSize(maxCacheSize)
 					, m_idSequence(idSequence)
 					, m_transactionDataContainer(transactionDataContainer)
+					, m_feeIndex(feeIndex)
 					, m_idLookup(idLookup)
 					, m_counters(counters)
 					, m_writeLock(std::move(writeLock))
@@ -147,7 +198,8 @@ namespace catapult { namespace cache {
 					return false;
 
 				m_idLookup.emplace(transactionInfo.EntityHash, ++m_idSequence);
-				m_transactionDataContainer.emplace(transactionInfo, m_idSequence);
+				auto dataIter = m_transactionDataContainer.emplace(transactionInfo, m_idSequence).first;
+				m_feeIndex.emplace(*dataIter);
 
 				m_counters.increment(transactionInfo.pEntity->SignerPublicKey);
 
@@ -165,6 +217,7 @@ namespace catapult { namespace cache {
 
 				m_counters.decrement(dataIter->pEntity->SignerPublicKey);
 
+				m_feeIndex.erase(TransactionFeeIndexEntry(*dataIter));
 				m_transactionDataContainer.erase(dataIter);
 				m_idLookup.erase(iter);
 				return erasedInfo;
@@ -186,6 +239,7 @@ namespace catapult { namespace cache {
 					transactionInfosCopy.emplace_back(data.copy());
 
 				m_transactionDataContainer.clear();
+				m_feeIndex.clear();
 				m_idLookup.clear();
 				m_counters.reset();
 				return transactionInfosCopy;
@@ -195,6 +249,7 @@ namespace catapult { namespace cache {
 			uint64_t m_maxCacheSize;
 			size_t& m_idSequence;
 			TransactionDataContainer& m_transactionDataContainer;
+			TransactionFeeIndex& m_feeIndex;
 			IdLookup& m_idLookup;
 			AccountCounters& m_counters;
 			utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
@@ -207,6 +262,7 @@ namespace catapult { namespace cache {
 
 	struct MemoryUtCache::Impl {
 		cache::TransactionDataContainer TransactionDataContainer;
+		cache::TransactionFeeIndex FeeIndex;
 		std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>> IdLookup;
 		AccountCounters Counters;
 	};
@@ -221,7 +277,12 @@ namespace catapult { namespace cache {
 
 	MemoryUtCacheView MemoryUtCache::view() const {
 		auto readLock = m_lock.acquireReader();
-		return MemoryUtCacheView(m_options.MaxResponseSize, m_pImpl->TransactionDataContainer, m_pImpl->IdLookup, std::move(readLock));
+		return MemoryUtCacheView(
+				m_options.MaxResponseSize,
+				m_pImpl->TransactionDataContainer,
+				m_pImpl->FeeIndex,
+				m_pImpl->IdLookup,
+				std::move(readLock));
 	}
 
 	UtCacheModifierProxy MemoryUtCache::modifier() {
@@ -230,6 +291,7 @@ namespace catapult { namespace cache {
 				m_options.MaxCacheSize,
 				m_idSequence,
 				m_pImpl->TransactionDataContainer,
+				m_pImpl->FeeIndex,
 				m_pImpl->IdLookup,
 				m_pImpl->Counters,
 				std::move(writeLock)));
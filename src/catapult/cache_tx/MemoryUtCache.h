@@ -29,7 +29,12 @@
 #include <set>
 #include <unordered_map>
 
-namespace catapult { namespace cache { struct TransactionData; } }
+namespace catapult {
+	namespace cache {
+		struct TransactionData;
+		struct TransactionFeeIndexEntry;
+	}
+}
 
 namespace catapult { namespace cache {
 
@@ -37,6 +42,19 @@ namespace catapult { namespace cache {
 	/// \note std::set is used to allow incomplete type.
 	using TransactionDataContainer = std::set<TransactionData>;
 
+	/// Internal secondary index of TransactionDataContainer ordered by max fee multiplier.
+	/// \note std::set is used to allow incomplete type.
+	using TransactionFeeIndex = std::set<TransactionFeeIndexEntry>;
+
+	/// Order of iteration by max fee multiplier.
+	enum class FeeMultiplierOrder {
+		/// Lowest max fee multiplier first.
+		Ascending,
+
+		/// Highest max fee multiplier first.
+		Descending
+	};
+
 	/// Read only view on top of unconfirmed transactions cache.
 	class MemoryUtCacheView {
 	private:
@@ -46,10 +64,11 @@ namespace catapult { namespace cache {
 
 	public:
 		/// Creates a view around a maximum response size (\a maxResponseSize), a transaction data container
-		/// (\a transactionDataContainer) and an id lookup (\a idLookup) with lock context \a readLock.
+		/// (\a transactionDataContainer), a fee index (\a feeIndex) and an id lookup (\a idLookup) with lock context \a readLock.
 		MemoryUtCacheView(
 				uint64_t maxResponseSize,
 				const TransactionDataContainer& transactionDataContainer,
+				const TransactionFeeIndex& feeIndex,
 				const IdLookup& idLookup,
 				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock);
 
@@ -63,6 +82,11 @@ namespace catapult { namespace cache {
 		/// Calls \a consumer with all transaction infos until all are consumed or \c false is returned by consumer.
 		void forEach(const TransactionInfoConsumer& consumer) const;
 
+		/// Calls \a consumer with all transaction infos in max fee multiplier \a order until all are consumed
+		/// or \c false is returned by consumer.
+		/// \note Transaction infos with equal max fee multipliers are always consumed from oldest to newest.
+		void forEach(FeeMultiplierOrder order, const TransactionInfoConsumer& consumer) const;
+
 		/// Gets a range of short hashes of all transactions in the cache.
 		/// \note Each short hash consists of the first 4 bytes of the complete hash.
 		model::ShortHashRange shortHashes() const;
@@ -74,6 +98,7 @@ namespace catapult { namespace cache {
 	private:
 		uint64_t m_maxResponseSize;
 		const TransactionDataContainer& m_transactionDataContainer;
+		const TransactionFeeIndex& m_feeIndex;
 		const IdLookup& m_idLookup;
 		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
 	};
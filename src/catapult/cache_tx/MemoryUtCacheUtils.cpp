@@ -30,32 +30,47 @@ namespace catapult { namespace cache {
 		return GetFirstTransactionInfoPointers(utCacheView, transactionLimit, countRetriever, [](const auto&) { return true; });
 	}
 
-	std::vector<const model::TransactionInfo*> GetFirstTransactionInfoPointers(
-			const MemoryUtCacheView& utCacheView,
-			uint32_t transactionLimit,
-			const EmbeddedCountRetriever& countRetriever,
-			const predicate<const model::TransactionInfo&>& filter) {
-		std::vector<const model::TransactionInfo*> transactionInfoPointers;
-		transactionInfoPointers.reserve(std::min<size_t>(utCacheView.size(), transactionLimit));
+	namespace {
+		template<typename TForEach>
+		std::vector<const model::TransactionInfo*> GetFirstTransactionInfoPointers(
+				size_t utCacheSize,
+				uint32_t transactionLimit,
+				const EmbeddedCountRetriever& countRetriever,
+				const predicate<const model::TransactionInfo&>& filter,
+				TForEach forEach) {
+			std::vector<const model::TransactionInfo*> transactionInfoPointers;
+			transactionInfoPointers.reserve(std::min<size_t>(utCacheSize, transactionLimit));
 
-		if (0 != transactionLimit) {
-			uint32_t totalTransactionsCount = 0;
-			utCacheView.forEach([transactionLimit, countRetriever, filter, &transactionInfoPointers, &totalTransactionsCount](
-					const auto& transactionInfo) {
-				auto currentTransactionsCount = countRetriever(*transactionInfo.pEntity);
-				if (totalTransactionsCount + currentTransactionsCount > transactionLimit)
-					return false;
+			if (0 != transactionLimit) {
+				uint32_t totalTransactionsCount = 0;
+				forEach([transactionLimit, &countRetriever, &filter, &transactionInfoPointers, &totalTransactionsCount](
+						const auto& transactionInfo) {
+					auto currentTransactionsCount = countRetriever(*transactionInfo.pEntity);
+					if (totalTransactionsCount + currentTransactionsCount > transactionLimit)
+						return false;
 
-				if (filter(transactionInfo)) {
-					totalTransactionsCount += currentTransactionsCount;
-					transactionInfoPointers.push_back(&transactionInfo);
-				}
+					if (filter(transactionInfo)) {
+						totalTransactionsCount += currentTransactionsCount;
+						transactionInfoPointers.push_back(&transactionInfo);
+					}
 
-				return true;
-			});
+					return true;
+				});
+			}
+
+			return transactionInfoPointers;
 		}
+	}
 
-		return transactionInfoPointers;
+	std::vector<const model::TransactionInfo*> GetFirstTransactionInfoPointers(
+			const MemoryUtCacheView& utCacheView,
+			uint32_t transactionLimit,
+			const EmbeddedCountRetriever& countRetriever,
+			const predicate<const model::TransactionInfo&>& filter) {
+		return GetFirstTransactionInfoPointers(utCacheView.size(), transactionLimit, countRetriever, filter, [&utCacheView](
+				const auto& consumer) {
+			utCacheView.forEach(consumer);
+		});
 	}
 
 	std::vector<const model::TransactionInfo*> GetFirstTransactionInfoPointers(
@@ -92,4 +107,16 @@ namespace catapult { namespace cache {
 
 		return candidateTransactionInfoPointers;
 	}
+
+	std::vector<const model::TransactionInfo*> GetFirstTransactionInfoPointers(
+			const MemoryUtCacheView& utCacheView,
+			uint32_t transactionLimit,
+			const EmbeddedCountRetriever& countRetriever,
+			FeeMultiplierOrder order,
+			const predicate<const model::TransactionInfo&>& filter) {
+		return GetFirstTransactionInfoPointers(utCacheView.size(), transactionLimit, countRetriever, filter, [&utCacheView, order](
+				const auto& consumer) {
+			utCacheView.forEach(order, consumer);
+		});
+	}
 }}
@@ -53,4 +53,15 @@ namespace catapult { namespace cache {
 			const EmbeddedCountRetriever& countRetriever,
 			const predicate<const model::TransactionInfo*, const model::TransactionInfo*>& sortComparer,
 			const predicate<const model::TransactionInfo&>& filter);
+
+	/// Gets the pointers to the first \a transactionLimit transaction infos in \a utCacheView that pass \a filter in max fee multiplier
+	/// \a order where \a countRetriever returns the total number of transactions contained within a top-level transaction.
+	/// \note Pointers are only safe to access during the lifetime of \a utCacheView.
+	/// \note Only visited transaction infos are accessed, so this does not depend on the total number of transaction infos.
+	std::vector<const model::TransactionInfo*> GetFirstTransactionInfoPointers(
+			const MemoryUtCacheView& utCacheView,
+			uint32_t transactionLimit,
+			const EmbeddedCountRetriever& countRetriever,
+			FeeMultiplierOrder order,
+			const predicate<const model::TransactionInfo&>& filter);
 }}
@@ -20,9 +20,12 @@
 **/
 
 #include "BatchEntityProcessor.h"
+#include "NotificationKeyAccess.h"
 #include "ProcessContextsBuilder.h"
 #include "ProcessingNotificationSubscriber.h"
 #include "catapult/cache/CatapultCache.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 
 using namespace catapult::validators;
 
@@ -61,9 +64,217 @@ namespace catapult { namespace chain {
 		private:
 			ExecutionConfiguration m_config;
 		};
+
+		// region speculation
+
+		struct SpeculationRecord {
+		public:
+			SpeculationRecord(model::NotificationType type, NotificationKeyAccess&& access)
+					: Type(type)
+					, Access(std::move(access))
+					, IsSpeculated(false)
+					, Result(ValidationResult::Success)
+			{}
+
+		public:
+			model::NotificationType Type;
+			NotificationKeyAccess Access;
+			bool IsSpeculated;
+			ValidationResult Result;
+		};
+
+		using SpeculationRecords = std::vector<SpeculationRecord>;
+
+		class SpeculatingNotificationSubscriber : public model::NotificationSubscriber {
+		public:
+			SpeculatingNotificationSubscriber(
+					const stateful::NotificationValidator& validator,
+					const ValidatorContext& validatorContext,
+					SpeculationRecords& records)
+					: m_validator(validator)
+					, m_validatorContext(validatorContext)
+					, m_records(records)
+			{}
+
+		public:
+			void notify(const model::Notification& notification) override {
+				SpeculationRecord record(notification.Type, CollectNotificationKeyAccess(notification, m_validatorContext));
+
+				// notifications with unknown state access are always validated serially
+				if (!record.Access.IsGlobal && IsSet(notification.Type, model::NotificationChannel::Validator)) {
+					record.Result = m_validator.validate(notification, m_validatorContext);
+					record.IsSpeculated = true;
+				}
+
+				m_records.push_back(std::move(record));
+			}
+
+		private:
+			const stateful::NotificationValidator& m_validator;
+			const ValidatorContext& m_validatorContext;
+			SpeculationRecords& m_records;
+		};
+
+		// endregion
+
+		// region replay
+
+		class SpeculativeNotificationValidator : public stateful::NotificationValidator {
+		public:
+			SpeculativeNotificationValidator(const stateful::NotificationValidator& validator, const ModifiedStateKeys& modifiedKeys)
+					: m_validator(validator)
+					, m_modifiedKeys(modifiedKeys)
+					, m_pRecord(nullptr)
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_validator.name();
+			}
+
+			ValidationResult validate(const model::Notification& notification, const ValidatorContext& context) const override {
+				if (m_pRecord && m_pRecord->IsSpeculated && !m_modifiedKeys.conflicts(m_pRecord->Access))
+					return m_pRecord->Result;
+
+				return m_validator.validate(notification, context);
+			}
+
+		public:
+			void setRecord(const SpeculationRecord* pRecord) {
+				m_pRecord = pRecord;
+			}
+
+		private:
+			const stateful::NotificationValidator& m_validator;
+			const ModifiedStateKeys& m_modifiedKeys;
+			const SpeculationRecord* m_pRecord;
+		};
+
+		class ReplayingNotificationSubscriber : public model::NotificationSubscriber {
+		public:
+			ReplayingNotificationSubscriber(
+					model::NotificationSubscriber& subscriber,
+					SpeculativeNotificationValidator& validator,
+					ModifiedStateKeys& modifiedKeys)
+					: m_subscriber(subscriber)
+					, m_validator(validator)
+					, m_modifiedKeys(modifiedKeys)
+					, m_pRecords(nullptr)
+					, m_nextIndex(0)
+			{}
+
+		public:
+			void setRecords(const SpeculationRecords& records) {
+				m_pRecords = &records;
+				m_nextIndex = 0;
+			}
+
+			void notify(const model::Notification& notification) override {
+				const auto* pRecord = nextRecord(notification.Type);
+				m_validator.setRecord(pRecord);
+				m_subscriber.notify(notification);
+
+				if (pRecord)
+					m_modifiedKeys.add(pRecord->Access);
+				else
+					m_modifiedKeys.markGlobal();
+			}
+
+		private:
+			const SpeculationRecord* nextRecord(model::NotificationType type) {
+				auto index = m_nextIndex++;
+				if (!m_pRecords || index >= m_pRecords->size())
+					return nullptr;
+
+				const auto& record = (*m_pRecords)[index];
+				return type == record.Type ? &record : nullptr;
+			}
+
+		private:
+			model::NotificationSubscriber& m_subscriber;
+			SpeculativeNotificationValidator& m_validator;
+			ModifiedStateKeys& m_modifiedKeys;
+			const SpeculationRecords* m_pRecords;
+			size_t m_nextIndex;
+		};
+
+		// endregion
+
+		class ParallelBatchEntityProcessor {
+		public:
+			ParallelBatchEntityProcessor(const ExecutionConfiguration& config, thread::IoThreadPool& pool)
+					: m_config(config)
+					, m_pool(pool)
+			{}
+
+		public:
+			ValidationResult operator()(
+					Height height,
+					Timestamp timestamp,
+					const model::WeakEntityInfos& entityInfos,
+					observers::ObserverState& state) const {
+				if (entityInfos.empty())
+					return ValidationResult::Neutral;
+
+				ProcessContextsBuilder contextBuilder(height, timestamp, m_config);
+				contextBuilder.setObserverState(state); // this uses contents of ObserverState to initialize the builder
+				auto validatorContext = contextBuilder.buildValidatorContext();
+				auto observerContext = contextBuilder.buildObserverContext();
+
+				// 1. validate all entities against the initial state in parallel
+				auto speculationRecordsGroups = speculate(entityInfos, validatorContext);
+
+				// 2. observe all entities serially and only revalidate notifications that read state modified by preceding observers
+				ModifiedStateKeys modifiedKeys;
+				SpeculativeNotificationValidator validator(*m_config.pValidator, modifiedKeys);
+				ProcessingNotificationSubscriber processingSub(validator, validatorContext, *m_config.pObserver, observerContext);
+				ReplayingNotificationSubscriber sub(processingSub, validator, modifiedKeys);
+				for (auto i = 0u; i < entityInfos.size(); ++i) {
+					sub.setRecords(speculationRecordsGroups[i]);
+					m_config.pNotificationPublisher->publish(entityInfos[i], sub);
+					if (!IsValidationResultSuccess(processingSub.result()))
+						return processingSub.result();
+				}
+
+				return ValidationResult::Success;
+			}
+
+		private:
+			std::vector<SpeculationRecords> speculate(
+					const model::WeakEntityInfos& entityInfos,
+					const ValidatorContext& validatorContext) const {
+				std::vector<SpeculationRecords> speculationRecordsGroups(entityInfos.size());
+				if (entityInfos.size() < 2)
+					return speculationRecordsGroups;
+
+				auto speculateEntity = [this, &validatorContext, &speculationRecordsGroups](const auto& entityInfo, auto index) {
+					auto& records = speculationRecordsGroups[index];
+					try {
+						SpeculatingNotificationSubscriber sub(*m_config.pValidator, validatorContext, records);
+						m_config.pNotificationPublisher->publish(entityInfo, sub);
+					} catch (...) {
+						// speculation is best effort, so fall back to serial validation, which will raise the same error
+						records.clear();
+					}
+
+					return true;
+				};
+
+				thread::ParallelFor(m_pool.ioContext(), entityInfos, m_pool.numWorkerThreads(), speculateEntity).get();
+				return speculationRecordsGroups;
+			}
+
+		private:
+			ExecutionConfiguration m_config;
+			thread::IoThreadPool& m_pool;
+		};
 	}
 
 	BatchEntityProcessor CreateBatchEntityProcessor(const ExecutionConfiguration& config) {
 		return DefaultBatchEntityProcessor(config);
 	}
+
+	BatchEntityProcessor CreateParallelBatchEntityProcessor(const ExecutionConfiguration& config, thread::IoThreadPool& pool) {
+		return ParallelBatchEntityProcessor(config, pool);
+	}
 }}
@@ -22,6 +22,10 @@
 #pragma once
 #include "ExecutionConfiguration.h"
 
+namespace catapult {
+	namespace thread { class IoThreadPool; }
+}
+
 namespace catapult { namespace chain {
 
 	/// Function signature for validating and executing a batch of entity infos with a shared height and time and updating
@@ -34,4 +38,10 @@ namespace catapult { namespace chain {
 
 	/// Creates a batch entity processor around \a config.
 	BatchEntityProcessor CreateBatchEntityProcessor(const ExecutionConfiguration& config);
+
+	/// Creates a batch entity processor around \a config that speculatively validates entities in parallel using \a pool.
+	/// \note Observers are always executed serially and speculative validation results are discarded whenever a preceding
+	///       observer could have modified any state read by the validation, so the processing results are identical to
+	///       the ones of the processor returned by CreateBatchEntityProcessor.
+	BatchEntityProcessor CreateParallelBatchEntityProcessor(const ExecutionConfiguration& config, thread::IoThreadPool& pool);
 }}
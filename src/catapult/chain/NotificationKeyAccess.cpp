@@ -0,0 +1,334 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "NotificationKeyAccess.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/model/Address.h"
+#include "catapult/utils/Casting.h"
+
+namespace catapult { namespace chain {
+
+	namespace {
+		enum class StateKeyTag : uint8_t { Account, Balance, Any_Balance, Activity, Mosaic, Transaction_Hash };
+
+		// region StateKeyBuilder
+
+		class StateKeyBuilder {
+		private:
+			static constexpr uint64_t Fnv1a_Offset_Basis = 0xCBF2'9CE4'8422'2325;
+			static constexpr uint64_t Fnv1a_Prime = 0x0000'0100'0000'01B3;
+
+		public:
+			explicit StateKeyBuilder(StateKeyTag tag) : m_key(Fnv1a_Offset_Basis) {
+				append(utils::to_underlying_type(tag));
+			}
+
+		public:
+			template<typename TValue>
+			StateKeyBuilder& operator<<(const TValue& value) {
+				const auto* pData = reinterpret_cast<const uint8_t*>(&value);
+				for (auto i = 0u; i < sizeof(TValue); ++i)
+					append(pData[i]);
+
+				return *this;
+			}
+
+			StateKey key() const {
+				return m_key;
+			}
+
+		private:
+			void append(uint8_t byte) {
+				m_key = (m_key ^ byte) * Fnv1a_Prime;
+			}
+
+		private:
+			StateKey m_key;
+		};
+
+		// endregion
+
+		// region KeyAccessBuilder
+
+		class KeyAccessBuilder {
+		public:
+			KeyAccessBuilder(NotificationKeyAccess& keyAccess, const validators::ValidatorContext& context)
+					: m_keyAccess(keyAccess)
+					, m_context(context)
+			{}
+
+		public:
+			const model::ResolverContext& resolvers() const {
+				return m_context.Resolvers;
+			}
+
+		public:
+			void readAccount(const Address& address) {
+				m_keyAccess.ReadKeys.push_back((StateKeyBuilder(StateKeyTag::Account) << address).key());
+			}
+
+			void registerAccount(const Address& address, bool isKnown) {
+				readAccount(address);
+
+				// account registration only modifies state when the account (or its public key) is not yet known
+				if (!isKnown)
+					m_keyAccess.WriteKeys.push_back((StateKeyBuilder(StateKeyTag::Account) << address).key());
+			}
+
+			void readBalance(const Address& address, MosaicId mosaicId) {
+				m_keyAccess.ReadKeys.push_back((StateKeyBuilder(StateKeyTag::Balance) << address << mosaicId).key());
+			}
+
+			void readAllBalances(const Address& address) {
+				m_keyAccess.ReadKeys.push_back((StateKeyBuilder(StateKeyTag::Any_Balance) << address).key());
+			}
+
+			void writeBalance(const Address& address, MosaicId mosaicId) {
+				// a balance change can be observed by validators inspecting either the specific balance or all balances
+				m_keyAccess.WriteKeys.push_back((StateKeyBuilder(StateKeyTag::Balance) << address << mosaicId).key());
+				m_keyAccess.WriteKeys.push_back((StateKeyBuilder(StateKeyTag::Any_Balance) << address).key());
+			}
+
+			void writeActivity(const Address& address) {
+				m_keyAccess.WriteKeys.push_back((StateKeyBuilder(StateKeyTag::Activity) << address).key());
+			}
+
+			void readMosaic(MosaicId mosaicId) {
+				m_keyAccess.ReadKeys.push_back((StateKeyBuilder(StateKeyTag::Mosaic) << mosaicId).key());
+			}
+
+			void readWriteTransactionHash(const Hash256& hash) {
+				auto key = (StateKeyBuilder(StateKeyTag::Transaction_Hash) << hash).key();
+				m_keyAccess.ReadKeys.push_back(key);
+				m_keyAccess.WriteKeys.push_back(key);
+			}
+
+		public:
+			bool isKnownAccount(const Address& address) const {
+				return m_context.Cache.sub<cache::AccountStateCache>().contains(address);
+			}
+
+			bool isKnownAccount(const Key& publicKey) const {
+				return m_context.Cache.sub<cache::AccountStateCache>().contains(publicKey);
+			}
+
+			Address toAddress(const Key& publicKey) const {
+				return model::PublicKeyToAddress(publicKey, m_context.Network.Identifier);
+			}
+
+		private:
+			NotificationKeyAccess& m_keyAccess;
+			const validators::ValidatorContext& m_context;
+		};
+
+		// endregion
+
+		// region collect
+
+		bool IsAggregateTransactionType(model::EntityType transactionType) {
+			auto facilityCode = static_cast<model::FacilityCode>(utils::to_underlying_type(transactionType) & 0xFF);
+			return model::FacilityCode::Aggregate == facilityCode;
+		}
+
+		bool CollectKeys(const model::AccountAddressNotification& notification, KeyAccessBuilder& builder) {
+			auto address = notification.Address.resolved(builder.resolvers());
+			builder.registerAccount(address, builder.isKnownAccount(address));
+			return true;
+		}
+
+		bool CollectKeys(const model::AccountPublicKeyNotification& notification, KeyAccessBuilder& builder) {
+			builder.registerAccount(builder.toAddress(notification.PublicKey), builder.isKnownAccount(notification.PublicKey));
+			return true;
+		}
+
+		bool CollectKeys(const model::BalanceTransferNotification& notification, KeyAccessBuilder& builder) {
+			const auto& resolvers = builder.resolvers();
+			auto recipient = resolvers.resolve(notification.Recipient);
+			auto mosaicId = resolvers.resolve(notification.MosaicId);
+
+			// recipient account is not read because validators treat unknown accounts like accounts without balances
+			builder.readAccount(notification.Sender);
+			builder.readBalance(notification.Sender, mosaicId);
+			builder.readAllBalances(recipient);
+			builder.readMosaic(mosaicId);
+			builder.writeBalance(notification.Sender, mosaicId);
+			builder.writeBalance(recipient, mosaicId);
+			return true;
+		}
+
+		bool CollectKeys(const model::BalanceDebitNotification& notification, KeyAccessBuilder& builder) {
+			auto mosaicId = builder.resolvers().resolve(notification.MosaicId);
+			builder.readAccount(notification.Sender);
+			builder.readBalance(notification.Sender, mosaicId);
+			builder.readMosaic(mosaicId);
+			builder.writeBalance(notification.Sender, mosaicId);
+			return true;
+		}
+
+		bool CollectKeys(const model::TransactionNotification& notification, KeyAccessBuilder& builder) {
+			// aggregate transactions can trigger observers (e.g. lock completion) that modify arbitrary accounts
+			if (IsAggregateTransactionType(notification.TransactionType))
+				return false;
+
+			builder.readAccount(notification.Sender);
+			builder.readWriteTransactionHash(notification.TransactionHash);
+			return true;
+		}
+
+		bool CollectKeys(const model::TransactionFeeNotification& notification, KeyAccessBuilder& builder) {
+			builder.readAccount(notification.Sender);
+			builder.writeActivity(notification.Sender);
+			return true;
+		}
+
+		bool CollectKeys(const model::AddressInteractionNotification& notification, KeyAccessBuilder& builder) {
+			builder.readAccount(notification.Source);
+			for (const auto& participant : notification.ParticipantsByAddress)
+				builder.readAccount(builder.resolvers().resolve(participant));
+
+			return true;
+		}
+
+		bool CollectKeys(const model::MosaicRequiredNotification& notification, KeyAccessBuilder& builder) {
+			const auto& resolvers = builder.resolvers();
+			builder.readAccount(notification.Owner.resolved(resolvers));
+			builder.readMosaic(notification.MosaicId.resolved(resolvers));
+			return true;
+		}
+
+		// stateless notifications do not access any state
+		bool CollectNoKeys(const model::Notification&, KeyAccessBuilder&) {
+			return true;
+		}
+
+		template<typename TNotification>
+		bool CollectNotificationKeys(const model::Notification& notification, KeyAccessBuilder& builder) {
+			return CollectKeys(static_cast<const TNotification&>(notification), builder);
+		}
+
+		using CollectFunc = bool (*)(const model::Notification&, KeyAccessBuilder&);
+
+		struct NotificationKeyCollector {
+			model::NotificationType Type;
+			CollectFunc Collect;
+		};
+
+		template<typename TNotification, CollectFunc Collect = CollectNotificationKeys<TNotification>>
+		constexpr NotificationKeyCollector MakeCollector() {
+			return { TNotification::Notification_Type, Collect };
+		}
+
+		// notifications with all other types (e.g. block and key link notifications) modify state that is not keyed and are global
+		constexpr NotificationKeyCollector Notification_Key_Collectors[] = {
+			MakeCollector<model::AccountAddressNotification>(),
+			MakeCollector<model::AccountPublicKeyNotification>(),
+			MakeCollector<model::BalanceTransferNotification>(),
+			MakeCollector<model::BalanceDebitNotification>(),
+			MakeCollector<model::EntityNotification, CollectNoKeys>(),
+			MakeCollector<model::TransactionDeadlineNotification, CollectNoKeys>(),
+			MakeCollector<model::SignatureNotification, CollectNoKeys>(),
+			MakeCollector<model::SourceChangeNotification, CollectNoKeys>(),
+			MakeCollector<model::InternalPaddingNotification, CollectNoKeys>(),
+			MakeCollector<model::TransactionNotification>(),
+			MakeCollector<model::TransactionFeeNotification>(),
+			MakeCollector<model::AddressInteractionNotification>(),
+			MakeCollector<model::MosaicRequiredNotification>()
+		};
+
+		const NotificationKeyCollector* FindCollector(model::NotificationType type) {
+			for (const auto& collector : Notification_Key_Collectors) {
+				if (type == collector.Type)
+					return &collector;
+			}
+
+			return nullptr;
+		}
+
+		bool TryCollect(const model::Notification& notification, KeyAccessBuilder& builder) {
+			const auto* pCollector = FindCollector(notification.Type);
+			return pCollector && pCollector->Collect(notification, builder);
+		}
+
+		// endregion
+	}
+
+	NotificationKeyAccess CollectNotificationKeyAccess(
+			const model::Notification& notification,
+			const validators::ValidatorContext& context) {
+		NotificationKeyAccess keyAccess;
+		KeyAccessBuilder builder(keyAccess, context);
+
+		auto isCollected = false;
+		try {
+			isCollected = TryCollect(notification, builder);
+		} catch (const std::exception&) {
+			// resolution failures are reported by validators, so treat the notification conservatively here
+		}
+
+		if (isCollected)
+			return keyAccess;
+
+		NotificationKeyAccess globalKeyAccess;
+		globalKeyAccess.IsGlobal = true;
+		return globalKeyAccess;
+	}
+
+	bool IsClassifiedNotificationType(model::NotificationType type) {
+		return !!FindCollector(type);
+	}
+
+	// region ModifiedStateKeys
+
+	ModifiedStateKeys::ModifiedStateKeys() : m_isGlobal(false)
+	{}
+
+	bool ModifiedStateKeys::isGlobal() const {
+		return m_isGlobal;
+	}
+
+	bool ModifiedStateKeys::conflicts(const NotificationKeyAccess& keyAccess) const {
+		if (m_isGlobal || keyAccess.IsGlobal)
+			return true;
+
+		for (auto key : keyAccess.ReadKeys) {
+			if (m_keys.cend() != m_keys.find(key))
+				return true;
+		}
+
+		return false;
+	}
+
+	void ModifiedStateKeys::add(const NotificationKeyAccess& keyAccess) {
+		if (keyAccess.IsGlobal) {
+			markGlobal();
+			return;
+		}
+
+		m_keys.insert(keyAccess.WriteKeys.cbegin(), keyAccess.WriteKeys.cend());
+	}
+
+	void ModifiedStateKeys::markGlobal() {
+		m_isGlobal = true;
+		m_keys.clear();
+	}
+
+	// endregion
+}}
@@ -0,0 +1,86 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/model/Notifications.h"
+#include "catapult/validators/ValidatorContext.h"
+#include <unordered_set>
+#include <vector>
+
+namespace catapult { namespace chain {
+
+	/// Hashed identifier of a piece of state that can be accessed when processing notifications.
+	/// \note Distinct pieces of state can map to the same key, which can only cause conflicts to be overreported.
+	using StateKey = uint64_t;
+
+	/// State keys that are accessed when processing a single notification.
+	struct NotificationKeyAccess {
+	public:
+		/// Creates an empty key access.
+		NotificationKeyAccess() : IsGlobal(false)
+		{}
+
+	public:
+		/// \c true if the notification can access any state.
+		bool IsGlobal;
+
+		/// Keys of state that can be read by validators.
+		std::vector<StateKey> ReadKeys;
+
+		/// Keys of state that can be modified by observers.
+		std::vector<StateKey> WriteKeys;
+	};
+
+	/// Collects the state keys accessed when processing \a notification using \a context.
+	/// \note Notifications that are not known to access only keyed state are marked global.
+	NotificationKeyAccess CollectNotificationKeyAccess(
+			const model::Notification& notification,
+			const validators::ValidatorContext& context);
+
+	/// Returns \c true if key access of notifications with \a type is explicitly classified by CollectNotificationKeyAccess.
+	/// \note Notifications with unclassified types are always marked global.
+	bool IsClassifiedNotificationType(model::NotificationType type);
+
+	/// Accumulates keys of modified state.
+	class ModifiedStateKeys {
+	public:
+		/// Creates an empty set.
+		ModifiedStateKeys();
+
+	public:
+		/// Returns \c true if any state might have been modified.
+		bool isGlobal() const;
+
+		/// Returns \c true if any state read according to \a keyAccess might have been modified.
+		bool conflicts(const NotificationKeyAccess& keyAccess) const;
+
+	public:
+		/// Adds all state written according to \a keyAccess.
+		void add(const NotificationKeyAccess& keyAccess);
+
+		/// Marks all state as modified.
+		void markGlobal();
+
+	private:
+		bool m_isGlobal;
+		std::unordered_set<StateKey> m_keys;
+	};
+}}
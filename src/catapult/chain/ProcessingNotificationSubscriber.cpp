@@ -36,6 +36,7 @@ namespace catapult { namespace chain {
 			, m_undoNotificationSubscriber(m_observer, m_observerContext)
 			, m_aggregateResult(validators::ValidationResult::Success)
 			, m_isUndoEnabled(false)
+			, m_isValidationEnabled(true)
 	{}
 
 	validators::ValidationResult ProcessingNotificationSubscriber::result() const {
@@ -53,6 +54,10 @@ namespace catapult { namespace chain {
 		m_undoNotificationSubscriber.undo();
 	}
 
+	void ProcessingNotificationSubscriber::disableValidation() {
+		m_isValidationEnabled = false;
+	}
+
 	void ProcessingNotificationSubscriber::notify(const model::Notification& notification) {
 		if (notification.Size < sizeof(model::Notification))
 			CATAPULT_THROW_INVALID_ARGUMENT("cannot process notification with incorrect size");
@@ -68,7 +73,7 @@ namespace catapult { namespace chain {
 	}
 
 	void ProcessingNotificationSubscriber::validate(const model::Notification& notification) {
-		if (!IsSet(notification.Type, model::NotificationChannel::Validator))
+		if (!m_isValidationEnabled || !IsSet(notification.Type, model::NotificationChannel::Validator))
 			return;
 
 		auto result = m_validator.validate(notification, m_validatorContext);
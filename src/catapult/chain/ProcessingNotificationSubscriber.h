@@ -47,6 +47,9 @@ namespace catapult { namespace chain {
 		/// Undoes all executions since enableUndo was first called.
 		void undo();
 
+		/// Disables validation so that subsequent notifications are only observed.
+		void disableValidation();
+
 	public:
 		void notify(const model::Notification& notification) override;
 
@@ -63,5 +66,6 @@ namespace catapult { namespace chain {
 		ProcessingUndoNotificationSubscriber m_undoNotificationSubscriber;
 		validators::ValidationResult m_aggregateResult;
 		bool m_isUndoEnabled;
+		bool m_isValidationEnabled;
 	};
 }}
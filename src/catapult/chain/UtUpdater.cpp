@@ -28,7 +28,10 @@
 #include "catapult/cache/RelockableDetachedCatapultCache.h"
 #include "catapult/cache_tx/UtCache.h"
 #include "catapult/model/FeeUtils.h"
+#include "catapult/model/NotificationStream.h"
+#include "catapult/model/TransactionUtils.h"
 #include "catapult/utils/HexFormatter.h"
+#include <atomic>
 
 namespace catapult { namespace chain {
 
@@ -43,6 +46,54 @@ namespace catapult { namespace chain {
 			cache::CatapultCacheDelta& UnconfirmedCatapultCache;
 		};
 
+		bool IsAliasAddress(const UnresolvedAddress& address) {
+			// alias addresses have the lowest bit of the first byte set
+			return 0 != (1 & address[0]);
+		}
+
+		// tracks accounts with state that can differ from the state that existing transactions were last validated against
+		class DependencyTracker {
+		public:
+			explicit DependencyTracker(const model::AddressSet& affectedAddresses)
+					: m_affectedAddresses(affectedAddresses)
+					, m_isAnyAliasDirty(false)
+			{}
+
+		public:
+			bool isDependent(const model::UnresolvedAddressSet& addresses) const {
+				for (const auto& address : addresses) {
+					// aliases cannot be resolved without the unconfirmed cache, so conservatively treat them as dependent
+					if (IsAliasAddress(address) || m_isAnyAliasDirty)
+						return true;
+
+					auto resolvedAddress = address.copyTo<Address>();
+					if (contains(m_affectedAddresses, resolvedAddress) || contains(m_dirtyAddresses, resolvedAddress))
+						return true;
+				}
+
+				return false;
+			}
+
+			void markDirty(const model::UnresolvedAddressSet& addresses) {
+				for (const auto& address : addresses) {
+					if (IsAliasAddress(address))
+						m_isAnyAliasDirty = true;
+					else
+						m_dirtyAddresses.insert(address.copyTo<Address>());
+				}
+			}
+
+		private:
+			static bool contains(const model::AddressSet& addresses, const Address& address) {
+				return addresses.cend() != addresses.find(address);
+			}
+
+		private:
+			const model::AddressSet& m_affectedAddresses;
+			model::AddressSet m_dirtyAddresses;
+			bool m_isAnyAliasDirty;
+		};
+
 		class TransactionInfoFormatter {
 		public:
 			explicit TransactionInfoFormatter(const model::TransactionInfo& transactionInfo) : m_transactionInfo(transactionInfo)
@@ -82,8 +133,15 @@ namespace catapult { namespace chain {
 				, m_timeSupplier(timeSupplier)
 				, m_failedTransactionSink(failedTransactionSink)
 				, m_throttle(throttle)
+				, m_numRevalidated(0)
+				, m_numSkipped(0)
 		{}
 
+	public:
+		UtUpdaterStatistics statistics() const {
+			return { m_numRevalidated, m_numSkipped };
+		}
+
 	public:
 		void update(const std::vector<model::TransactionInfo>& utInfos) {
 			// 1. lock the UT cache and lock the unconfirmed copy
@@ -100,7 +158,10 @@ namespace catapult { namespace chain {
 			apply(applyState, utInfos, TransactionSource::New);
 		}
 
-		void update(const utils::HashPointerSet& confirmedTransactionHashes, const std::vector<model::TransactionInfo>& utInfos) {
+		void update(
+				const utils::HashPointerSet& confirmedTransactionHashes,
+				const std::vector<model::TransactionInfo>& utInfos,
+				const model::AddressSet* pAffectedAddresses) {
 			if (!confirmedTransactionHashes.empty() || !utInfos.empty()) {
 				CATAPULT_LOG(debug)
 						<< "confirmed " << confirmedTransactionHashes.size() << " transactions, "
@@ -115,26 +176,41 @@ namespace catapult { namespace chain {
 			// 2. lock the catapult cache and rebase the unconfirmed catapult cache
 			auto pUnconfirmedCatapultCache = m_detachedCatapultCache.rebaseAndLock();
 
-			// 3. add back reverted txes
+			// 3. when the accounts modified by the chain change are known, only revalidate dependent original txes
+			std::unique_ptr<DependencyTracker> pDependencyTracker;
+			if (pAffectedAddresses)
+				pDependencyTracker = std::make_unique<DependencyTracker>(*pAffectedAddresses);
+
+			// 4. add back reverted txes
 			auto applyState = ApplyState(modifier, *pUnconfirmedCatapultCache);
-			apply(applyState, utInfos, TransactionSource::Reverted);
+			auto acceptAll = [](const auto&) { return true; };
+			apply(applyState, utInfos, TransactionSource::Reverted, acceptAll, pDependencyTracker.get());
 
-			// 4. add back original txes that have not been confirmed
-			apply(applyState, originalTransactionInfos, TransactionSource::Existing, [&confirmedTransactionHashes](const auto& info) {
+			// 5. add back original txes that have not been confirmed
+			auto initialStatistics = statistics();
+			auto isUnconfirmed = [&confirmedTransactionHashes](const auto& info) {
 				return confirmedTransactionHashes.cend() == confirmedTransactionHashes.find(&info.EntityHash);
-			});
+			};
+			apply(applyState, originalTransactionInfos, TransactionSource::Existing, isUnconfirmed, pDependencyTracker.get());
+
+			if (pDependencyTracker) {
+				CATAPULT_LOG(debug)
+						<< "revalidated " << (m_numRevalidated - initialStatistics.NumRevalidated) << " and skipped "
+						<< (m_numSkipped - initialStatistics.NumSkipped) << " existing transactions";
+			}
 		}
 
 	private:
 		void apply(const ApplyState& applyState, const std::vector<model::TransactionInfo>& utInfos, TransactionSource transactionSource) {
-			apply(applyState, utInfos, transactionSource, [](const auto&) { return true; });
+			apply(applyState, utInfos, transactionSource, [](const auto&) { return true; }, nullptr);
 		}
 
 		void apply(
 				const ApplyState& applyState,
 				const std::vector<model::TransactionInfo>& utInfos,
 				TransactionSource transactionSource,
-				const predicate<const model::TransactionInfo&>& filter) {
+				const predicate<const model::TransactionInfo&>& filter,
+				DependencyTracker* pDependencyTracker) {
 			// note that the validator and observer context height is one larger than the chain height
 			// since the validation and observation has to be for the *next* block
 			auto effectiveHeight = m_detachedCatapultCache.height() + Height(1);
@@ -150,6 +226,25 @@ namespace catapult { namespace chain {
 				if (!filter(utInfo))
 					continue;
 
+				// when dependencies are tracked, only transactions that can be affected by the chain change need to be revalidated
+				std::unique_ptr<model::NotificationStream> pNotifications;
+				std::shared_ptr<const model::UnresolvedAddressSet> pAddresses;
+				auto isValidationRequired = true;
+				if (pDependencyTracker) {
+					pAddresses = extractAddresses(utInfo, pNotifications);
+					const auto& blockTime = validatorContext.BlockTime;
+					isValidationRequired = requiresValidation(utInfo, transactionSource, blockTime, *pAddresses, *pDependencyTracker);
+				}
+
+				auto markDirty = [pDependencyTracker, &pAddresses]() {
+					if (pDependencyTracker)
+						pDependencyTracker->markDirty(*pAddresses);
+				};
+
+				// any transaction that is revalidated or dropped can change the state of its accounts seen by subsequent transactions
+				if (isValidationRequired)
+					markDirty();
+
 				auto minTransactionFee = model::CalculateTransactionFee(m_minFeeMultiplier, entity);
 				if (entity.MaxFee < minTransactionFee) {
 					// don't log reverted transactions that could have been included by harvester with lower min fee multiplier
@@ -159,12 +254,14 @@ namespace catapult { namespace chain {
 								<< " because min fee is " << minTransactionFee;
 					}
 
+					markDirty();
 					continue;
 				}
 
 				if (throttle(utInfo, transactionSource, applyState, validatorContext.Cache)) {
 					CATAPULT_LOG(warning) << "dropping transaction " << TransactionInfoFormatter(utInfo) << " due to throttle";
 					m_failedTransactionSink(entity, entityHash, Failure_Chain_Unconfirmed_Cache_Too_Full);
+					markDirty();
 					continue;
 				}
 
@@ -176,8 +273,19 @@ namespace catapult { namespace chain {
 				const auto& observer = *m_executionConfig.pObserver;
 				ProcessingNotificationSubscriber sub(validator, validatorContext, observer, observerContext);
 				sub.enableUndo();
-				auto entityInfo = model::WeakEntityInfo(entity, entityHash);
-				m_executionConfig.pNotificationPublisher->publish(entityInfo, sub);
+				if (!isValidationRequired)
+					sub.disableValidation();
+
+				if (pNotifications) {
+					pNotifications->replay(sub);
+				} else {
+					auto entityInfo = model::WeakEntityInfo(entity, entityHash);
+					m_executionConfig.pNotificationPublisher->publish(entityInfo, sub);
+				}
+
+				if (TransactionSource::Existing == transactionSource)
+					++(isValidationRequired ? m_numRevalidated : m_numSkipped);
+
 				if (!IsValidationResultSuccess(sub.result())) {
 					CATAPULT_LOG_LEVEL(validators::MapToLogLevel(sub.result()))
 							<< "dropping transaction " << TransactionInfoFormatter(utInfo) << ": " << sub.result();
@@ -193,6 +301,31 @@ namespace catapult { namespace chain {
 			}
 		}
 
+		std::shared_ptr<const model::UnresolvedAddressSet> extractAddresses(
+				const model::TransactionInfo& utInfo,
+				std::unique_ptr<model::NotificationStream>& pNotifications) const {
+			if (utInfo.OptionalExtractedAddresses)
+				return utInfo.OptionalExtractedAddresses;
+
+			// record notifications so that they can be replayed after extracting addresses without publishing them twice
+			auto entityInfo = model::WeakEntityInfo(*utInfo.pEntity, utInfo.EntityHash);
+			pNotifications = model::RecordNotifications(*m_executionConfig.pNotificationPublisher, entityInfo);
+			return std::make_shared<model::UnresolvedAddressSet>(model::ExtractAddresses(*utInfo.pEntity, *pNotifications));
+		}
+
+		static bool requiresValidation(
+				const model::TransactionInfo& utInfo,
+				TransactionSource transactionSource,
+				Timestamp blockTime,
+				const model::UnresolvedAddressSet& addresses,
+				const DependencyTracker& dependencyTracker) {
+			// only existing transactions have been validated before; expired transactions need to be rejected by validators
+			if (TransactionSource::Existing != transactionSource || utInfo.pEntity->Deadline < blockTime)
+				return true;
+
+			return dependencyTracker.isDependent(addresses);
+		}
+
 		bool throttle(
 				const model::TransactionInfo& utInfo,
 				TransactionSource transactionSource,
@@ -214,6 +347,9 @@ namespace catapult { namespace chain {
 		TimeSupplier m_timeSupplier;
 		FailedTransactionSink m_failedTransactionSink;
 		UtUpdater::Throttle m_throttle;
+
+		std::atomic<uint64_t> m_numRevalidated;
+		std::atomic<uint64_t> m_numSkipped;
 	};
 
 	UtUpdater::UtUpdater(
@@ -241,6 +377,17 @@ namespace catapult { namespace chain {
 	}
 
 	void UtUpdater::update(const utils::HashPointerSet& confirmedTransactionHashes, const std::vector<model::TransactionInfo>& utInfos) {
-		m_pImpl->update(confirmedTransactionHashes, utInfos);
+		m_pImpl->update(confirmedTransactionHashes, utInfos, nullptr);
+	}
+
+	void UtUpdater::update(
+			const utils::HashPointerSet& confirmedTransactionHashes,
+			const std::vector<model::TransactionInfo>& utInfos,
+			const model::AddressSet& affectedAddresses) {
+		m_pImpl->update(confirmedTransactionHashes, utInfos, &affectedAddresses);
+	}
+
+	UtUpdaterStatistics UtUpdater::statistics() const {
+		return m_pImpl->statistics();
 	}
 }}
@@ -22,6 +22,7 @@
 #pragma once
 #include "ChainFunctions.h"
 #include "ExecutionConfiguration.h"
+#include "catapult/model/ContainerTypes.h"
 #include "catapult/model/EntityInfo.h"
 #include "catapult/observers/ObserverTypes.h"
 #include "catapult/utils/ArraySet.h"
@@ -36,6 +37,15 @@ namespace catapult {
 
 namespace catapult { namespace chain {
 
+	/// Unconfirmed transactions updater statistics.
+	struct UtUpdaterStatistics {
+		/// Number of existing transactions that were revalidated after a chain change.
+		uint64_t NumRevalidated;
+
+		/// Number of existing transactions that were reapplied without revalidation after a chain change.
+		uint64_t NumSkipped;
+	};
+
 	/// Provides batch updating of an unconfirmed transactions cache.
 	class UtUpdater {
 	public:
@@ -95,6 +105,19 @@ namespace catapult { namespace chain {
 		/// removing transactions with hashes in \a confirmedTransactionHashes.
 		void update(const utils::HashPointerSet& confirmedTransactionHashes, const std::vector<model::TransactionInfo>& utInfos);
 
+		/// Updates this cache by applying new transaction infos in \a utInfos and
+		/// removing transactions with hashes in \a confirmedTransactionHashes.
+		/// Only existing transactions that depend on accounts in \a affectedAddresses are revalidated.
+		/// \note This must only be used when no state other than account state changed (e.g. no locks or mosaics expired).
+		void update(
+				const utils::HashPointerSet& confirmedTransactionHashes,
+				const std::vector<model::TransactionInfo>& utInfos,
+				const model::AddressSet& affectedAddresses);
+
+	public:
+		/// Gets the updater statistics.
+		UtUpdaterStatistics statistics() const;
+
 	private:
 		class Impl;
 		std::unique_ptr<Impl> m_pImpl;
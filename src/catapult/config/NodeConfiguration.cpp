@@ -43,6 +43,8 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(EnableSingleThreadPool);
 		LOAD_NODE_PROPERTY(EnableCacheDatabaseStorage);
 		LOAD_NODE_PROPERTY(EnableAutoSyncCleanup);
+		LOAD_NODE_PROPERTY(EnableSegmentedBlockStorage);
+		LOAD_NODE_PROPERTY(EnableParallelBlockValidation);
 
 		LOAD_NODE_PROPERTY(EnableTransactionSpamThrottling);
 		LOAD_NODE_PROPERTY(TransactionSpamThrottlingMaxBoostFee);
@@ -61,11 +63,15 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(UnconfirmedTransactionsCacheMaxResponseSize);
 		LOAD_NODE_PROPERTY(UnconfirmedTransactionsCacheMaxSize);
 
+		LOAD_NODE_PROPERTY(BlockStorageCacheMaxSize);
+		LOAD_NODE_PROPERTY(PublicKeyCacheMaxSize);
+
 		LOAD_NODE_PROPERTY(ConnectTimeout);
 		LOAD_NODE_PROPERTY(SyncTimeout);
 
 		LOAD_NODE_PROPERTY(SocketWorkingBufferSize);
 		LOAD_NODE_PROPERTY(SocketWorkingBufferSensitivity);
+		LOAD_NODE_PROPERTY(SocketWriteCoalescingSize);
 		LOAD_NODE_PROPERTY(MaxPacketDataSize);
 
 		LOAD_NODE_PROPERTY(BlockDisruptorSize);
@@ -97,6 +103,8 @@ namespace catapult { namespace config {
 		LOAD_CACHE_DATABASE_PROPERTY(MemtableMemoryBudget);
 
 		LOAD_CACHE_DATABASE_PROPERTY(MaxWriteBatchSize);
+		LOAD_CACHE_DATABASE_PROPERTY(PatriciaTreeNodeCacheSize);
+		LOAD_CACHE_DATABASE_PROPERTY(PatriciaTreeGarbageCollectionDelay);
 
 #undef LOAD_CACHE_DATABASE_PROPERTY
 
@@ -141,7 +149,7 @@ namespace catapult { namespace config {
 
 #undef LOAD_BANNING_PROPERTY
 
-		utils::VerifyBagSizeExact(bag, 36 + 7 + 4 + 4 + 5 + 7);
+		utils::VerifyBagSizeExact(bag, 40 + 8 + 4 + 4 + 5 + 8);
 		return config;
 	}
 
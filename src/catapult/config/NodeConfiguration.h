@@ -53,6 +53,12 @@ namespace catapult { namespace config {
 		/// \note This should be \c false if broker process is running.
 		bool EnableAutoSyncCleanup;
 
+		/// \c true if blocks should be saved in segmented append-only files instead of one file per block.
+		bool EnableSegmentedBlockStorage;
+
+		/// \c true if stateful validation of independent block entities should be speculatively parallelized.
+		bool EnableParallelBlockValidation;
+
 		/// \c true if transaction spam throttling should be enabled.
 		bool EnableTransactionSpamThrottling;
 
@@ -92,6 +98,12 @@ namespace catapult { namespace config {
 		/// Maximum size of the unconfirmed transactions cache.
 		uint32_t UnconfirmedTransactionsCacheMaxSize;
 
+		/// Maximum size of recent block elements cached by the block storage cache.
+		utils::FileSize BlockStorageCacheMaxSize;
+
+		/// Maximum size of decompressed public keys cached for signature verification.
+		utils::FileSize PublicKeyCacheMaxSize;
+
 		/// Timeout for connecting to a peer.
 		utils::TimeSpan ConnectTimeout;
 
@@ -105,6 +117,10 @@ namespace catapult { namespace config {
 		/// \note \c 0 will disable memory reclamation.
 		uint32_t SocketWorkingBufferSensitivity;
 
+		/// Socket write coalescing size (small buffers are copied together into segments of at most this size before writing).
+		/// \note \c 0 will disable write coalescing.
+		utils::FileSize SocketWriteCoalescingSize;
+
 		/// Maximum packet data size.
 		utils::FileSize MaxPacketDataSize;
 
@@ -169,6 +185,13 @@ namespace catapult { namespace config {
 
 			/// Maximum write batch size.
 			utils::FileSize MaxWriteBatchSize;
+
+			/// Maximum size of decoded patricia tree nodes cached per sub cache.
+			utils::FileSize PatriciaTreeNodeCacheSize;
+
+			/// Number of patricia tree commits for which unreachable patricia tree nodes are retained before being removed.
+			/// \note Garbage collection is disabled when zero.
+			uint32_t PatriciaTreeGarbageCollectionDelay;
 		};
 
 	public:
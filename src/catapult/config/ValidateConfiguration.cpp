@@ -87,12 +87,25 @@ namespace catapult { namespace config {
 				CATAPULT_THROW_VALIDATION_ERROR(out.str().c_str());
 			}
 		}
+
+		void ValidateConfiguration(const model::BlockChainConfiguration& blockChainConfig, const config::NodeConfiguration& nodeConfig) {
+			// rollbacks reset patricia trees to previous roots, so all nodes reachable from them must be retained
+			auto garbageCollectionDelay = nodeConfig.CacheDatabase.PatriciaTreeGarbageCollectionDelay;
+			if (0 != garbageCollectionDelay && garbageCollectionDelay < blockChainConfig.MaxRollbackBlocks) {
+				std::ostringstream out;
+				out
+						<< "PatriciaTreeGarbageCollectionDelay (" << garbageCollectionDelay
+						<< ") must be unset or at least MaxRollbackBlocks (" << blockChainConfig.MaxRollbackBlocks << ")";
+				CATAPULT_THROW_VALIDATION_ERROR(out.str().c_str());
+			}
+		}
 	}
 
 	void ValidateConfiguration(const CatapultConfiguration& config) {
 		ValidateConfiguration(config.BlockChain);
 		ValidateConfiguration(config.BlockChain, config.Inflation);
 		ValidateConfiguration(config.Node);
+		ValidateConfiguration(config.BlockChain, config.Node);
 	}
 
 #undef CATAPULT_THROW_VALIDATION_ERROR
@@ -23,6 +23,7 @@
 #include "ConsumerResults.h"
 #include "TransactionConsumers.h"
 #include "ValidationConsumerUtils.h"
+#include "catapult/crypto/Signer.h"
 #include "catapult/model/NotificationSubscriber.h"
 #include "catapult/thread/IoThreadPool.h"
 #include "catapult/thread/ParallelFor.h"
@@ -33,17 +34,17 @@ namespace catapult { namespace consumers {
 	namespace {
 		class SignatureCapturingNotificationSubscriber : public model::NotificationSubscriber {
 		public:
-			explicit SignatureCapturingNotificationSubscriber(const GenerationHashSeed& generationHashSeed)
+			SignatureCapturingNotificationSubscriber(const GenerationHashSeed& generationHashSeed, size_t startEntityIndex)
 					: m_generationHashSeed(generationHashSeed)
-					, m_entityIndex(0)
+					, m_entityIndex(startEntityIndex)
 			{}
 
 		public:
-			const auto& notificationToEntityIndexMap() const {
+			auto& notificationToEntityIndexMap() {
 				return m_notificationToEntityIndexMap;
 			}
 
-			const auto& inputs() const {
+			auto& inputs() {
 				return m_inputs;
 			}
 
@@ -79,17 +80,69 @@ namespace catapult { namespace consumers {
 			std::vector<crypto::SignatureInput> m_inputs;
 		};
 
-		std::unique_ptr<SignatureCapturingNotificationSubscriber> ExtractAllSignatureNotifications(
+		// entities are published in partitions of at least this size so that dispatch overhead is amortized
+		constexpr size_t Min_Entities_Per_Extraction_Partition = 32;
+
+		size_t CalculateNumPartitions(const thread::IoThreadPool& pool, size_t numItems, size_t minItemsPerPartition) {
+			auto numPartitions = (numItems + minItemsPerPartition - 1) / minItemsPerPartition;
+			return std::max<size_t>(1, std::min<size_t>(pool.numWorkerThreads(), numPartitions));
+		}
+
+		struct ExtractedSignatureNotifications {
+			std::vector<size_t> NotificationToEntityIndexMap;
+			std::vector<crypto::SignatureInput> Inputs;
+		};
+
+		ExtractedSignatureNotifications ExtractAllSignatureNotifications(
 				const GenerationHashSeed& generationHashSeed,
 				const model::NotificationPublisher& publisher,
+				thread::IoThreadPool& pool,
 				const model::WeakEntityInfos& entityInfos) {
-			auto pSub = std::make_unique<SignatureCapturingNotificationSubscriber>(generationHashSeed);
-			for (const auto& entityInfo : entityInfos) {
-				publisher.publish(entityInfo, *pSub);
-				pSub->next();
+			ExtractedSignatureNotifications extracted;
+			if (entityInfos.empty())
+				return extracted;
+
+			// publish entities in parallel, capturing the signatures of each partition separately
+			auto numPartitions = CalculateNumPartitions(pool, entityInfos.size(), Min_Entities_Per_Extraction_Partition);
+			std::vector<std::unique_ptr<SignatureCapturingNotificationSubscriber>> subscribers(numPartitions);
+			auto partitionCallback = [&generationHashSeed, &publisher, &subscribers](
+					auto itBegin,
+					auto itEnd,
+					auto startIndex,
+					auto partitionIndex) {
+				auto pSub = std::make_unique<SignatureCapturingNotificationSubscriber>(generationHashSeed, startIndex);
+				for (auto iter = itBegin; itEnd != iter; ++iter) {
+					publisher.publish(*iter, *pSub);
+					pSub->next();
+				}
+
+				subscribers[partitionIndex] = std::move(pSub);
+			};
+
+			thread::ParallelForPartition(pool.ioContext(), entityInfos, numPartitions, partitionCallback).get();
+
+			// merge partitions in order so that signatures are ordered by entity
+			for (const auto& pSub : subscribers) {
+				if (!pSub)
+					continue;
+
+				for (auto& input : pSub->inputs())
+					extracted.Inputs.push_back(std::move(input));
+
+				const auto& notificationToEntityIndexMap = pSub->notificationToEntityIndexMap();
+				extracted.NotificationToEntityIndexMap.insert(
+						extracted.NotificationToEntityIndexMap.end(),
+						notificationToEntityIndexMap.cbegin(),
+						notificationToEntityIndexMap.cend());
 			}
 
-			return pSub;
+			return extracted;
+		}
+
+		size_t CalculateNumVerificationPartitions(const thread::IoThreadPool& pool, size_t numSignatures) {
+			// avoid splitting signatures into partitions smaller than a full batch because the multi-scalar multiplication
+			// cost is only amortized across full batches
+			return CalculateNumPartitions(pool, numSignatures, crypto::Max_Verify_Multi_Batch_Size);
 		}
 
 		std::vector<validators::ValidationResult> MapNotificationResultsToEntityResults(
@@ -115,7 +168,7 @@ namespace catapult { namespace consumers {
 		return MakeBlockValidationConsumer(requiresValidationPredicate, [&pool, generationHashSeed, randomFiller, pPublisher](
 				const auto& entityInfos) {
 			// find all signature notifications
-			auto inputs = ExtractAllSignatureNotifications(generationHashSeed, *pPublisher, entityInfos)->inputs();
+			auto inputs = ExtractAllSignatureNotifications(generationHashSeed, *pPublisher, pool, entityInfos).Inputs;
 
 			// process signatures in batches
 			std::atomic<validators::ValidationResult> aggregateResult(validators::ValidationResult::Success);
@@ -125,7 +178,8 @@ namespace catapult { namespace consumers {
 					validators::AggregateValidationResult(aggregateResult, Failure_Consumer_Batch_Signature_Not_Verifiable);
 			};
 
-			thread::ParallelForPartition(pool.ioContext(), inputs, pool.numWorkerThreads(), partitionCallback).get();
+			auto numPartitions = CalculateNumVerificationPartitions(pool, inputs.size());
+			thread::ParallelForPartition(pool.ioContext(), inputs, numPartitions, partitionCallback).get();
 			return aggregateResult.load();
 		});
 	}
@@ -139,12 +193,12 @@ namespace catapult { namespace consumers {
 		return MakeTransactionValidationConsumer(failedTransactionSink, [&pool, generationHashSeed, randomFiller, pPublisher](
 				const auto& entityInfos) {
 			// find all signature notifications
-			auto pSub = ExtractAllSignatureNotifications(generationHashSeed, *pPublisher, entityInfos);
+			auto extracted = ExtractAllSignatureNotifications(generationHashSeed, *pPublisher, pool, entityInfos);
 
 			// process signatures in batches
 			// note: store notification (not entity) results because it's possible for an entity to be split across partitions,
 			//       which would lead to a write data race (of same data) from multiple threads
-			std::vector<validators::ValidationResult> notificationResults(pSub->inputs().size(), validators::ValidationResult::Success);
+			std::vector<validators::ValidationResult> notificationResults(extracted.Inputs.size(), validators::ValidationResult::Success);
 			auto partitionCallback = [&randomFiller, &notificationResults](auto itBegin, auto itEnd, auto startIndex, auto) {
 				auto count = static_cast<size_t>(std::distance(itBegin, itEnd));
 				auto partitionResultsPair = VerifyMulti(randomFiller, &*itBegin, count);
@@ -160,9 +214,10 @@ namespace catapult { namespace consumers {
 				}
 			};
 
-			thread::ParallelForPartition(pool.ioContext(), pSub->inputs(), pool.numWorkerThreads(), partitionCallback).get();
+			auto numPartitions = CalculateNumVerificationPartitions(pool, extracted.Inputs.size());
+			thread::ParallelForPartition(pool.ioContext(), extracted.Inputs, numPartitions, partitionCallback).get();
 
-			return MapNotificationResultsToEntityResults(entityInfos.size(), pSub->notificationToEntityIndexMap(), notificationResults);
+			return MapNotificationResultsToEntityResults(entityInfos.size(), extracted.NotificationToEntityIndexMap, notificationResults);
 		});
 	}
 }}
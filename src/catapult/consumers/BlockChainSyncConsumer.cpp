@@ -22,7 +22,9 @@
 #include "BlockConsumers.h"
 #include "ConsumerResultFactory.h"
 #include "InputUtils.h"
+#include "catapult/cache/CacheConstants.h"
 #include "catapult/cache/CatapultCache.h"
+#include "catapult/cache_core/AccountStateCache.h"
 #include "catapult/chain/BlockScorer.h"
 #include "catapult/chain/ChainUtils.h"
 #include "catapult/io/BlockStorageCache.h"
@@ -39,6 +41,41 @@ namespace catapult { namespace consumers {
 			return disruptor::CompletionStatus::Aborted == result.CompletionStatus;
 		}
 
+		model::AddressSet CollectAffectedAddresses(const cache::CatapultCacheDelta& cacheDelta) {
+			// delta includes changes from both unwound and newly applied blocks
+			const auto& accountStateCacheDelta = cacheDelta.sub<cache::AccountStateCache>();
+
+			model::AddressSet addresses;
+			auto addAll = [&addresses](const auto& accountStatePointers) {
+				for (const auto* pAccountState : accountStatePointers)
+					addresses.insert(pAccountState->Address);
+			};
+
+			addAll(accountStateCacheDelta.addedElements());
+			addAll(accountStateCacheDelta.modifiedElements());
+			addAll(accountStateCacheDelta.removedElements());
+			return addresses;
+		}
+
+		bool HasUntrackedChanges(const cache::CatapultCacheDelta& cacheDelta) {
+			// unconfirmed transactions only track account dependencies, so a change to any other sub cache (including
+			// expiring mosaics, namespaces and locks, which are touched when their expiry height is reached) requires all
+			// of them to be revalidated; block statistics are not used by validators and confirmed hashes are passed separately
+			for (auto subCacheId : cacheDelta.changedSubCacheIds()) {
+				switch (static_cast<cache::CacheId>(subCacheId)) {
+				case cache::CacheId::AccountState:
+				case cache::CacheId::BlockStatistic:
+				case cache::CacheId::Hash:
+					break;
+
+				default:
+					return true;
+				}
+			}
+
+			return false;
+		}
+
 		struct UnwindResult {
 		public:
 			model::ChainScore Score;
@@ -300,6 +337,10 @@ namespace catapult { namespace consumers {
 				m_handlers.PreStateWritten(syncState.cacheDelta(), newHeight);
 				m_handlers.CommitStep(CommitOperationStep::State_Written);
 
+				// - collect modified accounts before changes are committed so that unaffected transactions don't need revalidation
+				auto affectedAddresses = CollectAffectedAddresses(syncState.cacheDelta());
+				auto requiresFullRevalidation = HasUntrackedChanges(syncState.cacheDelta());
+
 				// *** checkpoint ***
 				// - both blocks and state have been written out to disk and can be fully restored
 				// - broker process is not yet able to consume changes (all changes are consumable after step 3)
@@ -318,7 +359,8 @@ namespace catapult { namespace consumers {
 				auto revertedTransactionInfos = CollectRevertedTransactionInfos(
 						peerTransactionHashes,
 						syncState.detachRemovedTransactionInfos());
-				m_handlers.TransactionsChange({ peerTransactionHashes, revertedTransactionInfos });
+				auto pAffectedAddresses = requiresFullRevalidation ? nullptr : &affectedAddresses;
+				m_handlers.TransactionsChange({ peerTransactionHashes, revertedTransactionInfos, pAffectedAddresses });
 			}
 
 		private:
@@ -21,6 +21,7 @@
 
 #pragma once
 #include "BlockChainProcessor.h"
+#include "catapult/model/ContainerTypes.h"
 #include "catapult/model/HeightHashPair.h"
 #include "catapult/subscribers/StateChangeInfo.h"
 #include "catapult/utils/ArraySet.h"
@@ -35,12 +36,15 @@ namespace catapult { namespace consumers {
 	/// Information passed to a transactions change handler.
 	struct TransactionsChangeInfo {
 	public:
-		/// Creates a new transactions change info around \a addedTransactionHashes and \a revertedTransactionInfos.
+		/// Creates a new transactions change info around \a addedTransactionHashes, \a revertedTransactionInfos
+		/// and optional addresses of affected accounts (\a pAddresses).
 		TransactionsChangeInfo(
 				const utils::HashPointerSet& addedTransactionHashes,
-				const std::vector<model::TransactionInfo>& revertedTransactionInfos)
+				const std::vector<model::TransactionInfo>& revertedTransactionInfos,
+				const model::AddressSet* pAddresses = nullptr)
 				: AddedTransactionHashes(addedTransactionHashes)
 				, RevertedTransactionInfos(revertedTransactionInfos)
+				, pAffectedAddresses(pAddresses)
 		{}
 
 	public:
@@ -49,6 +53,10 @@ namespace catapult { namespace consumers {
 
 		/// Infos of the transactions that were reverted (previously confirmed).
 		const std::vector<model::TransactionInfo>& RevertedTransactionInfos;
+
+		/// Addresses of all accounts modified by the change (optional).
+		/// \note When unset, the modified accounts are unknown or state other than account state was modified.
+		const model::AddressSet* pAffectedAddresses;
 	};
 
 	/// Type of block passed to undo block handler.
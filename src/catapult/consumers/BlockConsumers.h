@@ -56,6 +56,13 @@ namespace catapult { namespace consumers {
 			const utils::TimeSpan& maxBlockFutureTime,
 			const chain::TimeSupplier& timeSupplier);
 
+	/// Creates a consumer that records the notifications of all entities once using \a pPublisher and \a pool
+	/// so that downstream consumers can replay them instead of publishing them again.
+	/// \note This consumer is non-const because it updates the element notification streams.
+	disruptor::BlockConsumer CreateBlockNotificationRecordingConsumer(
+			const std::shared_ptr<const model::NotificationPublisher>& pPublisher,
+			thread::IoThreadPool& pool);
+
 	/// Predicate for checking whether or not an entity requires validation.
 	using RequiresValidationPredicate = model::MatchingEntityPredicate;
 
@@ -46,14 +46,20 @@ namespace catapult { namespace consumers {
 				for (auto& element : elements) {
 					// note that disruptor input elements have been extracted from a packet (or created within this
 					// process), so their sizes have already been validated
-					crypto::MerkleHashBuilder transactionsHashBuilder;
-					for (const auto& transaction : element.Block.Transactions()) {
-						model::TransactionElement transactionElement(transaction);
-						model::UpdateHashes(m_transactionRegistry, m_generationHashSeed, transactionElement);
-						element.Transactions.push_back(transactionElement);
+					for (const auto& transaction : element.Block.Transactions())
+						element.Transactions.push_back(model::TransactionElement(transaction));
 
+					std::vector<model::TransactionElement*> transactionElements;
+					transactionElements.reserve(element.Transactions.size());
+					for (auto& transactionElement : element.Transactions)
+						transactionElements.push_back(&transactionElement);
+
+					// hash all transactions together so that multiple buffers can be hashed in lockstep
+					model::UpdateHashes(m_transactionRegistry, m_generationHashSeed, transactionElements);
+
+					crypto::MerkleHashBuilder transactionsHashBuilder(element.Transactions.size());
+					for (const auto& transactionElement : element.Transactions)
 						transactionsHashBuilder.update(transactionElement.MerkleComponentHash);
-					}
 
 					Hash256 transactionsHash;
 					transactionsHashBuilder.final(transactionsHash);
@@ -93,8 +99,12 @@ namespace catapult { namespace consumers {
 				if (elements.empty())
 					return Abort(Failure_Consumer_Empty_Input);
 
+				std::vector<model::TransactionElement*> transactionElements;
+				transactionElements.reserve(elements.size());
 				for (auto& element : elements)
-					model::UpdateHashes(m_transactionRegistry, m_generationHashSeed, element);
+					transactionElements.push_back(&element);
+
+				model::UpdateHashes(m_transactionRegistry, m_generationHashSeed, transactionElements);
 
 				return Continue();
 			}
@@ -54,6 +54,9 @@ namespace catapult { namespace consumers {
 				continue;
 
 			entityInfos.emplace_back(element.Transaction, element.EntityHash);
+			if (element.OptionalNotifications)
+				entityInfos.back().setNotificationStream(*element.OptionalNotifications);
+
 			entityInfoElementIndexes.push_back(index - 1);
 		}
 	}
@@ -0,0 +1,95 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "BlockConsumers.h"
+#include "ConsumerResultFactory.h"
+#include "TransactionConsumers.h"
+#include "catapult/model/NotificationStream.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
+
+namespace catapult { namespace consumers {
+
+	namespace {
+		struct RecordingTarget {
+			model::WeakEntityInfo EntityInfo;
+			std::shared_ptr<const model::NotificationStream>* pOptionalNotifications;
+		};
+
+		template<typename TElement>
+		void AddRecordingTarget(std::vector<RecordingTarget>& targets, const model::WeakEntityInfo& entityInfo, TElement& element) {
+			targets.push_back({ entityInfo, &element.OptionalNotifications });
+		}
+
+		void RecordAll(const model::NotificationPublisher& publisher, thread::IoThreadPool& pool, std::vector<RecordingTarget>& targets) {
+			if (targets.empty())
+				return;
+
+			thread::ParallelFor(pool.ioContext(), targets, pool.numWorkerThreads(), [&publisher](auto& target, auto) {
+				try {
+					*target.pOptionalNotifications = model::RecordNotifications(publisher, target.EntityInfo);
+				} catch (...) {
+					// leave the stream unset so that downstream consumers publish (and fail) exactly as they would without recording
+				}
+
+				return true;
+			}).get();
+		}
+	}
+
+	disruptor::BlockConsumer CreateBlockNotificationRecordingConsumer(
+			const std::shared_ptr<const model::NotificationPublisher>& pPublisher,
+			thread::IoThreadPool& pool) {
+		return [pPublisher, &pool](BlockElements& elements) {
+			std::vector<RecordingTarget> targets;
+			for (auto& element : elements) {
+				// entity infos must match the ones created by model::ExtractEntityInfos in order for recorded streams to be replayed
+				for (auto& transactionElement : element.Transactions) {
+					auto entityInfo = model::WeakEntityInfo(transactionElement.Transaction, transactionElement.EntityHash, element.Block);
+					AddRecordingTarget(targets, entityInfo, transactionElement);
+				}
+
+				AddRecordingTarget(targets, model::WeakEntityInfo(element.Block, element.EntityHash, element.Block), element);
+			}
+
+			RecordAll(*pPublisher, pool, targets);
+			return Continue();
+		};
+	}
+
+	disruptor::TransactionConsumer CreateTransactionNotificationRecordingConsumer(
+			const std::shared_ptr<const model::NotificationPublisher>& pPublisher,
+			thread::IoThreadPool& pool) {
+		return [pPublisher, &pool](TransactionElements& elements) {
+			std::vector<RecordingTarget> targets;
+			for (auto& element : elements) {
+				if (disruptor::ConsumerResultSeverity::Success != element.ResultSeverity)
+					continue;
+
+				// entity infos must match the ones created by consumers::ExtractEntityInfos in order for recorded streams to be replayed
+				AddRecordingTarget(targets, model::WeakEntityInfo(element.Transaction, element.EntityHash), element);
+			}
+
+			RecordAll(*pPublisher, pool, targets);
+			return Continue();
+		};
+	}
+}}
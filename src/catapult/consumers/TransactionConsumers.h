@@ -46,6 +46,12 @@ namespace catapult { namespace consumers {
 			const HashCheckOptions& options,
 			const chain::KnownHashPredicate& knownHashPredicate);
 
+	/// Creates a consumer that records the notifications of all non-skipped entities once using \a pPublisher and \a pool
+	/// so that downstream consumers can replay them instead of publishing them again.
+	disruptor::TransactionConsumer CreateTransactionNotificationRecordingConsumer(
+			const std::shared_ptr<const model::NotificationPublisher>& pPublisher,
+			thread::IoThreadPool& pool);
+
 	/// Creates a consumer that runs stateless validation using \a pValidationPolicy and calls \a failedTransactionSink for each failure.
 	disruptor::TransactionConsumer CreateTransactionStatelessValidationConsumer(
 			const std::shared_ptr<const validators::ParallelValidationPolicy>& pValidationPolicy,
@@ -20,7 +20,7 @@
 **/
 
 #include "MerkleHashBuilder.h"
-#include "Hashes.h"
+#include "MultiBufferHashes.h"
 #include "catapult/functions.h"
 
 namespace catapult { namespace crypto {
@@ -35,6 +35,8 @@ namespace catapult { namespace crypto {
 
 			// build the merkle tree
 			auto numRemainingHashes = hashes.size();
+			std::vector<MultiBufferHashInput> inputs;
+			std::vector<Hash256> levelHashes;
 			hashConsumer(hashes.data(), hashes.size());
 			while (numRemainingHashes > 1) {
 				// merkle tree needs padding in case of an odd number of hashes, need to do before the next round of hashes is
@@ -42,23 +44,24 @@ namespace catapult { namespace crypto {
 				if (1 == numRemainingHashes % 2)
 					hashConsumer(&hashes[numRemainingHashes - 1], 1);
 
-				auto i = 0u;
-				for (; i < numRemainingHashes; i += 2) {
+				// hash all sibling pairs of the current level together using multi-buffer hashing
+				inputs.clear();
+				for (auto i = 0u; i < numRemainingHashes; i += 2) {
 					if (i + 1 < numRemainingHashes) {
-						Sha3_256({ hashes[i].data(), 2 * Hash256::Size }, hashes[i / 2]);
-						hashConsumer(&hashes[i / 2], 1);
+						inputs.push_back({ { RawBuffer{ hashes[i].data(), 2 * Hash256::Size } }, 1 });
 						continue;
 					}
 
 					// if there is an odd number of hashes, duplicate the last one
-					Sha3_256_Builder builder;
-					builder.update(hashes[i]);
-					builder.update(hashes[i]);
-					builder.final(hashes[i / 2]);
-					hashConsumer(&hashes[i / 2], 1);
+					inputs.push_back({ { RawBuffer(hashes[i]), RawBuffer(hashes[i]) }, 2 });
 					++numRemainingHashes;
 				}
 
+				levelHashes.resize(inputs.size());
+				Sha3_256_Multi(inputs.data(), levelHashes.data(), inputs.size());
+				std::copy(levelHashes.cbegin(), levelHashes.cend(), hashes.begin());
+				hashConsumer(hashes.data(), levelHashes.size());
+
 				numRemainingHashes /= 2;
 			}
 
@@ -0,0 +1,333 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MultiBufferHashes.h"
+#include "Hashes.h"
+#include "catapult/utils/Casting.h"
+#include "catapult/exceptions.h"
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define CATAPULT_MULTI_BUFFER_SHA3_SIMD
+#endif
+
+namespace catapult { namespace crypto {
+
+	namespace {
+		// region scalar
+
+		void Sha3_256_MultiScalar(const MultiBufferHashInput* pInputs, Hash256* pHashes, size_t count) {
+			for (auto i = 0u; i < count; ++i) {
+				Sha3_256_Builder builder;
+				for (auto j = 0u; j < pInputs[i].NumBuffers; ++j)
+					builder.update(pInputs[i].Buffers[j]);
+
+				builder.final(pHashes[i]);
+			}
+		}
+
+		// endregion
+
+#ifdef CATAPULT_MULTI_BUFFER_SHA3_SIMD
+
+		// region keccak
+
+		// SHA3-256 absorbs 136 bytes (17 lanes) per permutation
+		constexpr size_t Rate = 136;
+		constexpr size_t Num_Rate_Lanes = Rate / sizeof(uint64_t);
+		constexpr size_t Num_State_Lanes = 25;
+
+		constexpr uint64_t Round_Constants[] = {
+			0x0000000000000001, 0x0000000000008082, 0x800000000000808A, 0x8000000080008000,
+			0x000000000000808B, 0x0000000080000001, 0x8000000080008081, 0x8000000000008009,
+			0x000000000000008A, 0x0000000000000088, 0x0000000080008009, 0x000000008000000A,
+			0x000000008000808B, 0x800000000000008B, 0x8000000000008089, 0x8000000000008003,
+			0x8000000000008002, 0x8000000000000080, 0x000000000000800A, 0x800000008000000A,
+			0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008
+		};
+
+		constexpr unsigned Rho_Offsets[] = {
+			1, 3, 6, 10, 15, 21, 28, 36, 45, 55, 2, 14, 27, 41, 56, 8, 25, 43, 62, 18, 39, 61, 20, 44
+		};
+
+		constexpr unsigned Pi_Lanes[] = {
+			10, 7, 11, 17, 18, 3, 5, 16, 8, 21, 24, 4, 15, 23, 19, 13, 12, 2, 20, 14, 22, 9, 6, 1
+		};
+
+		// each vector element holds the same keccak lane of a different input
+		using Vector4 = uint64_t __attribute__((vector_size(32)));
+		using Vector8 = uint64_t __attribute__((vector_size(64)));
+
+		// notice that all functions operating on vectors are force inlined into the functions that enable the
+		// corresponding instruction set extensions, so they are compiled with those extensions
+
+		// notice that vectors are never passed or returned by value in order to avoid ABI differences
+		template<typename TVector>
+		__attribute__((always_inline)) inline void RotateLeft(TVector& result, const TVector& vector, unsigned shift) {
+			result = (vector << shift) | (vector >> (64 - shift));
+		}
+
+		// notice that inner loops are unrolled so that all lane indexes and rotation offsets are compile time constants
+		template<typename TVector>
+		__attribute__((always_inline)) inline void KeccakF1600(TVector* state) {
+			TVector columns[5];
+			for (auto round = 0u; round < 24; ++round) {
+				// theta
+				#pragma GCC unroll 25
+				for (auto x = 0u; x < 5; ++x)
+					columns[x] = state[x] ^ state[x + 5] ^ state[x + 10] ^ state[x + 15] ^ state[x + 20];
+
+				#pragma GCC unroll 25
+				for (auto x = 0u; x < 5; ++x) {
+					TVector temp;
+					RotateLeft(temp, columns[(x + 1) % 5], 1);
+					temp ^= columns[(x + 4) % 5];
+					#pragma GCC unroll 25
+					for (auto y = 0u; y < Num_State_Lanes; y += 5)
+						state[y + x] ^= temp;
+				}
+
+				// rho and pi
+				auto current = state[1];
+				#pragma GCC unroll 25
+				for (auto i = 0u; i < 24; ++i) {
+					auto next = state[Pi_Lanes[i]];
+					RotateLeft(state[Pi_Lanes[i]], current, Rho_Offsets[i]);
+					current = next;
+				}
+
+				// chi
+				#pragma GCC unroll 25
+				for (auto y = 0u; y < Num_State_Lanes; y += 5) {
+					#pragma GCC unroll 25
+					for (auto x = 0u; x < 5; ++x)
+						columns[x] = state[y + x];
+
+					#pragma GCC unroll 25
+					for (auto x = 0u; x < 5; ++x)
+						state[y + x] = columns[x] ^ (~columns[(x + 1) % 5] & columns[(x + 2) % 5]);
+				}
+
+				// iota
+				state[0] ^= Round_Constants[round];
+			}
+		}
+
+		// endregion
+
+		// region PaddedMessageReader
+
+		// reads rate-sized SHA3 padded blocks from a (multi-buffer) input
+		class PaddedMessageReader {
+		public:
+			PaddedMessageReader() : PaddedMessageReader(MultiBufferHashInput{ {}, 0 })
+			{}
+
+			explicit PaddedMessageReader(const MultiBufferHashInput& input)
+					: m_input(input)
+					, m_bufferIndex(0)
+					, m_bufferOffset(0)
+					, m_numBlocks(0) {
+				size_t size = 0;
+				for (auto i = 0u; i < m_input.NumBuffers; ++i)
+					size += m_input.Buffers[i].Size;
+
+				// padding always requires at least one byte
+				m_numBlocks = size / Rate + 1;
+			}
+
+		public:
+			size_t numBlocks() const {
+				return m_numBlocks;
+			}
+
+		public:
+			void next(uint8_t* pBlock) {
+				size_t blockSize = 0;
+				while (blockSize < Rate && m_bufferIndex < m_input.NumBuffers) {
+					const auto& buffer = m_input.Buffers[m_bufferIndex];
+					auto copySize = std::min(Rate - blockSize, buffer.Size - m_bufferOffset);
+					std::memcpy(pBlock + blockSize, buffer.pData + m_bufferOffset, copySize);
+					blockSize += copySize;
+					m_bufferOffset += copySize;
+
+					if (buffer.Size == m_bufferOffset) {
+						++m_bufferIndex;
+						m_bufferOffset = 0;
+					}
+				}
+
+				if (Rate == blockSize)
+					return;
+
+				// last block needs to be padded
+				std::memset(pBlock + blockSize, 0, Rate - blockSize);
+				pBlock[blockSize] ^= 0x06;
+				pBlock[Rate - 1] ^= 0x80;
+			}
+
+		private:
+			MultiBufferHashInput m_input;
+			size_t m_bufferIndex;
+			size_t m_bufferOffset;
+			size_t m_numBlocks;
+		};
+
+		// endregion
+
+		// region lockstep hashing
+
+		template<typename TVector, size_t Num_Inputs>
+		__attribute__((always_inline)) inline void HashLockstep(const MultiBufferHashInput* pInputs, Hash256* pHashes, size_t count) {
+			std::array<PaddedMessageReader, Num_Inputs> readers;
+			size_t maxNumBlocks = 0;
+			for (auto i = 0u; i < count; ++i) {
+				readers[i] = PaddedMessageReader(pInputs[i]);
+				maxNumBlocks = std::max(maxNumBlocks, readers[i].numBlocks());
+			}
+
+			TVector state[Num_State_Lanes] = {};
+
+			uint8_t blocks[Num_Inputs][Rate];
+			std::memset(blocks, 0, sizeof(blocks));
+
+			std::array<Hash256, Num_Inputs> hashes;
+			for (auto blockIndex = 0u; blockIndex < maxNumBlocks; ++blockIndex) {
+				// absorb next block of each input; inputs with fewer blocks absorb zeros, which is harmless because
+				// their hashes have already been squeezed
+				for (auto i = 0u; i < count; ++i) {
+					if (blockIndex < readers[i].numBlocks())
+						readers[i].next(blocks[i]);
+					else
+						std::memset(blocks[i], 0, Rate);
+				}
+
+				for (auto laneIndex = 0u; laneIndex < Num_Rate_Lanes; ++laneIndex) {
+					TVector lane = {};
+					for (auto i = 0u; i < Num_Inputs; ++i) {
+						uint64_t value;
+						std::memcpy(&value, blocks[i] + laneIndex * sizeof(uint64_t), sizeof(uint64_t));
+						lane[i] = value;
+					}
+
+					state[laneIndex] ^= lane;
+				}
+
+				KeccakF1600(state);
+
+				// squeeze hashes of inputs that have been fully absorbed
+				for (auto i = 0u; i < count; ++i) {
+					if (blockIndex + 1 != readers[i].numBlocks())
+						continue;
+
+					for (auto laneIndex = 0u; laneIndex < Hash256::Size / sizeof(uint64_t); ++laneIndex) {
+						uint64_t value = state[laneIndex][i];
+						std::memcpy(hashes[i].data() + laneIndex * sizeof(uint64_t), &value, sizeof(uint64_t));
+					}
+				}
+			}
+
+			std::copy(hashes.cbegin(), hashes.cbegin() + static_cast<std::ptrdiff_t>(count), pHashes);
+		}
+
+		template<typename TVector, size_t Num_Inputs>
+		__attribute__((always_inline)) inline void HashAllLockstep(const MultiBufferHashInput* pInputs, Hash256* pHashes, size_t count) {
+			for (size_t i = 0; i < count; i += Num_Inputs)
+				HashLockstep<TVector, Num_Inputs>(pInputs + i, pHashes + i, std::min(Num_Inputs, count - i));
+		}
+
+		__attribute__((target("avx2"))) void Sha3_256_MultiAvx2(const MultiBufferHashInput* pInputs, Hash256* pHashes, size_t count) {
+			HashAllLockstep<Vector4, 4>(pInputs, pHashes, count);
+		}
+
+		__attribute__((target("avx512f"))) void Sha3_256_MultiAvx512(
+				const MultiBufferHashInput* pInputs,
+				Hash256* pHashes,
+				size_t count) {
+			HashAllLockstep<Vector8, 8>(pInputs, pHashes, count);
+		}
+
+		// endregion
+
+#endif
+
+		MultiBufferSha3Implementation DetectDefaultImplementation() {
+			if (IsSupported(MultiBufferSha3Implementation::Avx512))
+				return MultiBufferSha3Implementation::Avx512;
+
+			if (IsSupported(MultiBufferSha3Implementation::Avx2))
+				return MultiBufferSha3Implementation::Avx2;
+
+			return MultiBufferSha3Implementation::Scalar;
+		}
+	}
+
+	bool IsSupported(MultiBufferSha3Implementation implementation) {
+		switch (implementation) {
+		case MultiBufferSha3Implementation::Scalar:
+			return true;
+
+#ifdef CATAPULT_MULTI_BUFFER_SHA3_SIMD
+		case MultiBufferSha3Implementation::Avx2:
+			__builtin_cpu_init();
+			return __builtin_cpu_supports("avx2");
+
+		case MultiBufferSha3Implementation::Avx512:
+			__builtin_cpu_init();
+			return __builtin_cpu_supports("avx512f");
+#endif
+
+		default:
+			return false;
+		}
+	}
+
+	MultiBufferSha3Implementation GetDefaultMultiBufferSha3Implementation() {
+		static const auto Default_Implementation = DetectDefaultImplementation();
+		return Default_Implementation;
+	}
+
+	void Sha3_256_Multi(const MultiBufferHashInput* pInputs, Hash256* pHashes, size_t count) {
+		Sha3_256_Multi(GetDefaultMultiBufferSha3Implementation(), pInputs, pHashes, count);
+	}
+
+	void Sha3_256_Multi(
+			MultiBufferSha3Implementation implementation,
+			const MultiBufferHashInput* pInputs,
+			Hash256* pHashes,
+			size_t count) {
+		switch (implementation) {
+		case MultiBufferSha3Implementation::Scalar:
+			return Sha3_256_MultiScalar(pInputs, pHashes, count);
+
+#ifdef CATAPULT_MULTI_BUFFER_SHA3_SIMD
+		case MultiBufferSha3Implementation::Avx2:
+			return Sha3_256_MultiAvx2(pInputs, pHashes, count);
+
+		case MultiBufferSha3Implementation::Avx512:
+			return Sha3_256_MultiAvx512(pInputs, pHashes, count);
+#endif
+
+		default:
+			CATAPULT_THROW_INVALID_ARGUMENT_1("unsupported multi-buffer sha3 implementation", utils::to_underlying_type(implementation));
+		}
+	}
+}}
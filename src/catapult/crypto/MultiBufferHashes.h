@@ -0,0 +1,71 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/types.h"
+#include <array>
+
+namespace catapult { namespace crypto {
+
+	/// Input to multi-buffer hashing composed of up to four concatenated buffers.
+	struct MultiBufferHashInput {
+	public:
+		/// Maximum number of buffers.
+		static constexpr size_t Max_Buffers = 4;
+
+	public:
+		/// Buffers.
+		std::array<RawBuffer, Max_Buffers> Buffers;
+
+		/// Number of buffers.
+		size_t NumBuffers;
+	};
+
+	/// Multi-buffer SHA3 implementations.
+	enum class MultiBufferSha3Implementation {
+		/// Inputs are hashed one at a time.
+		Scalar,
+
+		/// Four inputs are hashed in lockstep using AVX2 instructions.
+		Avx2,
+
+		/// Eight inputs are hashed in lockstep using AVX-512 instructions.
+		Avx512
+	};
+
+	/// Returns \c true if \a implementation is supported by the current cpu.
+	bool IsSupported(MultiBufferSha3Implementation implementation);
+
+	/// Gets the fastest multi-buffer SHA3 implementation supported by the current cpu.
+	MultiBufferSha3Implementation GetDefaultMultiBufferSha3Implementation();
+
+	/// Calculates the 256-bit SHA3 hashes of \a count inputs (\a pInputs) into \a pHashes.
+	/// \note The fastest implementation supported by the current cpu is used.
+	void Sha3_256_Multi(const MultiBufferHashInput* pInputs, Hash256* pHashes, size_t count);
+
+	/// Calculates the 256-bit SHA3 hashes of \a count inputs (\a pInputs) into \a pHashes using \a implementation.
+	/// \note \a implementation must be supported by the current cpu.
+	void Sha3_256_Multi(
+			MultiBufferSha3Implementation implementation,
+			const MultiBufferHashInput* pInputs,
+			Hash256* pHashes,
+			size_t count);
+}}
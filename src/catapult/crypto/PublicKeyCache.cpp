@@ -0,0 +1,233 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "PublicKeyCache.h"
+#include "catapult/utils/Hashers.h"
+#include "catapult/utils/SpinLock.h"
+#include <donna/catapult.h>
+#include <array>
+#include <list>
+#include <unordered_map>
+
+namespace catapult { namespace crypto {
+
+	namespace {
+		// region PreparedPublicKey
+
+		struct PreparedPublicKey {
+			// inverse of public key
+			ge25519 ALIGN(16) A;
+
+			// odd multiples of A used by double scalar multiplication
+			ge25519_pniels ALIGN(16) Multiples[S1_TABLE_SIZE];
+		};
+
+		bool Prepare(PreparedPublicKey& preparedKey, const Key& publicKey) {
+			if (!UnpackNegativeAndCheckSubgroup(preparedKey.A, publicKey))
+				return false;
+
+			ge25519_double_scalarmult_precompute(preparedKey.Multiples, &preparedKey.A);
+			return true;
+		}
+
+		// endregion
+
+		// region PublicKeyCacheShard
+
+		// estimated size of a cached public key, including map node, list node and shared pointer overhead
+		constexpr uint64_t Entry_Size = sizeof(PreparedPublicKey) + 2 * Key::Size + 128;
+
+		constexpr size_t Num_Shards = 16;
+
+		class PublicKeyCacheShard {
+		private:
+			using KeyList = std::list<Key>;
+
+			struct Entry {
+				std::shared_ptr<const PreparedPublicKey> pPreparedKey;
+				KeyList::iterator RecentKeysIter;
+			};
+
+		public:
+			size_t size() const {
+				utils::SpinLockGuard guard(m_lock);
+				return m_entries.size();
+			}
+
+		public:
+			std::shared_ptr<const PreparedPublicKey> tryFind(const Key& publicKey) {
+				utils::SpinLockGuard guard(m_lock);
+				auto iter = m_entries.find(publicKey);
+				if (m_entries.cend() == iter)
+					return nullptr;
+
+				m_recentKeys.splice(m_recentKeys.begin(), m_recentKeys, iter->second.RecentKeysIter);
+				return iter->second.pPreparedKey;
+			}
+
+			void add(const Key& publicKey, const std::shared_ptr<const PreparedPublicKey>& pPreparedKey, size_t maxKeys) {
+				utils::SpinLockGuard guard(m_lock);
+				if (m_entries.cend() != m_entries.find(publicKey))
+					return;
+
+				m_recentKeys.push_front(publicKey);
+				m_entries.emplace(publicKey, Entry{ pPreparedKey, m_recentKeys.begin() });
+				trimUnlocked(maxKeys);
+			}
+
+			void trim(size_t maxKeys) {
+				utils::SpinLockGuard guard(m_lock);
+				trimUnlocked(maxKeys);
+			}
+
+		private:
+			void trimUnlocked(size_t maxKeys) {
+				while (m_entries.size() > maxKeys) {
+					m_entries.erase(m_recentKeys.back());
+					m_recentKeys.pop_back();
+				}
+			}
+
+		private:
+			KeyList m_recentKeys; // most recently used keys are at the front
+			std::unordered_map<Key, Entry, utils::ArrayHasher<Key>> m_entries;
+			mutable utils::SpinLock m_lock;
+		};
+
+		// endregion
+
+		// region PublicKeyCache
+
+		class PublicKeyCache {
+		public:
+			// cache is disabled until it is configured
+			PublicKeyCache()
+					: m_maxKeysPerShard(0)
+					, m_numHits(0)
+					, m_numMisses(0)
+			{}
+
+		public:
+			bool isEnabled() const {
+				return 0 != m_maxKeysPerShard;
+			}
+
+			PublicKeyCacheStatistics statistics() const {
+				size_t numKeys = 0;
+				for (const auto& shard : m_shards)
+					numKeys += shard.size();
+
+				return { m_numHits, m_numMisses, numKeys, utils::FileSize::FromBytes(numKeys * Entry_Size) };
+			}
+
+		public:
+			void setMaxSize(utils::FileSize maxSize) {
+				m_maxKeysPerShard = static_cast<size_t>(maxSize.bytes() / Entry_Size / Num_Shards);
+				for (auto& shard : m_shards)
+					shard.trim(m_maxKeysPerShard);
+			}
+
+			void clear() {
+				for (auto& shard : m_shards)
+					shard.trim(0);
+
+				m_numHits = 0;
+				m_numMisses = 0;
+			}
+
+			std::shared_ptr<const PreparedPublicKey> findOrPrepare(const Key& publicKey) {
+				auto& shard = m_shards[publicKey[0] % Num_Shards];
+				auto pPreparedKey = shard.tryFind(publicKey);
+				if (pPreparedKey) {
+					++m_numHits;
+					return pPreparedKey;
+				}
+
+				++m_numMisses;
+
+				// only valid public keys are cached
+				auto pNewPreparedKey = std::make_shared<PreparedPublicKey>();
+				if (!Prepare(*pNewPreparedKey, publicKey))
+					return nullptr;
+
+				shard.add(publicKey, pNewPreparedKey, m_maxKeysPerShard);
+				return pNewPreparedKey;
+			}
+
+		private:
+			std::array<PublicKeyCacheShard, Num_Shards> m_shards;
+			std::atomic<size_t> m_maxKeysPerShard;
+			std::atomic<uint64_t> m_numHits;
+			std::atomic<uint64_t> m_numMisses;
+		};
+
+		PublicKeyCache& GetPublicKeyCache() {
+			static PublicKeyCache cache;
+			return cache;
+		}
+
+		// endregion
+	}
+
+	void SetPublicKeyCacheMaxSize(utils::FileSize maxSize) {
+		GetPublicKeyCache().setMaxSize(maxSize);
+	}
+
+	PublicKeyCacheStatistics GetPublicKeyCacheStatistics() {
+		return GetPublicKeyCache().statistics();
+	}
+
+	void ClearPublicKeyCache() {
+		GetPublicKeyCache().clear();
+	}
+
+	bool UnpackNegativeAndCheckSubgroupCached(ge25519& A, const Key& publicKey) {
+		auto& cache = GetPublicKeyCache();
+		if (!cache.isEnabled())
+			return UnpackNegativeAndCheckSubgroup(A, publicKey);
+
+		auto pPreparedKey = cache.findOrPrepare(publicKey);
+		if (!pPreparedKey)
+			return false;
+
+		A = pPreparedKey->A;
+		return true;
+	}
+
+	bool DoubleScalarMultCached(ge25519& R, const Key& publicKey, const bignum256modm_type& h, const bignum256modm_type& s) {
+		auto& cache = GetPublicKeyCache();
+		if (!cache.isEnabled()) {
+			ge25519 ALIGN(16) A;
+			if (!UnpackNegativeAndCheckSubgroup(A, publicKey))
+				return false;
+
+			ge25519_double_scalarmult_vartime(&R, &A, h, s);
+			return true;
+		}
+
+		auto pPreparedKey = cache.findOrPrepare(publicKey);
+		if (!pPreparedKey)
+			return false;
+
+		ge25519_double_scalarmult_vartime_precomputed(&R, pPreparedKey->Multiples, h, s);
+		return true;
+	}
+}}
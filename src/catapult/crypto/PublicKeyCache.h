@@ -0,0 +1,61 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "CryptoUtils.h"
+#include "catapult/utils/FileSize.h"
+
+namespace catapult { namespace crypto {
+
+	/// Public key cache statistics.
+	struct PublicKeyCacheStatistics {
+		/// Number of public keys found in the cache.
+		uint64_t NumHits;
+
+		/// Number of public keys not found in the cache.
+		uint64_t NumMisses;
+
+		/// Number of cached public keys.
+		size_t NumKeys;
+
+		/// Estimated size of cached public keys.
+		utils::FileSize Size;
+	};
+
+	/// Sets the maximum size of the process-wide cache of decompressed public keys and their precomputed multiples to \a maxSize.
+	/// \note The cache is disabled until a nonzero size is set and a zero size disables it again.
+	void SetPublicKeyCacheMaxSize(utils::FileSize maxSize);
+
+	/// Gets the process-wide public key cache statistics.
+	PublicKeyCacheStatistics GetPublicKeyCacheStatistics();
+
+	/// Removes all public keys from the process-wide public key cache and resets its statistics.
+	void ClearPublicKeyCache();
+
+	/// Unpacks inverse of \a publicKey into \a A and validates it like UnpackNegativeAndCheckSubgroup.
+	/// \note The public key cache is used, so validation is skipped for cached public keys.
+	bool UnpackNegativeAndCheckSubgroupCached(ge25519& A, const Key& publicKey);
+
+	/// Calculates \a R = \a s * B - \a h * \a publicKey, where B is the base point.
+	/// Returns \c false if \a publicKey is not valid.
+	/// \note The public key cache is used, so decompression and validation are skipped for cached public keys.
+	bool DoubleScalarMultCached(ge25519& R, const Key& publicKey, const bignum256modm_type& h, const bignum256modm_type& s);
+}}
@@ -22,6 +22,7 @@
 #include "Signer.h"
 #include "CryptoUtils.h"
 #include "Hashes.h"
+#include "PublicKeyCache.h"
 #include "SecureZero.h"
 #include "catapult/exceptions.h"
 #include <donna/catapult.h>
@@ -167,17 +168,13 @@ namespace catapult { namespace crypto {
 		bignum256modm h;
 		expand256_modm(h, hash_h.data(), 64);
 
-		// A = -pub
-		ge25519 ALIGN(16) A;
-		if (!UnpackNegativeAndCheckSubgroup(A, publicKey))
-			return false;
-
 		bignum256modm S;
 		expand256_modm(S, encodedS, 32);
 
-		// R = encodedS * B - h * A
+		// R = encodedS * B - h * pub
 		ge25519 ALIGN(16) R;
-		ge25519_double_scalarmult_vartime(&R, &A, h, S);
+		if (!DoubleScalarMultCached(R, publicKey, h, S))
+			return false;
 
 		// compare calculated R to given R
 		uint8_t checkr[Encoded_Size];
@@ -189,6 +186,8 @@ namespace catapult { namespace crypto {
 
 	// region VerifyMulti
 
+	static_assert(max_batch_size == Max_Verify_Multi_Batch_Size, "Max_Verify_Multi_Batch_Size must match donna batch size");
+
 	namespace {
 		std::pair<std::vector<bool>, bool> CheckForCanonicalFormAndNonzeroKeys(const SignatureInput* pSignatureInputs, size_t count) {
 			// reject if not canonical or public key is zero
@@ -206,14 +205,91 @@ namespace catapult { namespace crypto {
 
 		bool VerifySingle(const SignatureInput* pSignatureInputs, size_t offset, size_t count, std::vector<bool>& valid) {
 			bool aggregateResult = true;
-			for (auto i = 0u; i < count; ++i) {
-				valid[offset + i] = Verify(pSignatureInputs[i].PublicKey, pSignatureInputs[i].Buffers, pSignatureInputs[i].Signature);
-				aggregateResult &= valid[offset + i];
+			for (auto i = offset; i < offset + count; ++i) {
+				valid[i] = Verify(pSignatureInputs[i].PublicKey, pSignatureInputs[i].Buffers, pSignatureInputs[i].Signature);
+				aggregateResult &= valid[i];
 			}
 
 			return aggregateResult;
 		}
 
+		// because batch verification has some overhead like computing scalars, it is only faster when verifying more than 3 signatures
+		constexpr size_t Max_Single_Verification_Count = 3;
+
+		bool VerifyBatch(const RandomFiller& randomFiller, const SignatureInput* pSignatureInputs, size_t batchSize) {
+			batch_heap ALIGN(16) batch;
+			ge25519 ALIGN(16) p;
+
+			// generate r (scalars[batchSize+1]..scalars[2*batchSize]
+			// compute scalars[0] = ((r1s1 + r2s2 + ...))
+			randomFiller(reinterpret_cast<uint8_t*>(batch.r), batchSize * 16);
+			auto* r_scalars = &batch.scalars[batchSize + 1];
+			for (auto i = 0u; i < batchSize; ++i) {
+				expand256_modm(r_scalars[i], batch.r[i], 16);
+				expand256_modm(batch.scalars[i], pSignatureInputs[i].Signature.data() + 32, 32);
+				mul256_modm(batch.scalars[i], batch.scalars[i], r_scalars[i]);
+				if (0u < i)
+					add256_modm(batch.scalars[0], batch.scalars[0], batch.scalars[i]);
+			}
+
+			// compute scalars[1]..scalars[batchSize] as r[i]*H(R[i],A[i],m[i])
+			for (auto i = 0u; i < batchSize; ++i) {
+				Hash512 hash_h;
+				Sha512_Builder hasher_h;
+				const auto& signatureInput = pSignatureInputs[i];
+				hasher_h.update({ { signatureInput.Signature.data(), Encoded_Size }, signatureInput.PublicKey });
+				for (const auto& buffer : signatureInput.Buffers)
+					hasher_h.update(buffer);
+
+				hasher_h.final(hash_h);
+
+				expand256_modm(batch.scalars[i + 1], hash_h.data(), 64);
+				mul256_modm(batch.scalars[i + 1], batch.scalars[i + 1], r_scalars[i]);
+			}
+
+			// compute points
+			batch.points[0] = ge25519_basepoint;
+			for (auto i = 0u; i < batchSize; ++i) {
+				const auto& signatureInput = pSignatureInputs[i];
+				auto R = signatureInput.Signature.copyTo<Key>();
+				if (!UnpackNegativeAndCheckSubgroupCached(batch.points[i + 1], signatureInput.PublicKey))
+					return false;
+
+				if (!UnpackNegativeAndCheckSubgroup(batch.points[batchSize + i + 1], R))
+					return false;
+			}
+
+			ge25519_multi_scalarmult_vartime(&p, &batch, (batchSize * 2) + 1);
+			return ge25519_is_neutral_vartime(&p);
+		}
+
+		// finds all invalid signatures in a failed batch by bisecting it
+		// (cheaper than verifying all signatures individually when only a few signatures are invalid)
+		void VerifyFailedBatch(
+				const RandomFiller& randomFiller,
+				const SignatureInput* pSignatureInputs,
+				size_t offset,
+				size_t count,
+				std::pair<std::vector<bool>, bool>& result) {
+			if (count <= Max_Single_Verification_Count) {
+				result.second &= VerifySingle(pSignatureInputs, offset, count, result.first);
+				return;
+			}
+
+			auto leftCount = count / 2;
+			auto rightOffset = offset + leftCount;
+			auto rightCount = count - leftCount;
+			if (VerifyBatch(randomFiller, pSignatureInputs + offset, leftCount)) {
+				// valid signatures always pass batch verification, so right half must contain an invalid signature
+				VerifyFailedBatch(randomFiller, pSignatureInputs, rightOffset, rightCount, result);
+				return;
+			}
+
+			VerifyFailedBatch(randomFiller, pSignatureInputs, offset, leftCount, result);
+			if (rightCount <= Max_Single_Verification_Count || !VerifyBatch(randomFiller, pSignatureInputs + rightOffset, rightCount))
+				VerifyFailedBatch(randomFiller, pSignatureInputs, rightOffset, rightCount, result);
+		}
+
 		bool VerifyBatches(
 				const RandomFiller& randomFiller,
 				const SignatureInput* pSignatureInputs,
@@ -221,62 +297,13 @@ namespace catapult { namespace crypto {
 				std::pair<std::vector<bool>, bool>& result,
 				const predicate<size_t, size_t>& fallback) {
 			size_t offset = 0;
-			batch_heap ALIGN(16) batch;
-			ge25519 ALIGN(16) p;
-			bignum256modm* r_scalars;
-			size_t batchSize;
 			auto& aggregateResult = result.second;
 
-			// because batch verification has some overhead like computing scalars, it is only faster when verifying more than 3 signatures
-			while (count > 3) {
-				batchSize = (count > max_batch_size) ? max_batch_size : count;
-
-				// generate r (scalars[batchSize+1]..scalars[2*batchSize]
-				// compute scalars[0] = ((r1s1 + r2s2 + ...))
-				randomFiller(reinterpret_cast<uint8_t*>(batch.r), batchSize * 16);
-				r_scalars = &batch.scalars[batchSize + 1];
-				for (auto i = 0u; i < batchSize; ++i) {
-					expand256_modm(r_scalars[i], batch.r[i], 16);
-					expand256_modm(batch.scalars[i], pSignatureInputs[offset + i].Signature.data() + 32, 32);
-					mul256_modm(batch.scalars[i], batch.scalars[i], r_scalars[i]);
-					if (0u < i)
-						add256_modm(batch.scalars[0], batch.scalars[0], batch.scalars[i]);
-				}
-
-				// compute scalars[1]..scalars[batchSize] as r[i]*H(R[i],A[i],m[i])
-				for (auto i = 0u; i < batchSize; ++i) {
-					Hash512 hash_h;
-					Sha512_Builder hasher_h;
-					const auto& signatureInput = pSignatureInputs[offset + i];
-					hasher_h.update({ { signatureInput.Signature.data(), Encoded_Size }, signatureInput.PublicKey });
-					for (const auto& buffer : signatureInput.Buffers)
-						hasher_h.update(buffer);
-
-					hasher_h.final(hash_h);
-
-					expand256_modm(batch.scalars[i + 1], hash_h.data(), 64);
-					mul256_modm(batch.scalars[i + 1], batch.scalars[i + 1], r_scalars[i]);
-				}
-
-				// compute points
-				batch.points[0] = ge25519_basepoint;
-				bool success = true;
-				for (auto i = 0u; i < batchSize; ++i) {
-					const auto& signatureInput = pSignatureInputs[offset + i];
-					auto R = signatureInput.Signature.copyTo<Key>();
-					success &= UnpackNegativeAndCheckSubgroup(batch.points[i + 1], signatureInput.PublicKey);
-					success &= UnpackNegativeAndCheckSubgroup(batch.points[batchSize + i + 1], R);
-					if (!success)
-						break;
-				}
-
-				if (success) {
-					ge25519_multi_scalarmult_vartime(&p, &batch, (batchSize * 2) + 1);
-					success = ge25519_is_neutral_vartime(&p);
-				}
+			while (count > Max_Single_Verification_Count) {
+				auto batchSize = std::min<size_t>(count, Max_Verify_Multi_Batch_Size);
 
 				// fallback if batch verification failed
-				if (!success && !fallback(offset, batchSize))
+				if (!VerifyBatch(randomFiller, pSignatureInputs + offset, batchSize) && !fallback(offset, batchSize))
 					return false;
 
 				count -= batchSize;
@@ -293,10 +320,12 @@ namespace catapult { namespace crypto {
 			const SignatureInput* pSignatureInputs,
 			size_t count) {
 		auto result = CheckForCanonicalFormAndNonzeroKeys(pSignatureInputs, count);
-		VerifyBatches(randomFiller, pSignatureInputs, count, result, [&pSignatureInputs, &result](auto offset, auto batchSize) {
-			result.second &= VerifySingle(pSignatureInputs, offset, batchSize, result.first);
+		auto fallback = [&randomFiller, pSignatureInputs, &result](auto offset, auto batchSize) {
+			VerifyFailedBatch(randomFiller, pSignatureInputs, offset, batchSize, result);
 			return true;
-		});
+		};
+
+		VerifyBatches(randomFiller, pSignatureInputs, count, result, fallback);
 		return result;
 	}
 
@@ -56,10 +56,15 @@ namespace catapult { namespace crypto {
 	/// Generates a specified number of random bytes into an output buffer.
 	using RandomFiller = consumer<uint8_t*, size_t>;
 
+	/// Maximum number of signatures that are verified with a single multi-scalar multiplication by VerifyMulti.
+	/// \note Larger inputs are split into batches of this size.
+	constexpr size_t Max_Verify_Multi_Batch_Size = 64;
+
 	/// Verifies that all \a count signatures pointed to by \a pSignatureInputs are valid.
 	/// \a randomFiller is used to generate random bytes.
 	/// Collates and returns a pair consisting of an aggregate result that is \c true when all signatures are valid
 	/// and a vector of bools that indicates the verification result for each individual signature.
+	/// \note Batches that fail verification are bisected in order to find the invalid signatures.
 	std::pair<std::vector<bool>, bool> VerifyMulti(const RandomFiller& randomFiller, const SignatureInput* pSignatureInputs, size_t count);
 
 	/// Verifies that all \a count signatures pointed to by \a pSignatureInputs are valid.
@@ -23,9 +23,12 @@
 #include "BaseSetDefaultTraits.h"
 #include "BaseSetFindIterator.h"
 #include "DeltaElements.h"
+#include "catapult/utils/ArenaMemoryResource.h"
 #include "catapult/utils/NonCopyable.h"
 #include "catapult/exceptions.h"
+#include <map>
 #include <memory>
+#include <optional>
 #include <type_traits>
 #include <unordered_map>
 
@@ -97,6 +100,7 @@ namespace catapult { namespace deltaset {
 		explicit BaseSetDelta(const SetType& originalElements)
 				: m_originalElements(originalElements)
 				, m_generationId(1)
+				, m_keyGenerationIdMap(std::in_place, &m_arena)
 		{}
 
 	public:
@@ -312,8 +316,11 @@ namespace catapult { namespace deltaset {
 			m_removedElements.clear();
 			m_copiedElements.clear();
 
+			// generation tracking is per delta, so release all of its memory in bulk
 			m_generationId = 1;
-			m_keyGenerationIdMap.clear();
+			m_keyGenerationIdMap.reset();
+			m_arena.reset();
+			m_keyGenerationIdMap.emplace(&m_arena);
 		}
 
 	public:
@@ -324,8 +331,8 @@ namespace catapult { namespace deltaset {
 
 		/// Gets the generation id associated with \a key.
 		uint32_t generationId(const KeyType& key) const {
-			auto iter = m_keyGenerationIdMap.find(key);
-			return m_keyGenerationIdMap.cend() == iter ? 0 : iter->second;
+			auto iter = m_keyGenerationIdMap->find(key);
+			return m_keyGenerationIdMap->cend() == iter ? 0 : iter->second;
 		}
 
 		/// Increments the generation id.
@@ -336,24 +343,24 @@ namespace catapult { namespace deltaset {
 	private:
 		void markKey(const KeyType& key) {
 			// latest generation id should always be stored
-			m_keyGenerationIdMap[key] = m_generationId;
+			(*m_keyGenerationIdMap)[key] = m_generationId;
 		}
 
 		void clearKey(const KeyType& key) {
-			m_keyGenerationIdMap.erase(key);
+			m_keyGenerationIdMap->erase(key);
 		}
 
 	private:
 		// for sorted containers, use map because no hasher is specified
 		template<typename T, typename = void>
 		struct KeyGenerationIdMap {
-			using Type = std::map<KeyType, uint32_t, typename T::key_compare>;
+			using Type = std::pmr::map<KeyType, uint32_t, typename T::key_compare>;
 		};
 
 		// for hashed containers, use unordered_map because hasher is specified
 		template<typename T>
 		struct KeyGenerationIdMap<T, utils::traits::is_type_expression_t<typename T::hasher>> {
-			using Type = std::unordered_map<KeyType, uint32_t, typename T::hasher, typename T::key_equal>;
+			using Type = std::pmr::unordered_map<KeyType, uint32_t, typename T::hasher, typename T::key_equal>;
 		};
 
 	private:
@@ -363,7 +370,8 @@ namespace catapult { namespace deltaset {
 		MemorySetType m_copiedElements;
 
 		uint32_t m_generationId;
-		typename KeyGenerationIdMap<SetType>::Type m_keyGenerationIdMap;
+		utils::ArenaMemoryResource m_arena;
+		std::optional<typename KeyGenerationIdMap<SetType>::Type> m_keyGenerationIdMap;
 
 	private:
 		template<typename TElementTraits2, typename TSetTraits2>
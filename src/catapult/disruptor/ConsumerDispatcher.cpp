@@ -21,6 +21,7 @@
 
 #include "ConsumerDispatcher.h"
 #include "ConsumerEntry.h"
+#include "ConsumerWaiter.h"
 #include "catapult/thread/ThreadInfo.h"
 #include "catapult/utils/Functional.h"
 #include <thread>
@@ -63,18 +64,28 @@ namespace catapult { namespace disruptor {
 			, m_disruptor(options.DisruptorSize, options.ElementTraceInterval)
 			, m_inspector(inspector)
 			, m_numActiveElements(0) {
+		for (auto i = 0u; i < consumers.size(); ++i)
+			m_waiters.push_back(CreateConsumerWaiter(options.WaitStrategy));
+
 		auto currentLevel = 0u;
 		for (const auto& consumer : consumers) {
 			ConsumerEntry consumerEntry(currentLevel++);
 			m_threads.spawn([pThis = this, consumerEntry, consumer]() mutable {
 				thread::SetThreadName(std::to_string(consumerEntry.level()) + " " + pThis->name());
+
+				auto& waiter = *pThis->m_waiters[consumerEntry.level()];
+				auto isReady = [pThis, &consumerEntry]() {
+					return !pThis->m_keepRunning || pThis->m_barriers[consumerEntry.level()].position() != consumerEntry.position();
+				};
+
 				while (pThis->m_keepRunning) {
 					auto* pDisruptorElement = pThis->tryNext(consumerEntry);
 					if (!pDisruptorElement) {
-						std::this_thread::sleep_for(std::chrono::milliseconds(10));
+						waiter.wait(isReady);
 						continue;
 					}
 
+					waiter.reset();
 					auto result = consumer(pDisruptorElement->input());
 					if (CompletionStatus::Aborted == result.CompletionStatus)
 						pThis->m_disruptor.markSkipped(consumerEntry.position(), result);
@@ -93,6 +104,9 @@ namespace catapult { namespace disruptor {
 
 	void ConsumerDispatcher::shutdown() {
 		m_keepRunning = false;
+		for (const auto& pWaiter : m_waiters)
+			pWaiter->notify();
+
 		m_threads.join();
 	}
 
@@ -132,26 +146,42 @@ namespace catapult { namespace disruptor {
 		m_barriers[consumerEntry.level() + 1].advance();
 
 		// if advance was called by the last consumer, then run the inspector on the (current) thread of the last consumer
-		if (consumerEntry.level() + 1 != m_barriers.size() - 1)
+		if (consumerEntry.level() + 1 != m_barriers.size() - 1) {
+			m_waiters[consumerEntry.level() + 1]->notify();
 			return;
+		}
 
+		// abandoned elements (with zero id) were never dispatched, so they are not inspected
 		auto& element = m_disruptor.elementAt(consumerPosition);
-		LogCompletion(element, m_barriers, m_elementTraceInterval);
-		m_inspector(element.input(), element.completionResult());
+		if (0 != element.id()) {
+			LogCompletion(element, m_barriers, m_elementTraceInterval);
+			m_inspector(element.input(), element.completionResult());
+		}
+
 		element.markProcessingComplete();
 	}
 
-	bool ConsumerDispatcher::canProcessNextElement() const {
+	bool ConsumerDispatcher::tryClaim(PositionType& position) {
 		auto minPosition = m_barriers[m_barriers.size() - 1].position();
-		auto maxPosition = m_barriers[0].position();
-		auto requiredCapacity = maxPosition - minPosition + 1 + 1; // check for space for *next* element
-		auto totalCapacity = m_disruptor.capacity();
+		auto isClaimed = m_disruptor.tryClaim(minPosition, position);
 
-		if (requiredCapacity < totalCapacity)
+		// warn when the claim fails or uses the last available position
+		if (isClaimed && position - minPosition + 1 + 1 < m_disruptor.capacity())
 			return true;
 
+		auto maxPosition = m_barriers[0].position();
 		CATAPULT_LOG(warning) << "disruptor is full (minPosition = " << minPosition << ", maxPosition = " << maxPosition << ")";
-		return requiredCapacity == totalCapacity;
+		return isClaimed;
+	}
+
+	void ConsumerDispatcher::publish(PositionType position) {
+		// consumers process elements in position order, so wait for all preceding claims to be published
+		while (m_barriers[0].position() != position)
+			std::this_thread::yield();
+
+		m_barriers[0].advance();
+		if (!m_waiters.empty())
+			m_waiters[0]->notify();
 	}
 
 	ProcessingCompleteFunc ConsumerDispatcher::wrap(const ProcessingCompleteFunc& processingComplete) {
@@ -167,9 +197,9 @@ namespace catapult { namespace disruptor {
 			return 0;
 		}
 
-		// need to atomically check spare capacity AND add element
-		utils::SpinLockGuard guard(m_addSpinLock);
-		if (!canProcessNextElement()) {
+		// claim a position (checking spare capacity) without blocking other producers, fill it and then publish it
+		PositionType position;
+		if (!tryClaim(position)) {
 			if (m_shouldThrowIfFull)
 				CATAPULT_THROW_RUNTIME_ERROR("consumer is too far behind");
 
@@ -177,8 +207,19 @@ namespace catapult { namespace disruptor {
 		}
 
 		++m_numActiveElements;
-		auto id = m_disruptor.add(std::move(input), wrap(processingComplete));
-		m_barriers[0].advance();
+
+		// claimed position must always be published, otherwise all later producers would wait for it forever
+		DisruptorElementId id;
+		try {
+			id = m_disruptor.emplace(position, std::move(input), wrap(processingComplete));
+		} catch (...) {
+			--m_numActiveElements;
+			m_disruptor.abandon(position);
+			publish(position);
+			throw;
+		}
+
+		publish(position);
 		return id;
 	}
 
@@ -27,8 +27,14 @@
 #include "catapult/thread/ThreadGroup.h"
 #include "catapult/utils/NamedObject.h"
 #include <atomic>
+#include <memory>
 
-namespace catapult { namespace disruptor { class ConsumerEntry; } }
+namespace catapult {
+	namespace disruptor {
+		class ConsumerEntry;
+		class ConsumerWaiter;
+	}
+}
 
 namespace catapult { namespace disruptor {
 
@@ -76,7 +82,9 @@ namespace catapult { namespace disruptor {
 
 		void advance(ConsumerEntry& consumerEntry);
 
-		bool canProcessNextElement() const;
+		bool tryClaim(PositionType& position);
+
+		void publish(PositionType position);
 
 		ProcessingCompleteFunc wrap(const ProcessingCompleteFunc& processingComplete);
 
@@ -85,11 +93,10 @@ namespace catapult { namespace disruptor {
 		bool m_shouldThrowIfFull;
 		std::atomic_bool m_keepRunning;
 		DisruptorBarriers m_barriers;
+		std::vector<std::unique_ptr<ConsumerWaiter>> m_waiters; // one waiter per consumer level
 		Disruptor m_disruptor;
 		DisruptorInspector m_inspector;
 		thread::ThreadGroup m_threads;
 		std::atomic<size_t> m_numActiveElements;
-
-		utils::SpinLock m_addSpinLock; // lock to serialize access to Disruptor::add
 	};
 }}
@@ -24,6 +24,18 @@
 
 namespace catapult { namespace disruptor {
 
+	/// Strategy used by idle consumers to wait for new elements.
+	enum class ConsumerWaitStrategy {
+		/// Consumers spin continuously without ever releasing their cores.
+		Busy_Spin,
+
+		/// Consumers spin briefly, then yield and finally park until they are notified about new elements.
+		Spin_Yield_Park,
+
+		/// Consumers sleep for exponentially increasing durations.
+		Timed_Backoff
+	};
+
 	/// Consumer dispatcher options.
 	struct ConsumerDispatcherOptions {
 	public:
@@ -33,6 +45,7 @@ namespace catapult { namespace disruptor {
 				, DisruptorSize(disruptorSize)
 				, ElementTraceInterval(1)
 				, ShouldThrowWhenFull(true)
+				, WaitStrategy(ConsumerWaitStrategy::Spin_Yield_Park)
 		{}
 
 	public:
@@ -47,5 +60,8 @@ namespace catapult { namespace disruptor {
 
 		/// \c true if the dispatcher should throw when full, \c false if it should return an error.
 		bool ShouldThrowWhenFull;
+
+		/// Strategy used by idle consumers to wait for new elements.
+		ConsumerWaitStrategy WaitStrategy;
 	};
 }}
@@ -0,0 +1,162 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ConsumerWaiter.h"
+#include "catapult/exceptions.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+namespace catapult { namespace disruptor {
+
+	namespace {
+		void Pause() {
+#if defined(__x86_64__) || defined(_M_X64)
+			_mm_pause();
+#endif
+		}
+
+		// region BusySpinWaiter
+
+		class BusySpinWaiter : public ConsumerWaiter {
+		public:
+			void wait(const predicate<>&) override {
+				Pause();
+			}
+
+			void reset() override
+			{}
+
+			void notify() override
+			{}
+		};
+
+		// endregion
+
+		// region SpinYieldParkWaiter
+
+		class SpinYieldParkWaiter : public ConsumerWaiter {
+		private:
+			static constexpr uint32_t Num_Spins = 1024;
+			static constexpr uint32_t Num_Yields = 64;
+
+		public:
+			SpinYieldParkWaiter()
+					: m_numIdleCalls(0)
+					, m_isParked(false)
+			{}
+
+		public:
+			void wait(const predicate<>& isReady) override {
+				if (m_numIdleCalls < Num_Spins + Num_Yields) {
+					if (m_numIdleCalls++ < Num_Spins)
+						Pause();
+					else
+						std::this_thread::yield();
+
+					return;
+				}
+
+				// m_isParked must be set before isReady is checked so that a concurrent notify either observes the parked
+				// flag (and wakes this thread) or happens before the check (and isReady observes the change)
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_isParked = true;
+				m_condition.wait(lock, isReady);
+				m_isParked = false;
+			}
+
+			void reset() override {
+				m_numIdleCalls = 0;
+			}
+
+			void notify() override {
+				if (!m_isParked)
+					return;
+
+				// acquire the lock to prevent notification from being lost between isReady check and wait
+				{
+					std::lock_guard<std::mutex> lock(m_mutex);
+				}
+
+				m_condition.notify_one();
+			}
+
+		private:
+			uint32_t m_numIdleCalls;
+			std::atomic_bool m_isParked;
+			std::mutex m_mutex;
+			std::condition_variable m_condition;
+		};
+
+		// endregion
+
+		// region TimedBackoffWaiter
+
+		class TimedBackoffWaiter : public ConsumerWaiter {
+		private:
+			static constexpr auto Min_Backoff = std::chrono::microseconds(50);
+			static constexpr auto Max_Backoff = std::chrono::microseconds(10'000);
+
+		public:
+			TimedBackoffWaiter() : m_backoff(Min_Backoff)
+			{}
+
+		public:
+			void wait(const predicate<>&) override {
+				std::this_thread::sleep_for(m_backoff);
+				m_backoff = std::min<std::chrono::microseconds>(2 * m_backoff, Max_Backoff);
+			}
+
+			void reset() override {
+				m_backoff = Min_Backoff;
+			}
+
+			void notify() override
+			{}
+
+		private:
+			std::chrono::microseconds m_backoff;
+		};
+
+		// endregion
+	}
+
+	std::unique_ptr<ConsumerWaiter> CreateConsumerWaiter(ConsumerWaitStrategy strategy) {
+		switch (strategy) {
+		case ConsumerWaitStrategy::Busy_Spin:
+			return std::make_unique<BusySpinWaiter>();
+
+		case ConsumerWaitStrategy::Spin_Yield_Park:
+			return std::make_unique<SpinYieldParkWaiter>();
+
+		case ConsumerWaitStrategy::Timed_Backoff:
+			return std::make_unique<TimedBackoffWaiter>();
+		}
+
+		CATAPULT_THROW_INVALID_ARGUMENT_1("unsupported consumer wait strategy", static_cast<uint32_t>(strategy));
+	}
+}}
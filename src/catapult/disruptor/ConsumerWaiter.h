@@ -0,0 +1,49 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "ConsumerDispatcherOptions.h"
+#include "catapult/functions.h"
+#include <memory>
+
+namespace catapult { namespace disruptor {
+
+	/// Waits on behalf of an idle consumer until new elements are available.
+	class ConsumerWaiter {
+	public:
+		virtual ~ConsumerWaiter() = default;
+
+	public:
+		/// Idles once after the consumer found no element.
+		/// \note \a isReady is checked before blocking and must return \c true when the consumer should wake up.
+		virtual void wait(const predicate<>& isReady) = 0;
+
+		/// Resets the idle state after the consumer found an element.
+		virtual void reset() = 0;
+
+		/// Wakes up the consumer if it is blocked in wait.
+		/// \note This must be called after any change that causes isReady to return \c true.
+		virtual void notify() = 0;
+	};
+
+	/// Creates a consumer waiter implementing \a strategy.
+	std::unique_ptr<ConsumerWaiter> CreateConsumerWaiter(ConsumerWaitStrategy strategy);
+}}
@@ -28,22 +28,49 @@ namespace catapult { namespace disruptor {
 
 	// short rationale for lack of locks:
 	//  1. m_container is initialized with size, so most operations here don't require locks
-	//  2. add is guarded by a lock inside ConsumerDispatcher, which checks if the Disruptor is full
+	//  2. tryClaim atomically reserves a unique position, so concurrent producers never write the same element;
+	//     it only succeeds when the slowest consumer is far enough behind so that the reused element is no longer accessed
 	//  3. markSkipped and isSkipped are guarded by a lock inside DisruptorElement
 
 	Disruptor::Disruptor(size_t disruptorSize, size_t elementTraceInterval)
 			: m_elementTraceInterval(elementTraceInterval)
 			, m_container(disruptorSize)
+			, m_claimPosition(0)
 			, m_allElementsCount(0)
 	{}
 
 	DisruptorElementId Disruptor::add(ConsumerInput&& input, const ProcessingCompleteFunc& processingComplete) {
-		auto element = DisruptorElement(std::move(input), ++m_allElementsCount, processingComplete);
+		return emplace(m_claimPosition++, std::move(input), processingComplete);
+	}
+
+	bool Disruptor::tryClaim(PositionType minConsumerPosition, PositionType& position) {
+		// check for space for the claimed element and one element that might still be inspected by the last consumer
+		auto claimPosition = m_claimPosition.load();
+		do {
+			if (claimPosition - minConsumerPosition + 1 + 1 > m_container.capacity())
+				return false;
+		} while (!m_claimPosition.compare_exchange_weak(claimPosition, claimPosition + 1));
+
+		position = claimPosition;
+		return true;
+	}
+
+	DisruptorElementId Disruptor::emplace(
+			PositionType position,
+			ConsumerInput&& input,
+			const ProcessingCompleteFunc& processingComplete) {
+		auto element = DisruptorElement(std::move(input), position + 1, processingComplete);
 		if (IsIntervalElementId(element.id(), m_elementTraceInterval))
 			CATAPULT_LOG(debug) << "disruptor queuing " << element;
 
-		m_container.push_back(std::move(element));
-		return element.id();
+		auto id = element.id();
+		m_container[position] = std::move(element);
+		++m_allElementsCount;
+		return id;
+	}
+
+	void Disruptor::abandon(PositionType position) {
+		m_container[position].abandon(position);
 	}
 
 	void Disruptor::markSkipped(PositionType position, const ConsumerResult& result) {
@@ -27,6 +27,8 @@
 #include "catapult/model/EntityRange.h"
 #include "catapult/utils/CircularBuffer.h"
 #include "catapult/utils/NonCopyable.h"
+#include <algorithm>
+#include <atomic>
 #include <vector>
 
 namespace catapult { namespace disruptor {
@@ -41,8 +43,21 @@ namespace catapult { namespace disruptor {
 	public:
 		/// Adds \a input to the underlying container and returns the assigned disruptor element id.
 		/// Once the processing of the input is complete, \a processingComplete will be called.
+		/// \note This claims the next position without checking capacity and must not be mixed with concurrent claims.
 		DisruptorElementId add(ConsumerInput&& input, const ProcessingCompleteFunc& processingComplete);
 
+		/// Attempts to claim the next position given the position of the slowest consumer (\a minConsumerPosition).
+		/// On success, returns \c true and sets \a position to the claimed position.
+		/// \note This is safe to call concurrently from multiple producers.
+		bool tryClaim(PositionType minConsumerPosition, PositionType& position);
+
+		/// Stores \a input at the claimed \a position and returns the assigned disruptor element id.
+		/// Once the processing of the input is complete, \a processingComplete will be called.
+		DisruptorElementId emplace(PositionType position, ConsumerInput&& input, const ProcessingCompleteFunc& processingComplete);
+
+		/// Replaces the element at the claimed \a position with an abandoned element that is skipped by all consumers.
+		void abandon(PositionType position);
+
 		/// Sets the skip flag on the element at \a position with \a result.
 		void markSkipped(PositionType position, const ConsumerResult& result);
 
@@ -56,7 +71,7 @@ namespace catapult { namespace disruptor {
 
 		/// Gets the size of the disruptor.
 		inline size_t size() const {
-			return m_container.size();
+			return static_cast<size_t>(std::min<uint64_t>(m_allElementsCount, m_container.capacity()));
 		}
 
 		/// Gets the capacity of the disruptor.
@@ -72,6 +87,9 @@ namespace catapult { namespace disruptor {
 	private:
 		size_t m_elementTraceInterval;
 		utils::CircularBuffer<DisruptorElement> m_container;
-		std::atomic<uint64_t> m_allElementsCount;
+
+		// producer counters are padded to avoid false sharing with the (consumer read) container
+		alignas(Cache_Line_Size) std::atomic<PositionType> m_claimPosition;
+		alignas(Cache_Line_Size) std::atomic<uint64_t> m_allElementsCount;
 	};
 }}
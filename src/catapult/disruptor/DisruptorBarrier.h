@@ -30,7 +30,8 @@ namespace catapult { namespace disruptor {
 
 	/// DisruptorBarrier represents a consumer barrier (possibly shared by multiple consumers)
 	/// at a given level.
-	class DisruptorBarrier {
+	/// \note Each barrier occupies its own cache line so that advancing it does not invalidate neighboring barriers.
+	class alignas(Cache_Line_Size) DisruptorBarrier {
 	public:
 		/// Creates a barrier given its \a level and position (\a barrierEndPosition).
 		DisruptorBarrier(size_t level, PositionType position)
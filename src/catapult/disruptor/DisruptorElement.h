@@ -81,6 +81,15 @@ namespace catapult { namespace disruptor {
 			m_result.FinalConsumerPosition = position;
 		}
 
+		/// Replaces the element with an empty element that is skipped at \a position and has neither an id nor a completion handler.
+		/// \note This is used for positions that were claimed but could not be filled.
+		void abandon(PositionType position) {
+			m_input = ConsumerInput();
+			m_id = 0;
+			m_processingComplete = [](auto, auto) {};
+			markSkipped(position, ConsumerResult::Abort());
+		}
+
 		/// Calls the completion handler for the element.
 		void markProcessingComplete() {
 			m_processingComplete(m_id, m_result);
@@ -29,6 +29,9 @@ namespace catapult { namespace disruptor {
 	/// Position within disruptor components.
 	using PositionType = uint64_t;
 
+	/// Size of a cache line used to pad counters that are modified by different threads.
+	constexpr size_t Cache_Line_Size = 64;
+
 	/// Id of a disruptor element.
 	using DisruptorElementId = uint64_t;
 
@@ -29,12 +29,20 @@
 #include "catapult/config/CatapultDataDirectory.h"
 #include "catapult/config/NodeConfiguration.h"
 #include "catapult/consumers/BlockChainSyncHandlers.h"
+#include "catapult/crypto/Hashes.h"
 #include "catapult/io/BlockStorageCache.h"
 #include "catapult/io/BufferedFileStream.h"
 #include "catapult/io/FilesystemUtils.h"
 #include "catapult/io/IndexFile.h"
+#include "catapult/io/MemoryMappedInputStream.h"
+#include "catapult/io/PodIoUtils.h"
 #include "catapult/plugins/PluginManager.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 #include "catapult/utils/StackLogger.h"
+#include <sstream>
+#include <thread>
+#include <unordered_map>
 
 namespace catapult { namespace extensions {
 
@@ -42,7 +50,10 @@ namespace catapult { namespace extensions {
 
 	namespace {
 		constexpr size_t Default_Loader_Batch_Size = 100'000;
+		constexpr size_t State_File_Buffer_Size = 1024 * 1024;
 		constexpr auto Supplemental_Data_Filename = "supplemental.dat";
+		constexpr auto Manifest_Filename = "manifest.dat";
+		constexpr uint16_t Manifest_Version = 1;
 
 		std::string GetStorageFilename(const cache::CacheStorage& storage) {
 			return storage.name() + ".dat";
@@ -51,6 +62,133 @@ namespace catapult { namespace extensions {
 
 	// endregion
 
+	// region checksum stream
+
+	namespace {
+		class ChecksumOutputStream : public io::OutputStream {
+		public:
+			explicit ChecksumOutputStream(io::OutputStream& output)
+					: m_output(output)
+					, m_size(0)
+			{}
+
+		public:
+			uint64_t size() const {
+				return m_size;
+			}
+
+			Hash256 checksum() {
+				Hash256 checksum;
+				m_hashBuilder.final(checksum);
+				return checksum;
+			}
+
+		public:
+			void write(const RawBuffer& buffer) override {
+				m_output.write(buffer);
+				m_hashBuilder.update(buffer);
+				m_size += buffer.Size;
+			}
+
+			void flush() override {
+				m_output.flush();
+			}
+
+		private:
+			io::OutputStream& m_output;
+			crypto::Sha3_256_Builder m_hashBuilder;
+			uint64_t m_size;
+		};
+	}
+
+	// endregion
+
+	// region manifest
+
+	namespace {
+		// manifest lists the size and checksum of every cache storage file in a state directory;
+		// state saved before manifests were introduced does not have one and is loaded without verification
+		struct StateFileInfo {
+			std::string Filename;
+			uint64_t Size;
+			Hash256 Checksum;
+		};
+
+		using StateManifest = std::unordered_map<std::string, StateFileInfo>;
+
+		void SaveManifest(const config::CatapultDirectory& directory, const std::vector<StateFileInfo>& fileInfos) {
+			io::BufferedOutputFileStream output(io::RawFile(directory.file(Manifest_Filename), io::OpenMode::Read_Write));
+			io::Write16(output, Manifest_Version);
+			io::Write32(output, static_cast<uint32_t>(fileInfos.size()));
+			for (const auto& fileInfo : fileInfos) {
+				io::Write16(output, static_cast<uint16_t>(fileInfo.Filename.size()));
+				output.write({ reinterpret_cast<const uint8_t*>(fileInfo.Filename.data()), fileInfo.Filename.size() });
+				io::Write64(output, fileInfo.Size);
+				output.write(fileInfo.Checksum);
+			}
+
+			output.flush();
+		}
+
+		bool TryLoadManifest(const config::CatapultDirectory& directory, StateManifest& manifest) {
+			if (!std::filesystem::exists(directory.file(Manifest_Filename)))
+				return false;
+
+			io::BufferedInputFileStream input(io::RawFile(directory.file(Manifest_Filename), io::OpenMode::Read_Only));
+			auto version = io::Read16(input);
+			if (Manifest_Version != version)
+				CATAPULT_THROW_RUNTIME_ERROR_1("unsupported state manifest version", version);
+
+			auto numFileInfos = io::Read32(input);
+			for (auto i = 0u; i < numFileInfos; ++i) {
+				StateFileInfo fileInfo;
+				fileInfo.Filename.resize(io::Read16(input));
+				input.read({ reinterpret_cast<uint8_t*>(fileInfo.Filename.data()), fileInfo.Filename.size() });
+				fileInfo.Size = io::Read64(input);
+				input.read(fileInfo.Checksum);
+				manifest.emplace(fileInfo.Filename, fileInfo);
+			}
+
+			return true;
+		}
+	}
+
+	// endregion
+
+	// region parallel storage processing
+
+	namespace {
+		// processes each storage on a dedicated pool because the node pool is not running during shutdown
+		template<typename TStorages, typename TAction>
+		void ProcessStoragesParallel(const char* operationName, TStorages& storages, TAction action) {
+			if (storages.empty())
+				return;
+
+			auto numWorkerThreads = std::min<size_t>(storages.size(), std::max(1u, std::thread::hardware_concurrency()));
+			auto pPool = thread::CreateIoThreadPool(numWorkerThreads, operationName);
+			pPool->start();
+
+			// process each storage in its own partition so that a slow storage does not delay the others
+			std::vector<uint64_t> elapsedMillis(storages.size());
+			auto processStorage = [action, &elapsedMillis](auto& pStorage, auto index) {
+				utils::StackTimer stopwatch;
+				action(*pStorage, index);
+				elapsedMillis[index] = stopwatch.millis();
+			};
+			thread::ParallelForRethrowFirstException(pPool->ioContext(), storages, storages.size(), processStorage);
+			pPool->join();
+
+			std::ostringstream out;
+			out << operationName << " timings";
+			for (auto i = 0u; i < storages.size(); ++i)
+				out << std::endl << " + " << storages[i]->name() << " (" << elapsedMillis[i] << "ms)";
+
+			CATAPULT_LOG(important) << out.str();
+		}
+	}
+
+	// endregion
+
 	// region HasSerializedState
 
 	bool HasSerializedState(const config::CatapultDirectory& directory) {
@@ -62,10 +200,6 @@ namespace catapult { namespace extensions {
 	// region LoadDependentStateFromDirectory
 
 	namespace {
-		io::BufferedInputFileStream OpenInputStream(const config::CatapultDirectory& directory, const std::string& filename) {
-			return io::BufferedInputFileStream(io::RawFile(directory.file(filename), io::OpenMode::Read_Only));
-		}
-
 		void LoadDependentStateFromDirectory(
 				const config::CatapultDirectory& directory,
 				cache::CatapultCache& cache,
@@ -73,7 +207,7 @@ namespace catapult { namespace extensions {
 			// load supplemental data
 			Height chainHeight;
 			{
-				auto inputStream = OpenInputStream(directory, Supplemental_Data_Filename);
+				io::MemoryMappedInputStream inputStream(directory.file(Supplemental_Data_Filename));
 				cache::LoadSupplementalData(inputStream, supplementalData, chainHeight);
 			}
 
@@ -101,14 +235,44 @@ namespace catapult { namespace extensions {
 			if (!HasSerializedState(directory))
 				return false;
 
-			// 1. load cache data
-			utils::StackLogger stopwatch("load state", utils::LogLevel::important);
-			for (const auto& pStorage : cache.storages()) {
-				auto inputStream = OpenInputStream(directory, GetStorageFilename(*pStorage));
-				pStorage->loadAll(inputStream, Default_Loader_Batch_Size);
-			}
+			StateManifest manifest;
+			auto hasManifest = TryLoadManifest(directory, manifest);
+			if (!hasManifest)
+				CATAPULT_LOG(warning) << "state manifest is not present, cache data will not be verified";
 
-			// 2. load supplemental data
+			// 1. map and verify all cache data before loading any of it in order to reject bad files before the cache is modified
+			utils::StackLogger stopwatch("load state", utils::LogLevel::important);
+			auto storages = cache.storages();
+			std::vector<std::unique_ptr<io::MemoryMappedInputStream>> inputStreams(storages.size());
+			auto verifyStorage = [&directory, &manifest, hasManifest, &inputStreams](const auto& storage, auto index) {
+				auto filename = GetStorageFilename(storage);
+				auto pInputStream = std::make_unique<io::MemoryMappedInputStream>(directory.file(filename));
+				if (hasManifest) {
+					auto manifestIter = manifest.find(filename);
+					if (manifest.cend() == manifestIter)
+						CATAPULT_THROW_RUNTIME_ERROR_1("state manifest does not contain file", filename);
+
+					const auto& fileInfo = manifestIter->second;
+					if (fileInfo.Size != pInputStream->buffer().Size)
+						CATAPULT_THROW_RUNTIME_ERROR_1("state file has unexpected size", filename);
+
+					Hash256 checksum;
+					crypto::Sha3_256(pInputStream->buffer(), checksum);
+					if (fileInfo.Checksum != checksum)
+						CATAPULT_THROW_RUNTIME_ERROR_1("state file has unexpected checksum", filename);
+				}
+
+				inputStreams[index] = std::move(pInputStream);
+			};
+
+			ProcessStoragesParallel("verify state", storages, verifyStorage);
+
+			// 2. load cache data (each sub cache is independent, so all can be loaded concurrently)
+			ProcessStoragesParallel("load state", storages, [&inputStreams](auto& storage, auto index) {
+				storage.loadAll(*inputStreams[index], Default_Loader_Batch_Size);
+			});
+
+			// 3. load supplemental data
 			LoadDependentStateFromDirectory(directory, cache, supplementalData);
 			return true;
 		}
@@ -140,7 +304,7 @@ namespace catapult { namespace extensions {
 
 	namespace {
 		io::BufferedOutputFileStream OpenOutputStream(const config::CatapultDirectory& directory, const std::string& filename) {
-			return io::BufferedOutputFileStream(io::RawFile(directory.file(filename), io::OpenMode::Read_Write));
+			return io::BufferedOutputFileStream(io::RawFile(directory.file(filename), io::OpenMode::Read_Write), State_File_Buffer_Size);
 		}
 
 		void SaveStateToDirectory(
@@ -153,13 +317,21 @@ namespace catapult { namespace extensions {
 			// 1. create directory if required
 			config::CatapultDirectory(directory.path()).create();
 
-			// 2. save cache data
-			for (const auto& pStorage : cacheStorages) {
-				auto outputStream = OpenOutputStream(directory, GetStorageFilename(*pStorage));
-				save(*pStorage, outputStream);
-			}
+			// 2. save cache data (each storage only reads its own sub cache, so all can be saved concurrently)
+			std::vector<StateFileInfo> fileInfos(cacheStorages.size());
+			ProcessStoragesParallel("save state", cacheStorages, [&directory, &save, &fileInfos](const auto& storage, auto index) {
+				auto filename = GetStorageFilename(storage);
+				auto outputStream = OpenOutputStream(directory, filename);
+				ChecksumOutputStream checksumOutputStream(outputStream);
+				save(storage, checksumOutputStream);
+
+				fileInfos[index] = { filename, checksumOutputStream.size(), checksumOutputStream.checksum() };
+			});
+
+			// 3. save manifest
+			SaveManifest(directory, fileInfos);
 
-			// 3. save supplemental data
+			// 4. save supplemental data
 			cache::SupplementalData supplementalData{ state, score };
 			auto outputStream = OpenOutputStream(directory, Supplemental_Data_Filename);
 			cache::SaveSupplementalData(supplementalData, height, outputStream);
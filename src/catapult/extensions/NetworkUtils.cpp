@@ -50,6 +50,7 @@ namespace catapult { namespace extensions {
 		settings.Timeout = config.Node.ConnectTimeout;
 		settings.SocketWorkingBufferSize = config.Node.SocketWorkingBufferSize;
 		settings.SocketWorkingBufferSensitivity = config.Node.SocketWorkingBufferSensitivity;
+		settings.SocketWriteCoalescingSize = config.Node.SocketWriteCoalescingSize;
 		settings.MaxPacketDataSize = config.Node.MaxPacketDataSize;
 		settings.OutgoingProtocols = ionet::MapNodeRolesToIpProtocols(config.Node.Local.Roles);
 
@@ -23,6 +23,11 @@
 #include "MoveBlockFiles.h"
 #include "catapult/model/Elements.h"
 #include "catapult/utils/MemoryUtils.h"
+#include "catapult/utils/SpinLock.h"
+#include <algorithm>
+#include <cstring>
+#include <list>
+#include <map>
 
 namespace catapult { namespace io {
 
@@ -30,40 +35,157 @@ namespace catapult { namespace io {
 		std::shared_ptr<const model::Block> BlockElementAsSharedBlock(const std::shared_ptr<const model::BlockElement>& pBlockElement) {
 			return std::shared_ptr<const model::Block>(&pBlockElement->Block, [pBlockElement](const auto*) {});
 		}
+
+		// block element that owns its block
+		struct OwningBlockElement {
+		public:
+			explicit OwningBlockElement(std::unique_ptr<model::Block>&& pBlockParam)
+					: pBlock(std::move(pBlockParam))
+					, Element(*pBlock)
+			{}
+
+		public:
+			std::unique_ptr<model::Block> pBlock;
+			model::BlockElement Element;
+		};
+
+		// copies all parts of \a blockElement that are loaded by BlockStorage::loadBlockElement
+		std::shared_ptr<const model::BlockElement> CopyBlockElement(const model::BlockElement& blockElement) {
+			auto pBlock = utils::MakeUniqueWithSize<model::Block>(blockElement.Block.Size);
+			std::memcpy(static_cast<void*>(pBlock.get()), &blockElement.Block, blockElement.Block.Size);
+
+			auto pOwningBlockElement = std::make_shared<OwningBlockElement>(std::move(pBlock));
+			auto& element = pOwningBlockElement->Element;
+			element.EntityHash = blockElement.EntityHash;
+			element.GenerationHash = blockElement.GenerationHash;
+			element.SubCacheMerkleRoots = blockElement.SubCacheMerkleRoots;
+
+			auto iter = blockElement.Transactions.cbegin();
+			for (const auto& transaction : element.Block.Transactions()) {
+				element.Transactions.emplace_back(transaction);
+				element.Transactions.back().EntityHash = iter->EntityHash;
+				element.Transactions.back().MerkleComponentHash = iter->MerkleComponentHash;
+				++iter;
+			}
+
+			return std::shared_ptr<const model::BlockElement>(pOwningBlockElement, &element);
+		}
+
+		uint64_t EstimateSize(const model::BlockElement& blockElement) {
+			return sizeof(model::BlockElement)
+					+ blockElement.Block.Size
+					+ blockElement.SubCacheMerkleRoots.size() * Hash256::Size
+					+ blockElement.Transactions.size() * sizeof(model::TransactionElement);
+		}
 	}
 
 	// region CachedData
 
 	struct CachedData {
+	public:
+		explicit CachedData(uint64_t maxSize)
+				: m_maxSize(maxSize)
+				, m_size(0)
+				, m_numHits(0)
+				, m_numMisses(0)
+		{}
+
 	public:
 		Height height() const {
 			return m_pBlockElement ? m_pBlockElement->Block.Height : Height(0);
 		}
 
-		std::shared_ptr<const model::Block> block(Height) const {
-			return BlockElementAsSharedBlock(m_pBlockElement);
+		std::shared_ptr<const model::BlockElement> tryFind(Height height) const {
+			utils::SpinLockGuard guard(m_lock);
+
+			// block element at chain height is always available, so it is not counted
+			if (m_pBlockElement && height == m_pBlockElement->Block.Height)
+				return m_pBlockElement;
+
+			auto iter = m_entries.find(height);
+			if (m_entries.cend() == iter) {
+				++m_numMisses;
+				return nullptr;
+			}
+
+			m_recentHeights.splice(m_recentHeights.begin(), m_recentHeights, iter->second.RecentHeightsIter);
+			++m_numHits;
+			return iter->second.pBlockElement;
 		}
 
-		std::shared_ptr<const model::BlockElement> blockElement(Height) const {
-			return m_pBlockElement;
+		BlockStorageCacheStatistics statistics() const {
+			utils::SpinLockGuard guard(m_lock);
+			return { m_numHits, m_numMisses, m_entries.size(), utils::FileSize::FromBytes(m_size) };
 		}
 
 	public:
-		bool contains(Height height) const {
-			return height == m_pBlockElement->Block.Height;
+		bool canAdd(const model::BlockElement& blockElement) const {
+			return EstimateSize(blockElement) <= m_maxSize;
+		}
+
+		void add(const std::shared_ptr<const model::BlockElement>& pBlockElement) const {
+			auto size = EstimateSize(*pBlockElement);
+			if (size > m_maxSize)
+				return;
+
+			utils::SpinLockGuard guard(m_lock);
+			auto height = pBlockElement->Block.Height;
+			auto iter = m_entries.find(height);
+			if (m_entries.cend() != iter)
+				remove(iter);
+
+			m_recentHeights.push_front(height);
+			m_entries.emplace(height, Entry{ pBlockElement, size, m_recentHeights.begin() });
+			m_size += size;
+
+			// evict least recently used block elements
+			while (m_size > m_maxSize)
+				remove(m_entries.find(m_recentHeights.back()));
+		}
+
+		void dropAfter(Height height) {
+			utils::SpinLockGuard guard(m_lock);
+			auto iter = m_entries.upper_bound(height);
+			while (m_entries.end() != iter)
+				iter = remove(iter);
 		}
 
-	public:
 		void update(const std::shared_ptr<const model::BlockElement>& pBlockElement) {
+			utils::SpinLockGuard guard(m_lock);
 			m_pBlockElement = pBlockElement;
 		}
 
 		void reset() {
+			utils::SpinLockGuard guard(m_lock);
 			m_pBlockElement.reset();
 		}
 
 	private:
+		struct Entry {
+			std::shared_ptr<const model::BlockElement> pBlockElement;
+			uint64_t Size;
+			std::list<Height>::iterator RecentHeightsIter;
+		};
+
+		using EntryMap = std::map<Height, Entry>;
+
+		EntryMap::iterator remove(EntryMap::iterator iter) const {
+			m_size -= iter->second.Size;
+			m_recentHeights.erase(iter->second.RecentHeightsIter);
+			return m_entries.erase(iter);
+		}
+
+	private:
+		uint64_t m_maxSize;
 		std::shared_ptr<const model::BlockElement> m_pBlockElement;
+
+		// entries are added by (const) views, so all cache state is mutable and protected by m_lock
+		mutable EntryMap m_entries;
+		mutable std::list<Height> m_recentHeights; // most recently used height is first
+		mutable uint64_t m_size;
+		mutable uint64_t m_numHits;
+		mutable uint64_t m_numMisses;
+		mutable utils::SpinLock m_lock;
 	};
 
 	// endregion
@@ -89,18 +211,23 @@ namespace catapult { namespace io {
 
 	std::shared_ptr<const model::Block> BlockStorageView::loadBlock(Height height) const {
 		requireHeight(height, "block");
-		if (m_cachedData.contains(height))
-			return m_cachedData.block(height);
+		auto pBlockElement = m_cachedData.tryFind(height);
+		if (pBlockElement)
+			return BlockElementAsSharedBlock(pBlockElement);
 
+		// blocks are not added to the cache because they can't be converted into block elements
 		return m_storage.loadBlock(height);
 	}
 
 	std::shared_ptr<const model::BlockElement> BlockStorageView::loadBlockElement(Height height) const {
 		requireHeight(height, "block element");
-		if (m_cachedData.contains(height))
-			return m_cachedData.blockElement(height);
+		auto pBlockElement = m_cachedData.tryFind(height);
+		if (pBlockElement)
+			return pBlockElement;
 
-		return m_storage.loadBlockElement(height);
+		pBlockElement = m_storage.loadBlockElement(height);
+		m_cachedData.add(pBlockElement);
+		return pBlockElement;
 	}
 
 	std::pair<std::vector<uint8_t>, bool> BlockStorageView::loadBlockStatementData(Height height) const {
@@ -136,16 +263,25 @@ namespace catapult { namespace io {
 
 	void BlockStorageModifier::saveBlock(const model::BlockElement& blockElement) {
 		m_stagingStorage.saveBlock(blockElement);
+
+		// only copy block elements that can be cached, all others are loaded from storage when needed
+		if (m_cachedData.canAdd(blockElement))
+			m_savedBlockElements.push_back(CopyBlockElement(blockElement));
 	}
 
 	void BlockStorageModifier::saveBlocks(const std::vector<model::BlockElement>& blockElements) {
 		for (const auto& blockElement : blockElements)
-			m_stagingStorage.saveBlock(blockElement);
+			saveBlock(blockElement);
 	}
 
 	void BlockStorageModifier::dropBlocksAfter(Height height) {
 		m_stagingStorage.dropBlocksAfter(height);
 		m_saveStartHeight = height;
+
+		auto iter = std::find_if(m_savedBlockElements.cbegin(), m_savedBlockElements.cend(), [height](const auto& pBlockElement) {
+			return pBlockElement->Block.Height > height;
+		});
+		m_savedBlockElements.erase(iter, m_savedBlockElements.cend());
 	}
 
 	void BlockStorageModifier::commit() {
@@ -153,21 +289,32 @@ namespace catapult { namespace io {
 		MoveBlockFiles(m_stagingStorage, m_storage, m_saveStartHeight + Height(1));
 
 		// 2. update cache
+		m_cachedData.dropAfter(m_saveStartHeight);
+		for (const auto& pBlockElement : m_savedBlockElements)
+			m_cachedData.add(pBlockElement);
+
 		auto newChainHeight = m_storage.chainHeight();
-		if (newChainHeight > Height(0))
-			m_cachedData.update(m_storage.loadBlockElement(newChainHeight));
-		else
+		if (Height(0) == newChainHeight)
 			m_cachedData.reset();
+		else if (!m_savedBlockElements.empty() && newChainHeight == m_savedBlockElements.back()->Block.Height)
+			m_cachedData.update(m_savedBlockElements.back());
+		else
+			m_cachedData.update(m_storage.loadBlockElement(newChainHeight));
+
+		m_savedBlockElements.clear();
 	}
 
 	// endregion
 
 	// region BlockStorageCache
 
-	BlockStorageCache::BlockStorageCache(std::unique_ptr<BlockStorage>&& pStorage, std::unique_ptr<PrunableBlockStorage>&& pStagingStorage)
+	BlockStorageCache::BlockStorageCache(
+			std::unique_ptr<BlockStorage>&& pStorage,
+			std::unique_ptr<PrunableBlockStorage>&& pStagingStorage,
+			utils::FileSize maxCacheSize)
 			: m_pStorage(std::move(pStorage))
 			, m_pStagingStorage(std::move(pStagingStorage))
-			, m_pCachedData(std::make_unique<CachedData>()) {
+			, m_pCachedData(std::make_unique<CachedData>(maxCacheSize.bytes())) {
 		m_pCachedData->update(m_pStorage->loadBlockElement(m_pStorage->chainHeight()));
 	}
 
@@ -183,5 +330,9 @@ namespace catapult { namespace io {
 		return BlockStorageModifier(*m_pStorage, *m_pStagingStorage, std::move(writeLock), *m_pCachedData);
 	}
 
+	BlockStorageCacheStatistics BlockStorageCache::statistics() const {
+		return m_pCachedData->statistics();
+	}
+
 	// endregion
 }}
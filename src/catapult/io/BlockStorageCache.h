@@ -21,12 +21,28 @@
 
 #pragma once
 #include "BlockStorage.h"
+#include "catapult/utils/FileSize.h"
 #include "catapult/utils/SpinReaderWriterLock.h"
 
 namespace catapult { namespace io { struct CachedData; } }
 
 namespace catapult { namespace io {
 
+	/// Block storage cache statistics.
+	struct BlockStorageCacheStatistics {
+		/// Number of block and block element loads served from the cache.
+		uint64_t NumHits;
+
+		/// Number of block and block element loads delegated to the storage.
+		uint64_t NumMisses;
+
+		/// Number of cached block elements.
+		size_t NumBlockElements;
+
+		/// Estimated size of cached block elements.
+		utils::FileSize Size;
+	};
+
 	/// Read only view on top of block storage.
 	class BlockStorageView : utils::MoveOnly {
 	public:
@@ -90,14 +106,19 @@ namespace catapult { namespace io {
 		utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
 		CachedData& m_cachedData;
 		Height m_saveStartHeight;
+		std::vector<std::shared_ptr<const model::BlockElement>> m_savedBlockElements;
 	};
 
 	/// Cache around a BlockStorage.
-	/// \note Currently this "cache" provides synchronization and support for two-phase commit.
+	/// \note This cache provides synchronization, support for two-phase commit and caching of recently saved and loaded block elements.
 	class BlockStorageCache {
 	public:
 		/// Creates a new cache around \a pStorage that uses \a pStagingStorage for staging blocks in order to enable two-phase commit.
-		BlockStorageCache(std::unique_ptr<BlockStorage>&& pStorage, std::unique_ptr<PrunableBlockStorage>&& pStagingStorage);
+		/// At most \a maxCacheSize bytes of block elements are cached in addition to the block element at the chain height.
+		BlockStorageCache(
+				std::unique_ptr<BlockStorage>&& pStorage,
+				std::unique_ptr<PrunableBlockStorage>&& pStagingStorage,
+				utils::FileSize maxCacheSize = utils::FileSize());
 
 		/// Destroys the cache.
 		~BlockStorageCache();
@@ -109,6 +130,9 @@ namespace catapult { namespace io {
 		/// Gets a write only view of the storage.
 		BlockStorageModifier modifier();
 
+		/// Gets the cache statistics.
+		BlockStorageCacheStatistics statistics() const;
+
 	private:
 		std::unique_ptr<BlockStorage> m_pStorage;
 		std::unique_ptr<PrunableBlockStorage> m_pStagingStorage;
@@ -0,0 +1,171 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MemoryMappedFile.h"
+#include "catapult/exceptions.h"
+
+#ifdef _MSC_VER
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace catapult { namespace io {
+
+	namespace {
+		constexpr const char* Error_Open = "couldn't open the file";
+		constexpr const char* Error_Size = "couldn't determine file size";
+		constexpr const char* Error_Map = "couldn't map the file";
+
+		void ThrowError(const char* message, const std::string& pathname) {
+			CATAPULT_LOG(error) << message << " " << pathname;
+			CATAPULT_THROW_FILE_IO_ERROR(message);
+		}
+
+#ifdef _MSC_VER
+		class HandleGuard {
+		public:
+			explicit HandleGuard(HANDLE handle) : m_handle(handle)
+			{}
+
+			~HandleGuard() {
+				if (m_handle && INVALID_HANDLE_VALUE != m_handle)
+					::CloseHandle(m_handle);
+			}
+
+		public:
+			HANDLE get() const {
+				return m_handle;
+			}
+
+		private:
+			HANDLE m_handle;
+		};
+
+		const uint8_t* Map(const std::string& pathname, uint64_t& size) {
+			// allow other handles to append to and remove the mapped file
+			HandleGuard file(::CreateFileA(
+					pathname.c_str(),
+					GENERIC_READ,
+					FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+					nullptr,
+					OPEN_EXISTING,
+					FILE_ATTRIBUTE_NORMAL,
+					nullptr));
+			if (INVALID_HANDLE_VALUE == file.get())
+				ThrowError(Error_Open, pathname);
+
+			LARGE_INTEGER fileSize;
+			if (!::GetFileSizeEx(file.get(), &fileSize))
+				ThrowError(Error_Size, pathname);
+
+			size = static_cast<uint64_t>(fileSize.QuadPart);
+			if (0 == size)
+				return nullptr;
+
+			HandleGuard mapping(::CreateFileMappingA(file.get(), nullptr, PAGE_READONLY, 0, 0, nullptr));
+			if (!mapping.get())
+				ThrowError(Error_Map, pathname);
+
+			auto* pData = ::MapViewOfFile(mapping.get(), FILE_MAP_READ, 0, 0, 0);
+			if (!pData)
+				ThrowError(Error_Map, pathname);
+
+			return static_cast<const uint8_t*>(pData);
+		}
+
+		void Unmap(const uint8_t* pData, uint64_t) {
+			::UnmapViewOfFile(pData);
+		}
+#else
+		class DescriptorGuard {
+		public:
+			explicit DescriptorGuard(int fd) : m_fd(fd)
+			{}
+
+			~DescriptorGuard() {
+				if (-1 != m_fd)
+					::close(m_fd);
+			}
+
+		public:
+			int get() const {
+				return m_fd;
+			}
+
+		private:
+			int m_fd;
+		};
+
+		const uint8_t* Map(const std::string& pathname, uint64_t& size) {
+			DescriptorGuard fd(::open(pathname.c_str(), O_RDONLY | O_CLOEXEC));
+			if (-1 == fd.get())
+				ThrowError(Error_Open, pathname);
+
+			struct stat fileStat;
+			if (-1 == ::fstat(fd.get(), &fileStat))
+				ThrowError(Error_Size, pathname);
+
+			size = static_cast<uint64_t>(fileStat.st_size);
+			if (0 == size)
+				return nullptr;
+
+			// mapping keeps a reference to the file, so descriptor can be closed immediately
+			auto* pData = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd.get(), 0);
+			if (MAP_FAILED == pData)
+				ThrowError(Error_Map, pathname);
+
+			return static_cast<const uint8_t*>(pData);
+		}
+
+		void Unmap(const uint8_t* pData, uint64_t size) {
+			::munmap(const_cast<uint8_t*>(pData), size);
+		}
+#endif
+	}
+
+	MemoryMappedFile::MemoryMappedFile(const std::string& pathname)
+			: m_pathname(pathname)
+			, m_pData(nullptr)
+			, m_size(0) {
+		m_pData = Map(m_pathname, m_size);
+	}
+
+	MemoryMappedFile::~MemoryMappedFile() {
+		if (m_pData)
+			Unmap(m_pData, m_size);
+	}
+
+	const uint8_t* MemoryMappedFile::data() const {
+		return m_pData;
+	}
+
+	uint64_t MemoryMappedFile::size() const {
+		return m_size;
+	}
+
+	RawBuffer MemoryMappedFile::buffer() const {
+		return { m_pData, m_size };
+	}
+}}
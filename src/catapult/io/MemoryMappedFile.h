@@ -0,0 +1,56 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/utils/NonCopyable.h"
+#include "catapult/types.h"
+#include <string>
+
+namespace catapult { namespace io {
+
+	/// Read-only memory mapping of a whole file.
+	/// \note The mapping covers the file size at construction time. Appending to the file is safe, but truncating or
+	///       overwriting mapped data while the mapping is alive is not.
+	class MemoryMappedFile final : public utils::NonCopyable {
+	public:
+		/// Maps the file pointed to by \a pathname.
+		/// Throws catapult_file_io_error exception if the file could not be mapped.
+		explicit MemoryMappedFile(const std::string& pathname);
+
+		/// Unmaps the file.
+		~MemoryMappedFile();
+
+	public:
+		/// Gets a pointer to the mapped data.
+		const uint8_t* data() const;
+
+		/// Gets the size of the mapped data.
+		uint64_t size() const;
+
+		/// Gets the mapped data as a buffer.
+		RawBuffer buffer() const;
+
+	private:
+		const std::string m_pathname;
+		const uint8_t* m_pData;
+		uint64_t m_size;
+	};
+}}
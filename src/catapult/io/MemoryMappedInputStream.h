@@ -0,0 +1,64 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "BufferInputStreamAdapter.h"
+#include "MemoryMappedFile.h"
+
+namespace catapult { namespace io {
+
+	/// Input stream around a read-only memory mapping of a whole file.
+	/// \note Data is paged in lazily and is read without intermediate copies into a stream buffer.
+	class MemoryMappedInputStream : public InputStream {
+	public:
+		/// Creates an input stream around the file pointed to by \a pathname.
+		explicit MemoryMappedInputStream(const std::string& pathname)
+				: m_file(pathname)
+				, m_buffer(m_file.buffer())
+				, m_input(m_buffer)
+		{}
+
+	public:
+		/// Gets the mapped data.
+		RawBuffer buffer() const {
+			return m_buffer;
+		}
+
+		/// Gets the read position.
+		size_t position() const {
+			return m_input.position();
+		}
+
+	public:
+		bool eof() const override {
+			return m_input.eof();
+		}
+
+		void read(const MutableRawBuffer& buffer) override {
+			m_input.read(buffer);
+		}
+
+	private:
+		MemoryMappedFile m_file;
+		RawBuffer m_buffer;
+		BufferInputStreamAdapter<RawBuffer> m_input;
+	};
+}}
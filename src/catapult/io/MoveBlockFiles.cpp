@@ -26,7 +26,7 @@
 
 namespace catapult { namespace io {
 
-	void MoveBlockFiles(PrunableBlockStorage& sourceStorage, BlockStorage& destinationStorage, Height startHeight) {
+	void CopyBlockFiles(const BlockStorage& sourceStorage, BlockStorage& destinationStorage, Height startHeight) {
 		if (startHeight < Height(1))
 			CATAPULT_THROW_INVALID_ARGUMENT_1("invalid height passed", startHeight);
 
@@ -47,7 +47,10 @@ namespace catapult { namespace io {
 
 			destinationStorage.saveBlock(*pBlockElement);
 		}
+	}
 
+	void MoveBlockFiles(PrunableBlockStorage& sourceStorage, BlockStorage& destinationStorage, Height startHeight) {
+		CopyBlockFiles(sourceStorage, destinationStorage, startHeight);
 		sourceStorage.purge();
 	}
 }}
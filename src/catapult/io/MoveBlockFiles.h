@@ -31,6 +31,9 @@ namespace catapult {
 
 namespace catapult { namespace io {
 
+	/// Copies block files starting at \a startHeight from \a sourceStorage to \a destinationStorage.
+	void CopyBlockFiles(const BlockStorage& sourceStorage, BlockStorage& destinationStorage, Height startHeight);
+
 	/// Moves block files starting at \a startHeight from \a sourceStorage to \a destinationStorage.
 	void MoveBlockFiles(PrunableBlockStorage& sourceStorage, BlockStorage& destinationStorage, Height startHeight);
 }}
@@ -51,6 +51,7 @@ namespace catapult { namespace io {
 		constexpr const char* Error_Read = "couldn't read from file";
 		constexpr const char* Error_Seek = "couldn't seek in file";
 		constexpr const char* Error_Seek_Outside = "couldn't seek past end of file";
+		constexpr const char* Error_Truncate = "couldn't truncate file";
 		constexpr const char* Error_Desc = "invalid file descriptor";
 		constexpr const char* Error_Close = "couldn't close the file";
 
@@ -101,6 +102,23 @@ namespace catapult { namespace io {
 		constexpr auto fstat = ::_fstati64;
 		using StatStruct = struct ::_stat64;
 
+		inline int pread(int fd, void* pData, unsigned int size, int64_t offset) {
+			OVERLAPPED overlapped{};
+			overlapped.Offset = static_cast<DWORD>(offset);
+			overlapped.OffsetHigh = static_cast<DWORD>(static_cast<uint64_t>(offset) >> 32);
+
+			DWORD numBytesRead;
+			auto handle = reinterpret_cast<HANDLE>(::_get_osfhandle(fd));
+			if (!::ReadFile(handle, pData, size, &numBytesRead, &overlapped))
+				return ERROR_HANDLE_EOF == ::GetLastError() ? 0 : -1;
+
+			return static_cast<int>(numBytesRead);
+		}
+
+		inline int ftruncate(int fd, int64_t size) {
+			return 0 == ::_chsize_s(fd, size) ? 0 : -1;
+		}
+
 		template<typename TSize>
 		inline unsigned int CastToDataSize(TSize size) {
 			return static_cast<unsigned int>(size);
@@ -143,6 +161,8 @@ namespace catapult { namespace io {
 		constexpr auto File_Locking_None = 0;
 
 		constexpr auto close = ::close; // ::close unlocks all files, so explicit flock is not needed
+		constexpr auto pread = ::pread;
+		constexpr auto ftruncate = ::ftruncate;
 		using StatStruct = struct stat;
 
 		template<typename TSize>
@@ -214,6 +234,33 @@ namespace catapult { namespace io {
 			return ProcessInBlocks(read, Read_Error, fd, data);
 		}
 
+		FileOperationResult<size_t> nemReadAt(int fd, uint64_t position, const MutableRawBuffer& data) {
+			auto* pData = data.pData;
+			auto size = data.Size;
+			size_t numBytesProcessed = 0;
+			while (size > 0) {
+				auto numBytesToProcess = std::min<size_t>(0x40'00'00'00, size);
+				auto offset = static_cast<int64_t>(position + numBytesProcessed);
+				auto ioResult = pread(fd, pData, CastToDataSize(numBytesToProcess), offset);
+				if (Read_Error == ioResult)
+					return MakeFailureResult(Invalid_Size);
+
+				if (0 == ioResult)
+					break;
+
+				auto ioProcessed = CastToDataSize(ioResult);
+				numBytesProcessed += ioProcessed;
+				pData += ioProcessed;
+				size -= ioProcessed;
+			}
+
+			return data.Size == numBytesProcessed ? MakeSuccessResult(numBytesProcessed) : MakeFailureResult(numBytesProcessed);
+		}
+
+		FileOperationResult<bool> nemTruncate(int fd, uint64_t size) {
+			return -1 == ftruncate(fd, static_cast<int64_t>(size)) ? MakeFailureResult(false) : MakeSuccessResult(true);
+		}
+
 		FileOperationResult<bool> nemSeekSet(int fd, int64_t offset) {
 			return -1 == lseek(fd, offset, SEEK_SET) ? MakeFailureResult(false) : MakeSuccessResult(true);
 		}
@@ -324,6 +371,20 @@ namespace catapult { namespace io {
 		m_position += readResult.Value;
 	}
 
+	void RawFile::readAt(uint64_t position, const MutableRawBuffer& dataBuffer) const {
+		auto readResult = nemReadAt(m_fd.raw(), position, dataBuffer);
+		CATAPULT_CHECK_FILE_OPERATION_RESULT(Error_Read, readResult);
+	}
+
+	void RawFile::truncate(uint64_t size) {
+		auto truncateResult = nemTruncate(m_fd.raw(), size);
+		CATAPULT_CHECK_FILE_OPERATION_RESULT(Error_Truncate, truncateResult);
+
+		m_fileSize = size;
+		if (m_position > size)
+			seek(size);
+	}
+
 	void RawFile::seek(uint64_t position) {
 		// constrain seek to inside the file even though low-level api allows seek outside the file
 		// if needed, such behavior is better suited for resize and/or truncate methods
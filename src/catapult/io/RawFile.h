@@ -72,6 +72,15 @@ namespace catapult { namespace io {
 		/// Throws catapult_file_io_error exception if requested amount of data could not be read.
 		void read(const MutableRawBuffer& dataBuffer);
 
+		/// Reads data from the file starting at absolute \a position into \a dataBuffer without using or changing the current position.
+		/// Throws catapult_file_io_error exception if requested amount of data could not be read.
+		/// \note This function can be called concurrently but must not be mixed with position-based reads on Windows.
+		void readAt(uint64_t position, const MutableRawBuffer& dataBuffer) const;
+
+		/// Truncates the file to \a size bytes and moves the current position to the end of the file if it is past \a size.
+		/// Throws catapult_file_io_error exception if the file could not be truncated.
+		void truncate(uint64_t size);
+
 		/// Gets the size of the file.
 		uint64_t size() const;
 
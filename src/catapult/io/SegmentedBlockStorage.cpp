@@ -0,0 +1,701 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "SegmentedBlockStorage.h"
+#include "BlockElementSerializer.h"
+#include "BlockStatementSerializer.h"
+#include "BufferInputStreamAdapter.h"
+#include "FilesystemUtils.h"
+#include "StringOutputStream.h"
+#include "catapult/config/CatapultDataDirectory.h"
+#include "catapult/utils/MemoryUtils.h"
+#include "catapult/preprocessor.h"
+#include <algorithm>
+#include <limits>
+
+namespace catapult { namespace io {
+
+	namespace {
+		static constexpr auto Block_File_Extension = ".dat";
+		static constexpr auto Block_Statement_File_Extension = ".stmt";
+		static constexpr auto Segment_Prefix = "segment";
+		static constexpr auto Segment_Data_File_Extension = ".dat";
+		static constexpr auto Segment_Index_File_Extension = ".index.dat";
+		static constexpr size_t Max_Cached_Segment_Readers = 16;
+
+		using SegmentIndexEntry = SegmentedBlockStorage::SegmentIndexEntry;
+
+		// region path utils
+
+		uint64_t GetSegmentId(Height height) {
+			return height.unwrap() / Files_Per_Storage_Directory;
+		}
+
+		uint64_t GetSegmentIndex(Height height) {
+			return height.unwrap() % Files_Per_Storage_Directory;
+		}
+
+		Height GetSegmentStartHeight(uint64_t segmentId) {
+			return Height(segmentId * Files_Per_Storage_Directory);
+		}
+
+		std::string GetSegmentDataPath(const config::CatapultStorageDirectory& storageDir) {
+			return storageDir.indexFile(Segment_Prefix, Segment_Data_File_Extension);
+		}
+
+		std::string GetSegmentIndexPath(const config::CatapultStorageDirectory& storageDir) {
+			return storageDir.indexFile(Segment_Prefix, Segment_Index_File_Extension);
+		}
+
+		// does not create storage directory, so it is safe to use for reads
+		auto GetExistingStorageDirectory(const std::string& baseDirectory, uint64_t segmentId) {
+			return config::CatapultDataDirectory(baseDirectory).storageDir(GetSegmentStartHeight(segmentId));
+		}
+
+		bool IsDigit(char ch) {
+			return '0' <= ch && '9' >= ch;
+		}
+
+		bool IsRegularFile(const std::filesystem::path& path) {
+			return std::filesystem::exists(path) && std::filesystem::is_regular_file(path);
+		}
+
+		// endregion
+
+		// region index utils
+
+		uint64_t GetEndOffset(const SegmentIndexEntry& entry) {
+			return entry.Offset + entry.BlockElementSize + entry.BlockStatementSize;
+		}
+
+		std::vector<SegmentIndexEntry> ReadSegmentIndexEntries(const RawFile& indexFile, uint64_t maxEntries) {
+			std::vector<SegmentIndexEntry> entries(std::min<uint64_t>(maxEntries, indexFile.size() / sizeof(SegmentIndexEntry)));
+			indexFile.readAt(0, { reinterpret_cast<uint8_t*>(entries.data()), entries.size() * sizeof(SegmentIndexEntry) });
+			return entries;
+		}
+
+		// blocks are not guaranteed to be stored in height order (migrated blocks are appended), so use the largest end offset
+		uint64_t CalculateDataSize(const RawFile& indexFile, uint64_t numEntries) {
+			uint64_t dataSize = 0;
+			for (const auto& entry : ReadSegmentIndexEntries(indexFile, numEntries)) {
+				if (0 != entry.BlockElementSize)
+					dataSize = std::max(dataSize, GetEndOffset(entry));
+			}
+
+			return dataSize;
+		}
+
+		void WriteSegmentIndexEntry(RawFile& indexFile, uint64_t index, const SegmentIndexEntry& entry) {
+			// entries of heights that are not stored in the segment are zeroed
+			auto indexPosition = index * sizeof(SegmentIndexEntry);
+			if (indexFile.size() < indexPosition) {
+				indexFile.seek(indexFile.size());
+				indexFile.write(std::vector<uint8_t>(indexPosition - indexFile.size()));
+			}
+
+			indexFile.seek(indexPosition);
+			indexFile.write({ reinterpret_cast<const uint8_t*>(&entry), sizeof(SegmentIndexEntry) });
+		}
+
+		std::string SerializeBlockElement(const model::BlockElement& blockElement, uint32_t& blockElementSize) {
+			StringOutputStream outputStream(blockElement.Block.Size);
+			WriteBlockElement(blockElement, outputStream);
+			blockElementSize = static_cast<uint32_t>(outputStream.str().size());
+
+			if (blockElement.OptionalStatement)
+				WriteBlockStatement(*blockElement.OptionalStatement, outputStream);
+
+			return outputStream.str();
+		}
+
+		// endregion
+	}
+
+	// region SegmentReader / SegmentWriter
+
+	// snapshot of a single segment that is never modified after creation, so it can be shared across concurrent readers
+	// (saves replace cached readers with copies that include the new entries but share the existing data mapping)
+	struct SegmentedBlockStorage::SegmentReader {
+	public:
+		std::shared_ptr<const MemoryMappedFile> pDataMapping;
+		std::vector<SegmentIndexEntry> Entries;
+
+	public:
+		bool isUnmapped(Height height) const {
+			auto index = GetSegmentIndex(height);
+			if (index >= Entries.size() || 0 == Entries[index].BlockElementSize)
+				return false;
+
+			return !pDataMapping || GetEndOffset(Entries[index]) > pDataMapping->size();
+		}
+
+		const SegmentIndexEntry* tryFind(Height height) const {
+			auto index = GetSegmentIndex(height);
+			if (!pDataMapping || index >= Entries.size() || 0 == Entries[index].BlockElementSize)
+				return nullptr;
+
+			const auto& entry = Entries[index];
+			if (GetEndOffset(entry) > pDataMapping->size())
+				CATAPULT_THROW_RUNTIME_ERROR_1("segment data file is smaller than indexed data at height", height);
+
+			return &entry;
+		}
+
+		const uint8_t* data(const SegmentIndexEntry& entry) const {
+			return pDataMapping->data() + entry.Offset;
+		}
+	};
+
+	struct SegmentedBlockStorage::SegmentWriter {
+	public:
+		SegmentWriter(uint64_t segmentId, const config::CatapultStorageDirectory& storageDir)
+				: SegmentId(segmentId)
+				, DataFile(GetSegmentDataPath(storageDir), OpenMode::Read_Append, LockMode::None)
+				, IndexFile(GetSegmentIndexPath(storageDir), OpenMode::Read_Append, LockMode::None)
+				, NextIndex(Unknown_Index)
+				, AppendOffset(0)
+		{}
+
+	public:
+		static constexpr auto Unknown_Index = std::numeric_limits<uint64_t>::max();
+
+	public:
+		uint64_t SegmentId;
+		RawFile DataFile;
+		RawFile IndexFile;
+
+		// used for caching inside saveBlock()
+		uint64_t NextIndex;
+		uint64_t AppendOffset;
+	};
+
+	// endregion
+
+	// region ctor
+
+	SegmentedBlockStorage::SegmentedBlockStorage(const std::string& dataDirectory, FileBlockStorageMode mode)
+			: m_dataDirectory(dataDirectory)
+			, m_mode(mode)
+			, m_legacyStorage(m_dataDirectory, FileBlockStorageMode::None)
+			, m_hashFile(m_dataDirectory, "hashes")
+			, m_indexFile((std::filesystem::path(m_dataDirectory) / "index.dat").generic_string())
+	{}
+
+	SegmentedBlockStorage::~SegmentedBlockStorage() = default;
+
+	// endregion
+
+	// region LightBlockStorage
+
+	Height SegmentedBlockStorage::chainHeight() const {
+		return m_indexFile.exists() ? Height(m_indexFile.get()) : Height(0);
+	}
+
+	model::HashRange SegmentedBlockStorage::loadHashesFrom(Height height, size_t maxHashes) const {
+		if (FileBlockStorageMode::Hash_Index != m_mode)
+			CATAPULT_THROW_INVALID_ARGUMENT("loadHashesFrom is not supported when Hash_Index mode is disabled");
+
+		auto currentHeight = chainHeight();
+		if (Height(0) == height || currentHeight < height)
+			return model::HashRange();
+
+		auto numAvailableHashes = static_cast<size_t>((currentHeight - height).unwrap() + 1);
+		auto numHashes = std::min(maxHashes, numAvailableHashes);
+		return m_hashFile.loadRangeFrom(height, numHashes);
+	}
+
+	void SegmentedBlockStorage::saveBlock(const model::BlockElement& blockElement) {
+		auto currentHeight = chainHeight();
+		auto height = blockElement.Block.Height;
+
+		if (height != currentHeight + Height(1)) {
+			std::ostringstream out;
+			out << "cannot save block with height " << height << " when storage height is " << currentHeight;
+			CATAPULT_THROW_INVALID_ARGUMENT(out.str().c_str());
+		}
+
+		// complete truncations that were blocked by loaded blocks before any segment data is written
+		applyPendingTruncations();
+
+		auto segmentId = GetSegmentId(height);
+		auto index = GetSegmentIndex(height);
+		if (m_pendingTruncations.cend() != m_pendingTruncations.find(segmentId)) {
+			saveLegacyBlock(segmentId, blockElement);
+			return;
+		}
+
+		// serialize element and statements into a single buffer so that they can be appended with a single write
+		uint32_t blockElementSize;
+		auto buffer = SerializeBlockElement(blockElement, blockElementSize);
+
+		auto& writer = segmentWriter(segmentId);
+
+		// append after all blocks preceding this one in the segment, which drops any data left behind by an interrupted save
+		if (index != writer.NextIndex)
+			writer.AppendOffset = CalculateDataSize(writer.IndexFile, index);
+
+		auto offset = writer.AppendOffset;
+		if (offset > writer.DataFile.size())
+			CATAPULT_THROW_RUNTIME_ERROR_2("segment data file is smaller than indexed data", segmentId, writer.DataFile.size());
+
+		auto indexPosition = index * sizeof(SegmentIndexEntry);
+		if (writer.DataFile.size() > offset) {
+			{
+				std::lock_guard<std::mutex> guard(m_segmentReadersMutex);
+				m_segmentReaders.erase(segmentId);
+			}
+
+			// unindexed data can still be referenced by previously loaded blocks, so it must not be overwritten
+			if (isDataMapped(segmentId)) {
+				if (writer.IndexFile.size() > indexPosition)
+					writer.IndexFile.truncate(indexPosition);
+
+				deferTruncation(segmentId, offset);
+				saveLegacyBlock(segmentId, blockElement);
+				return;
+			}
+
+			writer.DataFile.truncate(offset);
+		}
+
+		writer.DataFile.seek(offset);
+		writer.DataFile.write({ reinterpret_cast<const uint8_t*>(buffer.data()), buffer.size() });
+
+		// write index entry only after data is fully written and drop entries left behind by an interrupted save
+		if (writer.IndexFile.size() > indexPosition)
+			writer.IndexFile.truncate(indexPosition);
+
+		auto blockStatementSize = static_cast<uint32_t>(buffer.size() - blockElementSize);
+		SegmentIndexEntry entry{ offset, blockElementSize, blockStatementSize };
+		WriteSegmentIndexEntry(writer.IndexFile, index, entry);
+
+		writer.NextIndex = index + 1;
+		writer.AppendOffset = offset + buffer.size();
+
+		if (FileBlockStorageMode::Hash_Index == m_mode)
+			m_hashFile.save(height, blockElement.EntityHash);
+
+		// updating chain height commits the block
+		m_indexFile.set(height.unwrap());
+
+		// keep the cached reader (and its mapping) and only add the new entry, which is mapped when it is first loaded
+		std::lock_guard<std::mutex> guard(m_segmentReadersMutex);
+		auto iter = m_segmentReaders.find(segmentId);
+		if (m_segmentReaders.end() == iter)
+			return;
+
+		auto pReader = std::make_shared<SegmentReader>(*iter->second);
+		pReader->Entries.resize(index);
+		pReader->Entries.push_back(entry);
+		iter->second = pReader;
+	}
+
+	void SegmentedBlockStorage::dropBlocksAfter(Height height) {
+		// update chain height first so that an interrupted truncation only leaves behind unreachable data
+		m_indexFile.set(height.unwrap());
+
+		// release cached mappings so that only data referenced by loaded blocks is preserved
+		resetSegments();
+
+		for (auto& pendingTruncationPair : m_pendingTruncations) {
+			auto& legacyHeights = pendingTruncationPair.second.LegacyHeights;
+			legacyHeights.erase(
+					std::remove_if(legacyHeights.begin(), legacyHeights.end(), [height](auto legacyHeight) {
+						return legacyHeight > height;
+					}),
+					legacyHeights.end());
+		}
+
+		applyPendingTruncations();
+
+		auto nextHeight = height + Height(1);
+		auto segmentId = GetSegmentId(nextHeight);
+		truncateSegment(segmentId, GetSegmentIndex(nextHeight));
+
+		if (std::filesystem::exists(m_dataDirectory)) {
+			auto begin = std::filesystem::directory_iterator(m_dataDirectory);
+			auto end = std::filesystem::directory_iterator();
+			for (auto iter = begin; end != iter; ++iter) {
+				auto name = iter->path().filename().generic_string();
+				if (!iter->is_directory() || name.empty() || !std::all_of(name.cbegin(), name.cend(), IsDigit))
+					continue;
+
+				auto laterSegmentId = std::stoull(name);
+				if (laterSegmentId > segmentId)
+					truncateSegment(laterSegmentId, 0);
+			}
+		}
+
+		resetSegments();
+	}
+
+	// endregion
+
+	// region BlockStorage
+
+	std::shared_ptr<const model::Block> SegmentedBlockStorage::loadBlock(Height height) const {
+		requireHeight(height, "block");
+		auto pReader = findSegmentReader(height);
+		const auto* pEntry = pReader->tryFind(height);
+		if (!pEntry)
+			return m_legacyStorage.loadBlock(height);
+
+		if (sizeof(model::BlockHeader) > pEntry->BlockElementSize)
+			CATAPULT_THROW_RUNTIME_ERROR_1("indexed block element is too small at height", height);
+
+		// block aliases mapped data and keeps the mapping alive, so it can be used without being copied
+		const auto* pBlock = reinterpret_cast<const model::Block*>(pReader->data(*pEntry));
+		if (pBlock->Size > pEntry->BlockElementSize)
+			CATAPULT_THROW_RUNTIME_ERROR_1("block is larger than indexed block element at height", height);
+
+		return std::shared_ptr<const model::Block>(pReader->pDataMapping, pBlock);
+	}
+
+	std::shared_ptr<const model::BlockElement> SegmentedBlockStorage::loadBlockElement(Height height) const {
+		requireHeight(height, "block element");
+		auto pReader = findSegmentReader(height);
+		const auto* pEntry = pReader->tryFind(height);
+		if (!pEntry)
+			return m_legacyStorage.loadBlockElement(height);
+
+		RawBuffer buffer(pReader->data(*pEntry), pEntry->BlockElementSize);
+		BufferInputStreamAdapter<RawBuffer> inputStream(buffer);
+		auto pBlockElement = ReadBlockElement(inputStream);
+
+		if (!inputStream.eof())
+			CATAPULT_THROW_RUNTIME_ERROR_1("additional data after block at height", height);
+
+		return PORTABLE_MOVE(pBlockElement);
+	}
+
+	std::pair<std::vector<uint8_t>, bool> SegmentedBlockStorage::loadBlockStatementData(Height height) const {
+		requireHeight(height, "block statement data");
+		auto pReader = findSegmentReader(height);
+		const auto* pEntry = pReader->tryFind(height);
+		if (!pEntry)
+			return m_legacyStorage.loadBlockStatementData(height);
+
+		if (0 == pEntry->BlockStatementSize)
+			return std::make_pair(std::vector<uint8_t>(), false);
+
+		const auto* pBlockStatementData = pReader->data(*pEntry) + pEntry->BlockElementSize;
+		std::vector<uint8_t> blockStatement(pBlockStatementData, pBlockStatementData + pEntry->BlockStatementSize);
+		return std::make_pair(std::move(blockStatement), true);
+	}
+
+	// endregion
+
+	// region PrunableBlockStorage
+
+	void SegmentedBlockStorage::purge() {
+		// remove everything under the directory
+		resetSegments();
+		m_hashFile.reset();
+		PurgeDirectory(m_dataDirectory);
+	}
+
+	// endregion
+
+	// region migrateLegacyBlocks
+
+	uint64_t SegmentedBlockStorage::migrateLegacyBlocks(LegacyBlockFilesAction legacyBlockFilesAction) {
+		applyPendingTruncations();
+
+		uint64_t numMigratedBlocks = 0;
+		auto chainHeight = this->chainHeight();
+		for (uint64_t segmentId = 0; segmentId <= GetSegmentId(chainHeight); ++segmentId) {
+			// data of segments with pending truncations must not be appended to
+			if (m_pendingTruncations.cend() != m_pendingTruncations.find(segmentId))
+				continue;
+
+			auto startHeight = std::max(Height(1), GetSegmentStartHeight(segmentId));
+			auto endHeight = std::min(chainHeight, GetSegmentStartHeight(segmentId + 1) - Height(1));
+
+			auto pReader = findSegmentReader(segmentId);
+			std::vector<Height> legacyHeights;
+			for (auto height = startHeight; height <= endHeight; height = height + Height(1)) {
+				if (!pReader->tryFind(height))
+					legacyHeights.push_back(height);
+			}
+
+			appendLegacyBlocks(segmentId, legacyHeights, legacyBlockFilesAction);
+			numMigratedBlocks += legacyHeights.size();
+		}
+
+		m_pSegmentWriter.reset();
+		return numMigratedBlocks;
+	}
+
+	void SegmentedBlockStorage::appendLegacyBlocks(
+			uint64_t segmentId,
+			const std::vector<Height>& legacyHeights,
+			LegacyBlockFilesAction legacyBlockFilesAction) {
+		if (legacyHeights.empty())
+			return;
+
+		// append migrated blocks after all existing data, so that blocks already stored in the segment are not moved
+		auto& writer = segmentWriter(segmentId);
+		writer.NextIndex = SegmentWriter::Unknown_Index;
+
+		auto offset = writer.DataFile.size();
+		writer.DataFile.seek(offset);
+
+		std::vector<std::pair<uint64_t, SegmentIndexEntry>> newEntries;
+		for (auto height : legacyHeights) {
+			uint32_t blockElementSize;
+			auto buffer = SerializeBlockElement(*m_legacyStorage.loadBlockElement(height), blockElementSize);
+
+			// statements are already serialized, so they can be copied as is
+			auto blockStatementPair = m_legacyStorage.loadBlockStatementData(height);
+			buffer.append(reinterpret_cast<const char*>(blockStatementPair.first.data()), blockStatementPair.first.size());
+
+			writer.DataFile.write({ reinterpret_cast<const uint8_t*>(buffer.data()), buffer.size() });
+
+			auto blockStatementSize = static_cast<uint32_t>(blockStatementPair.first.size());
+			newEntries.emplace_back(GetSegmentIndex(height), SegmentIndexEntry{ offset, blockElementSize, blockStatementSize });
+			offset += buffer.size();
+		}
+
+		// write index entries only after data is fully written, so that interrupted migration can be resumed
+		for (const auto& entryPair : newEntries)
+			WriteSegmentIndexEntry(writer.IndexFile, entryPair.first, entryPair.second);
+
+		if (LegacyBlockFilesAction::Remove == legacyBlockFilesAction) {
+			for (auto height : legacyHeights) {
+				auto legacyStorageDir = config::CatapultDataDirectory(m_dataDirectory).storageDir(height);
+				std::filesystem::remove(legacyStorageDir.storageFile(Block_File_Extension));
+				std::filesystem::remove(legacyStorageDir.storageFile(Block_Statement_File_Extension));
+			}
+		}
+
+		std::lock_guard<std::mutex> guard(m_segmentReadersMutex);
+		m_segmentReaders.erase(segmentId);
+	}
+
+	// endregion
+
+	// region requireHeight
+
+	void SegmentedBlockStorage::requireHeight(Height height, const char* description) const {
+		auto chainHeight = this->chainHeight();
+		if (height <= chainHeight)
+			return;
+
+		std::ostringstream out;
+		out << "cannot load " << description << " at height (" << height << ") greater than chain height (" << chainHeight << ")";
+		CATAPULT_THROW_INVALID_ARGUMENT(out.str().c_str());
+	}
+
+	// endregion
+
+	// region segment management
+
+	std::shared_ptr<SegmentedBlockStorage::SegmentReader> SegmentedBlockStorage::findSegmentReader(Height height) const {
+		auto segmentId = GetSegmentId(height);
+		std::lock_guard<std::mutex> guard(m_segmentReadersMutex);
+		auto pReader = findSegmentReaderUnsafe(segmentId);
+		if (!pReader->isUnmapped(height))
+			return pReader;
+
+		// block was appended after data was mapped, so map data again (at most once per appended block)
+		auto pRemappedReader = std::make_shared<SegmentReader>(*pReader);
+		auto dataPath = GetSegmentDataPath(GetExistingStorageDirectory(m_dataDirectory, segmentId));
+		if (IsRegularFile(dataPath))
+			pRemappedReader->pDataMapping = mapSegmentDataUnsafe(segmentId, dataPath);
+
+		m_segmentReaders[segmentId] = pRemappedReader;
+		return pRemappedReader;
+	}
+
+	std::shared_ptr<SegmentedBlockStorage::SegmentReader> SegmentedBlockStorage::findSegmentReader(uint64_t segmentId) const {
+		std::lock_guard<std::mutex> guard(m_segmentReadersMutex);
+		return findSegmentReaderUnsafe(segmentId);
+	}
+
+	std::shared_ptr<SegmentedBlockStorage::SegmentReader> SegmentedBlockStorage::findSegmentReaderUnsafe(uint64_t segmentId) const {
+		auto iter = m_segmentReaders.find(segmentId);
+		if (m_segmentReaders.cend() != iter)
+			return iter->second;
+
+		auto pReader = std::make_shared<SegmentReader>();
+		auto storageDir = GetExistingStorageDirectory(m_dataDirectory, segmentId);
+		auto indexPath = GetSegmentIndexPath(storageDir);
+		auto dataPath = GetSegmentDataPath(storageDir);
+		if (IsRegularFile(indexPath) && IsRegularFile(dataPath)) {
+			RawFile indexFile(indexPath, OpenMode::Read_Only, LockMode::None);
+			pReader->Entries = ReadSegmentIndexEntries(indexFile, Files_Per_Storage_Directory);
+			pReader->pDataMapping = mapSegmentDataUnsafe(segmentId, dataPath);
+		}
+
+		// bound number of open files by evicting the lowest segment, which is least likely to be requested
+		if (m_segmentReaders.size() >= Max_Cached_Segment_Readers)
+			m_segmentReaders.erase(m_segmentReaders.begin());
+
+		m_segmentReaders.emplace(segmentId, pReader);
+		return pReader;
+	}
+
+	std::shared_ptr<const MemoryMappedFile> SegmentedBlockStorage::mapSegmentDataUnsafe(
+			uint64_t segmentId,
+			const std::string& dataPath) const {
+		auto pDataMapping = std::make_shared<const MemoryMappedFile>(dataPath);
+
+		// track mappings independently of readers because they are kept alive by loaded blocks
+		auto& dataMappings = m_dataMappings[segmentId];
+		dataMappings.erase(
+				std::remove_if(dataMappings.begin(), dataMappings.end(), [](const auto& pMapping) { return pMapping.expired(); }),
+				dataMappings.end());
+		dataMappings.push_back(pDataMapping);
+		return pDataMapping;
+	}
+
+	SegmentedBlockStorage::SegmentWriter& SegmentedBlockStorage::segmentWriter(uint64_t segmentId) {
+		if (!m_pSegmentWriter || segmentId != m_pSegmentWriter->SegmentId) {
+			m_pSegmentWriter.reset();
+
+			auto storageDir = config::CatapultStorageDirectoryPreparer::Prepare(m_dataDirectory, GetSegmentStartHeight(segmentId));
+			m_pSegmentWriter = std::make_unique<SegmentWriter>(segmentId, storageDir);
+		}
+
+		return *m_pSegmentWriter;
+	}
+
+	void SegmentedBlockStorage::truncateSegment(uint64_t segmentId, uint64_t numRetainedEntries) {
+		auto storageDir = GetExistingStorageDirectory(m_dataDirectory, segmentId);
+		auto indexPath = GetSegmentIndexPath(storageDir);
+		auto dataPath = GetSegmentDataPath(storageDir);
+		if (!IsRegularFile(indexPath) || !IsRegularFile(dataPath))
+			return;
+
+		if (m_pSegmentWriter && segmentId == m_pSegmentWriter->SegmentId)
+			m_pSegmentWriter.reset();
+
+		// mapped data must not be modified, but removing index entries is sufficient to drop blocks
+		auto isMapped = isDataMapped(segmentId);
+		if (0 == numRetainedEntries) {
+			if (isMapped)
+				deferTruncation(segmentId, 0);
+			else
+				std::filesystem::remove(dataPath);
+
+			std::filesystem::remove(indexPath);
+			return;
+		}
+
+		// data of dropped blocks is stored after the data of all retained blocks
+		RawFile indexFile(indexPath, OpenMode::Read_Append, LockMode::None);
+		auto numEntries = indexFile.size() / sizeof(SegmentIndexEntry);
+		if (numEntries <= numRetainedEntries)
+			return;
+
+		auto dataSize = CalculateDataSize(indexFile, numRetainedEntries);
+		indexFile.truncate(numRetainedEntries * sizeof(SegmentIndexEntry));
+
+		if (isMapped) {
+			deferTruncation(segmentId, dataSize);
+			return;
+		}
+
+		RawFile dataFile(dataPath, OpenMode::Read_Append, LockMode::None);
+		if (dataFile.size() > dataSize)
+			dataFile.truncate(dataSize);
+	}
+
+	void SegmentedBlockStorage::deferTruncation(uint64_t segmentId, uint64_t dataSize) {
+		auto iter = m_pendingTruncations.find(segmentId);
+		if (m_pendingTruncations.end() == iter)
+			m_pendingTruncations.emplace(segmentId, PendingTruncation{ dataSize, {} });
+		else
+			iter->second.DataSize = std::min(iter->second.DataSize, dataSize);
+	}
+
+	void SegmentedBlockStorage::applyPendingTruncations() {
+		for (auto iter = m_pendingTruncations.begin(); m_pendingTruncations.end() != iter;) {
+			auto segmentId = iter->first;
+			{
+				std::lock_guard<std::mutex> guard(m_segmentReadersMutex);
+				m_segmentReaders.erase(segmentId);
+			}
+
+			if (isDataMapped(segmentId)) {
+				++iter;
+				continue;
+			}
+
+			if (m_pSegmentWriter && segmentId == m_pSegmentWriter->SegmentId)
+				m_pSegmentWriter.reset();
+
+			// no block references dropped data anymore, so it can be truncated
+			auto dataPath = GetSegmentDataPath(GetExistingStorageDirectory(m_dataDirectory, segmentId));
+			if (IsRegularFile(dataPath)) {
+				if (0 == iter->second.DataSize) {
+					std::filesystem::remove(dataPath);
+				} else {
+					RawFile dataFile(dataPath, OpenMode::Read_Append, LockMode::None);
+					if (dataFile.size() > iter->second.DataSize)
+						dataFile.truncate(iter->second.DataSize);
+				}
+			}
+
+			// blocks saved in the meantime can now be appended to the segment
+			appendLegacyBlocks(segmentId, iter->second.LegacyHeights, LegacyBlockFilesAction::Remove);
+			iter = m_pendingTruncations.erase(iter);
+		}
+	}
+
+	void SegmentedBlockStorage::saveLegacyBlock(uint64_t segmentId, const model::BlockElement& blockElement) {
+		auto height = blockElement.Block.Height;
+		m_legacyStorage.saveBlock(blockElement);
+		m_pendingTruncations[segmentId].LegacyHeights.push_back(height);
+
+		if (FileBlockStorageMode::Hash_Index == m_mode)
+			m_hashFile.save(height, blockElement.EntityHash);
+
+		// updating chain height commits the block
+		m_indexFile.set(height.unwrap());
+	}
+
+	bool SegmentedBlockStorage::isDataMapped(uint64_t segmentId) const {
+		std::lock_guard<std::mutex> guard(m_segmentReadersMutex);
+		auto iter = m_dataMappings.find(segmentId);
+		if (m_dataMappings.cend() == iter)
+			return false;
+
+		auto& dataMappings = iter->second;
+		auto isMapped = std::any_of(dataMappings.cbegin(), dataMappings.cend(), [](const auto& pMapping) {
+			return !pMapping.expired();
+		});
+
+		if (!isMapped)
+			m_dataMappings.erase(iter);
+
+		return isMapped;
+	}
+
+	void SegmentedBlockStorage::resetSegments() {
+		m_pSegmentWriter.reset();
+
+		std::lock_guard<std::mutex> guard(m_segmentReadersMutex);
+		m_segmentReaders.clear();
+	}
+
+	// endregion
+}}
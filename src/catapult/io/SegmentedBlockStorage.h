@@ -0,0 +1,140 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "FileBlockStorage.h"
+#include "MemoryMappedFile.h"
+#include <map>
+#include <mutex>
+
+namespace catapult { namespace io {
+
+	/// Actions that can be applied to per-block files after their blocks are migrated.
+	enum class LegacyBlockFilesAction {
+		/// Keep per-block files, which allows switching back to FileBlockStorage.
+		Keep,
+
+		/// Remove per-block files.
+		Remove
+	};
+
+	/// Segmented file-based block storage.
+	/// \note Blocks and statements are appended to one data file per storage directory, which is paired with a fixed-size
+	///       offset index file. Blocks without an index entry are loaded from files written by FileBlockStorage.
+	/// \note Segment data files are memory mapped and blocks returned by loadBlock alias the mapped data, which allows them
+	///       to be sent to peers without being copied. Data that might still be referenced by such blocks is never truncated
+	///       or overwritten; instead, its truncation is deferred until it is no longer mapped and blocks saved in the meantime
+	///       are stored in per-block files, which are migrated into the segment once the truncation is applied.
+	class SegmentedBlockStorage final : public PrunableBlockStorage {
+	public:
+#pragma pack(push, 1)
+
+		/// Segment index entry.
+		struct SegmentIndexEntry {
+			/// Offset of block element data in segment data file.
+			uint64_t Offset;
+
+			/// Size of serialized block element.
+			uint32_t BlockElementSize;
+
+			/// Size of serialized block statement (zero if not present).
+			uint32_t BlockStatementSize;
+		};
+
+#pragma pack(pop)
+
+	public:
+		/// Creates a segmented file-based block storage, where blocks will be stored inside \a dataDirectory
+		/// with specified storage \a mode.
+		explicit SegmentedBlockStorage(
+				const std::string& dataDirectory,
+				FileBlockStorageMode mode = FileBlockStorageMode::Hash_Index);
+
+		/// Destroys the storage.
+		~SegmentedBlockStorage() override;
+
+	public:
+		// LightBlockStorage
+		Height chainHeight() const override;
+		model::HashRange loadHashesFrom(Height height, size_t maxHashes) const override;
+		void saveBlock(const model::BlockElement& blockElement) override;
+		void dropBlocksAfter(Height height) override;
+
+		// BlockStorage
+		std::shared_ptr<const model::Block> loadBlock(Height height) const override;
+		std::shared_ptr<const model::BlockElement> loadBlockElement(Height height) const override;
+		std::pair<std::vector<uint8_t>, bool> loadBlockStatementData(Height height) const override;
+
+		// PrunableBlockStorage
+		void purge() override;
+
+	public:
+		/// Copies all blocks that are only stored in per-block files into segment files and applies \a legacyBlockFilesAction
+		/// to the per-block files. Returns the number of migrated blocks.
+		/// \note This must not be called while the storage is being accessed by other threads.
+		/// \note Segments with pending truncations are skipped.
+		uint64_t migrateLegacyBlocks(LegacyBlockFilesAction legacyBlockFilesAction);
+
+	private:
+		struct SegmentReader;
+		struct SegmentWriter;
+
+		struct PendingTruncation {
+			/// Size of segment data after truncation.
+			uint64_t DataSize;
+
+			/// Heights of blocks saved in per-block files while truncation is pending.
+			std::vector<Height> LegacyHeights;
+		};
+
+		void requireHeight(Height height, const char* description) const;
+		void appendLegacyBlocks(
+				uint64_t segmentId,
+				const std::vector<Height>& legacyHeights,
+				LegacyBlockFilesAction legacyBlockFilesAction);
+
+		std::shared_ptr<SegmentReader> findSegmentReader(Height height) const;
+		std::shared_ptr<SegmentReader> findSegmentReader(uint64_t segmentId) const;
+		std::shared_ptr<SegmentReader> findSegmentReaderUnsafe(uint64_t segmentId) const;
+		std::shared_ptr<const MemoryMappedFile> mapSegmentDataUnsafe(uint64_t segmentId, const std::string& dataPath) const;
+		SegmentWriter& segmentWriter(uint64_t segmentId);
+		void truncateSegment(uint64_t segmentId, uint64_t numRetainedEntries);
+		void deferTruncation(uint64_t segmentId, uint64_t dataSize);
+		void applyPendingTruncations();
+		void saveLegacyBlock(uint64_t segmentId, const model::BlockElement& blockElement);
+		bool isDataMapped(uint64_t segmentId) const;
+		void resetSegments();
+
+	private:
+		std::string m_dataDirectory;
+		FileBlockStorageMode m_mode;
+		FileBlockStorage m_legacyStorage;
+
+		HashFile m_hashFile;
+		IndexFile m_indexFile;
+
+		std::unique_ptr<SegmentWriter> m_pSegmentWriter;
+		mutable std::map<uint64_t, std::shared_ptr<SegmentReader>> m_segmentReaders;
+		mutable std::map<uint64_t, std::vector<std::weak_ptr<const MemoryMappedFile>>> m_dataMappings;
+		mutable std::mutex m_segmentReadersMutex;
+		std::map<uint64_t, PendingTruncation> m_pendingTruncations;
+	};
+}}
@@ -0,0 +1,81 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "PacketPayloadWriteBuffers.h"
+
+namespace catapult { namespace ionet {
+
+	PacketPayloadWriteBuffers::PacketPayloadWriteBuffers(const PacketPayload& payload, size_t coalescingSize)
+			: m_payload(payload)
+			, m_coalescingSize(coalescingSize)
+			, m_segmentStartOffset(0) {
+		auto headerBuffer = RawBuffer(reinterpret_cast<const uint8_t*>(&m_payload.header()), sizeof(PacketHeader));
+
+		// reserve all staging memory upfront so that segment buffers are never invalidated by reallocation
+		auto numCoalescableBytes = headerBuffer.Size < m_coalescingSize ? headerBuffer.Size : 0u;
+		for (const auto& buffer : m_payload.buffers())
+			numCoalescableBytes += buffer.Size < m_coalescingSize ? buffer.Size : 0u;
+
+		m_coalescedData.reserve(numCoalescableBytes);
+
+		append(headerBuffer);
+		for (const auto& buffer : m_payload.buffers())
+			append(buffer);
+
+		flushSegment();
+	}
+
+	const std::vector<RawBuffer>& PacketPayloadWriteBuffers::buffers() const {
+		return m_buffers;
+	}
+
+	size_t PacketPayloadWriteBuffers::size() const {
+		return m_payload.header().Size;
+	}
+
+	size_t PacketPayloadWriteBuffers::numCoalescedBytes() const {
+		return m_coalescedData.size();
+	}
+
+	void PacketPayloadWriteBuffers::append(const RawBuffer& buffer) {
+		if (0 == buffer.Size)
+			return;
+
+		if (buffer.Size >= m_coalescingSize) {
+			flushSegment();
+			m_buffers.push_back(buffer);
+			return;
+		}
+
+		if (m_coalescedData.size() - m_segmentStartOffset + buffer.Size > m_coalescingSize)
+			flushSegment();
+
+		m_coalescedData.insert(m_coalescedData.end(), buffer.pData, buffer.pData + buffer.Size);
+	}
+
+	void PacketPayloadWriteBuffers::flushSegment() {
+		if (m_coalescedData.size() == m_segmentStartOffset)
+			return;
+
+		m_buffers.push_back({ m_coalescedData.data() + m_segmentStartOffset, m_coalescedData.size() - m_segmentStartOffset });
+		m_segmentStartOffset = m_coalescedData.size();
+	}
+}}
@@ -0,0 +1,58 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "PacketPayload.h"
+#include "catapult/utils/NonCopyable.h"
+
+namespace catapult { namespace ionet {
+
+	/// Buffers that compose a single write of a packet payload (header followed by data buffers).
+	/// \note Consecutive buffers smaller than the coalescing size are copied into contiguous segments of at most that size
+	///       so that each segment is delivered by a single socket write (and, for ssl sockets, a single tls record).
+	///       Buffers at least as large as the coalescing size are referenced directly.
+	class PacketPayloadWriteBuffers : public utils::NonCopyable {
+	public:
+		/// Creates write buffers around \a payload with coalescing size \a coalescingSize.
+		PacketPayloadWriteBuffers(const PacketPayload& payload, size_t coalescingSize);
+
+	public:
+		/// Gets the buffers to write.
+		const std::vector<RawBuffer>& buffers() const;
+
+		/// Gets the total number of bytes to write.
+		size_t size() const;
+
+		/// Gets the number of bytes that were copied into coalesced segments.
+		size_t numCoalescedBytes() const;
+
+	private:
+		void append(const RawBuffer& buffer);
+		void flushSegment();
+
+	private:
+		const PacketPayload m_payload;
+		const size_t m_coalescingSize;
+		std::vector<uint8_t> m_coalescedData;
+		size_t m_segmentStartOffset;
+		std::vector<RawBuffer> m_buffers;
+	};
+}}
@@ -22,6 +22,7 @@
 #include "PacketSocket.h"
 #include "BufferedPacketIo.h"
 #include "Node.h"
+#include "PacketPayloadWriteBuffers.h"
 #include "WorkingBuffer.h"
 #include "catapult/thread/StrandOwnerLifetimeExtender.h"
 #include "catapult/thread/TimedCallback.h"
@@ -161,10 +162,11 @@ namespace catapult { namespace ionet {
 		template<typename TSocketCallbackWrapper>
 		class BasicPacketSocketWriter {
 		public:
-			BasicPacketSocketWriter(Socket& socket, TSocketCallbackWrapper& wrapper, size_t maxPacketDataSize)
+			BasicPacketSocketWriter(Socket& socket, TSocketCallbackWrapper& wrapper, const PacketSocketOptions& options)
 					: m_socket(socket)
 					, m_wrapper(wrapper)
-					, m_maxPacketDataSize(maxPacketDataSize)
+					, m_maxPacketDataSize(options.MaxPacketDataSize)
+					, m_writeCoalescingSize(options.WriteCoalescingSize)
 			{}
 
 		public:
@@ -175,62 +177,44 @@ namespace catapult { namespace ionet {
 					return;
 				}
 
-				auto pContext = std::make_shared<WriteContext>(payload, callback);
-				boost::asio::async_write(m_socket, pContext->headerBuffer(), m_wrapper.wrap([this, pContext](const auto& ec, auto) {
-					this->writeNext(ec, pContext);
+				// submit header and all data buffers as a single buffer sequence instead of issuing one write per buffer
+				auto pContext = std::make_shared<WriteContext>(payload, callback, m_writeCoalescingSize);
+				boost::asio::async_write(m_socket, pContext->buffers(), m_wrapper.wrap([pContext](const auto& ec, auto) {
+					pContext->complete(ec);
 				}));
 			}
 
 		private:
 			struct WriteContext {
 			public:
-				WriteContext(const PacketPayload& payload, const PacketSocket::WriteCallback& callback)
-						: m_payload(payload)
-						, m_callback(callback)
-						, m_nextBufferIndex(0)
-				{}
-
-			public:
-				auto headerBuffer() const {
-					const auto& header = m_payload.header();
-					return boost::asio::buffer(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
+				WriteContext(const PacketPayload& payload, const PacketSocket::WriteCallback& callback, size_t writeCoalescingSize)
+						: m_writeBuffers(payload, writeCoalescingSize)
+						, m_callback(callback) {
+					m_buffers.reserve(m_writeBuffers.buffers().size());
+					for (const auto& rawBuffer : m_writeBuffers.buffers())
+						m_buffers.push_back(boost::asio::buffer(rawBuffer.pData, rawBuffer.Size));
 				}
 
-				auto nextDataBuffer() {
-					auto rawBuffer = m_payload.buffers()[m_nextBufferIndex++];
-					return boost::asio::buffer(rawBuffer.pData, rawBuffer.Size);
+			public:
+				const auto& buffers() const {
+					return m_buffers;
 				}
 
-				bool tryComplete(const boost::system::error_code& ec) {
-					auto lastCode = mapWriteErrorCodeToSocketOperationCode(ec);
-					if (SocketOperationCode::Success != lastCode || m_nextBufferIndex >= m_payload.buffers().size()) {
-						m_callback(lastCode);
-						return true;
-					}
-
-					return false;
+				void complete(const boost::system::error_code& ec) {
+					m_callback(mapWriteErrorCodeToSocketOperationCode(ec));
 				}
 
 			private:
-				const PacketPayload m_payload;
+				const PacketPayloadWriteBuffers m_writeBuffers;
 				const PacketSocket::WriteCallback m_callback;
-				size_t m_nextBufferIndex;
+				std::vector<boost::asio::const_buffer> m_buffers;
 			};
 
-			void writeNext(const boost::system::error_code& lastEc, const std::shared_ptr<WriteContext>& pContext) {
-				if (pContext->tryComplete(lastEc))
-					return;
-
-				auto buffer = pContext->nextDataBuffer();
-				boost::asio::async_write(m_socket, buffer, m_wrapper.wrap([this, pContext](const auto& ec, auto) {
-					this->writeNext(ec, pContext);
-				}));
-			}
-
 		private:
 			Socket& m_socket;
 			TSocketCallbackWrapper& m_wrapper;
 			size_t m_maxPacketDataSize;
+			size_t m_writeCoalescingSize;
 		};
 
 		// endregion
@@ -373,7 +357,7 @@ namespace catapult { namespace ionet {
 					const std::shared_ptr<SocketGuard>& pSocketGuard,
 					const PacketSocketOptions& options,
 					TSocketCallbackWrapper& wrapper)
-					: BasicPacketSocketWriter<TSocketCallbackWrapper>(pSocketGuard->socket(), wrapper, options.MaxPacketDataSize)
+					: BasicPacketSocketWriter<TSocketCallbackWrapper>(pSocketGuard->socket(), wrapper, options)
 					, BasicPacketSocketReader<TSocketCallbackWrapper>(pSocketGuard->socket(), wrapper, m_buffer)
 					, m_pSocketGuard(pSocketGuard)
 					, m_socket(m_pSocketGuard->socket())
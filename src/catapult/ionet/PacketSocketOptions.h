@@ -86,6 +86,10 @@ namespace catapult { namespace ionet {
 		/// Working buffer sensitivity.
 		size_t WorkingBufferSensitivity;
 
+		/// Maximum size of a coalesced write segment (buffers smaller than this are copied together before writing).
+		/// \note \c 0 will disable write coalescing.
+		size_t WriteCoalescingSize;
+
 		/// Maximum packet data size.
 		size_t MaxPacketDataSize;
 
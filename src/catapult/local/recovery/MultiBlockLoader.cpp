@@ -25,12 +25,15 @@
 #include "catapult/chain/BlockExecutor.h"
 #include "catapult/chain/BlockScorer.h"
 #include "catapult/extensions/LocalNodeStateRef.h"
+#include "catapult/extensions/NemesisBlockLoader.h"
 #include "catapult/io/BlockStorageCache.h"
 #include "catapult/model/Block.h"
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/model/Elements.h"
 #include "catapult/observers/NotificationObserverAdapter.h"
 #include "catapult/plugins/PluginManager.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 #include "catapult/utils/StackLogger.h"
 
 namespace catapult { namespace local {
@@ -80,6 +83,9 @@ namespace catapult { namespace local {
 	// region LoadBlockChain
 
 	namespace {
+		constexpr size_t Blocks_Per_Worker_Thread = 8;
+		constexpr size_t Blocks_Per_State_Hash_Batch = 100;
+
 		class AnalyzeProgressLogger {
 		private:
 			static constexpr auto Log_Interval_Millis = 2'000;
@@ -89,39 +95,151 @@ namespace catapult { namespace local {
 			{}
 
 		public:
-			void operator()(Height height, Height chainHeight) {
+			void operator()(Height height, Height chainHeight, const LoadStageStatistics& statistics) {
 				auto currentMillis = m_stopwatch.millis();
 				if (currentMillis < (m_numLogs + 1) * Log_Interval_Millis)
 					return;
 
-				CATAPULT_LOG(info) << "loaded " << height << " / " << chainHeight << " blocks in " << currentMillis << "ms";
+				CATAPULT_LOG(info)
+						<< "loaded " << height << " / " << chainHeight << " blocks in " << currentMillis << "ms"
+						<< " (prefetch: " << BlocksPerSecond(statistics.NumPrefetchedBlocks, statistics.PrefetchMillis) << " blocks/s"
+						<< ", execute: " << BlocksPerSecond(statistics.NumExecutedBlocks, statistics.ExecuteMillis) << " blocks/s"
+						<< ", stalled " << statistics.StallMillis << "ms)";
 				++m_numLogs;
 			}
 
+		private:
+			static uint64_t BlocksPerSecond(uint64_t numBlocks, uint64_t millis) {
+				return 0 == millis ? numBlocks * 1000 : numBlocks * 1000 / millis;
+			}
+
 		private:
 			const utils::StackTimer& m_stopwatch;
 			size_t m_numLogs;
 		};
+
+		// region BlockElementBatch
+
+		/// Batch of consecutive block elements that are loaded and deserialized on a thread pool.
+		class BlockElementBatch {
+		private:
+			struct BatchState {
+			public:
+				explicit BatchState(size_t numBlocks)
+						: Heights(numBlocks)
+						, BlockElements(numBlocks)
+				{}
+
+			public:
+				std::vector<Height> Heights;
+				std::vector<std::shared_ptr<const model::BlockElement>> BlockElements;
+				std::vector<std::exception_ptr> Exceptions;
+				utils::StackTimer Stopwatch;
+				uint64_t ElapsedMillis = 0;
+			};
+
+		public:
+			BlockElementBatch() = default;
+
+			BlockElementBatch(BlockElementBatch&&) = default;
+
+			BlockElementBatch& operator=(BlockElementBatch&&) = default;
+
+			/// Starts loading blocks [\a startHeight, \a endHeight] from \a storage using \a pool.
+			BlockElementBatch(const io::BlockStorageView& storage, thread::IoThreadPool& pool, Height startHeight, Height endHeight)
+					: m_pState(std::make_shared<BatchState>(static_cast<size_t>((endHeight - startHeight).unwrap() + 1))) {
+				auto height = startHeight;
+				for (auto& batchHeight : m_pState->Heights) {
+					batchHeight = height;
+					height = height + Height(1);
+				}
+
+				// captured exceptions are rethrown by at so that all blocks preceding a failed block are still executed
+				auto pState = m_pState;
+				auto loadBlockElement = [&storage, pState](auto batchHeight, auto index) {
+					pState->BlockElements[index] = storage.loadBlockElement(batchHeight);
+				};
+
+				auto& ioContext = pool.ioContext();
+				m_future = thread::ParallelForCaptureExceptions(ioContext, m_pState->Heights, pool.numWorkerThreads(), loadBlockElement)
+					.then([pState](auto&& loadFuture) {
+						pState->Exceptions = loadFuture.get();
+						pState->ElapsedMillis = pState->Stopwatch.millis();
+						return true;
+					});
+			}
+
+			~BlockElementBatch() {
+				// storage is captured by reference, so outstanding loads must complete before it can be destroyed
+				if (m_future.valid())
+					m_future.get();
+			}
+
+		public:
+			/// Returns \c true if this batch is empty.
+			bool empty() const {
+				return !m_pState;
+			}
+
+			/// Gets the number of blocks in this batch.
+			size_t size() const {
+				return m_pState->Heights.size();
+			}
+
+			/// Gets the time it took to load this batch.
+			/// \note This blocks until the batch is loaded.
+			uint64_t elapsedMillis() {
+				wait();
+				return m_pState->ElapsedMillis;
+			}
+
+			/// Gets the block element at \a index, blocking until the batch is loaded.
+			std::shared_ptr<const model::BlockElement> at(size_t index) {
+				wait();
+				if (m_pState->Exceptions[index])
+					std::rethrow_exception(m_pState->Exceptions[index]);
+
+				return m_pState->BlockElements[index];
+			}
+
+		private:
+			void wait() {
+				if (m_future.valid())
+					m_future.get();
+
+				m_future = thread::future<bool>();
+			}
+
+		private:
+			std::shared_ptr<BatchState> m_pState;
+			thread::future<bool> m_future;
+		};
+
+		// endregion
 	}
 
 	class BlockChainLoader {
 	private:
-		using NotifyProgressFunc = consumer<Height, Height>;
+		using NotifyProgressFunc = consumer<Height, Height, const LoadStageStatistics&>;
 
 	public:
 		BlockChainLoader(
 				const BlockDependentNotificationObserverFactory& observerFactory,
 				const plugins::PluginManager& pluginManager,
 				const extensions::LocalNodeStateRef& stateRef,
-				Height startHeight)
+				thread::IoThreadPool& pool,
+				Height startHeight,
+				extensions::StateHashVerification stateHashVerification)
 				: m_observerFactory(observerFactory)
 				, m_pluginManager(pluginManager)
 				, m_stateRef(stateRef)
+				, m_pool(pool)
 				, m_startHeight(startHeight)
+				, m_stateHashVerification(stateHashVerification)
 		{}
 
 	public:
-		model::ChainScore loadAll(const NotifyProgressFunc& notifyProgress) const {
+		model::ChainScore loadAll(const NotifyProgressFunc& notifyProgress, LoadStageStatistics& statistics) const {
 			const auto& storage = m_stateRef.Storage.view();
 
 			auto height = m_startHeight;
@@ -130,15 +248,49 @@ namespace catapult { namespace local {
 			model::ChainScore score;
 			Hash256 stateHash;
 			auto chainHeight = storage.chainHeight();
-			while (chainHeight >= height) {
-				auto pBlockElement = storage.loadBlockElement(height);
-				score += model::ChainScore(chain::CalculateScore(pParentBlockElement->Block, pBlockElement->Block));
+			auto batchSize = std::max<size_t>(1, m_pool.numWorkerThreads()) * Blocks_Per_Worker_Thread;
+
+			// all blocks in a state hash batch are executed against the same cache delta so that patricia trees are only
+			// updated once per batch instead of once per block
+			std::unique_ptr<cache::CatapultCacheDelta> pCacheDelta;
+			size_t numUncommittedBlocks = 0;
+
+			// pipeline: while one batch is being executed, the next batch is loaded and deserialized on the pool
+			auto batch = startBatch(storage, height, chainHeight, batchSize);
+			while (!batch.empty()) {
+				auto nextBatchStartHeight = height + Height(batch.size());
+				auto nextBatch = startBatch(storage, nextBatchStartHeight, chainHeight, batchSize);
+
+				for (auto i = 0u; i < batch.size(); ++i) {
+					utils::StackTimer stallStopwatch;
+					auto pBlockElement = batch.at(i);
+					statistics.StallMillis += stallStopwatch.millis();
+
+					score += model::ChainScore(chain::CalculateScore(pParentBlockElement->Block, pBlockElement->Block));
+
+					utils::StackTimer executeStopwatch;
+					if (!pCacheDelta)
+						pCacheDelta = std::make_unique<cache::CatapultCacheDelta>(m_stateRef.Cache.createDelta());
+
+					execute(*pCacheDelta, *pBlockElement);
+					if (Blocks_Per_State_Hash_Batch == ++numUncommittedBlocks || chainHeight == height) {
+						stateHash = commit(*pCacheDelta, pBlockElement->Block);
+						pCacheDelta.reset();
+						numUncommittedBlocks = 0;
+					}
+
+					statistics.ExecuteMillis += executeStopwatch.millis();
+					++statistics.NumExecutedBlocks;
 
-				stateHash = execute(*pBlockElement);
-				notifyProgress(height, chainHeight);
+					notifyProgress(height, chainHeight, statistics);
 
-				pParentBlockElement = std::move(pBlockElement);
-				height = height + Height(1);
+					pParentBlockElement = std::move(pBlockElement);
+					height = height + Height(1);
+				}
+
+				statistics.NumPrefetchedBlocks += batch.size();
+				statistics.PrefetchMillis += batch.elapsedMillis();
+				batch = std::move(nextBatch);
 			}
 
 			if (chainHeight >= m_startHeight) {
@@ -151,8 +303,15 @@ namespace catapult { namespace local {
 		}
 
 	private:
-		Hash256 execute(const model::BlockElement& blockElement) const {
-			auto cacheDelta = m_stateRef.Cache.createDelta();
+		BlockElementBatch startBatch(const io::BlockStorageView& storage, Height startHeight, Height chainHeight, size_t batchSize) const {
+			if (startHeight > chainHeight)
+				return BlockElementBatch();
+
+			auto endHeight = std::min(chainHeight, startHeight + Height(batchSize - 1));
+			return BlockElementBatch(storage, m_pool, startHeight, endHeight);
+		}
+
+		void execute(cache::CatapultCacheDelta& cacheDelta, const model::BlockElement& blockElement) const {
 			auto observerState = observers::ObserverState(cacheDelta);
 
 			auto readOnlyCache = cacheDelta.toReadOnly();
@@ -161,9 +320,17 @@ namespace catapult { namespace local {
 			const auto& block = blockElement.Block;
 			observers::NotificationObserverAdapter observer(m_observerFactory(block), m_pluginManager.createNotificationPublisher());
 			chain::ExecuteBlock(blockElement, { observer, resolverContext, observerState });
+		}
 
-			// populate patricia tree delta
-			auto stateHash = cacheDelta.calculateStateHash(block.Height).StateHash;
+		Hash256 commit(cache::CatapultCacheDelta& cacheDelta, const model::Block& block) const {
+			// populate patricia tree delta with all changes accumulated since the last commit
+			auto stateHash = cacheDelta.calculateStateHash(block.Height, m_pool).StateHash;
+			if (extensions::StateHashVerification::Enabled == m_stateHashVerification && block.StateHash != stateHash) {
+				std::ostringstream out;
+				out << "block state hash (" << block.StateHash << ") does not match cache state hash (" << stateHash << ") at height "
+						<< block.Height;
+				CATAPULT_THROW_RUNTIME_ERROR(out.str().c_str());
+			}
 
 			m_stateRef.Cache.commit(block.Height);
 			return stateHash;
@@ -173,19 +340,35 @@ namespace catapult { namespace local {
 		BlockDependentNotificationObserverFactory m_observerFactory;
 		const plugins::PluginManager& m_pluginManager;
 		const extensions::LocalNodeStateRef& m_stateRef;
+		thread::IoThreadPool& m_pool;
 		Height m_startHeight;
+		extensions::StateHashVerification m_stateHashVerification;
 	};
 
 	model::ChainScore LoadBlockChain(
 			const BlockDependentNotificationObserverFactory& observerFactory,
 			const plugins::PluginManager& pluginManager,
 			const extensions::LocalNodeStateRef& stateRef,
-			Height startHeight) {
-		BlockChainLoader loader(observerFactory, pluginManager, stateRef, startHeight);
+			thread::IoThreadPool& pool,
+			Height startHeight,
+			extensions::StateHashVerification stateHashVerification) {
+		LoadStageStatistics statistics;
+		return LoadBlockChain(observerFactory, pluginManager, stateRef, pool, startHeight, stateHashVerification, statistics);
+	}
+
+	model::ChainScore LoadBlockChain(
+			const BlockDependentNotificationObserverFactory& observerFactory,
+			const plugins::PluginManager& pluginManager,
+			const extensions::LocalNodeStateRef& stateRef,
+			thread::IoThreadPool& pool,
+			Height startHeight,
+			extensions::StateHashVerification stateHashVerification,
+			LoadStageStatistics& statistics) {
+		BlockChainLoader loader(observerFactory, pluginManager, stateRef, pool, startHeight, stateHashVerification);
 
 		utils::StackLogger logger("load block chain", utils::LogLevel::important);
 		utils::StackTimer stopwatch;
-		return loader.loadAll(AnalyzeProgressLogger(stopwatch));
+		return loader.loadAll(AnalyzeProgressLogger(stopwatch), statistics);
 	}
 
 	// endregion
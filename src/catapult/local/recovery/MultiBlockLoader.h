@@ -25,12 +25,16 @@
 #include <functional>
 
 namespace catapult {
-	namespace extensions { struct LocalNodeStateRef; }
+	namespace extensions {
+		struct LocalNodeStateRef;
+		enum class StateHashVerification;
+	}
 	namespace model {
 		struct Block;
 		struct BlockChainConfiguration;
 	}
 	namespace plugins { class PluginManager; }
+	namespace thread { class IoThreadPool; }
 }
 
 namespace catapult { namespace local {
@@ -51,11 +55,47 @@ namespace catapult { namespace local {
 			const NotificationObserverFactory& transientObserverFactory,
 			const NotificationObserverFactory& permanentObserverFactory);
 
+	/// Block chain load stage statistics.
+	struct LoadStageStatistics {
+	public:
+		/// Number of blocks prefetched.
+		uint64_t NumPrefetchedBlocks = 0;
+
+		/// Cumulative wall time of all prefetch batches.
+		uint64_t PrefetchMillis = 0;
+
+		/// Number of blocks executed.
+		uint64_t NumExecutedBlocks = 0;
+
+		/// Cumulative time spent executing blocks.
+		uint64_t ExecuteMillis = 0;
+
+		/// Cumulative time the execute stage spent waiting for prefetched blocks.
+		uint64_t StallMillis = 0;
+	};
+
 	/// Loads a block chain from storage using the supplied observer factory (\a observerFactory) and plugin manager (\a pluginManager)
 	/// and updating \a stateRef starting with the block at \a startHeight.
+	/// Blocks are prefetched and deserialized on \a pool while previously loaded blocks are executed.
+	/// Cache state hashes are calculated and committed in batches of blocks and, if \a stateHashVerification is enabled,
+	/// checked against the state hash of the last block in each batch.
+	model::ChainScore LoadBlockChain(
+			const BlockDependentNotificationObserverFactory& observerFactory,
+			const plugins::PluginManager& pluginManager,
+			const extensions::LocalNodeStateRef& stateRef,
+			thread::IoThreadPool& pool,
+			Height startHeight,
+			extensions::StateHashVerification stateHashVerification);
+
+	/// Loads a block chain from storage using the supplied observer factory (\a observerFactory) and plugin manager (\a pluginManager)
+	/// and updating \a stateRef starting with the block at \a startHeight using \a pool and \a stateHashVerification.
+	/// Load stage statistics are accumulated into \a statistics.
 	model::ChainScore LoadBlockChain(
 			const BlockDependentNotificationObserverFactory& observerFactory,
 			const plugins::PluginManager& pluginManager,
 			const extensions::LocalNodeStateRef& stateRef,
-			Height startHeight);
+			thread::IoThreadPool& pool,
+			Height startHeight,
+			extensions::StateHashVerification stateHashVerification,
+			LoadStageStatistics& statistics);
 }}
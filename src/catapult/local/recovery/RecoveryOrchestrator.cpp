@@ -34,6 +34,7 @@
 #include "catapult/extensions/LocalNodeChainScore.h"
 #include "catapult/extensions/LocalNodeStateFileStorage.h"
 #include "catapult/extensions/LocalNodeStateRef.h"
+#include "catapult/extensions/NemesisBlockLoader.h"
 #include "catapult/extensions/ProcessBootstrapper.h"
 #include "catapult/io/BlockStorageCache.h"
 #include "catapult/io/FilesystemUtils.h"
@@ -44,7 +45,9 @@
 #include "catapult/subscribers/BrokerMessageReaders.h"
 #include "catapult/subscribers/FinalizationReader.h"
 #include "catapult/subscribers/TransactionStatusReader.h"
+#include "catapult/thread/IoThreadPool.h"
 #include "catapult/utils/StackLogger.h"
+#include <thread>
 
 namespace catapult { namespace local {
 
@@ -186,7 +189,17 @@ namespace catapult { namespace local {
 				// discontinuities in block analysis (e.g. statistic cache expects consecutive blocks)
 				CATAPULT_LOG(info) << "loading state - block loading required";
 				auto observerFactory = [&pluginManager = m_pluginManager](const auto&) { return pluginManager.createObserver(); };
-				auto partialScore = LoadBlockChain(observerFactory, m_pluginManager, stateRef(), heights.Cache + Height(1));
+				// use a dedicated pool so that loader threads are released as soon as loading completes
+				auto pLoaderPool = thread::CreateIoThreadPool(std::max(1u, std::thread::hardware_concurrency()), "block loader");
+				pLoaderPool->start();
+				auto partialScore = LoadBlockChain(
+						observerFactory,
+						m_pluginManager,
+						stateRef(),
+						*pLoaderPool,
+						heights.Cache + Height(1),
+						extensions::StateHashVerification::Enabled);
+				pLoaderPool->join();
 				m_score += partialScore;
 			}
 
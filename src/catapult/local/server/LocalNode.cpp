@@ -26,7 +26,9 @@
 #include "NodeContainerSubscriberAdapter.h"
 #include "NodeUtils.h"
 #include "StaticNodeRefreshService.h"
+#include "catapult/cache_db/PatriciaTreeGarbageCollector.h"
 #include "catapult/config/CatapultDataDirectory.h"
+#include "catapult/crypto/PublicKeyCache.h"
 #include "catapult/extensions/CommitStepHandler.h"
 #include "catapult/extensions/ConfigurationUtils.h"
 #include "catapult/extensions/LocalNodeChainScore.h"
@@ -100,7 +102,8 @@ namespace catapult { namespace local {
 					, m_catapultCache({}) // note that sub caches are added in boot
 					, m_storage(
 							m_pBootstrapper->subscriptionManager().createBlockStorage(m_pBlockChangeSubscriber),
-							CreateStagingBlockStorage(m_dataDirectory))
+							CreateStagingBlockStorage(m_dataDirectory),
+							m_config.Node.BlockStorageCacheMaxSize)
 					, m_pUtCache(m_pBootstrapper->subscriptionManager().createUtCache(extensions::GetUtCacheOptions(m_config.Node)))
 					, m_pFinalizationSubscriber(m_pBootstrapper->subscriptionManager().createFinalizationSubscriber())
 					, m_pNodeSubscriber(CreateNodeSubscriber(
@@ -117,10 +120,12 @@ namespace catapult { namespace local {
 					, m_isBooted(false) {
 				ValidateNodes(m_pBootstrapper->staticNodes());
 				AddLocalNode(m_nodes, m_pBootstrapper->config());
+				crypto::SetPublicKeyCacheMaxSize(m_config.Node.PublicKeyCacheMaxSize);
 			}
 
 			~DefaultLocalNode() override {
 				shutdown();
+				crypto::SetPublicKeyCacheMaxSize(utils::FileSize());
 			}
 
 		public:
@@ -183,6 +188,24 @@ namespace catapult { namespace local {
 				m_counters.emplace_back(utils::DiagnosticCounterId("UT CACHE"), [&source = *m_pUtCache]() {
 					return source.view().size();
 				});
+				m_counters.emplace_back(utils::DiagnosticCounterId("BLKCACHE HITS"), [&storage = m_storage]() {
+					return storage.statistics().NumHits;
+				});
+				m_counters.emplace_back(utils::DiagnosticCounterId("BLKCACHE MISS"), [&storage = m_storage]() {
+					return storage.statistics().NumMisses;
+				});
+				m_counters.emplace_back(utils::DiagnosticCounterId("PKCACHE HITS"), []() {
+					return crypto::GetPublicKeyCacheStatistics().NumHits;
+				});
+				m_counters.emplace_back(utils::DiagnosticCounterId("PKCACHE MISS"), []() {
+					return crypto::GetPublicKeyCacheStatistics().NumMisses;
+				});
+				m_counters.emplace_back(utils::DiagnosticCounterId("PTGC REMOVED"), []() {
+					return cache::GetPatriciaTreeGarbageCollectionStatistics().NumRemoved;
+				});
+				m_counters.emplace_back(utils::DiagnosticCounterId("PTGC BYTES"), []() {
+					return cache::GetPatriciaTreeGarbageCollectionStatistics().NumRemovedBytes;
+				});
 
 				AddNodeCounters(m_counters, m_nodes);
 			}
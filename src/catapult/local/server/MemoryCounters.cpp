@@ -20,6 +20,7 @@
 **/
 
 #include "MemoryCounters.h"
+#include "catapult/utils/ArenaMemoryResource.h"
 #include "catapult/utils/DiagnosticCounter.h"
 #include "catapult/utils/FileSize.h"
 #include <fstream>
@@ -103,5 +104,11 @@ namespace catapult { namespace local {
 		counters.emplace_back(MakeId("CUR VIRT"), []() { return GET_MEMORY_VALUE(size); });
 		counters.emplace_back(MakeId("SHR RSS"), []() { return GET_MEMORY_VALUE(shared); });
 #endif
+
+		// arena counters are zero until an arena requests memory
+		counters.emplace_back(MakeId("ARENA RSV"), []() {
+			return utils::FileSize::FromBytes(utils::GetArenaMemoryStatistics().NumReservedBytes).megabytes();
+		});
+		counters.emplace_back(MakeId("ARENA BLK"), []() { return utils::GetArenaMemoryStatistics().NumBlockAllocations; });
 		}
 }}
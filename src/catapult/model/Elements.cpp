@@ -20,6 +20,7 @@
 **/
 
 #include "Elements.h"
+#include "NotificationStream.h"
 
 namespace catapult { namespace model {
 
@@ -40,8 +41,12 @@ namespace catapult { namespace model {
 			template<typename TElement>
 			void add(const TElement& element) {
 				const auto& entity = GetEntity(element);
-				if (m_predicate(ToBasicEntityType(entity.Type), GetTimestamp(element), element.EntityHash))
-					m_entityInfos.push_back(WeakEntityInfo(entity, element.EntityHash, *m_pActiveBlockHeader));
+				if (!m_predicate(ToBasicEntityType(entity.Type), GetTimestamp(element), element.EntityHash))
+					return;
+
+				m_entityInfos.push_back(WeakEntityInfo(entity, element.EntityHash, *m_pActiveBlockHeader));
+				if (element.OptionalNotifications)
+					m_entityInfos.back().setNotificationStream(*element.OptionalNotifications);
 			}
 
 		private:
@@ -50,6 +50,10 @@ namespace catapult { namespace model {
 		/// Optional extracted addresses.
 		/// \note shared_ptr for optionality and more performant copyability.
 		std::shared_ptr<const UnresolvedAddressSet> OptionalExtractedAddresses;
+
+		/// Optional notifications recorded from the transaction.
+		/// \note shared_ptr for optionality and copyability (NotificationStream is not copyable).
+		std::shared_ptr<const NotificationStream> OptionalNotifications;
 	};
 
 	/// Processing element for a block composed of a block and metadata.
@@ -78,6 +82,10 @@ namespace catapult { namespace model {
 		/// Optional block statement.
 		/// \note shared_ptr for optionality and copyability (BlockStatement is move only).
 		std::shared_ptr<const BlockStatement> OptionalStatement;
+
+		/// Optional notifications recorded from the block.
+		/// \note shared_ptr for optionality and copyability (NotificationStream is not copyable).
+		std::shared_ptr<const NotificationStream> OptionalNotifications;
 	};
 
 	/// Predicate for evaluating a timestamp, a hash and an entity type.
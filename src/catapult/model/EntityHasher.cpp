@@ -24,6 +24,7 @@
 #include "TransactionPlugin.h"
 #include "catapult/crypto/Hashes.h"
 #include "catapult/crypto/MerkleHashBuilder.h"
+#include "catapult/crypto/MultiBufferHashes.h"
 
 namespace catapult { namespace model {
 
@@ -105,4 +106,35 @@ namespace catapult { namespace model {
 				transactionElement.EntityHash,
 				transactionRegistry);
 	}
+
+	void UpdateHashes(
+			const TransactionRegistry& transactionRegistry,
+			const GenerationHashSeed& generationHashSeed,
+			const std::vector<TransactionElement*>& transactionElements) {
+		// add full signature and public key (this is different than Sign/Verify)
+		std::vector<crypto::MultiBufferHashInput> inputs;
+		inputs.reserve(transactionElements.size());
+		for (const auto* pTransactionElement : transactionElements) {
+			const auto& transaction = pTransactionElement->Transaction;
+			const auto& plugin = *transactionRegistry.findPlugin(transaction.Type);
+			inputs.push_back({ {
+				RawBuffer(transaction.Signature),
+				RawBuffer(transaction.SignerPublicKey),
+				RawBuffer(generationHashSeed),
+				plugin.dataBuffer(transaction)
+			}, 4 });
+		}
+
+		std::vector<Hash256> entityHashes(transactionElements.size());
+		crypto::Sha3_256_Multi(inputs.data(), entityHashes.data(), inputs.size());
+
+		auto i = 0u;
+		for (auto* pTransactionElement : transactionElements) {
+			pTransactionElement->EntityHash = entityHashes[i++];
+			pTransactionElement->MerkleComponentHash = CalculateMerkleComponentHash(
+					pTransactionElement->Transaction,
+					pTransactionElement->EntityHash,
+					transactionRegistry);
+		}
+	}
 }}
@@ -57,4 +57,12 @@ namespace catapult { namespace model {
 				const TransactionRegistry& transactionRegistry,
 				const GenerationHashSeed& generationHashSeed,
 				TransactionElement& transactionElement);
+
+	/// Calculates the hashes for all \a transactionElements in place for the network with the specified
+	/// generation hash seed (\a generationHashSeed) using transaction information from \a transactionRegistry.
+	/// \note Entity hashes of multiple transactions are calculated together using multi-buffer hashing.
+	void UpdateHashes(
+				const TransactionRegistry& transactionRegistry,
+				const GenerationHashSeed& generationHashSeed,
+				const std::vector<TransactionElement*>& transactionElements);
 }}
@@ -23,6 +23,7 @@
 #include "Block.h"
 #include "BlockUtils.h"
 #include "FeeUtils.h"
+#include "NotificationStream.h"
 #include "NotificationSubscriber.h"
 #include "TransactionPlugin.h"
 
@@ -204,6 +205,12 @@ namespace catapult { namespace model {
 
 		public:
 			void publish(const WeakEntityInfoT<VerifiableEntity>& entityInfo, NotificationSubscriber& sub) const override {
+				// replay previously recorded notifications instead of publishing them again
+				if (entityInfo.isNotificationStreamSet() && entityInfo.notificationStream().isRecordedFrom(entityInfo)) {
+					entityInfo.notificationStream().replay(sub);
+					return;
+				}
+
 				m_basicPublisher.publish(entityInfo, sub);
 				m_customPublisher.publish(entityInfo, sub);
 			}
@@ -40,6 +40,7 @@ namespace catapult { namespace model {
 		Custom,
 
 		/// All notifications are published.
+		/// \note Notifications are replayed from an entity info's notification stream when one is set.
 		All
 	};
 
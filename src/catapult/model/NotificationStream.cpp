@@ -0,0 +1,107 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "NotificationStream.h"
+#include "Notifications.h"
+#include "NotificationPublisher.h"
+#include "NotificationSubscriber.h"
+#include "catapult/exceptions.h"
+#include <cstring>
+
+namespace catapult { namespace model {
+
+	namespace {
+		constexpr size_t Notification_Alignment = alignof(std::max_align_t);
+
+		class RecordingNotificationSubscriber : public NotificationSubscriber {
+		public:
+			explicit RecordingNotificationSubscriber(NotificationStream& stream) : m_stream(stream)
+			{}
+
+		public:
+			void notify(const Notification& notification) override {
+				m_stream.append(notification);
+			}
+
+		private:
+			NotificationStream& m_stream;
+		};
+	}
+
+	NotificationStream::NotificationStream(const WeakEntityInfo& entityInfo)
+			: m_pEntity(&entityInfo.entity())
+			, m_pHash(entityInfo.isHashSet() ? &entityInfo.hash() : nullptr)
+			, m_pAssociatedBlockHeader(entityInfo.isAssociatedBlockHeaderSet() ? &entityInfo.associatedBlockHeader() : nullptr)
+	{}
+
+	NotificationStream::~NotificationStream() {
+		for (auto* pNotification : m_ownedNotifications)
+			pNotification->~AddressInteractionNotification();
+	}
+
+	size_t NotificationStream::size() const {
+		return m_notifications.size();
+	}
+
+	size_t NotificationStream::capacity() const {
+		return m_arena.capacity();
+	}
+
+	bool NotificationStream::isRecordedFrom(const WeakEntityInfo& entityInfo) const {
+		if (!entityInfo.isSet() || m_pEntity != &entityInfo.entity())
+			return false;
+
+		const auto* pHash = entityInfo.isHashSet() ? &entityInfo.hash() : nullptr;
+		const auto* pAssociatedBlockHeader = entityInfo.isAssociatedBlockHeaderSet() ? &entityInfo.associatedBlockHeader() : nullptr;
+		return m_pHash == pHash && m_pAssociatedBlockHeader == pAssociatedBlockHeader;
+	}
+
+	void NotificationStream::append(const Notification& notification) {
+		if (notification.Size < sizeof(Notification))
+			CATAPULT_THROW_INVALID_ARGUMENT("cannot record notification with incorrect size");
+
+		if (AddressInteractionNotification::Notification_Type == notification.Type) {
+			// participants are owned by the notification, so a bitwise copy is insufficient
+			const auto& addressInteractionNotification = static_cast<const AddressInteractionNotification&>(notification);
+			auto* pMemory = m_arena.allocate(sizeof(AddressInteractionNotification), Notification_Alignment);
+			auto* pCopy = new (pMemory) AddressInteractionNotification(addressInteractionNotification);
+			m_ownedNotifications.push_back(pCopy);
+			m_notifications.push_back(pCopy);
+			return;
+		}
+
+		auto* pCopy = m_arena.allocate(notification.Size, Notification_Alignment);
+		std::memcpy(pCopy, &notification, notification.Size);
+		m_notifications.push_back(reinterpret_cast<const Notification*>(pCopy));
+	}
+
+	void NotificationStream::replay(NotificationSubscriber& sub) const {
+		for (const auto* pNotification : m_notifications)
+			sub.notify(*pNotification);
+	}
+
+	std::unique_ptr<NotificationStream> RecordNotifications(const NotificationPublisher& publisher, const WeakEntityInfo& entityInfo) {
+		auto pStream = std::make_unique<NotificationStream>(entityInfo);
+		RecordingNotificationSubscriber sub(*pStream);
+		publisher.publish(entityInfo, sub);
+		return pStream;
+	}
+}}
@@ -0,0 +1,79 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "WeakEntityInfo.h"
+#include "catapult/utils/ArenaMemoryResource.h"
+#include "catapult/utils/NonCopyable.h"
+#include <memory>
+#include <vector>
+
+namespace catapult {
+	namespace model {
+		struct AddressInteractionNotification;
+		struct Notification;
+		class NotificationPublisher;
+		class NotificationSubscriber;
+	}
+}
+
+namespace catapult { namespace model {
+
+	/// Compact sequence of notifications recorded once from a single entity and replayable to any number of subscribers.
+	/// \note Recorded notifications can reference entity data (and entity hash), so a stream must not outlive its entity.
+	class NotificationStream : public utils::NonCopyable {
+	public:
+		/// Creates an empty stream for notifications raised by \a entityInfo.
+		explicit NotificationStream(const WeakEntityInfo& entityInfo);
+
+		/// Destroys the stream.
+		~NotificationStream();
+
+	public:
+		/// Gets the number of recorded notifications.
+		size_t size() const;
+
+		/// Gets the number of bytes reserved by the stream arena.
+		size_t capacity() const;
+
+		/// Returns \c true if this stream was recorded from exactly the same entity, hash and block header as \a entityInfo.
+		bool isRecordedFrom(const WeakEntityInfo& entityInfo) const;
+
+	public:
+		/// Appends a copy of \a notification to the stream.
+		void append(const Notification& notification);
+
+		/// Replays all recorded notifications, in order, to \a sub.
+		void replay(NotificationSubscriber& sub) const;
+
+	private:
+		const VerifiableEntity* m_pEntity;
+		const Hash256* m_pHash;
+		const BlockHeader* m_pAssociatedBlockHeader;
+
+		utils::ArenaMemoryResource m_arena;
+		std::vector<const Notification*> m_notifications;
+		std::vector<AddressInteractionNotification*> m_ownedNotifications;
+	};
+
+	/// Records all notifications raised by \a publisher for \a entityInfo.
+	std::unique_ptr<NotificationStream> RecordNotifications(const NotificationPublisher& publisher, const WeakEntityInfo& entityInfo);
+}}
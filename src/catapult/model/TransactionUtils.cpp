@@ -22,6 +22,7 @@
 #include "TransactionUtils.h"
 #include "Address.h"
 #include "NotificationPublisher.h"
+#include "NotificationStream.h"
 #include "NotificationSubscriber.h"
 #include "ResolverContext.h"
 #include "Transaction.h"
@@ -66,4 +67,10 @@ namespace catapult { namespace model {
 		notificationPublisher.publish(weakInfo, sub);
 		return sub.addresses();
 	}
+
+	UnresolvedAddressSet ExtractAddresses(const Transaction& transaction, const NotificationStream& notificationStream) {
+		AddressCollector sub(NetworkIdentifier(transaction.Network));
+		notificationStream.replay(sub);
+		return sub.addresses();
+	}
 }}
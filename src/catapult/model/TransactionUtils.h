@@ -25,6 +25,7 @@
 namespace catapult {
 	namespace model {
 		class NotificationPublisher;
+		class NotificationStream;
 		struct Transaction;
 	}
 }
@@ -33,4 +34,7 @@ namespace catapult { namespace model {
 
 	/// Extracts all addresses that are involved in \a transaction using \a notificationPublisher.
 	UnresolvedAddressSet ExtractAddresses(const Transaction& transaction, const NotificationPublisher& notificationPublisher);
+
+	/// Extracts all addresses that are involved in \a transaction from its previously recorded \a notificationStream.
+	UnresolvedAddressSet ExtractAddresses(const Transaction& transaction, const NotificationStream& notificationStream);
 }}
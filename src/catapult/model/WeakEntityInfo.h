@@ -25,7 +25,12 @@
 #include <iosfwd>
 #include <vector>
 
-namespace catapult { namespace model { struct BlockHeader; } }
+namespace catapult {
+	namespace model {
+		struct BlockHeader;
+		class NotificationStream;
+	}
+}
 
 namespace catapult { namespace model {
 
@@ -38,6 +43,7 @@ namespace catapult { namespace model {
 				: m_pEntity(nullptr)
 				, m_pHash(nullptr)
 				, m_pAssociatedBlockHeader(nullptr)
+				, m_pNotificationStream(nullptr)
 		{}
 
 		/// Creates an entity info around \a entity.
@@ -46,6 +52,7 @@ namespace catapult { namespace model {
 				: m_pEntity(&entity)
 				, m_pHash(nullptr)
 				, m_pAssociatedBlockHeader(nullptr)
+				, m_pNotificationStream(nullptr)
 		{}
 
 		/// Creates an entity info around \a entity and \a hash.
@@ -53,6 +60,7 @@ namespace catapult { namespace model {
 				: m_pEntity(&entity)
 				, m_pHash(&hash)
 				, m_pAssociatedBlockHeader(nullptr)
+				, m_pNotificationStream(nullptr)
 		{}
 
 		/// Creates an entity info around \a entity, \a hash and \a associatedBlockHeader.
@@ -60,6 +68,7 @@ namespace catapult { namespace model {
 				: m_pEntity(&entity)
 				, m_pHash(&hash)
 				, m_pAssociatedBlockHeader(&associatedBlockHeader)
+				, m_pNotificationStream(nullptr)
 		{}
 
 	public:
@@ -78,6 +87,11 @@ namespace catapult { namespace model {
 			return !!m_pAssociatedBlockHeader;
 		}
 
+		/// Returns \c true if this info has an associated (pre-recorded) notification stream.
+		constexpr bool isNotificationStreamSet() const {
+			return !!m_pNotificationStream;
+		}
+
 	public:
 		/// Gets the entity.
 		constexpr const TEntity& entity() const {
@@ -99,6 +113,18 @@ namespace catapult { namespace model {
 			return *m_pAssociatedBlockHeader;
 		}
 
+		/// Gets the associated notification stream.
+		constexpr const NotificationStream& notificationStream() const {
+			return *m_pNotificationStream;
+		}
+
+	public:
+		/// Associates \a notificationStream with this info.
+		/// \note \a notificationStream must have been recorded from this info's entity.
+		void setNotificationStream(const NotificationStream& notificationStream) {
+			m_pNotificationStream = &notificationStream;
+		}
+
 	public:
 		/// Coerces this info into a differently typed info.
 		template<typename TEntityResult>
@@ -124,6 +150,7 @@ namespace catapult { namespace model {
 		const TEntity* m_pEntity;
 		const Hash256* m_pHash;
 		const BlockHeader* m_pAssociatedBlockHeader;
+		const NotificationStream* m_pNotificationStream;
 	};
 
 	using WeakEntityInfo = WeakEntityInfoT<VerifiableEntity>;
@@ -39,6 +39,7 @@ namespace catapult { namespace net {
 				, Timeout(utils::TimeSpan::FromSeconds(10))
 				, SocketWorkingBufferSize(utils::FileSize::FromKilobytes(4))
 				, SocketWorkingBufferSensitivity(0) // memory reclamation disabled
+				, SocketWriteCoalescingSize(utils::FileSize::FromKilobytes(16)) // maximum tls record size
 				, MaxPacketDataSize(utils::FileSize::FromBytes(Default_Max_Packet_Data_Size))
 				, OutgoingProtocols(ionet::IpProtocol::IPv4)
 				, AllowIncomingSelfConnections(true)
@@ -61,6 +62,9 @@ namespace catapult { namespace net {
 		/// Socket working buffer sensitivity.
 		size_t SocketWorkingBufferSensitivity;
 
+		/// Socket write coalescing size.
+		utils::FileSize SocketWriteCoalescingSize;
+
 		/// Maximum packet data size.
 		utils::FileSize MaxPacketDataSize;
 
@@ -83,6 +87,7 @@ namespace catapult { namespace net {
 			options.AcceptHandshakeTimeout = Timeout;
 			options.WorkingBufferSize = SocketWorkingBufferSize.bytes();
 			options.WorkingBufferSensitivity = SocketWorkingBufferSensitivity;
+			options.WriteCoalescingSize = SocketWriteCoalescingSize.bytes();
 			options.MaxPacketDataSize = MaxPacketDataSize.bytes();
 			options.OutgoingProtocols = OutgoingProtocols;
 			options.SslOptions = SslOptions;
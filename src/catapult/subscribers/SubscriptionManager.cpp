@@ -31,12 +31,22 @@
 #include "catapult/cache_tx/AggregateUtCache.h"
 #include "catapult/config/CatapultConfiguration.h"
 #include "catapult/io/AggregateBlockStorage.h"
+#include "catapult/io/SegmentedBlockStorage.h"
 
 namespace catapult { namespace subscribers {
 
+	namespace {
+		std::unique_ptr<io::PrunableBlockStorage> CreateFileStorage(const config::CatapultConfiguration& config) {
+			if (config.Node.EnableSegmentedBlockStorage)
+				return std::make_unique<io::SegmentedBlockStorage>(config.User.DataDirectory);
+
+			return std::make_unique<io::FileBlockStorage>(config.User.DataDirectory);
+		}
+	}
+
 	SubscriptionManager::SubscriptionManager(const config::CatapultConfiguration& config)
 			: m_config(config)
-			, m_pStorage(std::make_unique<io::FileBlockStorage>(m_config.User.DataDirectory)) {
+			, m_pStorage(CreateFileStorage(m_config)) {
 		m_subscriberUsedFlags.fill(false);
 	}
 
@@ -122,7 +122,7 @@ namespace catapult { namespace subscribers {
 
 	private:
 		const config::CatapultConfiguration& m_config;
-		std::unique_ptr<io::FileBlockStorage> m_pStorage;
+		std::unique_ptr<io::PrunableBlockStorage> m_pStorage;
 		std::array<bool, utils::to_underlying_type(SubscriberType::Count)> m_subscriberUsedFlags;
 
 		std::vector<std::unique_ptr<io::BlockChangeSubscriber>> m_blockChangeSubscribers;
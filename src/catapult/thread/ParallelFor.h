@@ -22,6 +22,9 @@
 #pragma once
 #include "Future.h"
 #include <boost/asio.hpp>
+#include <exception>
+#include <memory>
+#include <vector>
 
 namespace catapult { namespace thread {
 
@@ -125,4 +128,46 @@ namespace catapult { namespace thread {
 			}
 		});
 	}
+
+	/// Uses \a ioContext to process \a items in \a numPartitions batches and calls \a callback for each item.
+	/// Future is returned that is resolved with one (possibly empty) exception per item when all items have been processed.
+	/// \note Exceptions cannot escape pool threads, so any exception thrown by \a callback is captured at the index of its item.
+	template<typename TItems, typename TWorkCallback>
+	thread::future<std::vector<std::exception_ptr>> ParallelForCaptureExceptions(
+			boost::asio::io_context& ioContext,
+			TItems& items,
+			size_t numPartitions,
+			TWorkCallback callback) {
+		auto pExceptions = std::make_shared<std::vector<std::exception_ptr>>(items.size());
+		auto captureCallback = [callback, pExceptions](auto& item, auto index) {
+			try {
+				callback(item, index);
+			} catch (...) {
+				(*pExceptions)[index] = std::current_exception();
+			}
+
+			return true;
+		};
+
+		return ParallelFor(ioContext, items, numPartitions, captureCallback).then([pExceptions](auto&& processFuture) {
+			processFuture.get();
+			return std::move(*pExceptions);
+		});
+	}
+
+	/// Uses \a ioContext to process \a items in \a numPartitions batches, calls \a callback for each item
+	/// and blocks until all items have been processed.
+	/// \note The exception captured for the lowest item index (if any) is rethrown on the calling thread.
+	template<typename TItems, typename TWorkCallback>
+	void ParallelForRethrowFirstException(
+			boost::asio::io_context& ioContext,
+			TItems& items,
+			size_t numPartitions,
+			TWorkCallback callback) {
+		auto exceptions = ParallelForCaptureExceptions(ioContext, items, numPartitions, callback).get();
+		for (const auto& pException : exceptions) {
+			if (pException)
+				std::rethrow_exception(pException);
+		}
+	}
 }}
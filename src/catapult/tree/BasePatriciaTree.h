@@ -78,12 +78,68 @@ namespace catapult { namespace tree {
 	public:
 		/// Commits all changes in the rebased tree.
 		void commit() {
+			commit(nullptr);
+		}
+
+		/// Commits all changes in the rebased tree and sets \a committedNodeHashes to the hashes of all nodes that became reachable
+		/// or unreachable given the link counts of all committed nodes linked at more than one position (\a sharedLinkCounts)
+		/// and a predicate indicating whether or not a stored node is unreachable (\a isUnreachable).
+		void commit(
+				const NodeLinkCounts& sharedLinkCounts,
+				const predicate<const Hash256&>& isUnreachable,
+				CommittedNodeHashes& committedNodeHashes) {
+			auto isCommitted = [this, &isUnreachable](const auto& hash) {
+				return !isUnreachable(hash) && !m_dataSource.get(hash).empty();
+			};
+
+			commit([this, &sharedLinkCounts, &isCommitted, &committedNodeHashes](const auto& delta) {
+				committedNodeHashes = delta.findCommittedNodeHashes(root(), sharedLinkCounts, isCommitted);
+			});
+		}
+
+	public:
+		/// Finds the link counts of all nodes linked at more than one position.
+		/// \note This visits every position of the tree.
+		NodeLinkCounts findSharedLinkCounts() const {
+			NodeLinkCounts linkCounts;
+			std::vector<Hash256> hashes;
+			if (Hash256() != root())
+				hashes.push_back(root());
+
+			while (!hashes.empty()) {
+				auto hash = hashes.back();
+				hashes.pop_back();
+				++linkCounts[hash];
+
+				// a shared subtree is visited once per position, so that all of its nodes are counted once per position too
+				auto node = m_dataSource.get(hash);
+				if (!node.isBranch())
+					continue;
+
+				const auto& branchNode = node.asBranchNode();
+				for (auto i = 0u; i < BranchTreeNode::Max_Links; ++i) {
+					if (branchNode.hasLink(i))
+						hashes.push_back(branchNode.link(i));
+				}
+			}
+
+			for (auto iter = linkCounts.begin(); linkCounts.end() != iter;)
+				iter = 1 == iter->second ? linkCounts.erase(iter) : std::next(iter);
+
+			return linkCounts;
+		}
+
+	private:
+		void commit(const consumer<const DeltaType&>& findCommittedNodeHashes) {
 			auto pDelta = m_pWeakDelta.lock();
 			if (!pDelta)
 				CATAPULT_THROW_RUNTIME_ERROR("attempting to commit changes to a tree without any outstanding attached deltas");
 
 			// copy all pending changes directly into the data source, update the root hash and reset the delta
 			pDelta->setCheckpoint(); // commit should always create a checkpoint
+			if (findCommittedNodeHashes)
+				findCommittedNodeHashes(*pDelta);
+
 			pDelta->copyPendingChangesTo(m_dataSource);
 			pDelta->copyRootTo(m_tree); // cannot lookup in m_dataSource directly because of delayed write data sources
 			pDelta->reset(pDelta->root());
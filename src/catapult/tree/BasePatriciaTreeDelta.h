@@ -24,15 +24,34 @@
 #include "ReadThroughMemoryDataSource.h"
 #include "catapult/utils/HexFormatter.h"
 #include "catapult/exceptions.h"
+#include "catapult/functions.h"
+#include <map>
 #include <unordered_map>
-#include <unordered_set>
+#include <vector>
 
 namespace catapult { namespace tree {
 
+	/// Numbers of positions at which nodes are linked in a tree.
+	using NodeLinkCounts = std::unordered_map<Hash256, uint32_t, utils::ArrayHasher<Hash256>>;
+
+	/// Hashes of nodes affected by a tree commit.
+	struct CommittedNodeHashes {
+		/// Hashes of nodes that are reachable from the committed root but were not reachable from the previous root.
+		std::vector<Hash256> Reachable;
+
+		/// Hashes of nodes that are not reachable from the committed root
+		/// but were either reachable from the previous root or saved by an intermediate checkpoint.
+		std::vector<Hash256> Unreachable;
+
+		/// Updated link counts of all nodes that are or were linked at more than one position.
+		/// \note A count below two indicates a node that is no longer linked at more than one position.
+		NodeLinkCounts SharedLinkCounts;
+	};
+
 	/// Delta on top of a base patricia tree that offers methods to set/unset nodes.
 	template<typename TEncoder, typename TDataSource, typename THasher>
 	class BasePatriciaTreeDelta {
-	private:
+	public:
 		using KeyType = typename TEncoder::KeyType;
 		using ValueType = typename TEncoder::ValueType;
 
@@ -77,12 +96,139 @@ namespace catapult { namespace tree {
 			return m_tree.unset(key);
 		}
 
+		/// Prefetches all stored nodes along the paths of \a keys.
+		void prefetch(const std::vector<KeyType>& keys) const {
+			m_tree.prefetch(keys);
+		}
+
 	public:
 		/// Marks all nodes reachable at this point.
 		void setCheckpoint() {
 			m_tree.saveAll();
 		}
 
+	public:
+		/// Finds the hashes of all nodes that become reachable or unreachable when this delta replaces the tree with root hash
+		/// \a previousRootHash given the link counts of all nodes of that tree linked at more than one position (\a sharedLinkCounts)
+		/// and a predicate indicating whether or not a node is reachable from that tree (\a isCommitted).
+		/// \note Nodes are counted per position because identical subtrees (e.g. identical leaves below different branches)
+		///        are stored once, so a node is only unreachable when it is no longer linked at any position.
+		CommittedNodeHashes findCommittedNodeHashes(
+				const Hash256& previousRootHash,
+				const NodeLinkCounts& sharedLinkCounts,
+				const predicate<const Hash256&>& isCommitted) const {
+			// 1. compare both trees position by position (identical subtrees at the same position are skipped)
+			auto linkCountDeltas = calculateLinkCountDeltas(previousRootHash);
+
+			// 2. apply the link count changes; nodes that are not shared are linked at most once
+			CommittedNodeHashes committedNodeHashes;
+			for (const auto& pair : linkCountDeltas) {
+				const auto& hash = pair.first;
+				auto sharedLinkCountIter = sharedLinkCounts.find(hash);
+				auto isShared = sharedLinkCounts.cend() != sharedLinkCountIter;
+				uint64_t previousLinkCount = isShared
+						? sharedLinkCountIter->second
+						: (0 != pair.second.NumRemoved || isCommitted(hash) ? 1 : 0);
+				if (previousLinkCount < pair.second.NumRemoved)
+					CATAPULT_THROW_RUNTIME_ERROR_1("patricia tree node is unlinked at more positions than it is linked", hash);
+
+				auto linkCount = previousLinkCount + pair.second.NumAdded - pair.second.NumRemoved;
+				if (0 == previousLinkCount && 0 != linkCount)
+					committedNodeHashes.Reachable.push_back(hash);
+				else if (0 != previousLinkCount && 0 == linkCount)
+					committedNodeHashes.Unreachable.push_back(hash);
+
+				if (linkCount != previousLinkCount && (isShared || linkCount > 1))
+					committedNodeHashes.SharedLinkCounts.emplace(hash, static_cast<uint32_t>(linkCount));
+			}
+
+			// 3. pending nodes that are neither linked by the new tree nor committed were saved by intermediate checkpoints
+			m_dataSource.forEach([&linkCountDeltas, &isCommitted, &committedNodeHashes](const auto& node) {
+				const auto& hash = node.hash();
+				if (linkCountDeltas.cend() == linkCountDeltas.find(hash) && !isCommitted(hash))
+					committedNodeHashes.Unreachable.push_back(hash);
+			});
+
+			return committedNodeHashes;
+		}
+
+	private:
+		struct LinkCountDelta {
+			uint32_t NumAdded = 0;
+			uint32_t NumRemoved = 0;
+		};
+
+		using LinkCountDeltas = std::unordered_map<Hash256, LinkCountDelta, utils::ArrayHasher<Hash256>>;
+
+		// nibbles preceding a node
+		using NodePosition = std::vector<uint8_t>;
+
+		struct PositionHashes {
+			Hash256 Current;
+			Hash256 Previous;
+		};
+
+		struct ShorterPositionFirst {
+			bool operator()(const NodePosition& lhs, const NodePosition& rhs) const {
+				return lhs.size() != rhs.size() ? lhs.size() < rhs.size() : lhs < rhs;
+			}
+		};
+
+		using PositionHashesMap = std::map<NodePosition, PositionHashes, ShorterPositionFirst>;
+
+		LinkCountDeltas calculateLinkCountDeltas(const Hash256& previousRootHash) const {
+			// positions are processed from shortest to longest, so the nodes of both trees at a position are known when it is processed
+			PositionHashesMap positions;
+			positions.emplace(NodePosition(), PositionHashes{ root(), previousRootHash });
+
+			LinkCountDeltas linkCountDeltas;
+			while (!positions.empty()) {
+				auto position = positions.begin()->first;
+				auto positionHashes = positions.begin()->second;
+				positions.erase(positions.begin());
+
+				if (positionHashes.Current == positionHashes.Previous)
+					continue;
+
+				if (Hash256() != positionHashes.Current) {
+					++linkCountDeltas[positionHashes.Current].NumAdded;
+					AddChildPositions(m_dataSource.get(positionHashes.Current), position, &PositionHashes::Current, positions);
+				}
+
+				if (Hash256() != positionHashes.Previous) {
+					++linkCountDeltas[positionHashes.Previous].NumRemoved;
+					AddChildPositions(m_dataSource.get(positionHashes.Previous), position, &PositionHashes::Previous, positions);
+				}
+			}
+
+			return linkCountDeltas;
+		}
+
+		static void AddChildPositions(
+				const TreeNode& node,
+				const NodePosition& position,
+				Hash256 PositionHashes::* pPositionHash,
+				PositionHashesMap& positions) {
+			if (!node.isBranch())
+				return;
+
+			const auto& branchNode = node.asBranchNode();
+			const auto& path = branchNode.path();
+
+			auto childPosition = position;
+			for (auto i = 0u; i < path.size(); ++i)
+				childPosition.push_back(path.nibbleAt(i));
+
+			childPosition.push_back(0);
+			for (uint8_t i = 0; i < BranchTreeNode::Max_Links; ++i) {
+				if (!branchNode.hasLink(i))
+					continue;
+
+				childPosition.back() = i;
+				positions[childPosition].*pPositionHash = branchNode.link(i);
+			}
+		}
+
 	public:
 		/// Copies all pending changes to \a dataSource.
 		template<typename TDestinationDataSource>
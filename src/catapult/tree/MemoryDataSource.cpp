@@ -44,6 +44,9 @@ namespace catapult { namespace tree {
 		return TreeNode();
 	}
 
+	void MemoryDataSource::prefetch(const std::vector<Hash256>&) const
+	{}
+
 	void MemoryDataSource::forEach(const consumer<const TreeNode&>& consumer) const {
 		for (const auto& pair : m_leafNodes)
 			consumer(TreeNode(pair.second));
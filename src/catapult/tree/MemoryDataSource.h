@@ -25,6 +25,7 @@
 #include "catapult/utils/Hashers.h"
 #include "catapult/functions.h"
 #include <unordered_map>
+#include <vector>
 
 namespace catapult { namespace tree {
 
@@ -42,6 +43,10 @@ namespace catapult { namespace tree {
 		/// Gets the tree node associated with \a hash.
 		TreeNode get(const Hash256& hash) const;
 
+		/// Prefetches the nodes with \a hashes.
+		/// \note This is a no-op because all nodes are always in memory.
+		void prefetch(const std::vector<Hash256>& hashes) const;
+
 		/// Gets all nodes and passes them to \a consumer.
 		void forEach(const consumer<const TreeNode&>& consumer) const;
 
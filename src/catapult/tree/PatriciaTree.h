@@ -21,6 +21,8 @@
 
 #pragma once
 #include "TreeNode.h"
+#include <array>
+#include <vector>
 
 namespace catapult { namespace tree {
 
@@ -254,6 +256,85 @@ namespace catapult { namespace tree {
 
 		// endregion
 
+		// region prefetch
+
+	public:
+		/// Prefetches all stored nodes along the paths of \a keys with a single data source batch per tree level.
+		void prefetch(const std::vector<KeyType>& keys) const {
+			if (m_rootNode.empty() || keys.empty())
+				return;
+
+			std::vector<TreeNodePath> keyPaths;
+			keyPaths.reserve(keys.size());
+			for (const auto& key : keys)
+				keyPaths.emplace_back(TEncoder::EncodeKey(key));
+
+			std::vector<PrefetchItem> items;
+			items.push_back({ m_rootNode.copy(), std::move(keyPaths) });
+			while (!items.empty()) {
+				std::vector<PrefetchItem> nextItems;
+				std::vector<std::pair<Hash256, std::vector<TreeNodePath>>> unloadedLinks;
+				for (const auto& item : items)
+					splitPrefetchItem(item, nextItems, unloadedLinks);
+
+				if (!unloadedLinks.empty()) {
+					std::vector<Hash256> hashes;
+					hashes.reserve(unloadedLinks.size());
+					for (const auto& pair : unloadedLinks)
+						hashes.push_back(pair.first);
+
+					m_dataSource.prefetch(hashes);
+					for (auto& pair : unloadedLinks)
+						nextItems.push_back({ m_dataSource.get(pair.first), std::move(pair.second) });
+				}
+
+				items = std::move(nextItems);
+			}
+		}
+
+	private:
+		// node paired with the remaining paths of all keys that pass through it
+		struct PrefetchItem {
+			TreeNode Node;
+			std::vector<TreeNodePath> KeyPaths;
+		};
+
+		void splitPrefetchItem(
+				const PrefetchItem& item,
+				std::vector<PrefetchItem>& nextItems,
+				std::vector<std::pair<Hash256, std::vector<TreeNodePath>>>& unloadedLinks) const {
+			// only branch nodes can have nodes below them
+			if (!item.Node.isBranch())
+				return;
+
+			const auto& branchNode = item.Node.asBranchNode();
+			const auto& branchPath = branchNode.path();
+			std::array<std::vector<TreeNodePath>, BranchTreeNode::Max_Links> linkKeyPaths;
+			for (const auto& keyPath : item.KeyPaths) {
+				// if the key diverges from the branch path, no node below the branch is visited
+				auto differenceIndex = FindFirstDifferenceIndex(branchPath, keyPath);
+				if (differenceIndex != branchPath.size() || differenceIndex == keyPath.size())
+					continue;
+
+				auto linkIndex = keyPath.nibbleAt(differenceIndex);
+				if (branchNode.hasLink(linkIndex))
+					linkKeyPaths[linkIndex].push_back(keyPath.subpath(differenceIndex + 1));
+			}
+
+			for (auto i = 0u; i < BranchTreeNode::Max_Links; ++i) {
+				if (linkKeyPaths[i].empty())
+					continue;
+
+				auto linkedNode = branchNode.linkedNode(i);
+				if (!linkedNode.empty())
+					nextItems.push_back({ std::move(linkedNode), std::move(linkKeyPaths[i]) });
+				else
+					unloadedLinks.emplace_back(branchNode.link(i), std::move(linkKeyPaths[i]));
+			}
+		}
+
+		// endregion
+
 		// region tryLoad + setRoot + clear
 
 	public:
@@ -49,6 +49,11 @@ namespace catapult { namespace tree {
 			return !node.empty() ? std::move(node) : m_backingDataSource.get(hash);
 		}
 
+		/// Prefetches the nodes with \a hashes from the backing data source.
+		void prefetch(const std::vector<Hash256>& hashes) const {
+			m_backingDataSource.prefetch(hashes);
+		}
+
 		/// Gets all nodes in memory and passes them to \a consumer.
 		void forEach(const consumer<const TreeNode&>& consumer) const {
 			m_memoryDataSource.forEach(consumer);
@@ -0,0 +1,130 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ArenaMemoryResource.h"
+#include <algorithm>
+#include <atomic>
+
+namespace catapult { namespace utils {
+
+	namespace {
+		std::atomic<uint64_t> g_numReservedBytes(0);
+		std::atomic<uint64_t> g_numBlockAllocations(0);
+
+		uint8_t* AlignPointer(uint8_t* pData, size_t alignment) {
+			auto address = reinterpret_cast<uintptr_t>(pData);
+			auto alignedAddress = (address + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+			return reinterpret_cast<uint8_t*>(alignedAddress);
+		}
+	}
+
+	ArenaMemoryStatistics GetArenaMemoryStatistics() {
+		return { g_numReservedBytes.load(), g_numBlockAllocations.load() };
+	}
+
+	ArenaMemoryResource::ArenaMemoryResource(size_t initialBlockSize)
+			: m_nextBlockSize(std::max<size_t>(initialBlockSize, 1))
+			, m_pNext(nullptr)
+			, m_numRemainingBytes(0)
+			, m_numAllocations(0)
+			, m_size(0)
+			, m_capacity(0)
+	{}
+
+	ArenaMemoryResource::~ArenaMemoryResource() {
+		releaseBlocks(0);
+	}
+
+	size_t ArenaMemoryResource::numAllocations() const {
+		return m_numAllocations;
+	}
+
+	size_t ArenaMemoryResource::size() const {
+		return m_size;
+	}
+
+	size_t ArenaMemoryResource::capacity() const {
+		return m_capacity;
+	}
+
+	void ArenaMemoryResource::reset() {
+		if (m_blocks.empty())
+			return;
+
+		// retain only the largest block
+		auto largestIter = std::max_element(m_blocks.begin(), m_blocks.end(), [](const auto& lhs, const auto& rhs) {
+			return lhs.Size < rhs.Size;
+		});
+		std::swap(m_blocks.front(), *largestIter);
+		releaseBlocks(1);
+
+		m_pNext = m_blocks.front().pData.get();
+		m_numRemainingBytes = m_blocks.front().Size;
+		m_numAllocations = 0;
+		m_size = 0;
+	}
+
+	void* ArenaMemoryResource::do_allocate(size_t numBytes, size_t alignment) {
+		auto* pAligned = AlignPointer(m_pNext, alignment);
+		auto numPaddingBytes = static_cast<size_t>(pAligned - m_pNext);
+		if (!m_pNext || numPaddingBytes + numBytes > m_numRemainingBytes) {
+			addBlock(numBytes + alignment);
+			pAligned = AlignPointer(m_pNext, alignment);
+			numPaddingBytes = static_cast<size_t>(pAligned - m_pNext);
+		}
+
+		m_pNext = pAligned + numBytes;
+		m_numRemainingBytes -= numPaddingBytes + numBytes;
+
+		++m_numAllocations;
+		m_size += numBytes;
+		return pAligned;
+	}
+
+	void ArenaMemoryResource::do_deallocate(void*, size_t, size_t) {
+		// memory is only reclaimed by reset
+	}
+
+	bool ArenaMemoryResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+		return this == &other;
+	}
+
+	void ArenaMemoryResource::addBlock(size_t minSize) {
+		auto blockSize = std::max(m_nextBlockSize, minSize);
+		m_blocks.push_back({ std::unique_ptr<uint8_t[]>(new uint8_t[blockSize]), blockSize });
+		m_pNext = m_blocks.back().pData.get();
+		m_numRemainingBytes = blockSize;
+		m_nextBlockSize = std::min(2 * m_nextBlockSize, Max_Block_Size);
+
+		m_capacity += blockSize;
+		g_numReservedBytes += blockSize;
+		++g_numBlockAllocations;
+	}
+
+	void ArenaMemoryResource::releaseBlocks(size_t numRetainedBlocks) {
+		for (auto i = numRetainedBlocks; i < m_blocks.size(); ++i) {
+			m_capacity -= m_blocks[i].Size;
+			g_numReservedBytes -= m_blocks[i].Size;
+		}
+
+		m_blocks.resize(std::min(numRetainedBlocks, m_blocks.size()));
+	}
+}}
@@ -0,0 +1,102 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "NonCopyable.h"
+#include <memory>
+#include <memory_resource>
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace catapult { namespace utils {
+
+	/// Process-wide statistics about all arena memory resources.
+	struct ArenaMemoryStatistics {
+		/// Number of bytes currently reserved by all arenas.
+		uint64_t NumReservedBytes;
+
+		/// Total number of blocks requested from the system by all arenas.
+		uint64_t NumBlockAllocations;
+	};
+
+	/// Gets the process-wide arena statistics.
+	/// \note These are only updated when blocks are requested or released, so individual allocations are only counted per arena.
+	ArenaMemoryStatistics GetArenaMemoryStatistics();
+
+	/// Monotonic memory resource that serves allocations from progressively larger blocks and releases them all at once.
+	/// \note This is intended for many short-lived allocations that share a lifetime (e.g. everything allocated while
+	///       executing a block), so deallocation is a no-op and memory is only reclaimed by reset.
+	class ArenaMemoryResource : public std::pmr::memory_resource, public NonCopyable {
+	public:
+		/// Default size of the first block.
+		static constexpr size_t Default_Initial_Block_Size = 4 * 1024;
+
+		/// Maximum size of a (non-oversized) block.
+		static constexpr size_t Max_Block_Size = 1024 * 1024;
+
+	public:
+		/// Creates an arena with an initial block size of \a initialBlockSize.
+		explicit ArenaMemoryResource(size_t initialBlockSize = Default_Initial_Block_Size);
+
+		/// Destroys the arena and releases all memory.
+		~ArenaMemoryResource() override;
+
+	public:
+		/// Gets the number of allocations served since the last reset.
+		size_t numAllocations() const;
+
+		/// Gets the number of bytes served since the last reset.
+		size_t size() const;
+
+		/// Gets the number of bytes reserved.
+		size_t capacity() const;
+
+	public:
+		/// Releases all allocations in bulk.
+		/// \note The largest block is retained so that a reused arena does not need to request new memory.
+		void reset();
+
+	private:
+		void* do_allocate(size_t numBytes, size_t alignment) override;
+		void do_deallocate(void*, size_t, size_t) override;
+		bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+	private:
+		void addBlock(size_t minSize);
+		void releaseBlocks(size_t numRetainedBlocks);
+
+	private:
+		struct Block {
+			std::unique_ptr<uint8_t[]> pData;
+			size_t Size;
+		};
+
+		size_t m_nextBlockSize;
+		std::vector<Block> m_blocks;
+		uint8_t* m_pNext;
+		size_t m_numRemainingBytes;
+
+		size_t m_numAllocations;
+		size_t m_size;
+		size_t m_capacity;
+	};
+}}
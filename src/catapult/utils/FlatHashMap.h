@@ -0,0 +1,544 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "traits/StlTraits.h"
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace catapult { namespace utils {
+
+	/// Unordered map that uses an open-addressing (linear probing) index on top of chunked node storage.
+	/// \note The index is a flat array of (hash, node id) pairs, so lookups touch a single contiguous region until the matching
+	///       node is dereferenced. Nodes are never moved, so references and iterators to elements remain valid until the elements
+	///       are erased (even when the index is rehashed).
+	/// \note Iteration is in node (roughly insertion) order and erasing an element does not invalidate iterators to other elements.
+	template<typename TKey, typename TValue, typename THasher = std::hash<TKey>, typename TKeyEqual = std::equal_to<TKey>>
+	class FlatHashMap {
+	public:
+		using key_type = TKey;
+		using mapped_type = TValue;
+		using value_type = std::pair<const TKey, TValue>;
+		using size_type = size_t;
+		using hasher = THasher;
+		using key_equal = TKeyEqual;
+		using reference = value_type&;
+		using const_reference = const value_type&;
+
+	private:
+		static constexpr size_t Nodes_Per_Chunk = 256;
+		static constexpr size_t Min_Index_Capacity = 16;
+		static constexpr uint32_t Unset_Node_Id = 0;
+
+		struct Node {
+			std::aligned_storage_t<sizeof(value_type), alignof(value_type)> Storage;
+			uint32_t NextFreeNodeId;
+			bool IsOccupied;
+
+			value_type& value() {
+				return *reinterpret_cast<value_type*>(&Storage);
+			}
+
+			const value_type& value() const {
+				return *reinterpret_cast<const value_type*>(&Storage);
+			}
+		};
+
+		// node ids are one-based so that zero-initialized slots are empty
+		struct Slot {
+			uint32_t Hash;
+			uint32_t NodeId;
+		};
+
+	private:
+		template<bool IsConst>
+		class BasicIterator {
+		private:
+			using MapPointer = std::conditional_t<IsConst, const FlatHashMap*, FlatHashMap*>;
+
+		public:
+			using difference_type = std::ptrdiff_t;
+			using value_type = std::conditional_t<IsConst, const typename FlatHashMap::value_type, typename FlatHashMap::value_type>;
+			using pointer = value_type*;
+			using reference = value_type&;
+			using iterator_category = std::forward_iterator_tag;
+
+		public:
+			/// Creates an uninitialized iterator.
+			BasicIterator() : m_pMap(nullptr), m_nodeIndex(0)
+			{}
+
+			/// Creates an iterator around \a pMap pointing at the first occupied node at or after \a nodeIndex.
+			BasicIterator(MapPointer pMap, size_t nodeIndex)
+					: m_pMap(pMap)
+					, m_nodeIndex(nodeIndex) {
+				moveToOccupiedNode();
+			}
+
+			/// Creates a const iterator from a non-const iterator (\a iter).
+			template<bool IsOtherConst, typename = std::enable_if_t<IsConst && !IsOtherConst>>
+			BasicIterator(const BasicIterator<IsOtherConst>& iter)
+					: m_pMap(iter.m_pMap)
+					, m_nodeIndex(iter.m_nodeIndex)
+			{}
+
+		public:
+			/// Returns \c true if \a lhs and \a rhs are equal.
+			friend bool operator==(const BasicIterator& lhs, const BasicIterator& rhs) {
+				return lhs.m_pMap == rhs.m_pMap && lhs.m_nodeIndex == rhs.m_nodeIndex;
+			}
+
+			/// Returns \c true if \a lhs and \a rhs are not equal.
+			friend bool operator!=(const BasicIterator& lhs, const BasicIterator& rhs) {
+				return !(lhs == rhs);
+			}
+
+		public:
+			/// Advances the iterator to the next position.
+			BasicIterator& operator++() {
+				++m_nodeIndex;
+				moveToOccupiedNode();
+				return *this;
+			}
+
+			/// Advances the iterator to the next position.
+			BasicIterator operator++(int) {
+				auto copy = *this;
+				++*this;
+				return copy;
+			}
+
+		public:
+			/// Gets a reference to the current element.
+			reference operator*() const {
+				return m_pMap->node(m_nodeIndex).value();
+			}
+
+			/// Gets a pointer to the current element.
+			pointer operator->() const {
+				return &m_pMap->node(m_nodeIndex).value();
+			}
+
+		private:
+			void moveToOccupiedNode() {
+				while (m_nodeIndex < m_pMap->m_numNodes && !m_pMap->node(m_nodeIndex).IsOccupied)
+					++m_nodeIndex;
+			}
+
+		private:
+			MapPointer m_pMap;
+			size_t m_nodeIndex;
+
+		private:
+			friend class FlatHashMap;
+			friend class BasicIterator<!IsConst>;
+		};
+
+	public:
+		using iterator = BasicIterator<false>;
+		using const_iterator = BasicIterator<true>;
+
+	public:
+		/// Creates an empty map.
+		FlatHashMap()
+				: m_numNodes(0)
+				, m_freeNodeId(Unset_Node_Id)
+				, m_size(0)
+		{}
+
+		/// Creates a map containing all \a values.
+		FlatHashMap(std::initializer_list<value_type> values) : FlatHashMap() {
+			reserve(values.size());
+			insert(values.begin(), values.end());
+		}
+
+		/// Copy constructor that makes a deep copy of \a rhs.
+		FlatHashMap(const FlatHashMap& rhs) : FlatHashMap() {
+			reserve(rhs.size());
+			insert(rhs.cbegin(), rhs.cend());
+		}
+
+		/// Move constructor that takes ownership of all elements in \a rhs.
+		FlatHashMap(FlatHashMap&& rhs) noexcept : FlatHashMap() {
+			swap(rhs);
+		}
+
+		/// Destroys the map.
+		~FlatHashMap() {
+			destroyAll();
+		}
+
+	public:
+		/// Assignment operator that makes a deep copy of \a rhs.
+		FlatHashMap& operator=(const FlatHashMap& rhs) {
+			if (this != &rhs) {
+				auto copy = rhs;
+				swap(copy);
+			}
+
+			return *this;
+		}
+
+		/// Move assignment operator that takes ownership of all elements in \a rhs.
+		FlatHashMap& operator=(FlatHashMap&& rhs) noexcept {
+			swap(rhs);
+			return *this;
+		}
+
+		/// Swaps the contents of this map with \a rhs.
+		void swap(FlatHashMap& rhs) noexcept {
+			std::swap(m_slots, rhs.m_slots);
+			std::swap(m_chunks, rhs.m_chunks);
+			std::swap(m_numNodes, rhs.m_numNodes);
+			std::swap(m_freeNodeId, rhs.m_freeNodeId);
+			std::swap(m_size, rhs.m_size);
+		}
+
+	public:
+		/// Returns \c true if the map is empty.
+		bool empty() const {
+			return 0 == m_size;
+		}
+
+		/// Gets the number of elements in the map.
+		size_t size() const {
+			return m_size;
+		}
+
+	public:
+		/// Gets an iterator to the first element.
+		iterator begin() {
+			return iterator(this, 0);
+		}
+
+		/// Gets an iterator to the element following the last element.
+		iterator end() {
+			return iterator(this, m_numNodes);
+		}
+
+		/// Gets a const iterator to the first element.
+		const_iterator begin() const {
+			return cbegin();
+		}
+
+		/// Gets a const iterator to the element following the last element.
+		const_iterator end() const {
+			return cend();
+		}
+
+		/// Gets a const iterator to the first element.
+		const_iterator cbegin() const {
+			return const_iterator(this, 0);
+		}
+
+		/// Gets a const iterator to the element following the last element.
+		const_iterator cend() const {
+			return const_iterator(this, m_numNodes);
+		}
+
+	public:
+		/// Finds the element with \a key.
+		iterator find(const TKey& key) {
+			auto slotIndex = findSlotIndex(key);
+			return m_slots.size() == slotIndex ? end() : iterator(this, m_slots[slotIndex].NodeId - 1);
+		}
+
+		/// Finds the element with \a key.
+		const_iterator find(const TKey& key) const {
+			auto slotIndex = findSlotIndex(key);
+			return m_slots.size() == slotIndex ? cend() : const_iterator(this, m_slots[slotIndex].NodeId - 1);
+		}
+
+		/// Gets the number of elements with \a key.
+		size_t count(const TKey& key) const {
+			return m_slots.size() == findSlotIndex(key) ? 0 : 1;
+		}
+
+		/// Gets a reference to the value associated with \a key, inserting a default value if \a key is not found.
+		TValue& operator[](const TKey& key) {
+			auto iter = find(key);
+			if (end() != iter)
+				return iter->second;
+
+			return emplace(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple()).first->second;
+		}
+
+	public:
+		/// Constructs an element from \a args and inserts it if its key is not already contained.
+		template<typename... TArgs>
+		std::pair<iterator, bool> emplace(TArgs&&... args) {
+			// construct the element in place first because its key is only known after construction
+			auto nodeId = allocateNode();
+			auto& node = this->node(nodeId - 1);
+			try {
+				new (&node.Storage) value_type(std::forward<TArgs>(args)...);
+			} catch (...) {
+				freeNode(nodeId);
+				throw;
+			}
+
+			node.IsOccupied = true;
+			try {
+				return indexNode(nodeId);
+			} catch (...) {
+				// the element is unreachable when it cannot be indexed (e.g. when the index fails to grow), so release it
+				destroyNode(nodeId);
+				throw;
+			}
+		}
+
+		/// Inserts \a value if its key is not already contained.
+		std::pair<iterator, bool> insert(const value_type& value) {
+			return emplace(value);
+		}
+
+		/// Inserts \a value if its key is not already contained.
+		template<typename TPair, typename = std::enable_if_t<std::is_constructible_v<value_type, TPair&&>>>
+		std::pair<iterator, bool> insert(TPair&& value) {
+			return emplace(std::forward<TPair>(value));
+		}
+
+		/// Inserts \a value if its key is not already contained.
+		/// \note The hint is ignored because insertion position is determined by the key hash.
+		iterator insert(const_iterator, const value_type& value) {
+			return insert(value).first;
+		}
+
+		/// Inserts all elements in the range [\a begin, \a end).
+		template<typename TInputIterator>
+		void insert(TInputIterator begin, TInputIterator end) {
+			for (auto iter = begin; end != iter; ++iter)
+				insert(*iter);
+		}
+
+	public:
+		/// Erases the element with \a key and returns the number of erased elements.
+		size_t erase(const TKey& key) {
+			auto slotIndex = findSlotIndex(key);
+			if (m_slots.size() == slotIndex)
+				return 0;
+
+			eraseSlot(slotIndex);
+			return 1;
+		}
+
+		/// Erases the element pointed to by \a iter and returns an iterator to the next element.
+		iterator erase(const_iterator iter) {
+			auto nextIter = iterator(this, iter.m_nodeIndex + 1);
+			erase(iter->first);
+			return nextIter;
+		}
+
+		/// Erases the element pointed to by \a iter and returns an iterator to the next element.
+		iterator erase(iterator iter) {
+			return erase(const_iterator(iter));
+		}
+
+		/// Erases all elements.
+		/// \note Allocated index and node memory is retained for reuse.
+		void clear() {
+			destroyAll();
+			std::fill(m_slots.begin(), m_slots.end(), Slot{ 0, Unset_Node_Id });
+			m_numNodes = 0;
+			m_freeNodeId = Unset_Node_Id;
+			m_size = 0;
+		}
+
+		/// Reserves space for at least \a count elements without rehashing.
+		void reserve(size_t count) {
+			// keep load factor at or below 3/4
+			auto capacity = std::max<size_t>(m_slots.size(), Min_Index_Capacity);
+			while (capacity * 3 < count * 4)
+				capacity *= 2;
+
+			if (capacity != m_slots.size())
+				rehash(capacity);
+		}
+
+	public:
+		/// Returns \c true if this map contains the same key value pairs as \a rhs.
+		bool operator==(const FlatHashMap& rhs) const {
+			if (m_size != rhs.m_size)
+				return false;
+
+			for (const auto& pair : *this) {
+				auto iter = rhs.find(pair.first);
+				if (rhs.cend() == iter || !(iter->second == pair.second))
+					return false;
+			}
+
+			return true;
+		}
+
+		/// Returns \c true if this map does not contain the same key value pairs as \a rhs.
+		bool operator!=(const FlatHashMap& rhs) const {
+			return !(*this == rhs);
+		}
+
+	private:
+		static uint32_t Hash(const TKey& key) {
+			// fibonacci hashing spreads hashers that return raw key bytes or sequential values across the index
+			auto hash = static_cast<uint64_t>(THasher()(key)) * 0x9E37'79B9'7F4A'7C15ull;
+			return static_cast<uint32_t>(hash >> 32);
+		}
+
+		size_t indexMask() const {
+			return m_slots.size() - 1;
+		}
+
+		size_t findSlotIndex(const TKey& key) const {
+			return m_slots.empty() ? 0 : findSlotIndex(key, Hash(key));
+		}
+
+		size_t findSlotIndex(const TKey& key, uint32_t hash) const {
+			if (m_slots.empty())
+				return 0;
+
+			for (auto i = hash & indexMask();; i = (i + 1) & indexMask()) {
+				const auto& slot = m_slots[i];
+				if (Unset_Node_Id == slot.NodeId)
+					return m_slots.size();
+
+				if (hash == slot.Hash && TKeyEqual()(key, node(slot.NodeId - 1).value().first))
+					return i;
+			}
+		}
+
+		size_t findEmptySlotIndex(uint32_t hash) const {
+			auto i = hash & indexMask();
+			while (Unset_Node_Id != m_slots[i].NodeId)
+				i = (i + 1) & indexMask();
+
+			return i;
+		}
+
+		std::pair<iterator, bool> indexNode(uint32_t nodeId) {
+			const auto& key = node(nodeId - 1).value().first;
+			auto hash = Hash(key);
+			auto existingSlotIndex = findSlotIndex(key, hash);
+			if (m_slots.size() != existingSlotIndex) {
+				destroyNode(nodeId);
+				return std::make_pair(iterator(this, m_slots[existingSlotIndex].NodeId - 1), false);
+			}
+
+			reserve(m_size + 1);
+			m_slots[findEmptySlotIndex(hash)] = Slot{ hash, nodeId };
+			++m_size;
+			return std::make_pair(iterator(this, nodeId - 1), true);
+		}
+
+		void eraseSlot(size_t slotIndex) {
+			destroyNode(m_slots[slotIndex].NodeId);
+			--m_size;
+
+			// backward shift deletion keeps probe sequences contiguous without tombstones
+			auto holeIndex = slotIndex;
+			for (auto i = (slotIndex + 1) & indexMask(); Unset_Node_Id != m_slots[i].NodeId; i = (i + 1) & indexMask()) {
+				auto homeIndex = m_slots[i].Hash & indexMask();
+				if (((i - homeIndex) & indexMask()) >= ((i - holeIndex) & indexMask())) {
+					m_slots[holeIndex] = m_slots[i];
+					holeIndex = i;
+				}
+			}
+
+			m_slots[holeIndex] = Slot{ 0, Unset_Node_Id };
+		}
+
+		void rehash(size_t capacity) {
+			std::vector<Slot> slots(capacity, Slot{ 0, Unset_Node_Id });
+			std::swap(m_slots, slots);
+			for (const auto& slot : slots) {
+				if (Unset_Node_Id != slot.NodeId)
+					m_slots[findEmptySlotIndex(slot.Hash)] = slot;
+			}
+		}
+
+	private:
+		Node& node(size_t nodeIndex) {
+			return m_chunks[nodeIndex / Nodes_Per_Chunk][nodeIndex % Nodes_Per_Chunk];
+		}
+
+		const Node& node(size_t nodeIndex) const {
+			return m_chunks[nodeIndex / Nodes_Per_Chunk][nodeIndex % Nodes_Per_Chunk];
+		}
+
+		uint32_t allocateNode() {
+			if (Unset_Node_Id != m_freeNodeId) {
+				auto nodeId = m_freeNodeId;
+				m_freeNodeId = node(nodeId - 1).NextFreeNodeId;
+				return nodeId;
+			}
+
+			if (m_chunks.size() * Nodes_Per_Chunk == m_numNodes)
+				m_chunks.push_back(std::make_unique<Node[]>(Nodes_Per_Chunk));
+
+			node(m_numNodes).IsOccupied = false;
+			return static_cast<uint32_t>(++m_numNodes);
+		}
+
+		void freeNode(uint32_t nodeId) {
+			auto& node = this->node(nodeId - 1);
+			node.IsOccupied = false;
+			node.NextFreeNodeId = m_freeNodeId;
+			m_freeNodeId = nodeId;
+		}
+
+		void destroyNode(uint32_t nodeId) {
+			node(nodeId - 1).value().~value_type();
+			freeNode(nodeId);
+		}
+
+		void destroyAll() {
+			for (auto i = 0u; i < m_numNodes; ++i) {
+				auto& node = this->node(i);
+				if (node.IsOccupied) {
+					node.value().~value_type();
+					node.IsOccupied = false;
+				}
+			}
+		}
+
+	private:
+		std::vector<Slot> m_slots;
+		std::vector<std::unique_ptr<Node[]>> m_chunks;
+		size_t m_numNodes;
+		uint32_t m_freeNodeId;
+		size_t m_size;
+	};
+}}
+
+namespace catapult { namespace utils { namespace traits {
+
+	template<typename... TArgs>
+	struct is_map<FlatHashMap<TArgs...>> : std::true_type {};
+
+	template<typename... TArgs>
+	struct is_map<const FlatHashMap<TArgs...>> : std::true_type {};
+}}}
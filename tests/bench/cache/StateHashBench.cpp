@@ -0,0 +1,145 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache/CatapultCacheBuilder.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/cache_core/AccountStateCacheStorage.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <filesystem>
+
+namespace catapult { namespace cache {
+
+	namespace {
+		constexpr auto Num_Sub_Caches = 8u;
+		constexpr auto Num_Accounts_Per_Block = 200u;
+
+		// account state cache with a custom id so that multiple independent patricia tree caches can be registered
+		template<size_t CacheId>
+		class BenchAccountStateCache : public AccountStateCache {
+		public:
+			static constexpr size_t Id = CacheId;
+
+		public:
+			using AccountStateCache::AccountStateCache;
+		};
+
+		class DatabaseDirectoryGuard {
+		public:
+			DatabaseDirectoryGuard()
+					: m_directory(std::filesystem::temp_directory_path() / ("bench.cache." + std::to_string(bench::Random())))
+			{}
+
+			~DatabaseDirectoryGuard() {
+				std::filesystem::remove_all(m_directory);
+			}
+
+		public:
+			std::string subDirectory(size_t id) const {
+				return (m_directory / std::to_string(id)).generic_string();
+			}
+
+		private:
+			std::filesystem::path m_directory;
+		};
+
+		template<size_t CacheId>
+		void AddAccountStateCache(CatapultCacheBuilder& builder, const DatabaseDirectoryGuard& directoryGuard) {
+			auto cacheConfig = CacheConfiguration(directoryGuard.subDirectory(CacheId), PatriciaTreeStorageMode::Enabled);
+			auto options = AccountStateCacheTypes::Options{
+				model::NetworkIdentifier::Private_Test,
+				333,
+				222,
+				Amount(),
+				Amount(std::numeric_limits<Amount::ValueType>::max()),
+				Amount(),
+				MosaicId(1111),
+				MosaicId(2222)
+			};
+			builder.add<AccountStateCacheStorage>(std::make_unique<BenchAccountStateCache<CacheId>>(cacheConfig, options));
+		}
+
+		template<size_t... CacheIds>
+		CatapultCache CreateCatapultCache(const DatabaseDirectoryGuard& directoryGuard, std::index_sequence<CacheIds...>) {
+			CatapultCacheBuilder builder;
+			(AddAccountStateCache<CacheIds>(builder, directoryGuard), ...);
+			return builder.build();
+		}
+
+		template<size_t CacheId>
+		void AddRandomAccounts(CatapultCacheDelta& cacheDelta, Height height) {
+			auto& accountStateCacheDelta = cacheDelta.sub<BenchAccountStateCache<CacheId>>();
+			for (auto i = 0u; i < Num_Accounts_Per_Block; ++i) {
+				Address address;
+				bench::FillWithRandomData(address);
+				accountStateCacheDelta.addAccount(address, height);
+			}
+		}
+
+		template<size_t... CacheIds>
+		void AddRandomAccounts(CatapultCacheDelta& cacheDelta, Height height, std::index_sequence<CacheIds...>) {
+			(AddRandomAccounts<CacheIds>(cacheDelta, height), ...);
+		}
+
+		// range(0) is the number of pool threads, zero indicates that state hashes are calculated serially
+		void BenchmarkCommitBlock(benchmark::State& state) {
+			using CacheIds = std::make_index_sequence<Num_Sub_Caches>;
+
+			DatabaseDirectoryGuard directoryGuard;
+			auto cache = CreateCatapultCache(directoryGuard, CacheIds());
+
+			auto numThreads = static_cast<size_t>(state.range(0));
+			auto pPool = thread::CreateIoThreadPool(std::max<size_t>(1, numThreads), "state hash");
+			pPool->start();
+
+			Height height(1);
+			for (auto _ : state) {
+				state.PauseTiming();
+				auto cacheDelta = cache.createDelta();
+				AddRandomAccounts(cacheDelta, height, CacheIds());
+				state.ResumeTiming();
+
+				auto stateHashInfo = 0 == numThreads
+						? cacheDelta.calculateStateHash(height)
+						: cacheDelta.calculateStateHash(height, *pPool);
+				cache.commit(height);
+				benchmark::DoNotOptimize(stateHashInfo.StateHash);
+
+				height = height + Height(1);
+			}
+
+			pPool->join();
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+		}
+	}
+}}
+
+void RegisterTests() {
+	benchmark::RegisterBenchmark("BenchmarkCommitBlock", catapult::cache::BenchmarkCommitBlock)
+			->UseRealTime()
+			->Unit(benchmark::kMillisecond)
+			->Arg(0)
+			->Arg(1)
+			->Arg(2)
+			->Arg(4)
+			->Arg(8);
+}
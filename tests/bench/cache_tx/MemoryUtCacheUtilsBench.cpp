@@ -0,0 +1,113 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_tx/MemoryUtCache.h"
+#include "catapult/cache_tx/MemoryUtCacheUtils.h"
+#include "catapult/model/FeeUtils.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <cstring>
+
+namespace catapult { namespace cache {
+
+	namespace {
+		constexpr uint32_t Max_Transactions_Per_Block = 6'000;
+
+		uint32_t CountAsOne(const model::Transaction&) {
+			return 1;
+		}
+
+		bool SelectAll(const model::TransactionInfo&) {
+			return true;
+		}
+
+		bool CompareMaxFeeMultiplierDescending(const model::TransactionInfo* pLhs, const model::TransactionInfo* pRhs) {
+			auto lhsMaxFeeMultiplier = model::CalculateTransactionMaxFeeMultiplier(*pLhs->pEntity);
+			auto rhsMaxFeeMultiplier = model::CalculateTransactionMaxFeeMultiplier(*pRhs->pEntity);
+			return lhsMaxFeeMultiplier > rhsMaxFeeMultiplier;
+		}
+
+		std::unique_ptr<MemoryUtCache> CreateSeededMemoryUtCache(size_t count) {
+			auto pUtCache = std::make_unique<MemoryUtCache>(MemoryCacheOptions(1'000'000, count));
+			auto modifier = pUtCache->modifier();
+			for (auto i = 0u; i < count; ++i) {
+				auto pTransaction = std::make_shared<model::Transaction>();
+				std::memset(static_cast<void*>(pTransaction.get()), 0, sizeof(model::Transaction));
+				pTransaction->Size = sizeof(model::Transaction);
+				pTransaction->MaxFee = Amount(pTransaction->Size * (bench::Random() % 1000));
+				bench::FillWithRandomData(pTransaction->SignerPublicKey);
+
+				Hash256 hash;
+				bench::FillWithRandomData(hash);
+				modifier.add(model::TransactionInfo(pTransaction, hash));
+			}
+
+			return pUtCache;
+		}
+
+		// range(0) is the number of unconfirmed transactions
+		void BenchmarkSelectBySorting(benchmark::State& state) {
+			auto pUtCache = CreateSeededMemoryUtCache(static_cast<size_t>(state.range(0)));
+			auto utCacheView = pUtCache->view();
+
+			for (auto _ : state) {
+				auto transactionInfos = GetFirstTransactionInfoPointers(
+						utCacheView,
+						Max_Transactions_Per_Block,
+						CountAsOne,
+						CompareMaxFeeMultiplierDescending,
+						SelectAll);
+				benchmark::DoNotOptimize(transactionInfos.data());
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+		}
+
+		// range(0) is the number of unconfirmed transactions
+		void BenchmarkSelectByFeeIndex(benchmark::State& state) {
+			auto pUtCache = CreateSeededMemoryUtCache(static_cast<size_t>(state.range(0)));
+			auto utCacheView = pUtCache->view();
+
+			for (auto _ : state) {
+				auto transactionInfos = GetFirstTransactionInfoPointers(
+						utCacheView,
+						Max_Transactions_Per_Block,
+						CountAsOne,
+						FeeMultiplierOrder::Descending,
+						SelectAll);
+				benchmark::DoNotOptimize(transactionInfos.data());
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+		}
+	}
+}}
+
+void RegisterTests() {
+	for (auto* pBenchmark : {
+		benchmark::RegisterBenchmark("BenchmarkSelectBySorting", catapult::cache::BenchmarkSelectBySorting),
+		benchmark::RegisterBenchmark("BenchmarkSelectByFeeIndex", catapult::cache::BenchmarkSelectByFeeIndex)
+	}) {
+		pBenchmark->Unit(benchmark::kMillisecond);
+		for (auto numTransactions : { 10'000, 100'000, 1'000'000 })
+			pBenchmark->Arg(numTransactions);
+	}
+}
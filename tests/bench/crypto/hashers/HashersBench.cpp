@@ -20,6 +20,7 @@
 **/
 
 #include "catapult/crypto/Hashes.h"
+#include "catapult/crypto/MultiBufferHashes.h"
 #include "tests/bench/nodeps/Random.h"
 #include <benchmark/benchmark.h>
 
@@ -74,6 +75,68 @@ namespace catapult { namespace crypto {
 			for (auto arg : { 256, 1024, 4096, 16384})
 				benchmark.UseRealTime()->Arg(arg);
 		}
+
+		// region multi-buffer
+
+		constexpr size_t Num_Multi_Buffer_Messages = 1024;
+
+		std::vector<std::vector<uint8_t>> CreateRandomMessages(benchmark::State& state) {
+			std::vector<std::vector<uint8_t>> messages(Num_Multi_Buffer_Messages);
+			for (auto& message : messages) {
+				message.resize(static_cast<size_t>(state.range(0)));
+				bench::FillWithRandomData(message);
+			}
+
+			return messages;
+		}
+
+		void SetMultiBufferCounters(benchmark::State& state) {
+			auto numMessages = static_cast<int64_t>(Num_Multi_Buffer_Messages) * state.iterations();
+			state.SetBytesProcessed(numMessages * state.range(0));
+			state.SetItemsProcessed(numMessages);
+		}
+
+		void BenchmarkSha3_256_Single(benchmark::State& state) {
+			auto messages = CreateRandomMessages(state);
+			std::vector<Hash256> hashes(messages.size());
+			for (auto _ : state) {
+				for (auto i = 0u; i < messages.size(); ++i)
+					Sha3_256(messages[i], hashes[i]);
+
+				benchmark::DoNotOptimize(hashes.data());
+			}
+
+			SetMultiBufferCounters(state);
+		}
+
+		template<MultiBufferSha3Implementation Implementation>
+		void BenchmarkSha3_256_Multi(benchmark::State& state) {
+			if (!IsSupported(Implementation)) {
+				state.SkipWithError("implementation is not supported by cpu");
+				return;
+			}
+
+			auto messages = CreateRandomMessages(state);
+			std::vector<MultiBufferHashInput> inputs;
+			for (const auto& message : messages)
+				inputs.push_back({ { RawBuffer(message) }, 1 });
+
+			std::vector<Hash256> hashes(messages.size());
+			for (auto _ : state) {
+				Sha3_256_Multi(Implementation, inputs.data(), hashes.data(), inputs.size());
+				benchmark::DoNotOptimize(hashes.data());
+			}
+
+			SetMultiBufferCounters(state);
+		}
+
+		void AddMultiBufferArguments(benchmark::internal::Benchmark& benchmark) {
+			// small messages are typical for transactions and merkle nodes
+			for (auto arg : { 64, 256, 1024 })
+				benchmark.UseRealTime()->Arg(arg);
+		}
+
+		// endregion
 	}
 }}
 
@@ -89,4 +152,13 @@ void RegisterTests() {
 	CATAPULT_REGISTER_HASHER_BENCHMARK(Sha256Double_Traits);
 	CATAPULT_REGISTER_HASHER_BENCHMARK(Sha512_Traits);
 	CATAPULT_REGISTER_HASHER_BENCHMARK(Sha3_256_Traits);
+
+	using catapult::crypto::MultiBufferSha3Implementation;
+	catapult::crypto::AddMultiBufferArguments(*REGISTER_BENCHMARK(catapult::crypto::BenchmarkSha3_256_Single));
+	catapult::crypto::AddMultiBufferArguments(*REGISTER_BENCHMARK(
+			catapult::crypto::BenchmarkSha3_256_Multi<MultiBufferSha3Implementation::Scalar>));
+	catapult::crypto::AddMultiBufferArguments(*REGISTER_BENCHMARK(
+			catapult::crypto::BenchmarkSha3_256_Multi<MultiBufferSha3Implementation::Avx2>));
+	catapult::crypto::AddMultiBufferArguments(*REGISTER_BENCHMARK(
+			catapult::crypto::BenchmarkSha3_256_Multi<MultiBufferSha3Implementation::Avx512>));
 }
@@ -19,6 +19,7 @@
 *** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
 **/
 
+#include "catapult/crypto/PublicKeyCache.h"
 #include "catapult/crypto/Signer.h"
 #include "catapult/utils/Logging.h"
 #include "catapult/utils/RandomGenerator.h"
@@ -90,6 +91,99 @@ namespace catapult { namespace crypto {
 			if (0 != numFailures)
 				CATAPULT_LOG(warning) << numFailures << " calls to VerifyMulti failed";
 		}
+
+		// region skewed key distribution
+
+		// most signatures are created by a small number of hot signers (e.g. exchanges)
+		constexpr auto Num_Skewed_Signatures = 1000u;
+		constexpr auto Num_Hot_Signers = 16u;
+		constexpr auto Hot_Signer_Percentage = 90u;
+
+		struct SignedPayload {
+			Key PublicKey;
+			std::vector<uint8_t> Data;
+			catapult::Signature Signature;
+		};
+
+		std::vector<SignedPayload> CreateSkewedSignedPayloads() {
+			std::vector<KeyPair> hotKeyPairs;
+			for (auto i = 0u; i < Num_Hot_Signers; ++i)
+				hotKeyPairs.push_back(CreateRandomKeyPair());
+
+			std::vector<SignedPayload> payloads(Num_Skewed_Signatures);
+			for (auto& payload : payloads) {
+				auto isHot = bench::Random() % 100 < Hot_Signer_Percentage;
+				auto coldKeyPair = CreateRandomKeyPair();
+				const auto& keyPair = isHot ? hotKeyPairs[bench::Random() % Num_Hot_Signers] : coldKeyPair;
+
+				payload.PublicKey = keyPair.publicKey();
+				payload.Data.resize(Data_Size);
+				bench::FillWithRandomData(payload.Data);
+				crypto::Sign(keyPair, payload.Data, payload.Signature);
+			}
+
+			return payloads;
+		}
+
+		void SetPublicKeyCacheMaxSize(const benchmark::State& state) {
+			// state.range(0) is the public key cache size in kilobytes
+			// (all threads finish setup before any thread starts timing, so concurrent calls are harmless)
+			crypto::SetPublicKeyCacheMaxSize(utils::FileSize::FromKilobytes(static_cast<uint64_t>(state.range(0))));
+			crypto::ClearPublicKeyCache();
+		}
+
+		void LogPublicKeyCacheStatistics(benchmark::State& state) {
+			auto statistics = crypto::GetPublicKeyCacheStatistics();
+			auto numLookups = statistics.NumHits + statistics.NumMisses;
+			auto hitRate = 0 == numLookups ? 0 : static_cast<double>(statistics.NumHits) / static_cast<double>(numLookups);
+			state.counters["hit_rate"] = benchmark::Counter(hitRate, benchmark::Counter::kAvgThreads);
+		}
+
+		void BenchmarkVerifySkewed(benchmark::State& state) {
+			auto payloads = CreateSkewedSignedPayloads();
+			SetPublicKeyCacheMaxSize(state);
+
+			auto numFailures = 0u;
+			auto index = static_cast<size_t>(bench::Random());
+			for (auto _ : state) {
+				const auto& payload = payloads[index++ % payloads.size()];
+				if (!crypto::Verify(payload.PublicKey, payload.Data, payload.Signature))
+					++numFailures;
+			}
+
+			state.SetBytesProcessed(static_cast<int64_t>(Data_Size * state.iterations()));
+			LogPublicKeyCacheStatistics(state);
+
+			if (0 != numFailures)
+				CATAPULT_LOG(warning) << numFailures << " calls to Verify failed";
+		}
+
+		void BenchmarkVerifyMultiSkewed(benchmark::State& state) {
+			constexpr auto Batch_Size = 100u;
+			auto payloads = CreateSkewedSignedPayloads();
+			std::vector<SignatureInput> signatureInputs;
+			for (const auto& payload : payloads)
+				signatureInputs.push_back(SignatureInput({ payload.PublicKey, { payload.Data }, payload.Signature }));
+
+			SetPublicKeyCacheMaxSize(state);
+
+			auto numFailures = 0u;
+			auto offset = static_cast<size_t>(bench::Random() % (Num_Skewed_Signatures / Batch_Size)) * Batch_Size;
+			for (auto _ : state) {
+				if (!crypto::VerifyMulti(CreateRandomFiller(), signatureInputs.data() + offset, Batch_Size).second)
+					++numFailures;
+
+				offset = (offset + Batch_Size) % Num_Skewed_Signatures;
+			}
+
+			state.SetBytesProcessed(static_cast<int64_t>(Data_Size * Batch_Size * state.iterations()));
+			LogPublicKeyCacheStatistics(state);
+
+			if (0 != numFailures)
+				CATAPULT_LOG(warning) << numFailures << " calls to VerifyMulti failed";
+		}
+
+		// endregion
 	}
 }}
 
@@ -108,4 +202,19 @@ void RegisterTests() {
 			->Threads(2)
 			->Threads(4)
 			->Threads(8);
+
+	// compare disabled public key cache (0KB) with default sized public key cache (4MB)
+	benchmark::RegisterBenchmark("BenchmarkVerifySkewed", catapult::crypto::BenchmarkVerifySkewed)
+			->UseRealTime()
+			->Arg(0)
+			->Arg(4 * 1024)
+			->Threads(1)
+			->Threads(4);
+
+	benchmark::RegisterBenchmark("BenchmarkVerifyMultiSkewed", catapult::crypto::BenchmarkVerifyMultiSkewed)
+			->UseRealTime()
+			->Arg(0)
+			->Arg(4 * 1024)
+			->Threads(1)
+			->Threads(4);
 }
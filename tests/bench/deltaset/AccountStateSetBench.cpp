@@ -0,0 +1,184 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/deltaset/BaseSet.h"
+#include "catapult/deltaset/BaseSetDelta.h"
+#include "catapult/state/AccountState.h"
+#include "catapult/utils/FlatHashMap.h"
+#include "catapult/utils/Hashers.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <unordered_map>
+#include <utility>
+
+namespace {
+	// count all (non-aligned) heap allocations so that benchmarks can report allocations per block
+	std::atomic<uint64_t> g_numHeapAllocations(0);
+}
+
+void* operator new(size_t size) {
+	++g_numHeapAllocations;
+	if (auto* pData = std::malloc(size ? size : 1))
+		return pData;
+
+	throw std::bad_alloc();
+}
+
+void operator delete(void* pData) noexcept {
+	std::free(pData);
+}
+
+void operator delete(void* pData, size_t) noexcept {
+	std::free(pData);
+}
+
+namespace catapult { namespace deltaset {
+
+	namespace {
+		constexpr auto Num_Accounts_Per_Block = 1000u;
+
+		struct AccountStateToKeyConverter {
+			static const Address& ToKey(const state::AccountState& accountState) {
+				return accountState.Address;
+			}
+		};
+
+		// account state sets that only differ in their memory map type
+		template<typename TMap>
+		using AccountStateSet = BaseSet<MutableTypeTraits<state::AccountState>, MapStorageTraits<TMap, AccountStateToKeyConverter>>;
+
+		using UnorderedAccountStateSet = AccountStateSet<std::unordered_map<Address, state::AccountState, utils::ArrayHasher<Address>>>;
+		using FlatAccountStateSet = AccountStateSet<utils::FlatHashMap<Address, state::AccountState, utils::ArrayHasher<Address>>>;
+
+		Address GenerateRandomAddress() {
+			Address address;
+			bench::FillWithRandomData(address);
+			return address;
+		}
+
+		std::vector<Address> GenerateRandomAddresses(size_t count) {
+			std::vector<Address> addresses;
+			addresses.reserve(count);
+			for (auto i = 0u; i < count; ++i)
+				addresses.push_back(GenerateRandomAddress());
+
+			return addresses;
+		}
+
+		template<typename TSet>
+		auto CreateSeededDelta(TSet& set, const std::vector<Address>& addresses) {
+			auto pDelta = set.rebase();
+			for (const auto& address : addresses)
+				pDelta->emplace(address, Height(1));
+
+			set.commit();
+			return pDelta;
+		}
+
+		// range(0) is the number of accounts in the committed set
+		template<typename TSet>
+		void BenchmarkFind(benchmark::State& state) {
+			auto addresses = GenerateRandomAddresses(static_cast<size_t>(state.range(0)));
+			TSet set;
+			auto pDelta = CreateSeededDelta(set, addresses);
+			const auto& delta = *pDelta;
+
+			auto index = 0u;
+			for (auto _ : state) {
+				const auto& address = addresses[index];
+				benchmark::DoNotOptimize(delta.find(address).get());
+				index = (index + 7919) % static_cast<uint32_t>(addresses.size());
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+		}
+
+		// range(0) is the number of accounts in the committed set
+		template<typename TSet>
+		void BenchmarkInsert(benchmark::State& state) {
+			TSet set;
+			auto pDelta = CreateSeededDelta(set, GenerateRandomAddresses(static_cast<size_t>(state.range(0))));
+
+			uint64_t numHeapAllocations = 0;
+			for (auto _ : state) {
+				state.PauseTiming();
+				auto addresses = GenerateRandomAddresses(Num_Accounts_Per_Block);
+				pDelta->reset();
+				auto numStartHeapAllocations = g_numHeapAllocations.load();
+				state.ResumeTiming();
+
+				for (const auto& address : addresses)
+					pDelta->emplace(address, Height(2));
+
+				numHeapAllocations += g_numHeapAllocations.load() - numStartHeapAllocations;
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * Num_Accounts_Per_Block));
+			state.counters["allocs/block"] = static_cast<double>(numHeapAllocations) / static_cast<double>(state.iterations());
+		}
+
+		// range(0) is the number of accounts in the committed set
+		template<typename TSet>
+		void BenchmarkCommit(benchmark::State& state) {
+			auto addresses = GenerateRandomAddresses(static_cast<size_t>(state.range(0)));
+			TSet set;
+			auto pDelta = CreateSeededDelta(set, addresses);
+
+			auto index = 0u;
+			for (auto _ : state) {
+				state.PauseTiming();
+
+				// add new accounts and modify existing accounts like a typical block
+				for (auto i = 0u; i < Num_Accounts_Per_Block; ++i) {
+					pDelta->emplace(GenerateRandomAddress(), Height(2));
+
+					pDelta->find(addresses[index]).get()->Balances.credit(MosaicId(1), Amount(1));
+					index = (index + 7919) % static_cast<uint32_t>(addresses.size());
+				}
+
+				state.ResumeTiming();
+
+				set.commit();
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * Num_Accounts_Per_Block * 2));
+		}
+	}
+}}
+
+#define REGISTER_BENCHMARK(NAME, SET_TYPE) \
+	benchmark::RegisterBenchmark(#NAME "<" #SET_TYPE ">", catapult::deltaset::NAME<catapult::deltaset::SET_TYPE>) \
+			->UseRealTime() \
+			->Unit(benchmark::kMicrosecond) \
+			->RangeMultiplier(8) \
+			->Range(1 << 14, 1 << 20);
+
+void RegisterTests() {
+	REGISTER_BENCHMARK(BenchmarkFind, UnorderedAccountStateSet)
+	REGISTER_BENCHMARK(BenchmarkFind, FlatAccountStateSet)
+	REGISTER_BENCHMARK(BenchmarkInsert, UnorderedAccountStateSet)
+	REGISTER_BENCHMARK(BenchmarkInsert, FlatAccountStateSet)
+	REGISTER_BENCHMARK(BenchmarkCommit, UnorderedAccountStateSet)
+	REGISTER_BENCHMARK(BenchmarkCommit, FlatAccountStateSet)
+}
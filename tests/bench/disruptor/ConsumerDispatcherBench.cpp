@@ -0,0 +1,123 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/disruptor/ConsumerDispatcher.h"
+#include "catapult/model/Block.h"
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <thread>
+
+namespace catapult { namespace disruptor {
+
+	namespace {
+		model::BlockRange CreateBlockRange() {
+			std::vector<uint8_t> buffer(sizeof(model::BlockHeader));
+			reinterpret_cast<model::BlockHeader&>(buffer[0]).Size = static_cast<uint32_t>(buffer.size());
+			return model::BlockRange::CopyVariable(buffer.data(), buffer.size(), { 0 });
+		}
+
+		// range(0) is the wait strategy, range(1) is the number of consumer stages
+		void BenchmarkElementLatency(benchmark::State& state) {
+			auto options = ConsumerDispatcherOptions("bench dispatcher", 1024);
+			options.ElementTraceInterval = 0;
+			options.WaitStrategy = static_cast<ConsumerWaitStrategy>(state.range(0));
+
+			auto numStages = static_cast<size_t>(state.range(1));
+			std::vector<DisruptorConsumer> consumers(numStages, [](const auto&) { return ConsumerResult::Continue(); });
+			ConsumerDispatcher dispatcher(options, consumers);
+
+			for (auto _ : state) {
+				// measure the time from adding an element until it is completed by the last stage
+				std::atomic_bool isComplete(false);
+				auto start = std::chrono::high_resolution_clock::now();
+				dispatcher.processElement(ConsumerInput(CreateBlockRange()), [&isComplete](auto, const auto&) {
+					isComplete = true;
+				});
+
+				while (!isComplete)
+					std::this_thread::yield();
+
+				auto elapsed = std::chrono::high_resolution_clock::now() - start;
+				state.SetIterationTime(std::chrono::duration_cast<std::chrono::duration<double>>(elapsed).count());
+			}
+
+			dispatcher.shutdown();
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+		}
+
+		// range(0) is the number of producer threads
+		void BenchmarkProducerThroughput(benchmark::State& state) {
+			constexpr auto Num_Elements_Per_Iteration = 16u * 1024;
+
+			auto options = ConsumerDispatcherOptions("bench dispatcher", 4u * 1024);
+			options.ElementTraceInterval = 0;
+			options.ShouldThrowWhenFull = false;
+
+			ConsumerDispatcher dispatcher(options, { [](const auto&) { return ConsumerResult::Continue(); } });
+
+			auto numProducers = static_cast<size_t>(state.range(0));
+			auto numElementsPerProducer = Num_Elements_Per_Iteration / numProducers;
+			for (auto _ : state) {
+				std::vector<std::thread> threads;
+				for (auto i = 0u; i < numProducers; ++i) {
+					threads.emplace_back([&dispatcher, numElementsPerProducer]() {
+						for (auto j = 0u; j < numElementsPerProducer; ++j) {
+							// retry when the disruptor is full
+							while (0 == dispatcher.processElement(ConsumerInput(CreateBlockRange())))
+								std::this_thread::yield();
+						}
+					});
+				}
+
+				for (auto& thread : threads)
+					thread.join();
+
+				while (0 != dispatcher.numActiveElements())
+					std::this_thread::yield();
+			}
+
+			dispatcher.shutdown();
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numElementsPerProducer * numProducers));
+		}
+	}
+}}
+
+void RegisterTests() {
+	using catapult::disruptor::ConsumerWaitStrategy;
+
+	auto* pBenchmark = benchmark::RegisterBenchmark("BenchmarkElementLatency", catapult::disruptor::BenchmarkElementLatency)
+			->UseManualTime()
+			->Unit(benchmark::kMicrosecond);
+
+	for (auto waitStrategy : { ConsumerWaitStrategy::Busy_Spin, ConsumerWaitStrategy::Spin_Yield_Park, ConsumerWaitStrategy::Timed_Backoff }) {
+		for (auto numStages : { 1, 4, 8 })
+			pBenchmark->Args({ static_cast<int64_t>(waitStrategy), numStages });
+	}
+
+	benchmark::RegisterBenchmark("BenchmarkProducerThroughput", catapult::disruptor::BenchmarkProducerThroughput)
+			->UseRealTime()
+			->Unit(benchmark::kMillisecond)
+			->Arg(1)
+			->Arg(2)
+			->Arg(4)
+			->Arg(8)
+			->Arg(16);
+}
@@ -0,0 +1,103 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "src/importance/ImportanceCalculator.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/model/BlockChainConfiguration.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+
+namespace catapult { namespace importance {
+
+	namespace {
+		constexpr auto Harvesting_Mosaic_Id = MosaicId(2222);
+		constexpr auto Min_Harvester_Balance = Amount(1'000'000);
+
+		model::BlockChainConfiguration CreateConfiguration() {
+			auto config = model::BlockChainConfiguration::Uninitialized();
+			config.HarvestingMosaicId = Harvesting_Mosaic_Id;
+			config.ImportanceGrouping = 1;
+			config.TotalChainImportance = Importance(8'999'999'998'000'000);
+			config.ImportanceActivityPercentage = 5;
+			config.MinHarvesterBalance = Min_Harvester_Balance;
+			return config;
+		}
+
+		cache::AccountStateCacheTypes::Options CreateOptions(const model::BlockChainConfiguration& config) {
+			return {
+				model::NetworkIdentifier::Private_Test,
+				config.ImportanceGrouping,
+				1,
+				config.MinHarvesterBalance,
+				Amount(std::numeric_limits<Amount::ValueType>::max()),
+				Amount(std::numeric_limits<Amount::ValueType>::max()),
+				MosaicId(1111),
+				config.HarvestingMosaicId
+			};
+		}
+
+		void AddRandomHighValueAccounts(cache::AccountStateCacheDelta& delta, size_t numAccounts) {
+			for (auto i = 0u; i < numAccounts; ++i) {
+				Address address;
+				bench::FillWithRandomData(address);
+				delta.addAccount(address, Height(1));
+
+				auto& accountState = delta.find(address).get();
+				accountState.Balances.credit(Harvesting_Mosaic_Id, Min_Harvester_Balance + Amount(bench::Random() % 1'000'000'000));
+				accountState.ActivityBuckets.update(model::ImportanceHeight(1), [](auto& bucket) {
+					bucket.TotalFeesPaid = Amount(bench::Random() % 1'000);
+					bucket.BeneficiaryCount = static_cast<uint32_t>(bench::Random() % 10);
+				});
+			}
+
+			delta.updateHighValueAccounts(Height(1));
+		}
+
+		// range(0) is the number of high value accounts
+		void BenchmarkRecalculate(benchmark::State& state) {
+			auto numAccounts = static_cast<size_t>(state.range(0));
+			auto config = CreateConfiguration();
+			auto pCalculator = CreateImportanceCalculator(config);
+
+			cache::AccountStateCache cache(cache::CacheConfiguration(), CreateOptions(config));
+			auto delta = cache.createDelta();
+			AddRandomHighValueAccounts(*delta, numAccounts);
+
+			// importance snapshots must be set with ascending heights, so recalculate at a new importance height each iteration
+			model::ImportanceHeight importanceHeight(2);
+			for (auto _ : state) {
+				pCalculator->recalculate(ImportanceRollbackMode::Disabled, importanceHeight, *delta);
+				importanceHeight = importanceHeight + model::ImportanceHeight(1);
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numAccounts));
+		}
+	}
+}}
+
+void RegisterTests() {
+	benchmark::RegisterBenchmark("BenchmarkRecalculate", catapult::importance::BenchmarkRecalculate)
+			->UseRealTime()
+			->Unit(benchmark::kMillisecond)
+			->Arg(100'000)
+			->Arg(1'000'000)
+			->Arg(10'000'000);
+}
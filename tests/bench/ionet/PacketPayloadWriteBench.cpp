@@ -0,0 +1,200 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/ionet/PacketPayloadBuilder.h"
+#include "catapult/ionet/PacketPayloadWriteBuffers.h"
+#include "catapult/exceptions.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/ssl.hpp>
+#include <boost/asio/write.hpp>
+#include <openssl/x509.h>
+#include <thread>
+
+namespace catapult { namespace ionet {
+
+	namespace {
+		constexpr auto Num_Entities = 1'000u;
+		constexpr auto Write_Coalescing_Size = 16u * 1024;
+
+		using SslSocket = boost::asio::ssl::stream<boost::asio::ip::tcp::socket>;
+
+		// region SslLoopback
+
+		boost::asio::ssl::context CreateServerSslContext() {
+			std::array<uint8_t, 32> privateKeyBytes;
+			bench::FillWithRandomData(privateKeyBytes);
+
+			auto pKey = std::shared_ptr<EVP_PKEY>(
+					EVP_PKEY_new_raw_private_key(EVP_PKEY_ED25519, nullptr, privateKeyBytes.data(), privateKeyBytes.size()),
+					EVP_PKEY_free);
+			auto pCertificate = std::shared_ptr<X509>(X509_new(), X509_free);
+			if (!pKey || !pCertificate)
+				CATAPULT_THROW_RUNTIME_ERROR("failed to allocate key or certificate");
+
+			auto* pName = X509_get_subject_name(pCertificate.get());
+			const auto* pCommonName = reinterpret_cast<const uint8_t*>("bench");
+			if (!ASN1_INTEGER_set(X509_get_serialNumber(pCertificate.get()), 1)
+					|| !X509_gmtime_adj(X509_getm_notBefore(pCertificate.get()), 0)
+					|| !X509_gmtime_adj(X509_getm_notAfter(pCertificate.get()), 60 * 60)
+					|| !X509_NAME_add_entry_by_txt(pName, "CN", MBSTRING_ASC, pCommonName, -1, -1, 0)
+					|| !X509_set_issuer_name(pCertificate.get(), pName)
+					|| !X509_set_pubkey(pCertificate.get(), pKey.get())
+					|| !X509_sign(pCertificate.get(), pKey.get(), nullptr))
+				CATAPULT_THROW_RUNTIME_ERROR("failed to create self signed certificate");
+
+			boost::asio::ssl::context sslContext(boost::asio::ssl::context::tlsv13);
+			if (!SSL_CTX_use_certificate(sslContext.native_handle(), pCertificate.get())
+					|| !SSL_CTX_use_PrivateKey(sslContext.native_handle(), pKey.get()))
+				CATAPULT_THROW_RUNTIME_ERROR("failed to set ssl context certificate");
+
+			return sslContext;
+		}
+
+		/// Pair of connected loopback ssl sockets where all data written to the writer socket is drained by a background thread.
+		class SslLoopback {
+		public:
+			SslLoopback()
+					: m_serverContext(CreateServerSslContext())
+					, m_clientContext(boost::asio::ssl::context::tlsv13)
+					, m_serverSocket(m_ioContext, m_serverContext)
+					, m_clientSocket(m_ioContext, m_clientContext) {
+				auto loopbackEndpoint = boost::asio::ip::tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0);
+				boost::asio::ip::tcp::acceptor acceptor(m_ioContext, loopbackEndpoint);
+				std::thread serverThread([this, &acceptor]() {
+					acceptor.accept(m_serverSocket.lowest_layer());
+					m_serverSocket.handshake(boost::asio::ssl::stream_base::server);
+				});
+
+				m_clientSocket.lowest_layer().connect(acceptor.local_endpoint());
+				m_clientSocket.handshake(boost::asio::ssl::stream_base::client);
+				serverThread.join();
+
+				m_drainThread = std::thread([this]() { drain(); });
+			}
+
+			~SslLoopback() {
+				boost::system::error_code ignored;
+				m_serverSocket.lowest_layer().shutdown(boost::asio::ip::tcp::socket::shutdown_both, ignored);
+				m_drainThread.join();
+			}
+
+		public:
+			SslSocket& writer() {
+				return m_serverSocket;
+			}
+
+		private:
+			void drain() {
+				std::vector<uint8_t> buffer(64 * 1024);
+				boost::system::error_code ec;
+				while (!ec)
+					m_clientSocket.read_some(boost::asio::buffer(buffer), ec);
+			}
+
+		private:
+			boost::asio::io_context m_ioContext;
+			boost::asio::ssl::context m_serverContext;
+			boost::asio::ssl::context m_clientContext;
+			SslSocket m_serverSocket;
+			SslSocket m_clientSocket;
+			std::thread m_drainThread;
+		};
+
+		// endregion
+
+		// region benchmarks
+
+		PacketPayload CreatePayload(size_t entitySize) {
+			PacketPayloadBuilder builder(PacketType::Push_Transactions);
+			for (auto i = 0u; i < Num_Entities; ++i) {
+				std::vector<uint8_t> entity(entitySize);
+				bench::FillWithRandomData(entity);
+				builder.appendValues(entity);
+			}
+
+			return builder.build();
+		}
+
+		void WriteBufferSequence(SslSocket& socket, const PacketPayload& payload, size_t writeCoalescingSize) {
+			PacketPayloadWriteBuffers writeBuffers(payload, writeCoalescingSize);
+
+			std::vector<boost::asio::const_buffer> buffers;
+			buffers.reserve(writeBuffers.buffers().size());
+			for (const auto& rawBuffer : writeBuffers.buffers())
+				buffers.push_back(boost::asio::buffer(rawBuffer.pData, rawBuffer.Size));
+
+			boost::asio::write(socket, buffers);
+		}
+
+		// range(0) is the size of each entity in the payload
+		void BenchmarkWritePerBuffer(benchmark::State& state) {
+			SslLoopback loopback;
+			auto payload = CreatePayload(static_cast<size_t>(state.range(0)));
+
+			for (auto _ : state) {
+				// one write per buffer, each resulting in (at least) one tls record
+				boost::asio::write(loopback.writer(), boost::asio::buffer(&payload.header(), sizeof(PacketHeader)));
+				for (const auto& rawBuffer : payload.buffers())
+					boost::asio::write(loopback.writer(), boost::asio::buffer(rawBuffer.pData, rawBuffer.Size));
+			}
+
+			state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * payload.header().Size));
+		}
+
+		// range(0) is the size of each entity in the payload
+		void BenchmarkWriteBufferSequence(benchmark::State& state) {
+			SslLoopback loopback;
+			auto payload = CreatePayload(static_cast<size_t>(state.range(0)));
+
+			for (auto _ : state)
+				WriteBufferSequence(loopback.writer(), payload, 0);
+
+			state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * payload.header().Size));
+		}
+
+		// range(0) is the size of each entity in the payload
+		void BenchmarkWriteCoalescedBufferSequence(benchmark::State& state) {
+			SslLoopback loopback;
+			auto payload = CreatePayload(static_cast<size_t>(state.range(0)));
+
+			for (auto _ : state)
+				WriteBufferSequence(loopback.writer(), payload, Write_Coalescing_Size);
+
+			state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * payload.header().Size));
+		}
+
+		// endregion
+	}
+}}
+
+void RegisterTests() {
+	for (auto* pBenchmark : {
+		benchmark::RegisterBenchmark("BenchmarkWritePerBuffer", catapult::ionet::BenchmarkWritePerBuffer),
+		benchmark::RegisterBenchmark("BenchmarkWriteBufferSequence", catapult::ionet::BenchmarkWriteBufferSequence),
+		benchmark::RegisterBenchmark("BenchmarkWriteCoalescedBufferSequence", catapult::ionet::BenchmarkWriteCoalescedBufferSequence)
+	}) {
+		pBenchmark->Unit(benchmark::kMicrosecond)->UseRealTime();
+		for (auto entitySize : { 64, 256, 1024, 32 * 1024 })
+			pBenchmark->Arg(entitySize);
+	}
+}
@@ -0,0 +1,157 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/model/Address.h"
+#include "catapult/model/NotificationPublisher.h"
+#include "catapult/model/NotificationStream.h"
+#include "catapult/model/NotificationSubscriber.h"
+#include "catapult/model/Transaction.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <cstring>
+
+namespace catapult { namespace model {
+
+	namespace {
+		// publisher that mimics an aggregate transaction, which publishes a handful of notifications per embedded transaction
+		// and needs to derive the address of every embedded signer
+		class AggregateLikeNotificationPublisher : public NotificationPublisher {
+		public:
+			AggregateLikeNotificationPublisher(const std::vector<Key>& embeddedSigners, const UnresolvedAddressSet& participants)
+					: m_embeddedSigners(embeddedSigners)
+					, m_participants(participants)
+			{}
+
+		public:
+			void publish(const WeakEntityInfo& entityInfo, NotificationSubscriber& sub) const override {
+				const auto& entity = entityInfo.entity();
+				sub.notify(AccountPublicKeyNotification(entity.SignerPublicKey));
+				sub.notify(EntityNotification(entity.Network, entity.Version, 1, 1));
+
+				constexpr auto Relative = SourceChangeNotification::SourceChangeType::Relative;
+				for (const auto& embeddedSigner : m_embeddedSigners) {
+					auto signerAddress = PublicKeyToAddress(embeddedSigner, entity.Network);
+					sub.notify(SourceChangeNotification(Relative, 0, Relative, 1));
+					sub.notify(AccountPublicKeyNotification(embeddedSigner));
+					sub.notify(EntityNotification(entity.Network, entity.Version, 1, 1));
+					sub.notify(AddressInteractionNotification(signerAddress, entity.Type, m_participants));
+					sub.notify(BalanceTransferNotification(signerAddress, *m_participants.cbegin(), UnresolvedMosaicId(1), Amount(1)));
+				}
+			}
+
+		private:
+			const std::vector<Key>& m_embeddedSigners;
+			const UnresolvedAddressSet& m_participants;
+		};
+
+		class CountingNotificationSubscriber : public NotificationSubscriber {
+		public:
+			size_t count() const {
+				return m_count;
+			}
+
+		public:
+			void notify(const Notification&) override {
+				++m_count;
+			}
+
+		private:
+			size_t m_count = 0;
+		};
+
+		struct BenchContext {
+		public:
+			explicit BenchContext(size_t numEmbeddedTransactions)
+					: Hash()
+					, EmbeddedSigners(numEmbeddedTransactions) {
+				std::memset(static_cast<void*>(&Entity), 0, sizeof(Transaction));
+				Entity.Size = sizeof(Transaction);
+				Entity.Network = NetworkIdentifier::Private_Test;
+				bench::FillWithRandomData(Entity.SignerPublicKey);
+
+				for (auto& embeddedSigner : EmbeddedSigners)
+					bench::FillWithRandomData(embeddedSigner);
+
+				for (auto i = 0u; i < 3; ++i) {
+					UnresolvedAddress address;
+					bench::FillWithRandomData(address);
+					Participants.insert(address);
+				}
+			}
+
+		public:
+			Transaction Entity;
+			catapult::Hash256 Hash;
+			std::vector<Key> EmbeddedSigners;
+			UnresolvedAddressSet Participants;
+		};
+
+		// range(0) is the number of embedded transactions, range(1) is the number of pipeline stages consuming notifications
+		void BenchmarkPublishPerStage(benchmark::State& state) {
+			BenchContext context(static_cast<size_t>(state.range(0)));
+			AggregateLikeNotificationPublisher publisher(context.EmbeddedSigners, context.Participants);
+			auto entityInfo = WeakEntityInfo(context.Entity, context.Hash);
+
+			auto numStages = state.range(1);
+			for (auto _ : state) {
+				CountingNotificationSubscriber sub;
+				for (auto i = 0; i < numStages; ++i)
+					publisher.publish(entityInfo, sub);
+
+				benchmark::DoNotOptimize(sub.count());
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+		}
+
+		// range(0) is the number of embedded transactions, range(1) is the number of pipeline stages consuming notifications
+		void BenchmarkRecordOnceReplayPerStage(benchmark::State& state) {
+			BenchContext context(static_cast<size_t>(state.range(0)));
+			AggregateLikeNotificationPublisher publisher(context.EmbeddedSigners, context.Participants);
+			auto entityInfo = WeakEntityInfo(context.Entity, context.Hash);
+
+			auto numStages = state.range(1);
+			for (auto _ : state) {
+				CountingNotificationSubscriber sub;
+				auto pStream = RecordNotifications(publisher, entityInfo);
+				for (auto i = 0; i < numStages; ++i)
+					pStream->replay(sub);
+
+				benchmark::DoNotOptimize(sub.count());
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+		}
+	}
+}}
+
+void RegisterTests() {
+	for (auto* pBenchmark : {
+		benchmark::RegisterBenchmark("BenchmarkPublishPerStage", catapult::model::BenchmarkPublishPerStage),
+		benchmark::RegisterBenchmark("BenchmarkRecordOnceReplayPerStage", catapult::model::BenchmarkRecordOnceReplayPerStage)
+	}) {
+		pBenchmark->Unit(benchmark::kMicrosecond);
+		for (auto numEmbeddedTransactions : { 1, 10, 100 }) {
+			for (auto numStages : { 1, 3, 5 })
+				pBenchmark->Args({ numEmbeddedTransactions, numStages });
+		}
+	}
+}
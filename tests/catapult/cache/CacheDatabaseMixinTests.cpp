@@ -124,6 +124,31 @@ namespace catapult { namespace cache {
 		EXPECT_EQ(deltaset::ConditionalContainerMode::Storage, decltype(mixin)::GetContainerMode(config));
 	}
 
+	namespace {
+		void AssertPatriciaTreeGarbageCollectionPruning(PatriciaTreeStorageMode mode, bool expectedCanPrune) {
+			// Arrange:
+			test::TempDirectoryGuard dbDirGuard;
+			auto databaseConfig = config::NodeConfiguration::CacheDatabaseSubConfiguration();
+			databaseConfig.PatriciaTreeGarbageCollectionDelay = 10;
+			CacheConfiguration config(dbDirGuard.name(), databaseConfig, mode);
+
+			// Act:
+			ConcreteCacheDatabaseMixin mixin(config, { "default", "foo", "bar" });
+
+			// Assert:
+			EXPECT_EQ(expectedCanPrune, mixin.database().canPrune());
+		}
+	}
+
+	TEST(TEST_CLASS, CanInitializeDatabaseWithPatriciaTreeGarbageCollection) {
+		// Assert: garbage collection requires pruning
+		AssertPatriciaTreeGarbageCollectionPruning(PatriciaTreeStorageMode::Enabled, true);
+	}
+
+	TEST(TEST_CLASS, PatriciaTreeGarbageCollectionDoesNotEnablePruningWithoutPatriciaTreeSupport) {
+		AssertPatriciaTreeGarbageCollectionPruning(PatriciaTreeStorageMode::Disabled, false);
+	}
+
 	TEST(TEST_CLASS, CanFlushWhenCacheDatabaseIsDisabled) {
 		// Arrange:
 		CacheConfiguration config;
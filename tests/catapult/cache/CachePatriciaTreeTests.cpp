@@ -241,4 +241,131 @@ namespace catapult { namespace cache {
 	}
 
 	// endregion
+
+	// region enabled - garbage collection
+
+	namespace {
+		class GarbageCollectingCacheDatabaseHolder {
+		public:
+			explicit GarbageCollectingCacheDatabaseHolder(uint32_t garbageCollectionDelay)
+					: m_database(CacheDatabaseSettings(
+							m_dbDirGuard.name(),
+							CreateDatabaseConfiguration(garbageCollectionDelay),
+							{ "default", "patricia_tree" },
+							FilterPruningMode::Enabled))
+			{}
+
+		public:
+			CacheDatabase& database() {
+				return m_database;
+			}
+
+			bool contains(const Hash256& hash) {
+				RdbDataIterator iter;
+				m_database.get(1, HashToString(hash), iter);
+				return RdbDataIterator::End() != iter;
+			}
+
+		private:
+			static config::NodeConfiguration::CacheDatabaseSubConfiguration CreateDatabaseConfiguration(uint32_t garbageCollectionDelay) {
+				auto config = config::NodeConfiguration::CacheDatabaseSubConfiguration();
+				config.PatriciaTreeGarbageCollectionDelay = garbageCollectionDelay;
+				return config;
+			}
+
+		private:
+			test::TempDirectoryGuard m_dbDirGuard;
+			CacheDatabase m_database;
+		};
+
+		std::vector<Hash256> CommitValueChanges(CachePatriciaTree<DatabaseBasePatriciaTree>& tree, size_t numCommits) {
+			std::vector<Hash256> rootHashes;
+			for (auto i = 0u; i < numCommits; ++i) {
+				auto pDeltaTree = tree.rebase();
+				pDeltaTree->set(0x01'23'4A'99, "beta");
+				pDeltaTree->set(0x01'23'4A'B6, "alpha" + std::to_string(i));
+				tree.commit();
+				rootHashes.push_back(tree.get()->root());
+			}
+
+			return rootHashes;
+		}
+	}
+
+	TEST(TEST_CLASS, Enabled_CommitCollectsExpiredUnreachableNodesWhenGarbageCollectionIsEnabled) {
+		// Arrange:
+		GarbageCollectingCacheDatabaseHolder holder(1);
+		CachePatriciaTree<DatabaseBasePatriciaTree> tree(true, holder.database(), 1);
+
+		// Act: the second commit makes the first root unreachable, which is collected by the third commit
+		auto rootHashes = CommitValueChanges(tree, 3);
+
+		// Assert: only the first root was collected
+		EXPECT_FALSE(holder.contains(rootHashes[0]));
+		EXPECT_TRUE(holder.contains(rootHashes[1]));
+		EXPECT_TRUE(holder.contains(rootHashes[2]));
+	}
+
+	TEST(TEST_CLASS, Enabled_CommitRetainsUnreachableNodesWhenGarbageCollectionIsDisabled) {
+		// Arrange:
+		GarbageCollectingCacheDatabaseHolder holder(0);
+		CachePatriciaTree<DatabaseBasePatriciaTree> tree(true, holder.database(), 1);
+
+		// Act:
+		auto rootHashes = CommitValueChanges(tree, 3);
+
+		// Assert:
+		for (const auto& rootHash : rootHashes)
+			EXPECT_TRUE(holder.contains(rootHash)) << rootHash;
+	}
+
+	namespace {
+		template<typename TRecreateTree>
+		void AssertIdenticalLeafIsRetainedWhileLinkedAtOtherPosition(TRecreateTree recreateTree) {
+			// Arrange: seed two identical leaves (same suffix and value) below different branches
+			GarbageCollectingCacheDatabaseHolder holder(1);
+			auto pTree = std::make_unique<CachePatriciaTree<DatabaseBasePatriciaTree>>(true, holder.database(), 1);
+			{
+				auto pDeltaTree = pTree->rebase();
+				pDeltaTree->set(0x11'23'45'67, "same");
+				pDeltaTree->set(0x12'00'00'00, "alpha");
+				pDeltaTree->set(0x21'23'45'67, "same");
+				pDeltaTree->set(0x22'00'00'00, "beta");
+				pTree->commit();
+			}
+
+			auto sharedLinkCounts = pTree->get()->findSharedLinkCounts();
+			recreateTree(holder, pTree);
+
+			// Act: unlink the second leaf and force a collection
+			{
+				auto pDeltaTree = pTree->rebase();
+				pDeltaTree->unset(0x22'00'00'00);
+				pTree->commit();
+			}
+
+			auto rootHashes = CommitValueChanges(*pTree, 3);
+
+			// Assert: the leaf below the first (unchanged) branch was not collected
+			ASSERT_EQ(1u, sharedLinkCounts.size());
+			EXPECT_TRUE(holder.contains(sharedLinkCounts.cbegin()->first));
+			EXPECT_FALSE(holder.contains(rootHashes[0]));
+
+			std::vector<tree::TreeNode> nodePath;
+			EXPECT_TRUE(pTree->get()->lookup(0x11'23'45'67, nodePath).second);
+		}
+	}
+
+	TEST(TEST_CLASS, Enabled_CommitRetainsIdenticalLeafLinkedAtOtherPositionWhenGarbageCollectionIsEnabled) {
+		AssertIdenticalLeafIsRetainedWhileLinkedAtOtherPosition([](const auto&, const auto&) {});
+	}
+
+	TEST(TEST_CLASS, Enabled_CommitRetainsIdenticalLeafLinkedAtOtherPositionWhenGarbageCollectionIsEnabledAfterReload) {
+		AssertIdenticalLeafIsRetainedWhileLinkedAtOtherPosition([](auto& holder, auto& pTree) {
+			pTree.reset();
+			pTree = std::make_unique<CachePatriciaTree<DatabaseBasePatriciaTree>>(true, holder.database(), 1);
+		});
+	}
+
+	// endregion
 }}
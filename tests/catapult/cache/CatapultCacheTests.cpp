@@ -28,6 +28,7 @@
 #include "tests/test/cache/CacheBasicTests.h"
 #include "tests/test/cache/SimpleCache.h"
 #include "tests/test/core/StateTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/core/mocks/MockMemoryStream.h"
 #include "tests/TestHarness.h"
 
@@ -135,12 +136,20 @@ namespace catapult { namespace cache {
 				return view.calculateStateHash(Height(123));
 			}
 		};
+
+		struct ParallelDeltaTraits : public DeltaTraits {
+			static auto CalculateStateHash(const CatapultCacheDelta& view) {
+				auto pPool = test::CreateStartedIoThreadPool(2);
+				return view.calculateStateHash(Height(123), *pPool);
+			}
+		};
 	}
 
 #define VIEW_DELTA_TEST(TEST_NAME) \
 	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
 	TEST(TEST_CLASS, TEST_NAME##_View) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ViewTraits>(); } \
 	TEST(TEST_CLASS, TEST_NAME##_Delta) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<DeltaTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_DeltaParallel) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ParallelDeltaTraits>(); } \
 	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
 
 	VIEW_DELTA_TEST(StateHashIsZeroWhenStateCalculationIsDisabled) {
@@ -205,6 +214,31 @@ namespace catapult { namespace cache {
 		EXPECT_EQ(expectedSubCacheMerkleRoots, TTraits::CalculateStateHash(view).SubCacheMerkleRoots);
 	}
 
+	TEST(TEST_CLASS, ParallelStateHashIsDeterministicAndMatchesSerialStateHash) {
+		// Arrange: use more sub caches supporting merkle roots than pool threads
+		CatapultCacheBuilder builder;
+		AddSubCacheWithId<1>(builder, test::SimpleCacheViewMode::Merkle_Root);
+		AddSubCacheWithId<2>(builder);
+		AddSubCacheWithId<3>(builder, test::SimpleCacheViewMode::Merkle_Root);
+		AddSubCacheWithId<4>(builder, test::SimpleCacheViewMode::Merkle_Root);
+		AddSubCacheWithId<5>(builder, test::SimpleCacheViewMode::Merkle_Root);
+		AddSubCacheWithId<7>(builder, test::SimpleCacheViewMode::Merkle_Root);
+		auto cache = builder.build();
+		auto delta = cache.createDelta();
+		auto pPool = test::CreateStartedIoThreadPool(3);
+
+		auto expectedStateHashInfo = delta.calculateStateHash(Height(123));
+
+		for (auto i = 0u; i < 10; ++i) {
+			// Act:
+			auto stateHashInfo = delta.calculateStateHash(Height(123), *pPool);
+
+			// Assert:
+			EXPECT_EQ(expectedStateHashInfo.StateHash, stateHashInfo.StateHash) << "iteration " << i;
+			EXPECT_EQ(expectedStateHashInfo.SubCacheMerkleRoots, stateHashInfo.SubCacheMerkleRoots) << "iteration " << i;
+		}
+	}
+
 	namespace {
 		void AssertCannotSetWrongNumberOfSubCacheMerkleRoots(uint32_t numHashes) {
 			// Arrange:
@@ -247,6 +281,22 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region changedSubCacheIds
+
+	TEST(TEST_CLASS, CanGetChangedSubCacheIds) {
+		// Arrange: simple cache deltas always report added, modified and removed elements
+		auto cache = CreateSimpleCatapultCache();
+		auto delta = cache.createDelta();
+
+		// Act:
+		auto subCacheIds = delta.changedSubCacheIds();
+
+		// Assert: ids are ordered and empty sub cache slots are skipped
+		EXPECT_EQ(std::vector<size_t>({ 2, 4, 6 }), subCacheIds);
+	}
+
+	// endregion
+
 	// region prune
 
 	namespace {
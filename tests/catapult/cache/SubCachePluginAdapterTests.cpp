@@ -480,6 +480,28 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region hasChanges
+
+	TEST(TEST_CLASS, HasChangesReturnsTrueWhenDeltaHasElementChanges) {
+		// Arrange: simple cache delta always reports added, modified and removed elements
+		SimpleCachePluginAdapter adapter(CreateSimpleCacheWithValue(5));
+		auto pView = adapter.createDelta();
+
+		// Act + Assert:
+		EXPECT_TRUE(pView->hasChanges());
+	}
+
+	TEST(TEST_CLASS, HasChangesReturnsFalseWhenViewDoesNotTrackElementChanges) {
+		// Arrange:
+		SimpleCachePluginAdapter adapter(CreateSimpleCacheWithValue(5));
+		auto pView = adapter.createView();
+
+		// Act + Assert:
+		EXPECT_FALSE(pView->hasChanges());
+	}
+
+	// endregion
+
 	// region createDetachedDelta
 
 	TEST(TEST_CLASS, CanAccessDetachedDelta) {
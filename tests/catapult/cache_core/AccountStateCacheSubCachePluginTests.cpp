@@ -353,6 +353,144 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region summary load
+
+	namespace {
+		class SummaryLoadContext {
+		public:
+			SummaryLoadContext()
+					: m_plugin(
+							CacheConfiguration(m_dbDirGuard.name(), PatriciaTreeStorageMode::Disabled),
+							AccountStateCacheTypes::Options())
+					, m_stream(m_buffer)
+			{}
+
+		public:
+			io::OutputStream& output() {
+				return m_stream;
+			}
+
+			model::AddressSet highValueAddresses() {
+				return m_plugin.cache().createView()->highValueAccounts().addresses();
+			}
+
+			AddressAccountHistoryMap accountHistories() {
+				return m_plugin.cache().createView()->highValueAccounts().accountHistories();
+			}
+
+		public:
+			void writeAddresses(uint64_t count, const std::vector<Address>& addresses) {
+				io::Write64(m_stream, count);
+				for (const auto& address : addresses)
+					m_stream.write(address);
+			}
+
+			void writeBalanceHistory(const Address& address, const std::vector<std::pair<Height, Amount>>& balances) {
+				m_stream.write(address);
+
+				io::Write64(m_stream, balances.size());
+				for (const auto& pair : balances) {
+					io::Write(m_stream, pair.first);
+					io::Write(m_stream, pair.second);
+				}
+
+				// - write empty vrf and voting public key histories
+				io::Write64(m_stream, 0);
+				io::Write64(m_stream, 0);
+			}
+
+			void load() {
+				auto pStorage = m_plugin.createStorage();
+				m_stream.seek(0);
+				pStorage->loadAll(m_stream, 1);
+			}
+
+		private:
+			test::TempDirectoryGuard m_dbDirGuard;
+			AccountStateCacheSubCachePlugin m_plugin;
+			std::vector<uint8_t> m_buffer;
+			mocks::MockMemoryStream m_stream;
+		};
+	}
+
+	TEST(TEST_CLASS, Summary_CanLoadHighValueAddressesSpanningMultipleBulkReads) {
+		// Arrange: use more addresses than are allocated at once
+		SummaryLoadContext context;
+		auto addresses = test::GenerateRandomDataVector<Address>(64 * 1024 + 123);
+		context.writeAddresses(addresses.size(), addresses);
+		io::Write64(context.output(), 0);
+
+		// Act:
+		context.load();
+
+		// Assert:
+		EXPECT_EQ(model::AddressSet(addresses.cbegin(), addresses.cend()), context.highValueAddresses());
+		EXPECT_TRUE(context.accountHistories().empty());
+	}
+
+	TEST(TEST_CLASS, Summary_CannotLoadHighValueAddressesWithCountExceedingInput) {
+		// Arrange: count is much larger than the input, so it cannot be allocated up front
+		SummaryLoadContext context;
+		context.writeAddresses(uint64_t(1) << 58, test::GenerateRandomDataVector<Address>(3));
+
+		// Act + Assert: reading fails without allocating memory for all addresses
+		EXPECT_THROW(context.load(), catapult_file_io_error);
+		EXPECT_TRUE(context.highValueAddresses().empty());
+	}
+
+	TEST(TEST_CLASS, Summary_CannotLoadDuplicateHighValueAddresses) {
+		// Arrange:
+		SummaryLoadContext context;
+		auto addresses = test::GenerateRandomDataVector<Address>(3);
+		addresses.push_back(addresses[1]);
+		context.writeAddresses(addresses.size(), addresses);
+		io::Write64(context.output(), 0);
+
+		// Act + Assert:
+		EXPECT_THROW(context.load(), catapult_runtime_error);
+		EXPECT_TRUE(context.highValueAddresses().empty());
+	}
+
+	TEST(TEST_CLASS, Summary_CanLoadAccountHistoriesInPlace) {
+		// Arrange:
+		SummaryLoadContext context;
+		auto addresses = test::GenerateRandomDataVector<Address>(3);
+		context.writeAddresses(0, {});
+		io::Write64(context.output(), addresses.size());
+		context.writeBalanceHistory(addresses[0], { { Height(3), Amount(1'000'000) }, { Height(4), Amount(1'100'000) } });
+		context.writeBalanceHistory(addresses[1], { { Height(3), Amount(1'250'000) } });
+		context.writeBalanceHistory(addresses[2], { { Height(4), Amount(900'000) }, { Height(7), Amount(800'000) } });
+
+		// Act:
+		context.load();
+
+		// Assert:
+		auto expectedAccountHistories = test::GenerateAccountHistories({
+			{ addresses[0], { { Height(3), Amount(1'000'000) }, { Height(4), Amount(1'100'000) } } },
+			{ addresses[1], { { Height(3), Amount(1'250'000) } } },
+			{ addresses[2], { { Height(4), Amount(900'000) }, { Height(7), Amount(800'000) } } }
+		});
+		EXPECT_TRUE(context.highValueAddresses().empty());
+		test::AssertEqual(expectedAccountHistories, context.accountHistories());
+	}
+
+	TEST(TEST_CLASS, Summary_CannotLoadDuplicateAccountHistories) {
+		// Arrange:
+		SummaryLoadContext context;
+		auto addresses = test::GenerateRandomDataVector<Address>(2);
+		context.writeAddresses(0, {});
+		io::Write64(context.output(), 3);
+		context.writeBalanceHistory(addresses[0], { { Height(3), Amount(1'000'000) } });
+		context.writeBalanceHistory(addresses[1], { { Height(3), Amount(1'250'000) } });
+		context.writeBalanceHistory(addresses[0], { { Height(4), Amount(1'100'000) } });
+
+		// Act + Assert:
+		EXPECT_THROW(context.load(), catapult_runtime_error);
+		EXPECT_TRUE(context.accountHistories().empty());
+	}
+
+	// endregion
+
 	// region AccountStateCacheSubCachePlugin
 
 	namespace {
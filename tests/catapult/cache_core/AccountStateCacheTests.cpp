@@ -1474,6 +1474,45 @@ namespace catapult { namespace cache {
 
 		// Assert:
 		EXPECT_EQ(model::AddressSet({ addresses[0], addresses[2] }), delta->highValueAccounts().addresses());
+		EXPECT_EQ(2u, delta->highValueAccounts().accountIndex().size());
+	}
+
+	TEST(TEST_CLASS, HighValueAccountIndexIsPreservedAcrossCommit) {
+		// Arrange: set min balance to 1M
+		auto options = Default_Cache_Options;
+		options.MinHarvesterBalance = Amount(1'000'000);
+		AccountStateCache cache(CacheConfiguration(), options);
+
+		// - commit 2/3 accounts with sufficient balance
+		std::vector<Address> addresses;
+		{
+			auto delta = cache.createDelta();
+			addresses = AddAccountsWithBalances(*delta, { Amount(1'100'000), Amount(900'000), Amount(1'000'000) });
+			delta->updateHighValueAccounts(Height(1));
+			cache.commit();
+		}
+
+		// Act: increase the balance of one account in a new delta
+		auto delta = cache.createDelta();
+		delta->find(addresses[2]).get().Balances.credit(Harvesting_Mosaic_Id, Amount(500'000));
+		delta->updateHighValueAccounts(Height(2));
+
+		// Assert: the committed index is copied into the delta and updated there
+		const auto& deltaAccountIndex = delta->highValueAccounts().accountIndex();
+		ASSERT_EQ(2u, deltaAccountIndex.size());
+		for (auto i = 0u; i < deltaAccountIndex.size(); ++i) {
+			auto expectedBalance = addresses[0] == deltaAccountIndex.addresses()[i] ? Amount(1'100'000) : Amount(1'500'000);
+			EXPECT_EQ(expectedBalance, deltaAccountIndex.balances()[i]) << i;
+		}
+
+		// - the view is unchanged
+		auto view = cache.createView();
+		const auto& viewAccountIndex = view->highValueAccounts().accountIndex();
+		ASSERT_EQ(2u, viewAccountIndex.size());
+		for (auto i = 0u; i < viewAccountIndex.size(); ++i) {
+			auto expectedBalance = addresses[0] == viewAccountIndex.addresses()[i] ? Amount(1'100'000) : Amount(1'000'000);
+			EXPECT_EQ(expectedBalance, viewAccountIndex.balances()[i]) << i;
+		}
 	}
 
 	TEST(TEST_CLASS, DetachHighValueAccountsIsDestructive) {
@@ -1576,5 +1615,33 @@ namespace catapult { namespace cache {
 		EXPECT_EQ(addressSet, GetHighValueAddresses(*view));
 	}
 
+	TEST(TEST_CLASS, InitRebuildsHighValueAccountIndexFromAccountStates) {
+		// Arrange:
+		AccountStateCache cache(CacheConfiguration(), Default_Cache_Options);
+		std::vector<Address> addresses;
+		{
+			auto delta = cache.createDelta();
+			addresses = AddAccountsWithBalances(*delta, { Amount(1'100'000), Amount(1'200'000) });
+			cache.commit();
+		}
+
+		// - include an address without an account state
+		auto addressSet = model::AddressSet(addresses.cbegin(), addresses.cend());
+		addressSet.insert(test::GenerateRandomByteArray<Address>());
+
+		// Act:
+		cache.init(HighValueAccounts(addressSet, AddressAccountHistoryMap()));
+
+		// Assert: only addresses with account states are indexed
+		auto view = cache.createView();
+		const auto& accountIndex = view->highValueAccounts().accountIndex();
+		EXPECT_EQ(addressSet, GetHighValueAddresses(*view));
+		ASSERT_EQ(2u, accountIndex.size());
+		for (auto i = 0u; i < accountIndex.size(); ++i) {
+			auto expectedBalance = addresses[0] == accountIndex.addresses()[i] ? Amount(1'100'000) : Amount(1'200'000);
+			EXPECT_EQ(expectedBalance, accountIndex.balances()[i]) << i;
+		}
+	}
+
 	// endregion
 }}
@@ -73,6 +73,122 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region index
+
+	namespace {
+		state::AccountState CreateAccountStateWithActivity(const Address& address, uint32_t beneficiaryCount) {
+			auto accountState = state::AccountState(address, Height(1));
+			accountState.ActivityBuckets.update(model::ImportanceHeight(1), [beneficiaryCount](auto& bucket) {
+				bucket.BeneficiaryCount = beneficiaryCount;
+			});
+			return accountState;
+		}
+
+		uint32_t GetBeneficiaryCount(const HighValueAccountIndex& index, size_t row) {
+			return index.activityBuckets()[row].get(model::ImportanceHeight(1)).BeneficiaryCount;
+		}
+	}
+
+	TEST(TEST_CLASS, Index_CanCreateEmptyIndex) {
+		// Act:
+		HighValueAccountIndex index;
+
+		// Assert:
+		EXPECT_EQ(0u, index.size());
+		EXPECT_TRUE(index.addresses().empty());
+		EXPECT_TRUE(index.balances().empty());
+		EXPECT_TRUE(index.activityBuckets().empty());
+	}
+
+	TEST(TEST_CLASS, Index_SetAddsRowsForNewAccounts) {
+		// Arrange:
+		auto addresses = test::GenerateRandomDataVector<Address>(3);
+		HighValueAccountIndex index;
+
+		// Act:
+		for (auto i = 0u; i < addresses.size(); ++i)
+			index.set(CreateAccountStateWithActivity(addresses[i], 10 + i), Amount(100 + i));
+
+		// Assert:
+		ASSERT_EQ(3u, index.size());
+		EXPECT_EQ(addresses, index.addresses());
+		EXPECT_EQ(std::vector<Amount>({ Amount(100), Amount(101), Amount(102) }), index.balances());
+		for (auto i = 0u; i < addresses.size(); ++i)
+			EXPECT_EQ(10 + i, GetBeneficiaryCount(index, i)) << i;
+	}
+
+	TEST(TEST_CLASS, Index_SetUpdatesRowOfExistingAccount) {
+		// Arrange:
+		auto addresses = test::GenerateRandomDataVector<Address>(3);
+		HighValueAccountIndex index;
+		for (auto i = 0u; i < addresses.size(); ++i)
+			index.set(CreateAccountStateWithActivity(addresses[i], 10 + i), Amount(100 + i));
+
+		// Act:
+		index.set(CreateAccountStateWithActivity(addresses[1], 50), Amount(500));
+
+		// Assert:
+		ASSERT_EQ(3u, index.size());
+		EXPECT_EQ(addresses, index.addresses());
+		EXPECT_EQ(std::vector<Amount>({ Amount(100), Amount(500), Amount(102) }), index.balances());
+		EXPECT_EQ(50u, GetBeneficiaryCount(index, 1));
+	}
+
+	TEST(TEST_CLASS, Index_RemoveMovesLastRowIntoRemovedRow) {
+		// Arrange:
+		auto addresses = test::GenerateRandomDataVector<Address>(4);
+		HighValueAccountIndex index;
+		for (auto i = 0u; i < addresses.size(); ++i)
+			index.set(CreateAccountStateWithActivity(addresses[i], 10 + i), Amount(100 + i));
+
+		// Act:
+		index.remove(addresses[1]);
+
+		// Assert:
+		ASSERT_EQ(3u, index.size());
+		EXPECT_EQ(std::vector<Address>({ addresses[0], addresses[3], addresses[2] }), index.addresses());
+		EXPECT_EQ(std::vector<Amount>({ Amount(100), Amount(103), Amount(102) }), index.balances());
+		EXPECT_EQ(13u, GetBeneficiaryCount(index, 1));
+
+		// - moved row can still be updated
+		index.set(CreateAccountStateWithActivity(addresses[3], 50), Amount(500));
+		EXPECT_EQ(std::vector<Amount>({ Amount(100), Amount(500), Amount(102) }), index.balances());
+	}
+
+	TEST(TEST_CLASS, Index_CanRemoveLastRow) {
+		// Arrange:
+		auto addresses = test::GenerateRandomDataVector<Address>(3);
+		HighValueAccountIndex index;
+		for (auto i = 0u; i < addresses.size(); ++i)
+			index.set(CreateAccountStateWithActivity(addresses[i], 10 + i), Amount(100 + i));
+
+		// Act:
+		index.remove(addresses[2]);
+
+		// Assert:
+		ASSERT_EQ(2u, index.size());
+		EXPECT_EQ(std::vector<Address>({ addresses[0], addresses[1] }), index.addresses());
+		EXPECT_EQ(std::vector<Amount>({ Amount(100), Amount(101) }), index.balances());
+	}
+
+	TEST(TEST_CLASS, Index_RemoveIgnoresUnknownAddress) {
+		// Arrange:
+		auto addresses = test::GenerateRandomDataVector<Address>(3);
+		HighValueAccountIndex index;
+		for (auto i = 0u; i < addresses.size(); ++i)
+			index.set(CreateAccountStateWithActivity(addresses[i], 10 + i), Amount(100 + i));
+
+		// Act:
+		index.remove(test::GenerateRandomByteArray<Address>());
+
+		// Assert:
+		ASSERT_EQ(3u, index.size());
+		EXPECT_EQ(addresses, index.addresses());
+		EXPECT_EQ(std::vector<Amount>({ Amount(100), Amount(101), Amount(102) }), index.balances());
+	}
+
+	// endregion
+
 	// region accounts - constructor
 
 	TEST(TEST_CLASS, Accounts_CanCreateEmptyAccounts) {
@@ -81,6 +197,7 @@ namespace catapult { namespace cache {
 
 		// Assert:
 		EXPECT_TRUE(accounts.addresses().empty());
+		EXPECT_EQ(0u, accounts.accountIndex().size());
 
 		EXPECT_TRUE(accounts.accountHistories().empty());
 	}
@@ -109,6 +226,26 @@ namespace catapult { namespace cache {
 		test::AssertEqual(CreateThreeAccountHistories(), accounts.accountHistories());
 	}
 
+	TEST(TEST_CLASS, Accounts_CanCreateAroundMovedInputsWithAccountIndex) {
+		// Arrange:
+		auto addresses = GenerateRandomAddresses(4);
+		auto addressesCopy = addresses;
+		HighValueAccountIndex accountIndex;
+		for (const auto& address : addresses)
+			accountIndex.set(state::AccountState(address, Height(1)), Amount(123));
+
+		// Act:
+		HighValueAccounts accounts(std::move(addresses), std::move(accountIndex), CreateThreeAccountHistories());
+
+		// Assert:
+		EXPECT_EQ(addressesCopy, accounts.addresses());
+		const auto& accountIndexAddresses = accounts.accountIndex().addresses();
+		EXPECT_EQ(4u, accounts.accountIndex().size());
+		EXPECT_EQ(addressesCopy, model::AddressSet(accountIndexAddresses.cbegin(), accountIndexAddresses.cend()));
+
+		test::AssertEqual(CreateThreeAccountHistories(), accounts.accountHistories());
+	}
+
 	// endregion
 
 	// region updater - constructor
@@ -129,10 +266,32 @@ namespace catapult { namespace cache {
 
 		EXPECT_EQ(accounts.addresses(), updater.addresses());
 		EXPECT_TRUE(updater.removedAddresses().empty());
+		EXPECT_EQ(0u, updater.accountIndex().size());
 
 		test::AssertEqual(accounts.accountHistories(), updater.accountHistories());
 	}
 
+	TEST(TEST_CLASS, Updater_CanCreateAroundAccountsWithAccountIndex) {
+		// Arrange:
+		auto addresses = test::GenerateRandomDataVector<Address>(3);
+		HighValueAccountIndex accountIndex;
+		for (const auto& address : addresses)
+			accountIndex.set(state::AccountState(address, Height(1)), Amount(123));
+
+		auto accounts = HighValueAccounts(
+				model::AddressSet(addresses.cbegin(), addresses.cend()),
+				std::move(accountIndex),
+				AddressAccountHistoryMap());
+
+		// Act:
+		HighValueAccountsUpdater updater(CreateOptions(), accounts);
+
+		// Assert:
+		EXPECT_EQ(accounts.addresses(), updater.addresses());
+		EXPECT_EQ(addresses, updater.accountIndex().addresses());
+		EXPECT_EQ(std::vector<Amount>(3, Amount(123)), updater.accountIndex().balances());
+	}
+
 	// endregion
 
 	// region updater - setHeight
@@ -206,6 +365,22 @@ namespace catapult { namespace cache {
 		auto& SelectCopied(test::DeltaElementsTestUtils::Wrapper<MemorySetType>& deltas) {
 			return deltas.Copied;
 		}
+
+		void AssertAccountIndex(const HighValueAccountsUpdater& updater, test::DeltaElementsTestUtils::Wrapper<MemorySetType>& deltas) {
+			// account index should contain a row with the most recent balance for each (current) address
+			const auto& accountIndex = updater.accountIndex();
+			const auto& indexAddresses = accountIndex.addresses();
+			ASSERT_EQ(updater.addresses().size(), accountIndex.size());
+			EXPECT_EQ(updater.addresses(), model::AddressSet(indexAddresses.cbegin(), indexAddresses.cend()));
+
+			for (auto i = 0u; i < accountIndex.size(); ++i) {
+				auto accountStateIter = deltas.Copied.find(indexAddresses[i]);
+				if (deltas.Copied.cend() == accountStateIter)
+					accountStateIter = deltas.Added.find(indexAddresses[i]);
+
+				EXPECT_EQ(accountStateIter->second.Balances.get(Harvesting_Mosaic_Id), accountIndex.balances()[i]) << i;
+			}
+		}
 	}
 
 	namespace {
@@ -225,6 +400,8 @@ namespace catapult { namespace cache {
 			EXPECT_EQ(Pick(addedAddresses, { 0, 2, 4, 5 }), updater.addresses());
 			EXPECT_TRUE(updater.removedAddresses().empty());
 
+			AssertAccountIndex(updater, deltas);
+
 			// Sanity:
 			EXPECT_EQ(1u, updater.accountHistories().size());
 		}
@@ -245,6 +422,8 @@ namespace catapult { namespace cache {
 			EXPECT_EQ(Pick(addedAddresses, { 0, 2, 4, 5 }), updater.addresses());
 			EXPECT_EQ(Pick(addedAddresses, { 1, 3 }), updater.removedAddresses());
 
+			AssertAccountIndex(updater, deltas);
+
 			// Sanity:
 			EXPECT_EQ(1u, updater.accountHistories().size());
 		}
@@ -331,6 +510,8 @@ namespace catapult { namespace cache {
 		EXPECT_EQ(Pick(addedAddresses, { 0, 4, 5 }), updater.addresses());
 		EXPECT_EQ(Pick(addedAddresses, { 1, 2 }), updater.removedAddresses());
 
+		AssertAccountIndex(updater, deltas);
+
 		// Sanity:
 		EXPECT_TRUE(updater.accountHistories().empty());
 	}
@@ -364,6 +545,8 @@ namespace catapult { namespace cache {
 		EXPECT_EQ(Pick(addedAddresses, { 0, 4, 5 }), updater.addresses());
 		EXPECT_EQ(Pick(addedAddresses, { 1, 2 }), updater.removedAddresses());
 
+		AssertAccountIndex(updater, deltas);
+
 		// Sanity:
 		EXPECT_TRUE(updater.accountHistories().empty());
 	}
@@ -384,6 +567,7 @@ namespace catapult { namespace cache {
 		// Assert:
 		EXPECT_EQ(Pick(addedAddresses, { 0, 2 }), updater.addresses());
 		EXPECT_EQ(Pick(addedAddresses, { 1 }), updater.removedAddresses());
+		AssertAccountIndex(updater, deltas);
 
 		// Act: modify all
 		Debit(deltas.Copied.insert(*deltas.Added.find(addedAddresses[0])).first->second, Amount(200'000));
@@ -396,6 +580,7 @@ namespace catapult { namespace cache {
 		// Assert:
 		EXPECT_EQ(Pick(addedAddresses, { 1, 3 }), updater.addresses());
 		EXPECT_EQ(Pick(addedAddresses, { 0 }), updater.removedAddresses());
+		AssertAccountIndex(updater, deltas);
 
 		// Act: revert all
 		Credit(deltas.Copied.insert(*deltas.Added.find(addedAddresses[0])).first->second, Amount(200'000));
@@ -408,6 +593,7 @@ namespace catapult { namespace cache {
 		// Assert:
 		EXPECT_EQ(Pick(addedAddresses, { 0, 2 }), updater.addresses());
 		EXPECT_EQ(Pick(addedAddresses, { 1 }), updater.removedAddresses());
+		AssertAccountIndex(updater, deltas);
 
 		// Sanity:
 		EXPECT_TRUE(updater.accountHistories().empty());
@@ -1084,6 +1270,9 @@ namespace catapult { namespace cache {
 		// Assert:
 		EXPECT_EQ(Pick(addedAddresses, { 0, 2, 4, 5 }), accounts.addresses());
 
+		const auto& accountIndexAddresses = accounts.accountIndex().addresses();
+		EXPECT_EQ(accounts.addresses(), model::AddressSet(accountIndexAddresses.cbegin(), accountIndexAddresses.cend()));
+
 		// - notice that GetHarvesterEligibleTestBalances includes one account with min voter balance
 		auto expectedAccountHistories = CreateThreeAccountHistories();
 		expectedAccountHistories.emplace(addedAddresses[5], test::CreateAccountHistory({ { Height(3), Min_Voter_Balance } }));
@@ -1092,6 +1281,7 @@ namespace catapult { namespace cache {
 		// - updater is cleared
 		EXPECT_TRUE(updater.addresses().empty());
 		EXPECT_TRUE(updater.removedAddresses().empty());
+		EXPECT_EQ(0u, updater.accountIndex().size());
 
 		EXPECT_TRUE(updater.accountHistories().empty());
 	}
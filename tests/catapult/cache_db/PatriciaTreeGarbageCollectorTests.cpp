@@ -0,0 +1,351 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_db/PatriciaTreeGarbageCollector.h"
+#include "catapult/cache_db/RocksDatabase.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS PatriciaTreeGarbageCollectorTests
+
+	namespace {
+		constexpr uint32_t Collection_Delay = 2;
+
+		class TestContext {
+		public:
+			TestContext()
+					: m_database(RocksDatabaseSettings(m_dbDirGuard.name(), { "default" }, FilterPruningMode::Enabled))
+					, m_container(m_database, 0)
+			{}
+
+		public:
+			PatriciaTreeContainer& container() {
+				return m_container;
+			}
+
+			PatriciaTreeGarbageCollector& collector() {
+				if (!m_pCollector)
+					reload();
+
+				return *m_pCollector;
+			}
+
+		public:
+			Hash256 addNode() {
+				auto leafNode = tree::LeafTreeNode(tree::TreeNodePath(test::Random()), test::GenerateRandomByteArray<Hash256>());
+				auto node = tree::TreeNode(leafNode);
+				m_container.insert(std::make_pair(node.hash(), node.copy()));
+				return node.hash();
+			}
+
+			bool contains(const Hash256& hash) const {
+				return m_container.cend() != m_container.find(hash);
+			}
+
+			void commit(const std::vector<Hash256>& reachableHashes, const std::vector<Hash256>& unreachableHashes) {
+				commitNodeHashes({ reachableHashes, unreachableHashes, tree::NodeLinkCounts() }, test::GenerateRandomByteArray<Hash256>());
+			}
+
+			void commitNodeHashes(const tree::CommittedNodeHashes& committedNodeHashes, const Hash256& rootHash) {
+				collector().commit(committedNodeHashes, rootHash);
+			}
+
+			void commitUnrelated(size_t numCommits) {
+				for (auto i = 0u; i < numCommits; ++i)
+					commit({}, { test::GenerateRandomByteArray<Hash256>() });
+			}
+
+			void reload() {
+				m_pCollector.reset();
+				m_pCollector = std::make_unique<PatriciaTreeGarbageCollector>(m_container, 0, Collection_Delay);
+			}
+
+		private:
+			test::TempDirectoryGuard m_dbDirGuard;
+			RocksDatabase m_database;
+			PatriciaTreeContainer m_container;
+			std::unique_ptr<PatriciaTreeGarbageCollector> m_pCollector;
+		};
+
+		void AssertCollectorState(
+				const PatriciaTreeGarbageCollector& collector,
+				uint64_t expectedGeneration,
+				uint64_t expectedCollectedGeneration,
+				size_t expectedNumUnreachableNodes) {
+			EXPECT_EQ(expectedGeneration, collector.generation());
+			EXPECT_EQ(expectedCollectedGeneration, collector.collectedGeneration());
+			EXPECT_EQ(expectedNumUnreachableNodes, collector.numUnreachableNodes());
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateCollectorAroundEmptyContainer) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		const auto& collector = context.collector();
+
+		// Assert:
+		AssertCollectorState(collector, 0, 0, 0);
+		EXPECT_TRUE(collector.sharedLinkCounts().empty());
+		EXPECT_FALSE(collector.isTracking(Hash256()));
+	}
+
+	// endregion
+
+	// region commit
+
+	TEST(TEST_CLASS, CommitTracksUnreachableNodes) {
+		// Arrange:
+		TestContext context;
+		auto hash1 = context.addNode();
+		auto hash2 = context.addNode();
+
+		// Act:
+		context.commit({}, { hash1, hash2 });
+
+		// Assert:
+		AssertCollectorState(context.collector(), 1, 0, 2);
+		EXPECT_TRUE(context.contains(hash1));
+		EXPECT_TRUE(context.contains(hash2));
+		EXPECT_TRUE(context.collector().isUnreachable(hash1));
+		EXPECT_TRUE(context.collector().isUnreachable(hash2));
+	}
+
+	TEST(TEST_CLASS, CommitTracksRootHash) {
+		// Arrange:
+		TestContext context;
+		auto rootHash1 = test::GenerateRandomByteArray<Hash256>();
+		auto rootHash2 = test::GenerateRandomByteArray<Hash256>();
+
+		// Act:
+		context.commitNodeHashes(tree::CommittedNodeHashes(), rootHash1);
+		context.commitNodeHashes(tree::CommittedNodeHashes(), rootHash2);
+
+		// Assert:
+		EXPECT_FALSE(context.collector().isTracking(rootHash1));
+		EXPECT_TRUE(context.collector().isTracking(rootHash2));
+	}
+
+	TEST(TEST_CLASS, CommitDoesNotCreateGenerationWhenNoNodesAreUnreachableOrRevived) {
+		// Arrange:
+		TestContext context;
+		auto hash = context.addNode();
+
+		// Act: newly reachable nodes are not journaled
+		context.commit({ hash }, {});
+
+		// Assert:
+		AssertCollectorState(context.collector(), 0, 0, 0);
+		EXPECT_FALSE(context.collector().isUnreachable(hash));
+	}
+
+	TEST(TEST_CLASS, CommitUpdatesSharedLinkCounts) {
+		// Arrange:
+		TestContext context;
+		auto hash1 = context.addNode();
+		auto hash2 = context.addNode();
+		auto hash3 = context.addNode();
+		context.commitNodeHashes({ {}, {}, { { hash1, 2 }, { hash2, 3 } } }, test::GenerateRandomByteArray<Hash256>());
+
+		// Act: counts below two are no longer shared
+		context.commitNodeHashes({ {}, {}, { { hash1, 1 }, { hash2, 4 }, { hash3, 2 } } }, test::GenerateRandomByteArray<Hash256>());
+
+		// Assert:
+		AssertCollectorState(context.collector(), 0, 0, 0);
+		EXPECT_EQ(tree::NodeLinkCounts({ { hash2, 4 }, { hash3, 2 } }), context.collector().sharedLinkCounts());
+	}
+
+	TEST(TEST_CLASS, CommitDoesNotCollectUntilExpiredGenerationsSpanDelay) {
+		// Arrange:
+		TestContext context;
+		auto hash = context.addNode();
+		context.commit({}, { hash });
+
+		// Act: generation 0 is expired but the batch is not yet complete
+		context.commitUnrelated(2 * Collection_Delay - 2);
+
+		// Assert:
+		AssertCollectorState(context.collector(), 2 * Collection_Delay - 1, 0, 2 * Collection_Delay - 1);
+		EXPECT_TRUE(context.contains(hash));
+	}
+
+	TEST(TEST_CLASS, CommitCollectsExpiredUnreachableNodes) {
+		// Arrange:
+		TestContext context;
+		std::vector<Hash256> hashes;
+		for (auto i = 0u; i < 2 * Collection_Delay; ++i)
+			hashes.push_back(context.addNode());
+
+		auto statistics = GetPatriciaTreeGarbageCollectionStatistics();
+
+		// Act: make one node unreachable per generation
+		for (const auto& hash : hashes)
+			context.commit({}, { hash });
+
+		// Assert: nodes of first delay generations were collected
+		AssertCollectorState(context.collector(), 2 * Collection_Delay, Collection_Delay, Collection_Delay);
+		for (auto i = 0u; i < hashes.size(); ++i)
+			EXPECT_EQ(i >= Collection_Delay, context.contains(hashes[i])) << "node " << i;
+
+		// - nodes and journal entries of collected generations were removed
+		auto newStatistics = GetPatriciaTreeGarbageCollectionStatistics();
+		EXPECT_EQ(statistics.NumCollections + 1, newStatistics.NumCollections);
+		EXPECT_EQ(statistics.NumRemoved + 2 * Collection_Delay, newStatistics.NumRemoved);
+		EXPECT_LT(statistics.NumRemovedBytes, newStatistics.NumRemovedBytes);
+	}
+
+	TEST(TEST_CLASS, CommitDoesNotCollectRevivedNodes) {
+		// Arrange:
+		TestContext context;
+		auto hash = context.addNode();
+		context.commit({}, { hash });
+
+		// Act: revive the node and force a collection
+		context.commit({ hash }, { test::GenerateRandomByteArray<Hash256>() });
+		context.commitUnrelated(2 * Collection_Delay - 2);
+
+		// Assert:
+		AssertCollectorState(context.collector(), 2 * Collection_Delay, Collection_Delay, Collection_Delay);
+		EXPECT_TRUE(context.contains(hash));
+	}
+
+	TEST(TEST_CLASS, CommitAssignsNewerGenerationToNodesThatBecomeUnreachableAgain) {
+		// Arrange:
+		TestContext context;
+		auto hash = context.addNode();
+		context.commit({}, { hash });
+		context.commit({ hash }, { test::GenerateRandomByteArray<Hash256>() });
+
+		// Act: node is unreachable again in last non-expired generation
+		context.commit({}, { hash });
+		context.commitUnrelated(2 * Collection_Delay - 3);
+
+		// Assert:
+		AssertCollectorState(context.collector(), 2 * Collection_Delay, Collection_Delay, Collection_Delay);
+		EXPECT_TRUE(context.contains(hash));
+	}
+
+	// endregion
+
+	// region reset
+
+	TEST(TEST_CLASS, ResetStartsTrackingRootHashAndSharedLinkCounts) {
+		// Arrange:
+		TestContext context;
+		auto hash = context.addNode();
+		auto rootHash = test::GenerateRandomByteArray<Hash256>();
+		context.commitNodeHashes({ {}, {}, { { test::GenerateRandomByteArray<Hash256>(), 2 } } }, test::GenerateRandomByteArray<Hash256>());
+
+		// Act:
+		context.collector().reset(rootHash, { { hash, 3 } });
+
+		// Assert:
+		EXPECT_TRUE(context.collector().isTracking(rootHash));
+		EXPECT_EQ(tree::NodeLinkCounts({ { hash, 3 } }), context.collector().sharedLinkCounts());
+	}
+
+	TEST(TEST_CLASS, ResetNeverCollectsUncollectedUnreachableNodes) {
+		// Arrange:
+		TestContext context;
+		auto hash = context.addNode();
+		context.commit({}, { hash });
+
+		// Act:
+		context.collector().reset(test::GenerateRandomByteArray<Hash256>(), tree::NodeLinkCounts());
+		context.commitUnrelated(2 * Collection_Delay);
+
+		// Assert: generations before the reset are never replayed or collected
+		AssertCollectorState(context.collector(), 2 * Collection_Delay + 1, Collection_Delay + 1, Collection_Delay);
+		EXPECT_FALSE(context.collector().isUnreachable(hash));
+		EXPECT_TRUE(context.contains(hash));
+
+		// Act:
+		context.reload();
+
+		// Assert:
+		AssertCollectorState(context.collector(), 2 * Collection_Delay + 1, Collection_Delay + 1, Collection_Delay);
+		EXPECT_FALSE(context.collector().isUnreachable(hash));
+	}
+
+	// endregion
+
+	// region reload
+
+	TEST(TEST_CLASS, ReloadRestoresGenerationsAndUnreachableNodesFromJournal) {
+		// Arrange:
+		TestContext context;
+		auto hash1 = context.addNode();
+		auto hash2 = context.addNode();
+		context.commit({}, { hash1 });
+		context.commit({ hash1 }, { hash2 });
+
+		// Act:
+		context.reload();
+
+		// Assert: only hash2 is unreachable
+		AssertCollectorState(context.collector(), 2, 0, 1);
+
+		// Act: force a collection
+		context.commitUnrelated(2 * Collection_Delay - 2);
+
+		// Assert:
+		AssertCollectorState(context.collector(), 2 * Collection_Delay, Collection_Delay, Collection_Delay);
+		EXPECT_TRUE(context.contains(hash1));
+		EXPECT_FALSE(context.contains(hash2));
+	}
+
+	TEST(TEST_CLASS, ReloadRestoresRootHashAndSharedLinkCounts) {
+		// Arrange:
+		TestContext context;
+		auto hash1 = context.addNode();
+		auto hash2 = context.addNode();
+		auto rootHash = test::GenerateRandomByteArray<Hash256>();
+		context.commitNodeHashes({ {}, {}, { { hash1, 2 }, { hash2, 3 } } }, test::GenerateRandomByteArray<Hash256>());
+		context.commitNodeHashes({ {}, {}, { { hash1, 1 } } }, rootHash);
+
+		// Act:
+		context.reload();
+
+		// Assert:
+		EXPECT_TRUE(context.collector().isTracking(rootHash));
+		EXPECT_EQ(tree::NodeLinkCounts({ { hash2, 3 } }), context.collector().sharedLinkCounts());
+	}
+
+	TEST(TEST_CLASS, ReloadDoesNotReplayCollectedGenerations) {
+		// Arrange:
+		TestContext context;
+		context.commitUnrelated(2 * Collection_Delay + 1);
+
+		// Act:
+		context.reload();
+
+		// Assert:
+		AssertCollectorState(context.collector(), 2 * Collection_Delay + 1, Collection_Delay, Collection_Delay + 1);
+	}
+
+	// endregion
+}}
@@ -0,0 +1,231 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_db/PatriciaTreeNodeCache.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS PatriciaTreeNodeCacheTests
+
+	namespace {
+		tree::TreeNode CreateLeafNode(uint32_t path) {
+			return tree::TreeNode(tree::LeafTreeNode(tree::TreeNodePath(path), test::GenerateRandomByteArray<Hash256>()));
+		}
+
+		uint64_t GetEstimatedNodeSize() {
+			PatriciaTreeNodeCache cache(utils::FileSize::FromKilobytes(100));
+			cache.add(CreateLeafNode(0x64'6F'67'00));
+			return cache.statistics().Size.bytes();
+		}
+
+		void AssertStatistics(
+				const PatriciaTreeNodeCache& cache,
+				uint64_t expectedNumHits,
+				uint64_t expectedNumMisses,
+				size_t expectedNumNodes) {
+			auto statistics = cache.statistics();
+			EXPECT_EQ(expectedNumHits, statistics.NumHits);
+			EXPECT_EQ(expectedNumMisses, statistics.NumMisses);
+			EXPECT_EQ(expectedNumNodes, statistics.NumNodes);
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CacheIsInitiallyEmpty) {
+		// Act:
+		PatriciaTreeNodeCache cache(utils::FileSize::FromKilobytes(100));
+
+		// Assert:
+		EXPECT_TRUE(cache.enabled());
+		AssertStatistics(cache, 0, 0, 0);
+		EXPECT_EQ(utils::FileSize(), cache.statistics().Size);
+	}
+
+	TEST(TEST_CLASS, CacheWithZeroSizeIsDisabled) {
+		// Arrange:
+		PatriciaTreeNodeCache cache((utils::FileSize()));
+		auto node = CreateLeafNode(0x64'6F'67'00);
+
+		// Act:
+		cache.add(node);
+		auto cachedNode = cache.tryGet(node.hash());
+
+		// Assert:
+		EXPECT_FALSE(cache.enabled());
+		EXPECT_TRUE(cachedNode.empty());
+		EXPECT_FALSE(cache.contains(node.hash()));
+		AssertStatistics(cache, 0, 0, 0);
+	}
+
+	// endregion
+
+	// region add / tryGet / contains
+
+	TEST(TEST_CLASS, CanAddAndGetNode) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(utils::FileSize::FromKilobytes(100));
+		auto node = CreateLeafNode(0x64'6F'67'00);
+
+		// Act:
+		cache.add(node);
+		auto cachedNode = cache.tryGet(node.hash());
+
+		// Assert:
+		EXPECT_TRUE(cache.contains(node.hash()));
+		EXPECT_TRUE(cachedNode.isLeaf());
+		EXPECT_EQ(node.hash(), cachedNode.hash());
+		AssertStatistics(cache, 1, 0, 1);
+		EXPECT_EQ(utils::FileSize::FromBytes(GetEstimatedNodeSize()), cache.statistics().Size);
+	}
+
+	TEST(TEST_CLASS, CannotGetUnknownNode) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(utils::FileSize::FromKilobytes(100));
+		cache.add(CreateLeafNode(0x64'6F'67'00));
+		auto hash = test::GenerateRandomByteArray<Hash256>();
+
+		// Act:
+		auto cachedNode = cache.tryGet(hash);
+
+		// Assert:
+		EXPECT_FALSE(cache.contains(hash));
+		EXPECT_TRUE(cachedNode.empty());
+		AssertStatistics(cache, 0, 1, 1);
+	}
+
+	TEST(TEST_CLASS, AddingNodeMultipleTimesHasNoEffect) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(utils::FileSize::FromKilobytes(100));
+		auto node = CreateLeafNode(0x64'6F'67'00);
+
+		// Act:
+		cache.add(node);
+		cache.add(node);
+
+		// Assert:
+		AssertStatistics(cache, 0, 0, 1);
+		EXPECT_EQ(utils::FileSize::FromBytes(GetEstimatedNodeSize()), cache.statistics().Size);
+	}
+
+	TEST(TEST_CLASS, AddingEmptyNodeHasNoEffect) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(utils::FileSize::FromKilobytes(100));
+
+		// Act:
+		cache.add(tree::TreeNode());
+
+		// Assert:
+		AssertStatistics(cache, 0, 0, 0);
+	}
+
+	TEST(TEST_CLASS, AddingNodeLargerThanCacheHasNoEffect) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(utils::FileSize::FromBytes(GetEstimatedNodeSize() - 1));
+
+		// Act:
+		cache.add(CreateLeafNode(0x64'6F'67'00));
+
+		// Assert:
+		AssertStatistics(cache, 0, 0, 0);
+	}
+
+	// endregion
+
+	// region eviction
+
+	TEST(TEST_CLASS, LeastRecentlyAddedNodeIsEvictedWhenCacheIsFull) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(utils::FileSize::FromBytes(2 * GetEstimatedNodeSize()));
+		auto node1 = CreateLeafNode(0x64'6F'67'01);
+		auto node2 = CreateLeafNode(0x64'6F'67'02);
+		auto node3 = CreateLeafNode(0x64'6F'67'03);
+
+		// Act:
+		cache.add(node1);
+		cache.add(node2);
+		cache.add(node3);
+
+		// Assert:
+		EXPECT_FALSE(cache.contains(node1.hash()));
+		EXPECT_TRUE(cache.contains(node2.hash()));
+		EXPECT_TRUE(cache.contains(node3.hash()));
+		AssertStatistics(cache, 0, 0, 2);
+	}
+
+	TEST(TEST_CLASS, LeastRecentlyUsedNodeIsEvictedWhenCacheIsFull) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(utils::FileSize::FromBytes(2 * GetEstimatedNodeSize()));
+		auto node1 = CreateLeafNode(0x64'6F'67'01);
+		auto node2 = CreateLeafNode(0x64'6F'67'02);
+		auto node3 = CreateLeafNode(0x64'6F'67'03);
+
+		cache.add(node1);
+		cache.add(node2);
+
+		// Act: touch node1 so that node2 is least recently used
+		cache.tryGet(node1.hash());
+		cache.add(node3);
+
+		// Assert:
+		EXPECT_TRUE(cache.contains(node1.hash()));
+		EXPECT_FALSE(cache.contains(node2.hash()));
+		EXPECT_TRUE(cache.contains(node3.hash()));
+		AssertStatistics(cache, 1, 0, 2);
+	}
+
+	// endregion
+
+	// region remove
+
+	TEST(TEST_CLASS, CanRemoveNode) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(utils::FileSize::FromKilobytes(100));
+		auto node1 = CreateLeafNode(0x64'6F'67'01);
+		auto node2 = CreateLeafNode(0x64'6F'67'02);
+		cache.add(node1);
+		cache.add(node2);
+
+		// Act:
+		cache.remove(node1.hash());
+
+		// Assert:
+		EXPECT_FALSE(cache.contains(node1.hash()));
+		EXPECT_TRUE(cache.contains(node2.hash()));
+		AssertStatistics(cache, 0, 0, 1);
+		EXPECT_EQ(utils::FileSize::FromBytes(GetEstimatedNodeSize()), cache.statistics().Size);
+	}
+
+	TEST(TEST_CLASS, RemovingUnknownNodeHasNoEffect) {
+		// Arrange:
+		PatriciaTreeNodeCache cache(utils::FileSize::FromKilobytes(100));
+		cache.add(CreateLeafNode(0x64'6F'67'01));
+
+		// Act:
+		cache.remove(test::GenerateRandomByteArray<Hash256>());
+
+		// Assert:
+		AssertStatistics(cache, 0, 0, 1);
+	}
+
+	// endregion
+}}
@@ -35,10 +35,10 @@ namespace catapult { namespace cache {
 
 		class RocksDataSourceWrapper {
 		public:
-			RocksDataSourceWrapper()
+			explicit RocksDataSourceWrapper(utils::FileSize nodeCacheSize = utils::FileSize())
 					: m_db(DefaultSettings(m_dbDirGuard.name()))
 					, m_container(m_db, 0)
-					, m_dataSource(m_container) {
+					, m_dataSource(m_container, nodeCacheSize) {
 				m_container.setSize(0);
 			}
 
@@ -51,6 +51,21 @@ namespace catapult { namespace cache {
 				return m_dataSource.get(hash);
 			}
 
+			void prefetch(const std::vector<Hash256>& hashes) {
+				m_dataSource.prefetch(hashes);
+			}
+
+			PatriciaTreeNodeCacheStatistics nodeCacheStatistics() const {
+				return m_dataSource.nodeCacheStatistics();
+			}
+
+			// saves \a node directly in the container, bypassing the data source (and its node cache)
+			template<typename TNode>
+			void setUncached(const TNode& node) {
+				m_container.insert(std::make_pair(node.hash(), tree::TreeNode(node)));
+				m_container.setSize(size() + 1);
+			}
+
 			void set(const tree::BranchTreeNode& node) {
 				m_dataSource.set(node);
 				m_container.setSize(size() + 1);
@@ -74,4 +89,147 @@ namespace catapult { namespace cache {
 	}
 
 	DEFINE_PATRICIA_TREE_DATA_SOURCE_TESTS(RocksDataSourceTraits)
+
+	// region node cache
+
+	namespace {
+		constexpr auto Node_Cache_Size = utils::FileSize::FromKilobytes(100);
+
+		auto CreateLeafNode() {
+			return tree::LeafTreeNode(tree::TreeNodePath(0x64'6F'67'00), test::GenerateRandomByteArray<Hash256>());
+		}
+
+		auto CreateBranchNode() {
+			auto node = tree::BranchTreeNode(tree::TreeNodePath(0x64'6F'00'00));
+			node.setLink(test::GenerateRandomByteArray<Hash256>(), 3);
+			node.setLink(test::GenerateRandomByteArray<Hash256>(), 7);
+			return node;
+		}
+
+		void AssertStatistics(
+				const PatriciaTreeNodeCacheStatistics& statistics,
+				uint64_t expectedNumHits,
+				uint64_t expectedNumMisses,
+				size_t expectedNumNodes) {
+			EXPECT_EQ(expectedNumHits, statistics.NumHits);
+			EXPECT_EQ(expectedNumMisses, statistics.NumMisses);
+			EXPECT_EQ(expectedNumNodes, statistics.NumNodes);
+		}
+	}
+
+	TEST(TEST_CLASS, NodeCacheIsNotUsedWhenDisabled) {
+		// Arrange:
+		auto node = CreateBranchNode();
+		RocksDataSourceWrapper dataSource;
+		dataSource.set(node);
+
+		// Act:
+		auto dataSourceNode1 = dataSource.get(node.hash());
+		auto dataSourceNode2 = dataSource.get(node.hash());
+
+		// Assert:
+		EXPECT_EQ(node.hash(), dataSourceNode1.hash());
+		EXPECT_EQ(node.hash(), dataSourceNode2.hash());
+		AssertStatistics(dataSource.nodeCacheStatistics(), 0, 0, 0);
+	}
+
+	TEST(TEST_CLASS, SetAddsBranchNodeToNodeCache) {
+		// Arrange:
+		auto node = CreateBranchNode();
+		RocksDataSourceWrapper dataSource(Node_Cache_Size);
+		dataSource.set(node);
+
+		// Act:
+		auto dataSourceNode = dataSource.get(node.hash());
+
+		// Assert:
+		EXPECT_TRUE(dataSourceNode.isBranch());
+		EXPECT_EQ(node.hash(), dataSourceNode.hash());
+		AssertStatistics(dataSource.nodeCacheStatistics(), 1, 0, 1);
+	}
+
+	TEST(TEST_CLASS, SetDoesNotAddLeafNodeToNodeCache) {
+		// Arrange:
+		auto node = CreateLeafNode();
+		RocksDataSourceWrapper dataSource(Node_Cache_Size);
+		dataSource.set(node);
+
+		// Act:
+		auto dataSourceNode = dataSource.get(node.hash());
+
+		// Assert:
+		EXPECT_TRUE(dataSourceNode.isLeaf());
+		EXPECT_EQ(node.hash(), dataSourceNode.hash());
+		AssertStatistics(dataSource.nodeCacheStatistics(), 0, 1, 0);
+	}
+
+	TEST(TEST_CLASS, GetAddsLoadedBranchNodeToNodeCache) {
+		// Arrange:
+		auto node = CreateBranchNode();
+		RocksDataSourceWrapper dataSource(Node_Cache_Size);
+		dataSource.setUncached(node);
+
+		// Act:
+		auto dataSourceNode1 = dataSource.get(node.hash());
+		auto dataSourceNode2 = dataSource.get(node.hash());
+
+		// Assert: only first get was served from the database
+		EXPECT_EQ(node.hash(), dataSourceNode1.hash());
+		EXPECT_EQ(node.hash(), dataSourceNode2.hash());
+		EXPECT_EQ(2u, dataSourceNode2.asBranchNode().numLinks());
+		AssertStatistics(dataSource.nodeCacheStatistics(), 1, 1, 1);
+	}
+
+	TEST(TEST_CLASS, GetDoesNotAddLoadedLeafNodeToNodeCache) {
+		// Arrange:
+		auto node = CreateLeafNode();
+		RocksDataSourceWrapper dataSource(Node_Cache_Size);
+		dataSource.setUncached(node);
+
+		// Act:
+		dataSource.get(node.hash());
+		auto dataSourceNode = dataSource.get(node.hash());
+
+		// Assert:
+		EXPECT_EQ(node.hash(), dataSourceNode.hash());
+		AssertStatistics(dataSource.nodeCacheStatistics(), 0, 2, 0);
+	}
+
+	TEST(TEST_CLASS, PrefetchAddsAllFoundNodesToNodeCache) {
+		// Arrange:
+		auto leafNode = CreateLeafNode();
+		auto branchNode = CreateBranchNode();
+		RocksDataSourceWrapper dataSource(Node_Cache_Size);
+		dataSource.setUncached(leafNode);
+		dataSource.setUncached(branchNode);
+
+		// Act:
+		dataSource.prefetch({ leafNode.hash(), test::GenerateRandomByteArray<Hash256>(), branchNode.hash() });
+		auto dataSourceLeafNode = dataSource.get(leafNode.hash());
+		auto dataSourceBranchNode = dataSource.get(branchNode.hash());
+
+		// Assert:
+		EXPECT_TRUE(dataSourceLeafNode.isLeaf());
+		EXPECT_EQ(leafNode.hash(), dataSourceLeafNode.hash());
+		EXPECT_TRUE(dataSourceBranchNode.isBranch());
+		EXPECT_EQ(branchNode.hash(), dataSourceBranchNode.hash());
+		AssertStatistics(dataSource.nodeCacheStatistics(), 2, 0, 2);
+	}
+
+	TEST(TEST_CLASS, PrefetchHasNoEffectWhenNodeCacheIsDisabled) {
+		// Arrange:
+		auto node = CreateBranchNode();
+		RocksDataSourceWrapper dataSource;
+		dataSource.setUncached(node);
+
+		// Act:
+		dataSource.prefetch({ node.hash() });
+		auto dataSourceNode = dataSource.get(node.hash());
+
+		// Assert:
+		EXPECT_EQ(node.hash(), dataSourceNode.hash());
+		AssertStatistics(dataSource.nodeCacheStatistics(), 0, 0, 0);
+	}
+
+	// endregion
 }}
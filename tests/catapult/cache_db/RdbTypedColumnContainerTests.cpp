@@ -115,6 +115,13 @@ namespace catapult { namespace cache {
 				iterator.setFound(IsKeyFound);
 			}
 
+			void findAll(const std::vector<RawBuffer>& keys, std::vector<RdbDataIterator>& iterators) const {
+				FindAllKeys.push_back(keys);
+				iterators.resize(keys.size());
+				for (auto i = 0u; i < keys.size(); ++i)
+					iterators[i].setFound(0 == i % 2);
+			}
+
 			auto prune(uint64_t pruningBoundary) {
 				PruneParams.push(pruningBoundary);
 				return NumPruned;
@@ -129,6 +136,7 @@ namespace catapult { namespace cache {
 
 			test::ParamsCapture<InsertParamsType> InsertParams;
 			mutable test::ParamsCapture<FindParamsType> FindParams;
+			mutable std::vector<std::vector<RawBuffer>> FindAllKeys;
 			test::ParamsCapture<PruneParamsType> PruneParams;
 			test::ParamsCapture<RemoveParamsType> RemoveParams;
 		};
@@ -152,6 +160,10 @@ namespace catapult { namespace cache {
 				m_db.find(key, iterator);
 			}
 
+			void findAll(const std::vector<RawBuffer>& keys, std::vector<RdbDataIterator>& iterators) const {
+				m_db.findAll(keys, iterators);
+			}
+
 			size_t prune(uint64_t pruningBoundary) {
 				return m_db.prune(pruningBoundary);
 			}
@@ -236,6 +248,31 @@ namespace catapult { namespace cache {
 		EXPECT_EQ(&iter.dbIterator(), params.pIterator);
 	}
 
+	TEST(TEST_CLASS, FindAllSerializesKeysAndForwardsToContainer) {
+		// Arrange:
+		MockDb db;
+		auto container = CreateContainer(db);
+
+		// Act:
+		std::vector<test::StringKey> keys{ test::StringKey("hello"), test::StringKey("amazing"), test::StringKey("world") };
+		auto iters = container.findAll(keys);
+
+		// Assert:
+		ASSERT_EQ(1u, db.FindAllKeys.size());
+		const auto& serializedKeys = db.FindAllKeys[0];
+		ASSERT_EQ(3u, serializedKeys.size());
+		for (auto i = 0u; i < keys.size(); ++i) {
+			EXPECT_EQ(test::AsBytePointer(keys[i].data()), serializedKeys[i].pData) << i;
+			EXPECT_EQ(keys[i].size(), serializedKeys[i].Size) << i;
+		}
+
+		// - mock finds keys with even indexes
+		ASSERT_EQ(3u, iters.size());
+		EXPECT_NE(container.cend(), iters[0]);
+		EXPECT_EQ(container.cend(), iters[1]);
+		EXPECT_NE(container.cend(), iters[2]);
+	}
+
 	TEST(TEST_CLASS, PruneExtractsBoundaryFromKeyAndForwardsToContainer) {
 		// Arrange:
 		MockDb db;
@@ -222,6 +222,15 @@ namespace catapult { namespace cache {
 		EXPECT_THROW(database.get(0, "hello", iter), catapult_invalid_argument);
 	}
 
+	TEST(TEST_CLASS, DefaultCreatedRdbDoesNotAllowGetAll) {
+		// Arrange:
+		RocksDatabase database;
+
+		// Act + Assert:
+		std::vector<RdbDataIterator> iters;
+		EXPECT_THROW(database.getAll(0, { "hello" }, iters), catapult_invalid_argument);
+	}
+
 	TEST(TEST_CLASS, DefaultCreatedRdbDoesNotAllowPut) {
 		// Arrange:
 		RocksDatabase database;
@@ -338,6 +347,38 @@ namespace catapult { namespace cache {
 		test::AssertIteratorValue("awesome", iter2);
 	}
 
+	TEST(TEST_CLASS, CanReadFromDbInBatch_MultipleValues) {
+		// Arrange:
+		test::RdbTestContext context(DefaultSettings(), [](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], "hello", "amazing");
+			db.Put(rocksdb::WriteOptions(), columns[0], "world", "awesome");
+		});
+		auto& database = context.database();
+
+		// Act:
+		std::vector<RdbDataIterator> iters;
+		database.getAll(0, { "world", "missing", "hello" }, iters);
+
+		// Assert:
+		ASSERT_EQ(3u, iters.size());
+		test::AssertIteratorValue("awesome", iters[0]);
+		EXPECT_EQ(RdbDataIterator::End(), iters[1]);
+		test::AssertIteratorValue("amazing", iters[2]);
+	}
+
+	TEST(TEST_CLASS, CanReadFromDbInBatch_NoValues) {
+		// Arrange:
+		test::RdbTestContext context(DefaultSettings());
+		auto& database = context.database();
+
+		// Act:
+		std::vector<RdbDataIterator> iters(2);
+		database.getAll(0, {}, iters);
+
+		// Assert:
+		EXPECT_TRUE(iters.empty());
+	}
+
 	TEST(TEST_CLASS, CanWriteToDb_MultipleValues) {
 		// Arrange:
 		test::RdbTestContext context(DefaultSettings());
@@ -494,6 +535,98 @@ namespace catapult { namespace cache {
 		});
 	}
 
+	namespace {
+		std::unordered_set<std::string> ToKeys(std::initializer_list<uint64_t> values) {
+			std::unordered_set<std::string> keys;
+			for (auto value : values)
+				keys.insert(test::ToSlice(value).ToString());
+
+			return keys;
+		}
+	}
+
+	TEST(TEST_CLASS, PruneKeysIsNoOpWhenPruningIsDisabled) {
+		// Arrange: create 120 even keys (0 - 238)
+		auto evenSeeder = test::CreateEvenDbSeeder(120);
+		test::RdbTestContext context(DefaultSettings(), evenSeeder);
+
+		// Act:
+		auto statistics = context.database().prune(0, ToKeys({ 4, 10 }));
+
+		// Assert:
+		EXPECT_EQ(0u, statistics.NumRemoved);
+		EXPECT_EQ(0u, statistics.NumRemovedBytes);
+		AssertHasValidKey(context.database(), 4);
+		AssertHasValidKey(context.database(), 10);
+	}
+
+	TEST(TEST_CLASS, PruneKeysRemovesOnlyExpiredKeys) {
+		// Arrange: create 120 even keys (0 - 238)
+		auto evenSeeder = test::CreateEvenDbSeeder(120);
+		test::RdbTestContext context(PruningSettings(), evenSeeder);
+
+		// Act: prune two existing keys and one unknown key
+		auto statistics = context.database().prune(0, ToKeys({ 4, 10, 11 }));
+
+		// Assert:
+		auto expectedNumRemovedBytes = 2 * sizeof(uint64_t) + test::EvenKeyToValue(4).size() + test::EvenKeyToValue(10).size();
+		EXPECT_EQ(2u, statistics.NumRemoved);
+		EXPECT_EQ(expectedNumRemovedBytes, statistics.NumRemovedBytes);
+
+		auto& database = context.database();
+		AssertNoKey(database, 4);
+		AssertNoKey(database, 10);
+		for (auto i = 0u; i < 240; i += 2) {
+			if (4 != i && 10 != i)
+				AssertHasValidKey(database, i);
+		}
+	}
+
+	TEST(TEST_CLASS, PruneKeysDoesNotAffectSubsequentCompactions) {
+		// Arrange: create 120 even keys (0 - 238)
+		auto evenSeeder = test::CreateEvenDbSeeder(120);
+		test::RdbTestContext context(PruningSettings(), evenSeeder);
+		auto& database = context.database();
+		database.prune(0, ToKeys({ 4 }));
+
+		// Act: prune all keys < 2
+		auto numPruned = database.prune(0, 2);
+
+		// Assert: only key 0 was pruned
+		EXPECT_EQ(1u, numPruned);
+		AssertNoKey(database, 0);
+		for (auto i = 2u; i < 240; i += 2) {
+			if (4 != i)
+				AssertHasValidKey(database, i);
+		}
+	}
+
+	TEST(TEST_CLASS, PruneUsesSeparateFilterForEachColumn) {
+		// Arrange: create 10 even keys (0 - 18) in two columns
+		auto settings = CreateSettings({ "default", "foo" }, 0, FilterPruningMode::Enabled);
+		test::RdbTestContext context(settings, [](auto& db, const auto& columns) {
+			for (uint64_t key = 0; key < 20; key += 2) {
+				db.Put(rocksdb::WriteOptions(), columns[0], test::ToSlice(key), test::EvenKeyToValue(key));
+				db.Put(rocksdb::WriteOptions(), columns[1], test::ToSlice(key), test::EvenKeyToValue(key));
+			}
+		});
+		auto& database = context.database();
+
+		// - prune all keys from the second column
+		EXPECT_EQ(10u, database.prune(1, 20));
+
+		// Act: prune a single key from the first column
+		auto statistics = database.prune(0, ToKeys({ 4 }));
+
+		// Assert: the boundary set for the second column was not applied to the first column
+		EXPECT_EQ(1u, statistics.NumRemoved);
+		AssertNoKey(database, 4);
+		for (auto i = 0u; i < 20; i += 2) {
+			if (4 != i)
+				AssertHasValidKey(database, i);
+		}
+	}
+
 	// endregion
 
 	// region batch processing
@@ -36,6 +36,7 @@ namespace catapult { namespace cache {
 		EXPECT_FALSE(!!filter.compactionFilter());
 		EXPECT_EQ(0u, filter.pruningBoundary());
 		EXPECT_EQ(0u, filter.numRemoved());
+		EXPECT_EQ(0u, filter.numRemovedBytes());
 	}
 
 	TEST(TEST_CLASS, CanCreateRocksPruningFilter) {
@@ -46,6 +47,7 @@ namespace catapult { namespace cache {
 		EXPECT_TRUE(!!filter.compactionFilter());
 		EXPECT_EQ(0u, filter.pruningBoundary());
 		EXPECT_EQ(0u, filter.numRemoved());
+		EXPECT_EQ(0u, filter.numRemovedBytes());
 	}
 
 	TEST(TEST_CLASS, SetPruningBoundaryIsNoOpWhenPruningIsDisabled) {
@@ -120,4 +122,118 @@ namespace catapult { namespace cache {
 		EXPECT_TRUE(RunFilter(compactionFilter, "size1234"));
 		EXPECT_TRUE(RunFilter(compactionFilter, "size12345"));
 	}
+
+	// region expired keys
+
+	namespace {
+		bool RunFilter(rocksdb::CompactionFilter& filter, const std::string& key, const std::string& value) {
+			return filter.Filter(0, key, value, nullptr, nullptr);
+		}
+	}
+
+	TEST(TEST_CLASS, SetExpiredKeysIsNoOpWhenPruningIsDisabled) {
+		// Arrange:
+		RocksPruningFilter filter;
+
+		// Act + Assert: no exception
+		filter.setExpiredKeys({ "alpha", "beta" });
+	}
+
+	TEST(TEST_CLASS, CompactionFilterReturnsTrueForExpiredKeys) {
+		// Arrange:
+		RocksPruningFilter filter(FilterPruningMode::Enabled);
+		filter.setExpiredKeys({ "alpha", "beta", "gamma long key" });
+		auto& compactionFilter = *filter.compactionFilter();
+
+		// Act + Assert: expired keys are pruned irrespective of their size
+		EXPECT_TRUE(RunFilter(compactionFilter, "alpha"));
+		EXPECT_TRUE(RunFilter(compactionFilter, "beta"));
+		EXPECT_TRUE(RunFilter(compactionFilter, "gamma long key"));
+	}
+
+	TEST(TEST_CLASS, CompactionFilterReturnsFalseForOtherKeysWhenBoundaryIsUnset) {
+		// Arrange:
+		RocksPruningFilter filter(FilterPruningMode::Enabled);
+		filter.setExpiredKeys({ "alpha", "beta", "gamma long key" });
+		auto& compactionFilter = *filter.compactionFilter();
+
+		// Act + Assert:
+		EXPECT_FALSE(RunFilter(compactionFilter, "alph"));
+		EXPECT_FALSE(RunFilter(compactionFilter, "betas"));
+		EXPECT_FALSE(RunFilter(compactionFilter, "delta long key"));
+	}
+
+	TEST(TEST_CLASS, CompactionFilterMatchesExpiredKeysContainingZeroBytes) {
+		// Arrange:
+		auto expiredKey = std::string("al\0pha", 6);
+		RocksPruningFilter filter(FilterPruningMode::Enabled);
+		filter.setExpiredKeys({ expiredKey });
+		auto& compactionFilter = *filter.compactionFilter();
+
+		// Act + Assert: whole keys (including bytes following zero bytes) are compared
+		EXPECT_TRUE(RunFilter(compactionFilter, expiredKey));
+		EXPECT_FALSE(RunFilter(compactionFilter, std::string("al\0phb", 6)));
+		EXPECT_FALSE(RunFilter(compactionFilter, std::string("al", 2)));
+	}
+
+	TEST(TEST_CLASS, CompactionFilterPrunesExpiredKeysAndKeysSmallerThanBoundary) {
+		// Arrange:
+		RocksPruningFilter filter(FilterPruningMode::Enabled);
+		filter.setPruningBoundary(10);
+		filter.setExpiredKeys({ "alpha" });
+		auto& compactionFilter = *filter.compactionFilter();
+
+		// Act + Assert:
+		EXPECT_TRUE(RunFilter(compactionFilter, "alpha"));
+		EXPECT_TRUE(RunFilter(compactionFilter, 9));
+		EXPECT_FALSE(RunFilter(compactionFilter, 10));
+	}
+
+	TEST(TEST_CLASS, CompactionFilterCountsRemovedEntriesAndBytes) {
+		// Arrange:
+		RocksPruningFilter filter(FilterPruningMode::Enabled);
+		filter.setPruningBoundary(10);
+		filter.setExpiredKeys({ "alpha", "beta" });
+		auto& compactionFilter = *filter.compactionFilter();
+
+		// Act:
+		RunFilter(compactionFilter, "alpha", std::string(100, 'a'));
+		RunFilter(compactionFilter, "beta", std::string(50, 'b'));
+		RunFilter(compactionFilter, "gamma", std::string(70, 'c'));
+		RunFilter(compactionFilter, 9);
+
+		// Assert: alpha (5 + 100), beta (4 + 50) and 9 (8 + 0) are removed
+		EXPECT_EQ(3u, filter.numRemoved());
+		EXPECT_EQ(167u, filter.numRemovedBytes());
+	}
+
+	TEST(TEST_CLASS, SetExpiredKeysResetsCounters) {
+		// Arrange:
+		RocksPruningFilter filter(FilterPruningMode::Enabled);
+		filter.setExpiredKeys({ "alpha" });
+		RunFilter(*filter.compactionFilter(), "alpha", std::string(100, 'a'));
+
+		// Act:
+		filter.setExpiredKeys({ "beta" });
+
+		// Assert:
+		EXPECT_EQ(0u, filter.numRemoved());
+		EXPECT_EQ(0u, filter.numRemovedBytes());
+	}
+
+	TEST(TEST_CLASS, SetExpiredKeysReplacesPreviousExpiredKeys) {
+		// Arrange:
+		RocksPruningFilter filter(FilterPruningMode::Enabled);
+		filter.setExpiredKeys({ "alpha" });
+
+		// Act:
+		filter.setExpiredKeys({ "beta" });
+		auto& compactionFilter = *filter.compactionFilter();
+
+		// Assert:
+		EXPECT_FALSE(RunFilter(compactionFilter, "alpha"));
+		EXPECT_TRUE(RunFilter(compactionFilter, "beta"));
+	}
+
+	// endregion
 }}
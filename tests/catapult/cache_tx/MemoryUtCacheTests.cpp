@@ -506,6 +506,113 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region forEach (fee multiplier order)
+
+	namespace {
+		std::vector<model::TransactionInfo> CreateTransactionInfosWithFeeMultipliers(const std::vector<uint32_t>& feeMultipliers) {
+			auto i = 0u;
+			auto transactionInfos = test::CreateTransactionInfos(feeMultipliers.size());
+			for (auto& transactionInfo : transactionInfos) {
+				const_cast<Amount&>(transactionInfo.pEntity->MaxFee) = Amount(transactionInfo.pEntity->Size * feeMultipliers[i]);
+				++i;
+			}
+
+			return transactionInfos;
+		}
+
+		std::vector<Timestamp::ValueType> ExtractRawDeadlines(
+				const MemoryUtCache& cache,
+				FeeMultiplierOrder order,
+				size_t numRequested = std::numeric_limits<size_t>::max()) {
+			std::vector<Timestamp::ValueType> rawDeadlines;
+			cache.view().forEach(order, [numRequested, &rawDeadlines](const auto& info) {
+				rawDeadlines.push_back(info.pEntity->Deadline.unwrap());
+				return numRequested != rawDeadlines.size();
+			});
+
+			return rawDeadlines;
+		}
+
+		void SeedCacheWithFeeMultipliers(MemoryUtCache& cache) {
+			// (deadline, multiplier) { (1, 3), (2, 1), (3, 3), (4, 2), (5, 1), (6, 3) }
+			test::AddAll(cache, CreateTransactionInfosWithFeeMultipliers({ 3, 1, 3, 2, 1, 3 }));
+		}
+	}
+
+	TEST(TEST_CLASS, ForEachByFeeMultiplierForwardsNoTransactionInfosWhenCacheIsEmpty) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+
+		// Act + Assert:
+		EXPECT_TRUE(ExtractRawDeadlines(cache, FeeMultiplierOrder::Ascending).empty());
+		EXPECT_TRUE(ExtractRawDeadlines(cache, FeeMultiplierOrder::Descending).empty());
+	}
+
+	TEST(TEST_CLASS, ForEachByFeeMultiplierCanForwardTransactionsInAscendingOrder) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		SeedCacheWithFeeMultipliers(cache);
+
+		// Act:
+		auto rawDeadlines = ExtractRawDeadlines(cache, FeeMultiplierOrder::Ascending);
+
+		// Assert: transactions with equal multipliers are ordered from oldest to newest
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 2, 5, 4, 1, 3, 6 }), rawDeadlines);
+	}
+
+	TEST(TEST_CLASS, ForEachByFeeMultiplierCanForwardTransactionsInDescendingOrder) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		SeedCacheWithFeeMultipliers(cache);
+
+		// Act:
+		auto rawDeadlines = ExtractRawDeadlines(cache, FeeMultiplierOrder::Descending);
+
+		// Assert: transactions with equal multipliers are ordered from oldest to newest
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 1, 3, 6, 4, 2, 5 }), rawDeadlines);
+	}
+
+	TEST(TEST_CLASS, ForEachByFeeMultiplierForwardsSubsetOfTransactionsWhenShortCircuited) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		SeedCacheWithFeeMultipliers(cache);
+
+		// Act + Assert:
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 2, 5, 4 }), ExtractRawDeadlines(cache, FeeMultiplierOrder::Ascending, 3));
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 1, 3, 6, 4 }), ExtractRawDeadlines(cache, FeeMultiplierOrder::Descending, 4));
+	}
+
+	TEST(TEST_CLASS, ForEachByFeeMultiplierReflectsRemovedAndAddedTransactions) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = CreateTransactionInfosWithFeeMultipliers({ 3, 1, 3, 2, 1, 3 });
+		test::AddAll(cache, transactionInfos);
+
+		// Act: remove (3, 3) and (5, 1) and re-add (3, 3)
+		cache.modifier().remove(transactionInfos[2].EntityHash);
+		cache.modifier().remove(transactionInfos[4].EntityHash);
+		cache.modifier().add(transactionInfos[2]);
+
+		// Assert: re-added transaction is the newest one
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 2, 4, 1, 6, 3 }), ExtractRawDeadlines(cache, FeeMultiplierOrder::Ascending));
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 1, 6, 3, 4, 2 }), ExtractRawDeadlines(cache, FeeMultiplierOrder::Descending));
+	}
+
+	TEST(TEST_CLASS, ForEachByFeeMultiplierForwardsNoTransactionInfosAfterRemoveAll) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		SeedCacheWithFeeMultipliers(cache);
+
+		// Act:
+		cache.modifier().removeAll();
+
+		// Assert:
+		EXPECT_TRUE(ExtractRawDeadlines(cache, FeeMultiplierOrder::Ascending).empty());
+		EXPECT_TRUE(ExtractRawDeadlines(cache, FeeMultiplierOrder::Descending).empty());
+	}
+
+	// endregion
+
 	// region shortHashes
 
 	TEST(TEST_CLASS, ShortHashesReturnsShortHashesForAllTransactions) {
@@ -231,5 +231,94 @@ namespace catapult { namespace cache {
 			test::AssertEqual(*allTransactionInfos[9 - i * 2], *transactionInfos[i], "transaction at " + std::to_string(i));
 	}
 
+	// endregion
+	// region FeeMultiplierOrdered
+
+	namespace {
+		std::unique_ptr<MemoryUtCache> CreateMemoryUtCacheWithFeeMultipliers(const std::vector<uint32_t>& feeMultipliers) {
+			// deadline of each transaction is one more than its index
+			auto transactionInfos = test::CreateTransactionInfos(feeMultipliers.size());
+			for (auto i = 0u; i < feeMultipliers.size(); ++i) {
+				auto& transaction = const_cast<model::Transaction&>(*transactionInfos[i].pEntity);
+				transaction.MaxFee = Amount(transaction.Size * feeMultipliers[i]);
+			}
+
+			auto pUtCache = std::make_unique<MemoryUtCache>(MemoryCacheOptions(1000, 1000));
+			test::AddAll(*pUtCache, transactionInfos);
+			return pUtCache;
+		}
+
+		std::vector<Timestamp::ValueType> ExtractRawDeadlines(const std::vector<const model::TransactionInfo*>& transactionInfos) {
+			std::vector<Timestamp::ValueType> rawDeadlines;
+			for (const auto* pTransactionInfo : transactionInfos)
+				rawDeadlines.push_back(pTransactionInfo->pEntity->Deadline.unwrap());
+
+			return rawDeadlines;
+		}
+
+		bool SelectEvenDeadlineFilter(const model::TransactionInfo& transactionInfo) {
+			return 0 == transactionInfo.pEntity->Deadline.unwrap() % 2;
+		}
+
+		void AssertFeeMultiplierOrdering(
+				uint32_t count,
+				const EmbeddedCountRetriever& countRetriever,
+				FeeMultiplierOrder order,
+				const predicate<const model::TransactionInfo&>& filter,
+				const std::vector<Timestamp::ValueType>& expectedRawDeadlines) {
+			// Arrange: (deadline, multiplier) { (1, 3), (2, 1), (3, 3), (4, 2), (5, 1), (6, 3), (7, 2), (8, 2) }
+			auto pUtCache = CreateMemoryUtCacheWithFeeMultipliers({ 3, 1, 3, 2, 1, 3, 2, 2 });
+			auto utCacheView = pUtCache->view();
+
+			// Act:
+			auto transactionInfos = GetFirstTransactionInfoPointers(utCacheView, count, countRetriever, order, filter);
+
+			// Assert:
+			EXPECT_EQ(expectedRawDeadlines, ExtractRawDeadlines(transactionInfos));
+		}
+	}
+
+	TEST(TEST_CLASS, GetFirstTransactionInfoPointersReturnsNoTransactionInfosWhenCacheIsEmpty_FeeMultiplierOrdered) {
+		// Arrange:
+		auto pUtCache = CreateMemoryUtCacheWithFeeMultipliers({});
+		auto utCacheView = pUtCache->view();
+
+		// Act:
+		auto transactionInfos = GetFirstTransactionInfoPointers(
+				utCacheView,
+				3,
+				CountAsOne,
+				FeeMultiplierOrder::Descending,
+				SelectAllFilter);
+
+		// Assert:
+		EXPECT_TRUE(transactionInfos.empty());
+	}
+
+	TEST(TEST_CLASS, GetFirstTransactionInfoPointersReturnsNoTransactionInfosWhenZeroAreRequested_FeeMultiplierOrdered) {
+		AssertFeeMultiplierOrdering(0, CountAsOne, FeeMultiplierOrder::Descending, SelectAllFilter, {});
+	}
+
+	TEST(TEST_CLASS, GetFirstTransactionInfoPointersAppliesAscendingOrdering_FeeMultiplierOrdered) {
+		AssertFeeMultiplierOrdering(4, CountAsOne, FeeMultiplierOrder::Ascending, SelectAllFilter, { 2, 5, 4, 7 });
+		AssertFeeMultiplierOrdering(100, CountAsOne, FeeMultiplierOrder::Ascending, SelectAllFilter, { 2, 5, 4, 7, 8, 1, 3, 6 });
+	}
+
+	TEST(TEST_CLASS, GetFirstTransactionInfoPointersAppliesDescendingOrdering_FeeMultiplierOrdered) {
+		AssertFeeMultiplierOrdering(4, CountAsOne, FeeMultiplierOrder::Descending, SelectAllFilter, { 1, 3, 6, 4 });
+		AssertFeeMultiplierOrdering(100, CountAsOne, FeeMultiplierOrder::Descending, SelectAllFilter, { 1, 3, 6, 4, 7, 8, 2, 5 });
+	}
+
+	TEST(TEST_CLASS, GetFirstTransactionInfoPointersAppliesFiltering_FeeMultiplierOrdered) {
+		// Assert: (6, 4, 8) should be returned; if count was applied first, wrong (6) would be returned
+		AssertFeeMultiplierOrdering(3, CountAsOne, FeeMultiplierOrder::Descending, SelectEvenDeadlineFilter, { 6, 4, 8 });
+	}
+
+	TEST(TEST_CLASS, GetFirstTransactionInfoPointersAppliesCountAgainstTotalTransactions_FeeMultiplierOrdered) {
+		// Arrange: total counts in descending order = { 5 3 2 2 } 3 4 4 1
+		AssertFeeMultiplierOrdering(12, CountAbsFromFive, FeeMultiplierOrder::Descending, SelectAllFilter, { 1, 3, 6, 4 });
+		AssertFeeMultiplierOrdering(14, CountAbsFromFive, FeeMultiplierOrder::Descending, SelectAllFilter, { 1, 3, 6, 4 });
+	}
+
 	// endregion
 }}
@@ -20,7 +20,9 @@
 **/
 
 #include "catapult/chain/BatchEntityProcessor.h"
+#include "catapult/thread/IoThreadPool.h"
 #include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/other/MockExecutionConfiguration.h"
 #include "tests/TestHarness.h"
 
@@ -269,4 +271,341 @@ namespace catapult { namespace chain {
 		context.assertContexts(Height(248), Timestamp(725));
 		context.assertEntityInfos(entityInfos);
 	}
+
+	// region parallel - test utils
+
+	namespace {
+		constexpr auto Num_Accounts = 6u;
+		constexpr auto Initial_Balance = 1000u;
+		constexpr MosaicId Test_Mosaic_Id(1234);
+		constexpr auto Unknown_Notification_Type = model::MakeNotificationType(
+				model::NotificationChannel::All,
+				static_cast<model::FacilityCode>(0),
+				0x7FFF);
+
+		// transfer descriptors are encoded in the (fake) entity hashes
+		struct TransferDescriptor {
+			uint8_t SenderIndex;
+			uint8_t RecipientIndex;
+			uint32_t Amount;
+			bool HasUnknownNotification;
+		};
+
+		Address ToAddress(uint8_t index) {
+			Address address{};
+			address[0] = static_cast<uint8_t>(index + 1);
+			return address;
+		}
+
+		Hash256 ToHash(const TransferDescriptor& descriptor) {
+			Hash256 hash{};
+			hash[0] = descriptor.SenderIndex;
+			hash[1] = descriptor.RecipientIndex;
+			std::memcpy(&hash[2], &descriptor.Amount, sizeof(uint32_t));
+			hash[6] = descriptor.HasUnknownNotification ? 1 : 0;
+			return hash;
+		}
+
+		TransferDescriptor FromHash(const Hash256& hash) {
+			TransferDescriptor descriptor;
+			descriptor.SenderIndex = hash[0];
+			descriptor.RecipientIndex = hash[1];
+			std::memcpy(&descriptor.Amount, &hash[2], sizeof(uint32_t));
+			descriptor.HasUnknownNotification = 1 == hash[6];
+			return descriptor;
+		}
+
+		class TransferNotificationPublisher : public model::NotificationPublisher {
+		public:
+			void publish(const model::WeakEntityInfo& entityInfo, model::NotificationSubscriber& subscriber) const override {
+				auto descriptor = FromHash(entityInfo.hash());
+				auto sender = ToAddress(descriptor.SenderIndex);
+				auto recipient = ToAddress(descriptor.RecipientIndex);
+				auto unresolvedRecipient = recipient.copyTo<UnresolvedAddress>();
+				auto unresolvedMosaicId = UnresolvedMosaicId(Test_Mosaic_Id.unwrap());
+
+				subscriber.notify(model::AccountAddressNotification(unresolvedRecipient));
+				if (descriptor.HasUnknownNotification)
+					subscriber.notify(test::CreateNotification(Unknown_Notification_Type));
+
+				subscriber.notify(model::BalanceTransferNotification(sender, unresolvedRecipient, unresolvedMosaicId, Amount(descriptor.Amount)));
+			}
+		};
+
+		class BalanceCheckingValidator : public validators::stateful::AggregateNotificationValidator {
+		public:
+			BalanceCheckingValidator() : m_name("BalanceCheckingValidator"), m_numTransferValidations(0)
+			{}
+
+		public:
+			size_t numTransferValidations() const {
+				return m_numTransferValidations;
+			}
+
+		public:
+			const std::string& name() const override {
+				return m_name;
+			}
+
+			std::vector<std::string> names() const override {
+				return { name() };
+			}
+
+			ValidationResult validate(const model::Notification& notification, const ValidatorContext& context) const override {
+				if (model::BalanceTransferNotification::Notification_Type != notification.Type)
+					return ValidationResult::Success;
+
+				++m_numTransferValidations;
+				const auto& transferNotification = static_cast<const model::BalanceTransferNotification&>(notification);
+				auto accountStateIter = context.Cache.sub<cache::AccountStateCache>().find(transferNotification.Sender);
+				const auto* pAccountState = accountStateIter.tryGet();
+				auto balance = pAccountState ? pAccountState->Balances.get(Test_Mosaic_Id) : Amount();
+				return balance < transferNotification.Amount ? ValidationResult::Failure : ValidationResult::Success;
+			}
+
+		private:
+			std::string m_name;
+			mutable std::atomic<size_t> m_numTransferValidations;
+		};
+
+		class BalanceTransferObserver : public observers::AggregateNotificationObserver {
+		public:
+			BalanceTransferObserver() : m_name("BalanceTransferObserver")
+			{}
+
+		public:
+			const std::vector<std::string>& events() const {
+				return m_events;
+			}
+
+		public:
+			const std::string& name() const override {
+				return m_name;
+			}
+
+			std::vector<std::string> names() const override {
+				return { name() };
+			}
+
+			void notify(const model::Notification& notification, observers::ObserverContext& context) const override {
+				auto& accountStateCache = context.Cache.sub<cache::AccountStateCache>();
+				std::ostringstream out;
+				if (model::AccountAddressNotification::Notification_Type == notification.Type) {
+					auto address = static_cast<const model::AccountAddressNotification&>(notification).Address.resolved(context.Resolvers);
+					out << "register " << address;
+					if (!accountStateCache.contains(address))
+						accountStateCache.addAccount(address, context.Height);
+				} else if (model::BalanceTransferNotification::Notification_Type == notification.Type) {
+					const auto& transferNotification = static_cast<const model::BalanceTransferNotification&>(notification);
+					auto recipient = context.Resolvers.resolve(transferNotification.Recipient);
+					out << "transfer " << transferNotification.Sender << " -> " << recipient << " " << transferNotification.Amount;
+					accountStateCache.find(transferNotification.Sender).get().Balances.debit(Test_Mosaic_Id, transferNotification.Amount);
+					accountStateCache.find(recipient).get().Balances.credit(Test_Mosaic_Id, transferNotification.Amount);
+				} else {
+					out << "other " << utils::to_underlying_type(notification.Type);
+				}
+
+				m_events.push_back(out.str());
+			}
+
+		private:
+			std::string m_name;
+			mutable std::vector<std::string> m_events;
+		};
+
+		struct ProcessingOutcome {
+			ValidationResult Result;
+			std::vector<std::string> Events;
+			std::vector<Amount> Balances;
+			size_t NumTransferValidations;
+		};
+
+		class ParallelProcessorTestContext {
+		public:
+			ParallelProcessorTestContext() : m_pPool(test::CreateStartedIoThreadPool(4))
+			{}
+
+		public:
+			ProcessingOutcome processSerial(const std::vector<TransferDescriptor>& descriptors) {
+				return process(descriptors, [](const auto& config, auto&) { return CreateBatchEntityProcessor(config); });
+			}
+
+			ProcessingOutcome processParallel(const std::vector<TransferDescriptor>& descriptors) {
+				return process(descriptors, CreateParallelBatchEntityProcessor);
+			}
+
+		private:
+			template<typename TProcessorFactory>
+			ProcessingOutcome process(const std::vector<TransferDescriptor>& descriptors, TProcessorFactory processorFactory) {
+				auto pValidator = std::make_shared<BalanceCheckingValidator>();
+				auto pObserver = std::make_shared<BalanceTransferObserver>();
+
+				ExecutionConfiguration config;
+				config.Network.Identifier = test::Mock_Execution_Configuration_Network_Identifier;
+				config.ResolverContextFactory = [](const auto&) { return model::ResolverContext(); };
+				config.pObserver = pObserver;
+				config.pValidator = pValidator;
+				config.pNotificationPublisher = std::make_shared<TransferNotificationPublisher>();
+				auto processor = processorFactory(config, *m_pPool);
+
+				// - use the hashes to describe the transfers (all entity infos can share a single entity)
+				std::vector<Hash256> hashes;
+				for (const auto& descriptor : descriptors)
+					hashes.push_back(ToHash(descriptor));
+
+				model::WeakEntityInfos entityInfos;
+				for (const auto& hash : hashes)
+					entityInfos.emplace_back(m_entity, hash);
+
+				// - seed the first half of the accounts with balances
+				auto cache = test::CreateEmptyCatapultCache();
+				auto delta = cache.createDelta();
+				auto& accountStateCache = delta.sub<cache::AccountStateCache>();
+				for (auto i = 0u; i < Num_Accounts / 2; ++i) {
+					accountStateCache.addAccount(ToAddress(static_cast<uint8_t>(i)), Height(1));
+					accountStateCache.find(ToAddress(static_cast<uint8_t>(i))).get().Balances.credit(Test_Mosaic_Id, Amount(Initial_Balance));
+				}
+
+				auto observerState = observers::ObserverState(delta);
+				ProcessingOutcome outcome;
+				outcome.Result = processor(Height(246), Timestamp(721), entityInfos, observerState);
+				outcome.Events = pObserver->events();
+				for (auto i = 0u; i < Num_Accounts; ++i) {
+					auto accountStateIter = accountStateCache.find(ToAddress(static_cast<uint8_t>(i)));
+					outcome.Balances.push_back(accountStateIter.tryGet() ? accountStateIter.get().Balances.get(Test_Mosaic_Id) : Amount());
+				}
+
+				outcome.NumTransferValidations = pValidator->numTransferValidations();
+				return outcome;
+			}
+
+		private:
+			std::unique_ptr<thread::IoThreadPool> m_pPool;
+			model::VerifiableEntity m_entity;
+		};
+
+		void AssertSameOutcome(const ProcessingOutcome& expected, const ProcessingOutcome& actual, const std::string& message = "") {
+			EXPECT_EQ(expected.Result, actual.Result) << message;
+			EXPECT_EQ(expected.Events, actual.Events) << message;
+			EXPECT_EQ(expected.Balances, actual.Balances) << message;
+		}
+	}
+
+	// endregion
+
+	// region parallel
+
+	TEST(TEST_CLASS, ParallelProcessorCanProcessZeroEntities) {
+		// Arrange:
+		ParallelProcessorTestContext context;
+
+		// Act:
+		auto outcome = context.processParallel({});
+
+		// Assert:
+		EXPECT_EQ(ValidationResult::Neutral, outcome.Result);
+		EXPECT_TRUE(outcome.Events.empty());
+		EXPECT_EQ(0u, outcome.NumTransferValidations);
+	}
+
+	TEST(TEST_CLASS, ParallelProcessorReusesSpeculativeResultsForIndependentTransfers) {
+		// Arrange:
+		ParallelProcessorTestContext context;
+		std::vector<TransferDescriptor> descriptors{
+			{ 0, 3, 100, false },
+			{ 1, 4, 200, false },
+			{ 2, 5, 300, false }
+		};
+
+		// Act:
+		auto serialOutcome = context.processSerial(descriptors);
+		auto parallelOutcome = context.processParallel(descriptors);
+
+		// Assert: each transfer is only validated once
+		EXPECT_EQ(ValidationResult::Success, parallelOutcome.Result);
+		AssertSameOutcome(serialOutcome, parallelOutcome);
+		EXPECT_EQ(3u, parallelOutcome.NumTransferValidations);
+	}
+
+	TEST(TEST_CLASS, ParallelProcessorRevalidatesTransfersDependentOnPreviousTransfers) {
+		// Arrange: second transfer spends a balance received in the first transfer
+		ParallelProcessorTestContext context;
+		std::vector<TransferDescriptor> descriptors{
+			{ 0, 3, 100, false },
+			{ 3, 4, 100, false },
+			{ 1, 5, 300, false }
+		};
+
+		// Act:
+		auto serialOutcome = context.processSerial(descriptors);
+		auto parallelOutcome = context.processParallel(descriptors);
+
+		// Assert: speculative failure of the second transfer is discarded
+		EXPECT_EQ(ValidationResult::Success, parallelOutcome.Result);
+		AssertSameOutcome(serialOutcome, parallelOutcome);
+		EXPECT_EQ(4u, parallelOutcome.NumTransferValidations);
+	}
+
+	TEST(TEST_CLASS, ParallelProcessorRevalidatesTransfersInvalidatedByPreviousTransfers) {
+		// Arrange: second transfer overspends because of the first transfer
+		ParallelProcessorTestContext context;
+		std::vector<TransferDescriptor> descriptors{
+			{ 0, 3, Initial_Balance - 100, false },
+			{ 0, 4, 200, false },
+			{ 1, 5, 300, false }
+		};
+
+		// Act:
+		auto serialOutcome = context.processSerial(descriptors);
+		auto parallelOutcome = context.processParallel(descriptors);
+
+		// Assert: speculative success of the second transfer is discarded
+		EXPECT_EQ(ValidationResult::Failure, parallelOutcome.Result);
+		AssertSameOutcome(serialOutcome, parallelOutcome);
+	}
+
+	TEST(TEST_CLASS, ParallelProcessorValidatesSeriallyAfterUnknownNotification) {
+		// Arrange:
+		ParallelProcessorTestContext context;
+		std::vector<TransferDescriptor> descriptors{
+			{ 0, 3, 100, false },
+			{ 1, 4, 200, true },
+			{ 2, 5, 300, false }
+		};
+
+		// Act:
+		auto serialOutcome = context.processSerial(descriptors);
+		auto parallelOutcome = context.processParallel(descriptors);
+
+		// Assert: transfers following (and including) the unknown notification are revalidated
+		EXPECT_EQ(ValidationResult::Success, parallelOutcome.Result);
+		AssertSameOutcome(serialOutcome, parallelOutcome);
+		EXPECT_EQ(3u + 2, parallelOutcome.NumTransferValidations);
+	}
+
+	TEST(TEST_CLASS, ParallelProcessorIsDeterministicForRandomTransfers) {
+		// Arrange:
+		ParallelProcessorTestContext context;
+		for (auto round = 0u; round < 50; ++round) {
+			std::vector<TransferDescriptor> descriptors;
+			auto numTransfers = 1u + test::RandomByte() % 20;
+			for (auto i = 0u; i < numTransfers; ++i) {
+				descriptors.push_back({
+					static_cast<uint8_t>(test::RandomByte() % Num_Accounts),
+					static_cast<uint8_t>(test::RandomByte() % Num_Accounts),
+					static_cast<uint32_t>(1 + test::Random() % (Initial_Balance / 2)),
+					0 == test::RandomByte() % 10
+				});
+			}
+
+			// Act:
+			auto serialOutcome = context.processSerial(descriptors);
+			auto parallelOutcome = context.processParallel(descriptors);
+
+			// Assert:
+			AssertSameOutcome(serialOutcome, parallelOutcome, "round " + std::to_string(round));
+		}
+	}
+
+	// endregion
 }}
@@ -0,0 +1,465 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/chain/NotificationKeyAccess.h"
+#include "catapult/cache/CatapultCache.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/model/Address.h"
+#include "tests/test/cache/CacheTestUtils.h"
+#include "tests/test/core/AddressTestUtils.h"
+#include "tests/test/core/NotificationTestUtils.h"
+#include "tests/test/core/ResolverTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace chain {
+
+#define TEST_CLASS NotificationKeyAccessTests
+
+	namespace {
+		constexpr auto Network_Identifier = model::NetworkIdentifier::Private_Test;
+		constexpr auto Transfer_Transaction_Type = model::MakeEntityType(
+				model::BasicEntityType::Transaction,
+				model::FacilityCode::Transfer,
+				1);
+		constexpr auto Aggregate_Transaction_Type = model::MakeEntityType(
+				model::BasicEntityType::Transaction,
+				model::FacilityCode::Aggregate,
+				1);
+
+		class TestContext {
+		public:
+			TestContext() : m_cache(test::CreateEmptyCatapultCache())
+			{}
+
+		public:
+			void addAccount(const Address& address) {
+				auto delta = m_cache.createDelta();
+				delta.sub<cache::AccountStateCache>().addAccount(address, Height(1));
+				m_cache.commit(Height(1));
+			}
+
+			void addAccount(const Key& publicKey) {
+				auto delta = m_cache.createDelta();
+				delta.sub<cache::AccountStateCache>().addAccount(publicKey, Height(1));
+				m_cache.commit(Height(1));
+			}
+
+		public:
+			NotificationKeyAccess collect(const model::Notification& notification) const {
+				return collect(notification, test::CreateResolverContextXor());
+			}
+
+			NotificationKeyAccess collect(const model::Notification& notification, const model::ResolverContext& resolvers) const {
+				auto view = m_cache.createView();
+				auto readOnlyCache = view.toReadOnly();
+				model::NetworkInfo network;
+				network.Identifier = Network_Identifier;
+				auto context = validators::ValidatorContext(
+						model::NotificationContext(Height(123), resolvers),
+						Timestamp(0),
+						network,
+						readOnlyCache);
+				return CollectNotificationKeyAccess(notification, context);
+			}
+
+			bool conflicts(const model::Notification& first, const model::Notification& second) const {
+				ModifiedStateKeys modifiedKeys;
+				modifiedKeys.add(collect(first));
+				return modifiedKeys.conflicts(collect(second));
+			}
+
+		private:
+			cache::CatapultCache m_cache;
+		};
+
+		model::BalanceTransferNotification CreateTransfer(const Address& sender, const Address& recipient, MosaicId mosaicId) {
+			return model::BalanceTransferNotification(sender, test::UnresolveXor(recipient), test::UnresolveXor(mosaicId), Amount(100));
+		}
+
+		model::BalanceDebitNotification CreateDebit(const Address& sender, MosaicId mosaicId) {
+			return model::BalanceDebitNotification(sender, test::UnresolveXor(mosaicId), Amount(100));
+		}
+
+		void AssertGlobal(const NotificationKeyAccess& keyAccess) {
+			EXPECT_TRUE(keyAccess.IsGlobal);
+			EXPECT_TRUE(keyAccess.ReadKeys.empty());
+			EXPECT_TRUE(keyAccess.WriteKeys.empty());
+		}
+
+		void AssertEmpty(const NotificationKeyAccess& keyAccess) {
+			EXPECT_FALSE(keyAccess.IsGlobal);
+			EXPECT_TRUE(keyAccess.ReadKeys.empty());
+			EXPECT_TRUE(keyAccess.WriteKeys.empty());
+		}
+	}
+
+	// region CollectNotificationKeyAccess - global / empty
+
+	TEST(TEST_CLASS, UnknownNotificationIsGlobal) {
+		// Arrange:
+		TestContext context;
+		auto notification = test::CreateNotification(static_cast<model::NotificationType>(0x1234'5678));
+
+		// Act:
+		auto keyAccess = context.collect(notification);
+
+		// Assert:
+		AssertGlobal(keyAccess);
+	}
+
+	TEST(TEST_CLASS, AggregateTransactionNotificationIsGlobal) {
+		// Arrange:
+		TestContext context;
+		auto hash = test::GenerateRandomByteArray<Hash256>();
+		auto notification = model::TransactionNotification(test::GenerateRandomAddress(), hash, Aggregate_Transaction_Type, Timestamp());
+
+		// Act:
+		auto keyAccess = context.collect(notification);
+
+		// Assert:
+		AssertGlobal(keyAccess);
+	}
+
+	TEST(TEST_CLASS, NotificationWithUnresolvableDataIsGlobal) {
+		// Arrange:
+		TestContext context;
+		auto notification = CreateTransfer(test::GenerateRandomAddress(), test::GenerateRandomAddress(), MosaicId(111));
+		auto resolvers = model::ResolverContext(
+				[](const auto&) -> MosaicId { CATAPULT_THROW_RUNTIME_ERROR("mosaic cannot be resolved"); },
+				[](const auto& unresolved) { return model::ResolverContext().resolve(unresolved); });
+
+		// Act:
+		auto keyAccess = context.collect(notification, resolvers);
+
+		// Assert:
+		AssertGlobal(keyAccess);
+	}
+
+	TEST(TEST_CLASS, StatelessNotificationsHaveNoKeys) {
+		// Arrange:
+		TestContext context;
+
+		// Act + Assert:
+		AssertEmpty(context.collect(model::EntityNotification(Network_Identifier, 1, 1, 1)));
+		AssertEmpty(context.collect(model::TransactionDeadlineNotification(Timestamp(), utils::TimeSpan())));
+		AssertEmpty(context.collect(model::InternalPaddingNotification(0)));
+	}
+
+	// endregion
+
+	// region CollectNotificationKeyAccess - account
+
+	TEST(TEST_CLASS, AccountAddressNotificationWritesUnknownAccount) {
+		// Arrange:
+		TestContext context;
+		auto address = test::GenerateRandomAddress();
+
+		// Act + Assert:
+		EXPECT_TRUE(context.conflicts(
+				model::AccountAddressNotification(test::UnresolveXor(address)),
+				CreateTransfer(address, test::GenerateRandomAddress(), MosaicId(111))));
+	}
+
+	TEST(TEST_CLASS, AccountAddressNotificationDoesNotWriteKnownAccount) {
+		// Arrange:
+		TestContext context;
+		auto address = test::GenerateRandomAddress();
+		context.addAccount(address);
+
+		// Act:
+		auto keyAccess = context.collect(model::AccountAddressNotification(test::UnresolveXor(address)));
+
+		// Assert:
+		EXPECT_FALSE(keyAccess.IsGlobal);
+		EXPECT_EQ(1u, keyAccess.ReadKeys.size());
+		EXPECT_TRUE(keyAccess.WriteKeys.empty());
+	}
+
+	TEST(TEST_CLASS, AccountPublicKeyNotificationWritesAccountWithUnknownPublicKey) {
+		// Arrange: register account by address only
+		TestContext context;
+		auto publicKey = test::GenerateRandomByteArray<Key>();
+		auto address = model::PublicKeyToAddress(publicKey, Network_Identifier);
+		context.addAccount(address);
+
+		// Act + Assert:
+		EXPECT_TRUE(context.conflicts(
+				model::AccountPublicKeyNotification(publicKey),
+				CreateTransfer(address, test::GenerateRandomAddress(), MosaicId(111))));
+	}
+
+	TEST(TEST_CLASS, AccountPublicKeyNotificationDoesNotWriteAccountWithKnownPublicKey) {
+		// Arrange:
+		TestContext context;
+		auto publicKey = test::GenerateRandomByteArray<Key>();
+		context.addAccount(publicKey);
+
+		// Act:
+		auto keyAccess = context.collect(model::AccountPublicKeyNotification(publicKey));
+
+		// Assert:
+		EXPECT_FALSE(keyAccess.IsGlobal);
+		EXPECT_EQ(1u, keyAccess.ReadKeys.size());
+		EXPECT_TRUE(keyAccess.WriteKeys.empty());
+	}
+
+	// endregion
+
+	// region CollectNotificationKeyAccess - balance
+
+	TEST(TEST_CLASS, BalanceTransfersFromSameSenderConflict) {
+		// Arrange:
+		TestContext context;
+		auto sender = test::GenerateRandomAddress();
+
+		// Act + Assert:
+		EXPECT_TRUE(context.conflicts(
+				CreateTransfer(sender, test::GenerateRandomAddress(), MosaicId(111)),
+				CreateTransfer(sender, test::GenerateRandomAddress(), MosaicId(111))));
+	}
+
+	TEST(TEST_CLASS, BalanceTransferConflictsWithSubsequentTransferFromRecipient) {
+		// Arrange:
+		TestContext context;
+		auto recipient = test::GenerateRandomAddress();
+
+		// Act + Assert:
+		EXPECT_TRUE(context.conflicts(
+				CreateTransfer(test::GenerateRandomAddress(), recipient, MosaicId(111)),
+				CreateTransfer(recipient, test::GenerateRandomAddress(), MosaicId(111))));
+	}
+
+	TEST(TEST_CLASS, BalanceTransfersToSameRecipientConflict) {
+		// Arrange: recipient balances are read (e.g. by max mosaics validator)
+		TestContext context;
+		auto recipient = test::GenerateRandomAddress();
+
+		// Act + Assert:
+		EXPECT_TRUE(context.conflicts(
+				CreateTransfer(test::GenerateRandomAddress(), recipient, MosaicId(111)),
+				CreateTransfer(test::GenerateRandomAddress(), recipient, MosaicId(222))));
+	}
+
+	TEST(TEST_CLASS, BalanceTransfersOfDifferentMosaicsFromSameSenderDoNotConflict) {
+		// Arrange:
+		TestContext context;
+		auto sender = test::GenerateRandomAddress();
+
+		// Act + Assert:
+		EXPECT_FALSE(context.conflicts(
+				CreateTransfer(sender, test::GenerateRandomAddress(), MosaicId(111)),
+				CreateTransfer(sender, test::GenerateRandomAddress(), MosaicId(222))));
+	}
+
+	TEST(TEST_CLASS, BalanceTransfersBetweenDisjointAccountsDoNotConflict) {
+		// Arrange:
+		TestContext context;
+
+		// Act + Assert:
+		EXPECT_FALSE(context.conflicts(
+				CreateTransfer(test::GenerateRandomAddress(), test::GenerateRandomAddress(), MosaicId(111)),
+				CreateTransfer(test::GenerateRandomAddress(), test::GenerateRandomAddress(), MosaicId(111))));
+	}
+
+	TEST(TEST_CLASS, BalanceDebitConflictsWithSubsequentDebitOfSameBalance) {
+		// Arrange:
+		TestContext context;
+		auto sender = test::GenerateRandomAddress();
+
+		// Act + Assert:
+		EXPECT_TRUE(context.conflicts(CreateDebit(sender, MosaicId(111)), CreateDebit(sender, MosaicId(111))));
+		EXPECT_FALSE(context.conflicts(CreateDebit(sender, MosaicId(111)), CreateDebit(sender, MosaicId(222))));
+		EXPECT_FALSE(context.conflicts(CreateDebit(sender, MosaicId(111)), CreateDebit(test::GenerateRandomAddress(), MosaicId(111))));
+	}
+
+	// endregion
+
+	// region CollectNotificationKeyAccess - transaction
+
+	TEST(TEST_CLASS, TransactionNotificationsWithSameHashConflict) {
+		// Arrange:
+		TestContext context;
+		auto hash1 = test::GenerateRandomByteArray<Hash256>();
+		auto hash2 = test::GenerateRandomByteArray<Hash256>();
+		auto sender = test::GenerateRandomAddress();
+
+		// Act + Assert:
+		EXPECT_TRUE(context.conflicts(
+				model::TransactionNotification(sender, hash1, Transfer_Transaction_Type, Timestamp()),
+				model::TransactionNotification(sender, hash1, Transfer_Transaction_Type, Timestamp())));
+		EXPECT_FALSE(context.conflicts(
+				model::TransactionNotification(sender, hash1, Transfer_Transaction_Type, Timestamp()),
+				model::TransactionNotification(sender, hash2, Transfer_Transaction_Type, Timestamp())));
+	}
+
+	TEST(TEST_CLASS, TransactionFeeNotificationDoesNotConflictWithBalanceTransfer) {
+		// Arrange: activity is written but not read by balance validators
+		TestContext context;
+		auto sender = test::GenerateRandomAddress();
+
+		// Act + Assert:
+		EXPECT_FALSE(context.conflicts(
+				model::TransactionFeeNotification(sender, 100, Amount(10), Amount(20)),
+				CreateTransfer(sender, test::GenerateRandomAddress(), MosaicId(111))));
+	}
+
+	TEST(TEST_CLASS, AddressInteractionNotificationReadsParticipantAccounts) {
+		// Arrange:
+		TestContext context;
+		auto participant = test::GenerateRandomAddress();
+		auto interactionNotification = model::AddressInteractionNotification(
+				test::GenerateRandomAddress(),
+				Transfer_Transaction_Type,
+				{ test::UnresolveXor(participant) });
+
+		// Act + Assert:
+		EXPECT_TRUE(context.conflicts(model::AccountAddressNotification(test::UnresolveXor(participant)), interactionNotification));
+		EXPECT_FALSE(context.conflicts(interactionNotification, model::AccountAddressNotification(test::UnresolveXor(participant))));
+	}
+
+	// endregion
+
+	// region IsClassifiedNotificationType
+
+	TEST(TEST_CLASS, KeyedCoreNotificationTypesAreClassified) {
+		// Arrange:
+		using namespace model;
+		auto notificationTypes = std::vector<NotificationType>{
+			Core_Register_Account_Address_Notification,
+			Core_Register_Account_Public_Key_Notification,
+			Core_Balance_Transfer_Notification,
+			Core_Entity_Notification,
+			Core_Transaction_Notification,
+			Core_Signature_Notification,
+			Core_Balance_Debit_Notification,
+			Core_Address_Interaction_Notification,
+			Core_Mosaic_Required_Notification,
+			Core_Source_Change_Notification,
+			Core_Transaction_Fee_Notification,
+			Core_Transaction_Deadline_Notification,
+			Core_Internal_Padding_Notification
+		};
+
+		// Act + Assert:
+		for (auto notificationType : notificationTypes)
+			EXPECT_TRUE(IsClassifiedNotificationType(notificationType)) << utils::to_underlying_type(notificationType);
+	}
+
+	TEST(TEST_CLASS, GlobalCoreNotificationTypesAreNotClassified) {
+		// Arrange: these notifications modify state that is not keyed (e.g. harvester and importance state)
+		using namespace model;
+		auto notificationTypes = std::vector<NotificationType>{
+			Core_Block_Notification,
+			Core_Voting_Key_Link_Notification,
+			Core_Vrf_Key_Link_Notification,
+			Core_Key_Link_Action_Notification,
+			Core_Block_Importance_Notification,
+			Core_Block_Type_Notification
+		};
+
+		// Act + Assert:
+		for (auto notificationType : notificationTypes)
+			EXPECT_FALSE(IsClassifiedNotificationType(notificationType)) << utils::to_underlying_type(notificationType);
+	}
+
+	TEST(TEST_CLASS, PluginNotificationTypesAreNotClassified) {
+		// Arrange:
+		auto notificationTypes = std::vector<model::NotificationType>{
+			model::MakeNotificationType(model::NotificationChannel::All, model::FacilityCode::Transfer, 1),
+			model::MakeNotificationType(model::NotificationChannel::Validator, model::FacilityCode::Mosaic, 1),
+			static_cast<model::NotificationType>(0x1234'5678)
+		};
+
+		// Act + Assert:
+		for (auto notificationType : notificationTypes)
+			EXPECT_FALSE(IsClassifiedNotificationType(notificationType)) << utils::to_underlying_type(notificationType);
+	}
+
+	// endregion
+
+	// region ModifiedStateKeys
+
+	TEST(TEST_CLASS, ModifiedStateKeysInitiallyHasNoConflicts) {
+		// Arrange:
+		ModifiedStateKeys modifiedKeys;
+		NotificationKeyAccess keyAccess;
+		keyAccess.ReadKeys = { 1, 2, 3 };
+
+		// Act + Assert:
+		EXPECT_FALSE(modifiedKeys.isGlobal());
+		EXPECT_FALSE(modifiedKeys.conflicts(keyAccess));
+		EXPECT_FALSE(modifiedKeys.conflicts(NotificationKeyAccess()));
+	}
+
+	TEST(TEST_CLASS, ModifiedStateKeysConflictsWhenAnyReadKeyWasWritten) {
+		// Arrange:
+		ModifiedStateKeys modifiedKeys;
+		NotificationKeyAccess writeAccess;
+		writeAccess.ReadKeys = { 2 };
+		writeAccess.WriteKeys = { 4, 5 };
+		modifiedKeys.add(writeAccess);
+
+		NotificationKeyAccess keyAccess1;
+		keyAccess1.ReadKeys = { 1, 2, 3 };
+		NotificationKeyAccess keyAccess2;
+		keyAccess2.ReadKeys = { 3, 5 };
+
+		// Act + Assert: only written keys are tracked
+		EXPECT_FALSE(modifiedKeys.conflicts(keyAccess1));
+		EXPECT_TRUE(modifiedKeys.conflicts(keyAccess2));
+	}
+
+	TEST(TEST_CLASS, ModifiedStateKeysAlwaysConflictsWithGlobalKeyAccess) {
+		// Arrange:
+		ModifiedStateKeys modifiedKeys;
+		NotificationKeyAccess keyAccess;
+		keyAccess.IsGlobal = true;
+
+		// Act + Assert:
+		EXPECT_TRUE(modifiedKeys.conflicts(keyAccess));
+	}
+
+	TEST(TEST_CLASS, ModifiedStateKeysConflictsWithEverythingAfterGlobalWrite) {
+		// Arrange:
+		ModifiedStateKeys modifiedKeys;
+		NotificationKeyAccess globalAccess;
+		globalAccess.IsGlobal = true;
+		modifiedKeys.add(globalAccess);
+
+		// Act + Assert:
+		EXPECT_TRUE(modifiedKeys.isGlobal());
+		EXPECT_TRUE(modifiedKeys.conflicts(NotificationKeyAccess()));
+	}
+
+	TEST(TEST_CLASS, ModifiedStateKeysConflictsWithEverythingAfterMarkGlobal) {
+		// Arrange:
+		ModifiedStateKeys modifiedKeys;
+
+		// Act:
+		modifiedKeys.markGlobal();
+
+		// Assert:
+		EXPECT_TRUE(modifiedKeys.isGlobal());
+		EXPECT_TRUE(modifiedKeys.conflicts(NotificationKeyAccess()));
+	}
+
+	// endregion
+}}
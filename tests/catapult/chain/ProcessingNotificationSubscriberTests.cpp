@@ -329,6 +329,43 @@ namespace catapult { namespace chain {
 
 	// endregion
 
+	// region disableValidation
+
+	TEST(TEST_CLASS, NotificationsAreOnlyObservedWhenValidationIsDisabled) {
+		// Arrange:
+		TestContext context;
+		context.setValidationResult(ValidationResult::Failure);
+		context.sub().disableValidation();
+
+		// Act: process three notifications
+		context.sub().notify(test::CreateNotification(Notification_Type_Validator));
+		context.sub().notify(test::CreateNotification(Notification_Type_All));
+		context.sub().notify(test::CreateNotification(Notification_Type_Observer));
+
+		// Assert: validator was bypassed and all observable notifications were observed
+		EXPECT_EQ(ValidationResult::Success, context.sub().result());
+		context.assertValidatorCalls({});
+		context.assertObserverCalls({ Notification_Type_All, Notification_Type_Observer });
+	}
+
+	TEST(TEST_CLASS, CanDisableValidationAfterProcessingNotifications) {
+		// Arrange:
+		TestContext context;
+		context.sub().notify(test::CreateNotification(Notification_Type_All));
+
+		// Act:
+		context.setValidationResult(ValidationResult::Failure);
+		context.sub().disableValidation();
+		context.sub().notify(test::CreateNotification(Notification_Type_All_2));
+
+		// Assert: only the first notification was validated
+		EXPECT_EQ(ValidationResult::Success, context.sub().result());
+		context.assertValidatorCalls({ Notification_Type_All });
+		context.assertObserverCalls({ Notification_Type_All, Notification_Type_All_2 });
+	}
+
+	// endregion
+
 	// region undo
 
 	TEST(TEST_CLASS, CannotUndoWhenUndoIsNotEnabled) {
@@ -1064,4 +1064,195 @@ namespace catapult { namespace chain {
 	}
 
 	// endregion
+
+	// region update (block disruptor) - incremental
+
+	namespace {
+		UnresolvedAddress GenerateRandomNonAliasAddress() {
+			auto address = test::GenerateRandomByteArray<UnresolvedAddress>();
+			address[0] &= 0xFE;
+			return address;
+		}
+
+		UnresolvedAddress GenerateRandomAliasAddress() {
+			auto address = test::GenerateRandomByteArray<UnresolvedAddress>();
+			address[0] |= 0x01;
+			return address;
+		}
+
+		std::vector<UnresolvedAddress> GenerateRandomNonAliasAddresses(size_t count) {
+			std::vector<UnresolvedAddress> addresses;
+			for (auto i = 0u; i < count; ++i)
+				addresses.push_back(GenerateRandomNonAliasAddress());
+
+			return addresses;
+		}
+
+		void SetAddresses(TransactionData& data, size_t index, const model::UnresolvedAddressSet& addresses) {
+			data.UtInfos[index].OptionalExtractedAddresses = std::make_shared<model::UnresolvedAddressSet>(addresses);
+		}
+
+		model::AddressSet ToAddressSet(const std::vector<UnresolvedAddress>& unresolvedAddresses) {
+			model::AddressSet addresses;
+			for (const auto& unresolvedAddress : unresolvedAddresses)
+				addresses.insert(unresolvedAddress.copyTo<Address>());
+
+			return addresses;
+		}
+
+		void AssertStatistics(const UtUpdater& updater, uint64_t expectedNumRevalidated, uint64_t expectedNumSkipped) {
+			auto statistics = updater.statistics();
+			EXPECT_EQ(expectedNumRevalidated, statistics.NumRevalidated);
+			EXPECT_EQ(expectedNumSkipped, statistics.NumSkipped);
+		}
+
+		// transactions starting at 40 have deadlines after Default_Time and are not expired
+		constexpr size_t Unexpired_Start = 40;
+	}
+
+	TEST(TEST_CLASS, StatisticsAreInitiallyZero) {
+		// Arrange:
+		UpdaterTestContext context;
+
+		// Act + Assert:
+		AssertStatistics(context.updater(), 0, 0);
+	}
+
+	TEST(TEST_CLASS, FullUpdateRevalidatesAllExistingTransactions) {
+		// Arrange: initialize the UT cache with 4 transactions
+		UpdaterTestContext context;
+		auto originalTransactionData = CreateTransactionData(4, Unexpired_Start);
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+
+		// Act:
+		context.updater().update({}, {});
+
+		// Assert:
+		EXPECT_EQ(4u, context.transactionsCache().view().size());
+		context.assertEntityInfos(originalTransactionData.EntityInfos);
+		AssertStatistics(context.updater(), 4, 0);
+	}
+
+	TEST(TEST_CLASS, IncrementalUpdateOnlyRevalidatesExistingTransactionsWithAffectedAccounts) {
+		// Arrange: initialize the UT cache with 4 transactions with distinct accounts
+		UpdaterTestContext context;
+		auto addresses = GenerateRandomNonAliasAddresses(4);
+		auto originalTransactionData = CreateTransactionData(4, Unexpired_Start);
+		for (auto i = 0u; i < 4; ++i)
+			SetAddresses(originalTransactionData, i, { addresses[i] });
+
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+
+		// - set neutral results for an unaffected and an affected transaction
+		context.setValidationResult(ValidationResult::Neutral, originalTransactionData.Hashes[0], 1);
+		context.setValidationResult(ValidationResult::Neutral, originalTransactionData.Hashes[2], 1);
+
+		// Act:
+		context.updater().update({}, {}, ToAddressSet({ addresses[2], addresses[3] }));
+
+		// Assert: only affected transactions were revalidated (and the neutral one was dropped)
+		EXPECT_EQ(3u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), Select(originalTransactionData.Hashes, { 0, 1, 3 }));
+
+		//   E[0] O0,O1; E[1] O2,O3; E[2] V0; E[3] V1,O4,V2,O5
+		context.assertEntityInfos(originalTransactionData.EntityInfos, { 2, 3, 3 }, { 0, 0, 1, 1, 3, 3 });
+		AssertStatistics(context.updater(), 2, 2);
+	}
+
+	TEST(TEST_CLASS, IncrementalUpdateRevalidatesExistingTransactionsDependingOnRevalidatedTransactions) {
+		// Arrange: initialize the UT cache with 3 transactions where the first two share an account
+		UpdaterTestContext context;
+		auto addresses = GenerateRandomNonAliasAddresses(4);
+		auto originalTransactionData = CreateTransactionData(3, Unexpired_Start);
+		SetAddresses(originalTransactionData, 0, { addresses[0], addresses[1] });
+		SetAddresses(originalTransactionData, 1, { addresses[1], addresses[2] });
+		SetAddresses(originalTransactionData, 2, { addresses[3] });
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+
+		// Act:
+		context.updater().update({}, {}, ToAddressSet({ addresses[0] }));
+
+		// Assert: second transaction was revalidated because it depends on the (revalidated) first transaction
+		EXPECT_EQ(3u, context.transactionsCache().view().size());
+		context.assertEntityInfos(originalTransactionData.EntityInfos, { 0, 0, 1, 1 }, { 0, 0, 1, 1, 2, 2 });
+		AssertStatistics(context.updater(), 2, 1);
+	}
+
+	TEST(TEST_CLASS, IncrementalUpdateRevalidatesExistingTransactionsDependingOnRevertedTransactions) {
+		// Arrange: initialize the UT cache with 2 transactions
+		UpdaterTestContext context;
+		auto addresses = GenerateRandomNonAliasAddresses(2);
+		auto originalTransactionData = CreateTransactionData(2, Unexpired_Start + 1);
+		SetAddresses(originalTransactionData, 0, { addresses[0] });
+		SetAddresses(originalTransactionData, 1, { addresses[1] });
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+
+		// - prepare a reverted transaction that shares an account with the second transaction
+		auto transactionData = CreateTransactionData(1, Unexpired_Start);
+		SetAddresses(transactionData, 0, { addresses[1] });
+
+		// Act:
+		context.updater().update({}, transactionData.UtInfos, {});
+
+		// Assert: reverted transaction and dependent original transaction were validated
+		EXPECT_EQ(3u, context.transactionsCache().view().size());
+		context.assertEntityInfos(
+				ConcatContainers(transactionData.EntityInfos, originalTransactionData.EntityInfos),
+				{ 0, 0, 2, 2 },
+				{ 0, 0, 1, 1, 2, 2 });
+		AssertStatistics(context.updater(), 1, 1);
+	}
+
+	TEST(TEST_CLASS, IncrementalUpdateRevalidatesExistingTransactionsWithAliasAddresses) {
+		// Arrange: initialize the UT cache with 2 transactions
+		UpdaterTestContext context;
+		auto originalTransactionData = CreateTransactionData(2, Unexpired_Start);
+		SetAddresses(originalTransactionData, 0, { GenerateRandomNonAliasAddress() });
+		SetAddresses(originalTransactionData, 1, { GenerateRandomAliasAddress() });
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+
+		// Act:
+		context.updater().update({}, {}, {});
+
+		// Assert: transaction with alias was revalidated because the alias could resolve to any account
+		EXPECT_EQ(2u, context.transactionsCache().view().size());
+		context.assertEntityInfos(originalTransactionData.EntityInfos, { 1, 1 }, { 0, 0, 1, 1 });
+		AssertStatistics(context.updater(), 1, 1);
+	}
+
+	TEST(TEST_CLASS, IncrementalUpdateRevalidatesExpiredExistingTransactions) {
+		// Arrange: initialize the UT cache with 2 transactions, where only the second one is not expired
+		UpdaterTestContext context;
+		auto originalTransactionData = CreateTransactionData(2, Unexpired_Start);
+		SetAddresses(originalTransactionData, 0, { GenerateRandomNonAliasAddress() });
+		SetAddresses(originalTransactionData, 1, { GenerateRandomNonAliasAddress() });
+		const_cast<Timestamp&>(originalTransactionData.UtInfos[0].pEntity->Deadline) = Default_Time - Timestamp(1);
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+
+		// Act:
+		context.updater().update({}, {}, {});
+
+		// Assert: expired transaction was revalidated
+		EXPECT_EQ(2u, context.transactionsCache().view().size());
+		context.assertEntityInfos(originalTransactionData.EntityInfos, { 0, 0 }, { 0, 0, 1, 1 });
+		AssertStatistics(context.updater(), 1, 1);
+	}
+
+	TEST(TEST_CLASS, IncrementalUpdateCanSkipExistingTransactionsWithoutExtractedAddresses) {
+		// Arrange: initialize the UT cache with 3 transactions without extracted addresses
+		//          (mock notifications do not register any accounts, so none are dependent)
+		UpdaterTestContext context;
+		auto originalTransactionData = CreateTransactionData(3, Unexpired_Start);
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+
+		// Act:
+		context.updater().update({}, {}, ToAddressSet(GenerateRandomNonAliasAddresses(3)));
+
+		// Assert: all transactions were observed (via recorded notifications) but none were revalidated
+		EXPECT_EQ(3u, context.transactionsCache().view().size());
+		context.assertEntityInfos(originalTransactionData.EntityInfos, {}, { 0, 0, 1, 1, 2, 2 });
+		AssertStatistics(context.updater(), 0, 3);
+	}
+
+	// endregion
 }}
@@ -108,6 +108,8 @@ namespace catapult { namespace config {
 			EXPECT_FALSE(config.EnableSingleThreadPool);
 			EXPECT_TRUE(config.EnableCacheDatabaseStorage);
 			EXPECT_TRUE(config.EnableAutoSyncCleanup);
+			EXPECT_FALSE(config.EnableSegmentedBlockStorage);
+			EXPECT_FALSE(config.EnableParallelBlockValidation);
 
 			EXPECT_TRUE(config.EnableTransactionSpamThrottling);
 			EXPECT_EQ(Amount(10'000'000), config.TransactionSpamThrottlingMaxBoostFee);
@@ -126,11 +128,15 @@ namespace catapult { namespace config {
 			EXPECT_EQ(utils::FileSize::FromMegabytes(20), config.UnconfirmedTransactionsCacheMaxResponseSize);
 			EXPECT_EQ(1'000'000u, config.UnconfirmedTransactionsCacheMaxSize);
 
+			EXPECT_EQ(utils::FileSize::FromMegabytes(50), config.BlockStorageCacheMaxSize);
+			EXPECT_EQ(utils::FileSize::FromMegabytes(4), config.PublicKeyCacheMaxSize);
+
 			EXPECT_EQ(utils::TimeSpan::FromSeconds(10), config.ConnectTimeout);
 			EXPECT_EQ(utils::TimeSpan::FromSeconds(60), config.SyncTimeout);
 
 			EXPECT_EQ(utils::FileSize::FromKilobytes(512), config.SocketWorkingBufferSize);
 			EXPECT_EQ(100u, config.SocketWorkingBufferSensitivity);
+			EXPECT_EQ(utils::FileSize::FromKilobytes(16), config.SocketWriteCoalescingSize);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(150), config.MaxPacketDataSize);
 
 			EXPECT_EQ(4096u, config.BlockDisruptorSize);
@@ -158,6 +164,8 @@ namespace catapult { namespace config {
 			EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.CacheDatabase.MemtableMemoryBudget);
 
 			EXPECT_EQ(utils::FileSize::FromMegabytes(5), config.CacheDatabase.MaxWriteBatchSize);
+			EXPECT_EQ(utils::FileSize::FromMegabytes(16), config.CacheDatabase.PatriciaTreeNodeCacheSize);
+			EXPECT_EQ(40u, config.CacheDatabase.PatriciaTreeGarbageCollectionDelay);
 
 			EXPECT_EQ("", config.Local.Host);
 			EXPECT_EQ("", config.Local.FriendlyName);
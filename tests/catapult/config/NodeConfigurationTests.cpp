@@ -43,6 +43,8 @@ namespace catapult { namespace config {
 							{ "enableSingleThreadPool", "true" },
 							{ "enableCacheDatabaseStorage", "true" },
 							{ "enableAutoSyncCleanup", "true" },
+							{ "enableSegmentedBlockStorage", "true" },
+							{ "enableParallelBlockValidation", "true" },
 
 							{ "enableTransactionSpamThrottling", "true" },
 							{ "transactionSpamThrottlingMaxBoostFee", "54'123" },
@@ -61,11 +63,15 @@ namespace catapult { namespace config {
 							{ "unconfirmedTransactionsCacheMaxResponseSize", "234KB" },
 							{ "unconfirmedTransactionsCacheMaxSize", "98'763" },
 
+							{ "blockStorageCacheMaxSize", "3MB" },
+							{ "publicKeyCacheMaxSize", "2MB" },
+
 							{ "connectTimeout", "4m" },
 							{ "syncTimeout", "5m" },
 
 							{ "socketWorkingBufferSize", "128KB" },
 							{ "socketWorkingBufferSensitivity", "6225" },
+							{ "socketWriteCoalescingSize", "12KB" },
 							{ "maxPacketDataSize", "10MB" },
 
 							{ "blockDisruptorSize", "1000" },
@@ -96,7 +102,9 @@ namespace catapult { namespace config {
 							{ "blockCacheSize", "111MB" },
 							{ "memtableMemoryBudget", "45MB" },
 
-							{ "maxWriteBatchSize", "17KB" }
+							{ "maxWriteBatchSize", "17KB" },
+							{ "patriciaTreeNodeCacheSize", "23MB" },
+							{ "patriciaTreeGarbageCollectionDelay", "29" }
 						}
 					},
 					{
@@ -156,6 +164,8 @@ namespace catapult { namespace config {
 				EXPECT_FALSE(config.EnableSingleThreadPool);
 				EXPECT_FALSE(config.EnableCacheDatabaseStorage);
 				EXPECT_FALSE(config.EnableAutoSyncCleanup);
+				EXPECT_FALSE(config.EnableSegmentedBlockStorage);
+				EXPECT_FALSE(config.EnableParallelBlockValidation);
 
 				EXPECT_FALSE(config.EnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(), config.TransactionSpamThrottlingMaxBoostFee);
@@ -174,11 +184,15 @@ namespace catapult { namespace config {
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.UnconfirmedTransactionsCacheMaxResponseSize);
 				EXPECT_EQ(0u, config.UnconfirmedTransactionsCacheMaxSize);
 
+				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.BlockStorageCacheMaxSize);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.PublicKeyCacheMaxSize);
+
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ConnectTimeout);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.SyncTimeout);
 
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.SocketWorkingBufferSize);
 				EXPECT_EQ(0u, config.SocketWorkingBufferSensitivity);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.SocketWriteCoalescingSize);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxPacketDataSize);
 
 				EXPECT_EQ(0u, config.BlockDisruptorSize);
@@ -206,6 +220,8 @@ namespace catapult { namespace config {
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.CacheDatabase.MemtableMemoryBudget);
 
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.CacheDatabase.MaxWriteBatchSize);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.CacheDatabase.PatriciaTreeNodeCacheSize);
+				EXPECT_EQ(0u, config.CacheDatabase.PatriciaTreeGarbageCollectionDelay);
 
 				EXPECT_EQ("", config.Local.Host);
 				EXPECT_EQ("", config.Local.FriendlyName);
@@ -242,6 +258,8 @@ namespace catapult { namespace config {
 				EXPECT_TRUE(config.EnableSingleThreadPool);
 				EXPECT_TRUE(config.EnableCacheDatabaseStorage);
 				EXPECT_TRUE(config.EnableAutoSyncCleanup);
+				EXPECT_TRUE(config.EnableSegmentedBlockStorage);
+				EXPECT_TRUE(config.EnableParallelBlockValidation);
 
 				EXPECT_TRUE(config.EnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(54'123), config.TransactionSpamThrottlingMaxBoostFee);
@@ -260,11 +278,15 @@ namespace catapult { namespace config {
 				EXPECT_EQ(utils::FileSize::FromKilobytes(234), config.UnconfirmedTransactionsCacheMaxResponseSize);
 				EXPECT_EQ(98'763u, config.UnconfirmedTransactionsCacheMaxSize);
 
+				EXPECT_EQ(utils::FileSize::FromMegabytes(3), config.BlockStorageCacheMaxSize);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(2), config.PublicKeyCacheMaxSize);
+
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(4), config.ConnectTimeout);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(5), config.SyncTimeout);
 
 				EXPECT_EQ(utils::FileSize::FromKilobytes(128), config.SocketWorkingBufferSize);
 				EXPECT_EQ(6225u, config.SocketWorkingBufferSensitivity);
+				EXPECT_EQ(utils::FileSize::FromKilobytes(12), config.SocketWriteCoalescingSize);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(10), config.MaxPacketDataSize);
 
 				EXPECT_EQ(1000u, config.BlockDisruptorSize);
@@ -292,6 +314,8 @@ namespace catapult { namespace config {
 				EXPECT_EQ(utils::FileSize::FromMegabytes(45), config.CacheDatabase.MemtableMemoryBudget);
 
 				EXPECT_EQ(utils::FileSize::FromKilobytes(17), config.CacheDatabase.MaxWriteBatchSize);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(23), config.CacheDatabase.PatriciaTreeNodeCacheSize);
+				EXPECT_EQ(29u, config.CacheDatabase.PatriciaTreeGarbageCollectionDelay);
 
 				EXPECT_EQ("alice.com", config.Local.Host);
 				EXPECT_EQ("a GREAT node", config.Local.FriendlyName);
@@ -306,4 +306,42 @@ namespace catapult { namespace config {
 	}
 
 	// endregion
+
+	// region cache database patricia tree garbage collection delay validation
+
+	namespace {
+		auto CreateCatapultConfigurationWithGarbageCollectionDelay(uint32_t garbageCollectionDelay, uint32_t maxRollbackBlocks) {
+			auto mutableConfig = CreateMutableCatapultConfiguration();
+			mutableConfig.BlockChain.ImportanceGrouping = maxRollbackBlocks;
+			mutableConfig.BlockChain.MaxRollbackBlocks = maxRollbackBlocks;
+			mutableConfig.Node.CacheDatabase.PatriciaTreeGarbageCollectionDelay = garbageCollectionDelay;
+			return mutableConfig.ToConst();
+		}
+	}
+
+	TEST(TEST_CLASS, PatriciaTreeGarbageCollectionDelayMustBeUnsetOrAtLeastMaxRollbackBlocks) {
+		// Arrange:
+		auto assertNoThrow = [](uint32_t garbageCollectionDelay, uint32_t maxRollbackBlocks) {
+			auto config = CreateCatapultConfigurationWithGarbageCollectionDelay(garbageCollectionDelay, maxRollbackBlocks);
+			EXPECT_NO_THROW(ValidateConfiguration(config)) << "GCD " << garbageCollectionDelay << ", MRB " << maxRollbackBlocks;
+		};
+
+		auto assertThrow = [](uint32_t garbageCollectionDelay, uint32_t maxRollbackBlocks) {
+			auto config = CreateCatapultConfigurationWithGarbageCollectionDelay(garbageCollectionDelay, maxRollbackBlocks);
+			EXPECT_THROW(ValidateConfiguration(config), utils::property_malformed_error)
+					<< "GCD " << garbageCollectionDelay << ", MRB " << maxRollbackBlocks;
+		};
+
+		// Act + Assert:
+		// - no exceptions
+		assertNoThrow(0, 360); // unset
+		assertNoThrow(360, 360); // GCD == MRB
+		assertNoThrow(361, 360); // GCD > MRB
+
+		// - exceptions
+		assertThrow(1, 360);
+		assertThrow(359, 360); // GCD < MRB
+	}
+
+	// endregion
 }}
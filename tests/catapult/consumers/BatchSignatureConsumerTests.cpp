@@ -24,12 +24,14 @@
 #include "catapult/crypto/Signer.h"
 #include "catapult/model/NotificationSubscriber.h"
 #include "catapult/model/TransactionStatus.h"
+#include "catapult/utils/Hashers.h"
 #include "catapult/utils/RandomGenerator.h"
 #include "tests/catapult/consumers/test/ConsumerTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/nodeps/KeyTestUtils.h"
 #include "tests/TestHarness.h"
+#include <mutex>
 
 namespace catapult { namespace consumers {
 
@@ -101,9 +103,17 @@ namespace catapult { namespace consumers {
 				return m_entityInfos;
 			}
 
+		public:
+			void addUnverifiableEntity(const Hash256& entityHash) {
+				m_unverifiableEntityHashes.insert(entityHash);
+			}
+
 		public:
 			void publish(const model::WeakEntityInfo& entityInfo, model::NotificationSubscriber& sub) const override {
+				// entities can be published concurrently
+				std::lock_guard<std::mutex> lock(m_mutex);
 				auto isAlwaysVerifiable = m_alwaysVerifiableIndexes.cend() != m_alwaysVerifiableIndexes.find(m_entityInfos.size());
+				auto isUnverifiable = m_unverifiableEntityHashes.cend() != m_unverifiableEntityHashes.find(entityInfo.hash());
 				m_entityInfos.push_back(entityInfo);
 
 				auto i = 0u;
@@ -124,7 +134,7 @@ namespace catapult { namespace consumers {
 						crypto::Sign(input.Signer, input.Data, input.Signature);
 					}
 
-					if (!HasFlag(NotificationDescriptor::Verifiable, descriptor) && !isAlwaysVerifiable)
+					if ((!HasFlag(NotificationDescriptor::Verifiable, descriptor) && !isAlwaysVerifiable) || isUnverifiable)
 						input.Signature[15] ^= 0xFF;
 
 					const auto& signerPublicKey = input.Signer.publicKey();
@@ -137,11 +147,13 @@ namespace catapult { namespace consumers {
 			const GenerationHashSeed& m_generationHashSeed;
 			std::vector<NotificationDescriptor> m_descriptors;
 			std::unordered_set<size_t> m_alwaysVerifiableIndexes;
+			std::unordered_set<Hash256, utils::ArrayHasher<Hash256>> m_unverifiableEntityHashes;
 			mutable model::WeakEntityInfos m_entityInfos;
 
 			// backing for data stored by reference in SignatureNotification (for test purposes, only sign hashes)
 			// use list so that tests will work with arbitrary number of elements without requiring preallocation
 			mutable std::list<SignatureInput> m_signatureInputs;
+			mutable std::mutex m_mutex;
 		};
 
 		// endregion
@@ -505,6 +517,54 @@ namespace catapult { namespace consumers {
 		BlockTraits::AssertEntities(elements, context.pPublisher->entityInfos(), 8, requiresValidationPredicate);
 	}
 
+	namespace {
+		auto CreateManyBlockElements() {
+			// create enough entities and signatures to span multiple extraction partitions and verification batches
+			auto pBlock1 = test::GenerateBlockWithTransactions(40, Height(246));
+			auto pBlock2 = test::GenerateBlockWithTransactions(45, Height(247));
+			auto pBlock3 = test::GenerateBlockWithTransactions(50, Height(248));
+			return test::CreateBlockElements({ pBlock1.get(), pBlock2.get(), pBlock3.get() });
+		}
+
+		void AssignUniqueEntityHashes(disruptor::BlockElements& elements) {
+			// assign unique hashes so that individual entities can be targeted
+			for (auto& element : elements) {
+				element.EntityHash = test::GenerateRandomByteArray<Hash256>();
+				for (auto& transactionElement : element.Transactions)
+					transactionElement.EntityHash = test::GenerateRandomByteArray<Hash256>();
+			}
+		}
+	}
+
+	TEST(BLOCK_TEST_CLASS, CanProcessManyEntitiesWithSignatureNotifications_AllVerifiable) {
+		// Arrange:
+		auto elements = CreateManyBlockElements();
+		AssignUniqueEntityHashes(elements);
+		BlockTraits::TestContext context(GetMixedDescriptors(), {}, RequiresAllPredicate);
+
+		// Act:
+		auto result = context.Consumer(elements);
+
+		// Assert:
+		test::AssertContinued(result);
+		EXPECT_EQ(3u + 40 + 45 + 50, context.pPublisher->entityInfos().size());
+	}
+
+	TEST(BLOCK_TEST_CLASS, CanProcessManyEntitiesWithSignatureNotifications_SingleUnverifiable) {
+		// Arrange:
+		auto elements = CreateManyBlockElements();
+		AssignUniqueEntityHashes(elements);
+		BlockTraits::TestContext context(GetMixedDescriptors(), {}, RequiresAllPredicate);
+		context.pPublisher->addUnverifiableEntity(elements[1].Transactions[27].EntityHash);
+
+		// Act:
+		auto result = context.Consumer(elements);
+
+		// Assert:
+		test::AssertAborted(result, Failure_Consumer_Batch_Signature_Not_Verifiable, disruptor::ConsumerResultSeverity::Fatal);
+		EXPECT_EQ(3u + 40 + 45 + 50, context.pPublisher->entityInfos().size());
+	}
+
 	// endregion
 
 	// region transaction only
@@ -531,5 +591,68 @@ namespace catapult { namespace consumers {
 		EXPECT_EQ(disruptor::ConsumerResultSeverity::Success, elements[3].ResultSeverity);
 	}
 
+	namespace {
+		auto CreateManyTransactionElements() {
+			// create enough entities and signatures to span multiple extraction partitions and verification batches
+			std::vector<std::unique_ptr<model::Transaction>> transactions;
+			std::vector<const model::Transaction*> rawTransactions;
+			for (auto i = 0u; i < 150; ++i) {
+				transactions.push_back(test::GenerateRandomTransaction());
+				rawTransactions.push_back(transactions.back().get());
+			}
+
+			return test::CreateTransactionElements(rawTransactions);
+		}
+
+		void AssignUniqueEntityHashes(disruptor::TransactionElements& elements) {
+			// assign unique hashes so that individual entities can be targeted
+			for (auto& element : elements)
+				element.EntityHash = test::GenerateRandomByteArray<Hash256>();
+		}
+	}
+
+	TEST(TRANSACTION_TEST_CLASS, CanProcessManyEntitiesWithSignatureNotifications_AllVerifiable) {
+		// Arrange:
+		auto elements = CreateManyTransactionElements();
+		AssignUniqueEntityHashes(elements);
+		TransactionTraits::TestContext context(GetMixedDescriptors());
+
+		// Act:
+		auto result = context.Consumer(elements);
+
+		// Assert:
+		test::AssertContinued(result);
+		EXPECT_EQ(150u, context.pPublisher->entityInfos().size());
+
+		// - no elements should have failed
+		EXPECT_TRUE(context.FailedTransactionStatuses.empty());
+		for (const auto& element : elements)
+			EXPECT_EQ(disruptor::ConsumerResultSeverity::Success, element.ResultSeverity);
+	}
+
+	TEST(TRANSACTION_TEST_CLASS, CanProcessManyEntitiesWithSignatureNotifications_SomeUnverifiable) {
+		// Arrange:
+		auto elements = CreateManyTransactionElements();
+		AssignUniqueEntityHashes(elements);
+		TransactionTraits::TestContext context(GetMixedDescriptors());
+		context.pPublisher->addUnverifiableEntity(elements[97].EntityHash);
+
+		// Act:
+		auto result = context.Consumer(elements);
+
+		// Assert:
+		test::AssertAborted(result, Failure_Consumer_Batch_Signature_Not_Verifiable, disruptor::ConsumerResultSeverity::Fatal);
+		EXPECT_EQ(150u, context.pPublisher->entityInfos().size());
+
+		// - only the unverifiable element should have failed
+		ASSERT_EQ(1u, context.FailedTransactionStatuses.size());
+		EXPECT_EQ(elements[97].EntityHash, context.FailedTransactionStatuses[0].Hash);
+
+		for (auto i = 0u; i < elements.size(); ++i) {
+			auto expectedSeverity = 97 == i ? disruptor::ConsumerResultSeverity::Failure : disruptor::ConsumerResultSeverity::Success;
+			EXPECT_EQ(expectedSeverity, elements[i].ResultSeverity) << "element at " << i;
+		}
+	}
+
 	// endregion
 }}
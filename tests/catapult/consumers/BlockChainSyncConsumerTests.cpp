@@ -281,14 +281,21 @@ namespace catapult { namespace consumers {
 
 		struct TransactionsChangeParams {
 		public:
-			TransactionsChangeParams(const HashSet& addedTransactionHashes, const HashSet& revertedTransactionHashes)
+			TransactionsChangeParams(
+					const HashSet& addedTransactionHashes,
+					const HashSet& revertedTransactionHashes,
+					const model::AddressSet* pAffectedAddresses)
 					: AddedTransactionHashes(addedTransactionHashes)
 					, RevertedTransactionHashes(revertedTransactionHashes)
+					, HasAffectedAddresses(!!pAffectedAddresses)
+					, AffectedAddresses(pAffectedAddresses ? *pAffectedAddresses : model::AddressSet())
 			{}
 
 		public:
 			const HashSet AddedTransactionHashes;
 			const HashSet RevertedTransactionHashes;
+			const bool HasAffectedAddresses;
+			const model::AddressSet AffectedAddresses;
 		};
 
 		class MockTransactionsChange : public test::ParamsCapture<TransactionsChangeParams> {
@@ -296,7 +303,8 @@ namespace catapult { namespace consumers {
 			void operator()(const TransactionsChangeInfo& changeInfo) const {
 				TransactionsChangeParams params(
 						CopyHashes(changeInfo.AddedTransactionHashes),
-						CopyHashes(changeInfo.RevertedTransactionInfos));
+						CopyHashes(changeInfo.RevertedTransactionInfos),
+						changeInfo.pAffectedAddresses);
 				const_cast<MockTransactionsChange*>(this)->push(std::move(params));
 			}
 
@@ -373,13 +381,14 @@ namespace catapult { namespace consumers {
 			};
 
 		public:
-			static cache::CatapultCache Create(PruneIdentifiers& pruneIdentifiers) {
+			static cache::CatapultCache Create(PruneIdentifiers& pruneIdentifiers, const bool& hasExpiringElements) {
 				auto config = model::BlockChainConfiguration::Uninitialized();
 				config.VotingSetGrouping = 1;
 
-				std::vector<std::unique_ptr<cache::SubCachePlugin>> subCaches(3);
+				std::vector<std::unique_ptr<cache::SubCachePlugin>> subCaches(ExpiringCacheSubCachePlugin::Id + 1);
 				test::CoreSystemCacheFactory::CreateSubCaches(config, subCaches);
 				subCaches[PruneAwareCacheSubCachePlugin::Id] = std::make_unique<PruneAwareCacheSubCachePlugin>(pruneIdentifiers);
+				subCaches[ExpiringCacheSubCachePlugin::Id] = std::make_unique<ExpiringCacheSubCachePlugin>(hasExpiringElements);
 
 				auto cache = cache::CatapultCache(std::move(subCaches));
 				test::AddMarkerAccount(cache);
@@ -393,6 +402,10 @@ namespace catapult { namespace consumers {
 				{}
 
 			public:
+				bool hasChanges() const override {
+					return false;
+				}
+
 				void prune(Height height) override {
 					m_pruneIdentifiers.Heights.push_back(height);
 				}
@@ -429,6 +442,58 @@ namespace catapult { namespace consumers {
 			private:
 				PruneIdentifiers& m_pruneIdentifiers;
 			};
+
+			// simulates a cache with elements (e.g. locks or mosaics) that are touched when they expire
+			class ExpiringSubCacheView : public test::UnsupportedSubCacheView {
+			public:
+				ExpiringSubCacheView(size_t id, bool hasExpiringElements) : m_id(), m_hasExpiringElements(hasExpiringElements) {
+					m_id.CacheId = id;
+				}
+
+			public:
+				const cache::SubCacheViewIdentifier& id() const override {
+					return m_id;
+				}
+
+				bool hasChanges() const override {
+					return m_hasExpiringElements;
+				}
+
+				void prune(Height) override
+				{}
+
+				void prune(Timestamp) override
+				{}
+
+			private:
+				cache::SubCacheViewIdentifier m_id;
+				bool m_hasExpiringElements;
+			};
+
+			class ExpiringCacheSubCachePlugin : public test::UnsupportedSubCachePlugin<ExpiringCacheSubCachePlugin> {
+			public:
+				static constexpr size_t Id = utils::to_underlying_type(cache::CacheId::Mosaic);
+				static constexpr auto Name = "ExpiringCache";
+
+			public:
+				explicit ExpiringCacheSubCachePlugin(const bool& hasExpiringElements) : m_hasExpiringElements(hasExpiringElements)
+				{}
+
+			public:
+				std::unique_ptr<const cache::SubCacheView> createView() const override {
+					return std::make_unique<ExpiringSubCacheView>(Id, false);
+				}
+
+				std::unique_ptr<cache::SubCacheView> createDelta() override {
+					return std::make_unique<ExpiringSubCacheView>(Id, m_hasExpiringElements);
+				}
+
+				void commit() override
+				{}
+
+			private:
+				const bool& m_hasExpiringElements;
+			};
 		};
 
 		// endregion
@@ -444,7 +509,8 @@ namespace catapult { namespace consumers {
 			{}
 
 			ConsumerTestContext(std::unique_ptr<io::BlockStorage>&& pStorage, std::unique_ptr<io::PrunableBlockStorage>&& pStagingStorage)
-					: Cache(CatapultCacheFactory::Create(CachePruneIdentifiers))
+					: HasExpiringElements(false)
+					, Cache(CatapultCacheFactory::Create(CachePruneIdentifiers, HasExpiringElements))
 					, Storage(std::move(pStorage), std::move(pStagingStorage))
 					, LocalFinalizedHeightHashPair{ Height(1), Hash256() }
 					, NetworkFinalizedHeightHashPair{ Height(1), Hash256() } {
@@ -488,6 +554,7 @@ namespace catapult { namespace consumers {
 
 		public:
 			CatapultCacheFactory::PruneIdentifiers CachePruneIdentifiers;
+			bool HasExpiringElements;
 			cache::CatapultCache Cache;
 			io::BlockStorageCache Storage;
 			model::HeightHashPair LocalFinalizedHeightHashPair;
@@ -643,8 +710,13 @@ namespace catapult { namespace consumers {
 				// - the state was actually changed
 				EXPECT_EQ(Modified_Last_Recalculation_Height, Cache.createView().dependentState().LastRecalculationHeight);
 
-				// - transaction changes were announced
-				EXPECT_EQ(1u, TransactionsChange.params().size());
+				// - transaction changes were announced with the accounts modified by the processor
+				ASSERT_EQ(1u, TransactionsChange.params().size());
+				const auto& transactionsChangeParams = TransactionsChange.params()[0];
+				auto pAccountStateCacheView = Cache.sub<cache::AccountStateCache>().createView();
+				auto sentinelAddress = pAccountStateCacheView->find(Sentinel_Processor_Public_Key).get().Address;
+				EXPECT_TRUE(transactionsChangeParams.HasAffectedAddresses);
+				EXPECT_EQ(model::AddressSet({ sentinelAddress }), transactionsChangeParams.AffectedAddresses);
 
 				// - commit steps were announced
 				ASSERT_EQ(3u, CommitStep.params().size());
@@ -1318,6 +1390,31 @@ namespace catapult { namespace consumers {
 		AssertHashesAreEqual(expectedRevertedHashes, txChangeParams.RevertedTransactionHashes);
 	}
 
+	TEST(TEST_CLASS, CanSyncCompatibleChainsWithExpiringElements_TransactionNotification) {
+		// Arrange: create a local storage with blocks 1-7 and a remote storage with blocks 8-11
+		ConsumerTestContext context;
+		context.seedStorage(Height(7), 3);
+		auto input = CreateInput(Height(8), 4);
+
+		// - simulate a lock or mosaic expiring without modifying any account (other than the processor sentinel)
+		context.HasExpiringElements = true;
+
+		// Act:
+		auto result = context.Consumer(input);
+
+		// Assert:
+		test::AssertContinued(result);
+		EXPECT_EQ(0u, context.UndoBlock.params().size());
+
+		// - the change notification had no affected addresses, so all unconfirmed transactions will be revalidated
+		ASSERT_EQ(1u, context.TransactionsChange.params().size());
+		const auto& txChangeParams = context.TransactionsChange.params()[0];
+
+		EXPECT_TRUE(txChangeParams.AddedTransactionHashes.empty());
+		EXPECT_TRUE(txChangeParams.RevertedTransactionHashes.empty());
+		EXPECT_FALSE(txChangeParams.HasAffectedAddresses);
+	}
+
 	// endregion
 
 	// region element updates
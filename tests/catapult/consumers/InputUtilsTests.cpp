@@ -20,6 +20,7 @@
 **/
 
 #include "catapult/consumers/InputUtils.h"
+#include "catapult/model/NotificationStream.h"
 #include "tests/catapult/consumers/test/ConsumerTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/TransactionInfoTestUtils.h"
@@ -163,6 +164,28 @@ namespace catapult { namespace consumers {
 		AssertEqual(elements[4], entityInfos[1], "1");
 	}
 
+	TEST(TEST_CLASS, ExtractEntityInfos_AttachesRecordedNotificationStreams) {
+		// Arrange:
+		ConsumerInput input(test::CreateTransactionEntityRange(3));
+		auto& elements = input.transactions();
+		auto pStream = std::make_shared<model::NotificationStream>(model::WeakEntityInfo(elements[1].Transaction, elements[1].EntityHash));
+		elements[1].OptionalNotifications = pStream;
+
+		// Act:
+		model::WeakEntityInfos entityInfos;
+		std::vector<size_t> entityInfoElementIndexes;
+		ExtractEntityInfos(elements, entityInfos, entityInfoElementIndexes);
+
+		// Assert:
+		ASSERT_EQ(3u, entityInfos.size());
+		EXPECT_FALSE(entityInfos[0].isNotificationStreamSet());
+		EXPECT_FALSE(entityInfos[2].isNotificationStreamSet());
+
+		ASSERT_TRUE(entityInfos[1].isNotificationStreamSet());
+		EXPECT_EQ(pStream.get(), &entityInfos[1].notificationStream());
+		EXPECT_TRUE(entityInfos[1].notificationStream().isRecordedFrom(entityInfos[1]));
+	}
+
 	// endregion
 
 	// region CollectRevertedTransactionInfos
@@ -0,0 +1,236 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/consumers/BlockConsumers.h"
+#include "catapult/consumers/TransactionConsumers.h"
+#include "catapult/model/NotificationPublisher.h"
+#include "catapult/model/NotificationStream.h"
+#include "tests/catapult/consumers/test/ConsumerTestUtils.h"
+#include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/test/core/mocks/MockNotificationSubscriber.h"
+#include "tests/TestHarness.h"
+#include <mutex>
+
+namespace catapult { namespace consumers {
+
+#define BLOCK_TEST_CLASS BlockNotificationRecordingConsumerTests
+#define TRANSACTION_TEST_CLASS TransactionNotificationRecordingConsumerTests
+
+	namespace {
+		class MockNotificationPublisher : public model::NotificationPublisher {
+		public:
+			MockNotificationPublisher()
+					: m_failingHash()
+					, m_numPublishCalls(0)
+			{}
+
+		public:
+			size_t numPublishCalls() const {
+				return m_numPublishCalls;
+			}
+
+		public:
+			void setFailingHash(const Hash256& hash) {
+				m_failingHash = hash;
+			}
+
+		public:
+			void publish(const model::WeakEntityInfo& entityInfo, model::NotificationSubscriber& sub) const override {
+				{
+					// entities can be published concurrently
+					std::lock_guard<std::mutex> lock(m_mutex);
+					++m_numPublishCalls;
+				}
+
+				if (m_failingHash == entityInfo.hash())
+					CATAPULT_THROW_RUNTIME_ERROR("cannot publish entity");
+
+				sub.notify(model::AccountPublicKeyNotification(entityInfo.entity().SignerPublicKey));
+				sub.notify(model::EntityNotification(entityInfo.entity().Network, entityInfo.entity().Version, 0, 0));
+			}
+
+		private:
+			Hash256 m_failingHash;
+			mutable size_t m_numPublishCalls;
+			mutable std::mutex m_mutex;
+		};
+
+		template<typename TConsumer>
+		struct TestContext {
+		public:
+			template<typename TConsumerFactory>
+			explicit TestContext(TConsumerFactory consumerFactory)
+					: pPublisher(std::make_shared<MockNotificationPublisher>())
+					, pPool(test::CreateStartedIoThreadPool())
+					, Consumer(consumerFactory(pPublisher, *pPool))
+			{}
+
+		public:
+			std::shared_ptr<MockNotificationPublisher> pPublisher;
+			std::unique_ptr<thread::IoThreadPool> pPool;
+			TConsumer Consumer;
+		};
+
+		void AssertRecorded(const model::WeakEntityInfo& entityInfo, const std::string& message) {
+			// Assert: entity info should have an associated stream that was recorded from it
+			ASSERT_TRUE(entityInfo.isNotificationStreamSet()) << message;
+
+			const auto& stream = entityInfo.notificationStream();
+			EXPECT_TRUE(stream.isRecordedFrom(entityInfo)) << message;
+			EXPECT_EQ(2u, stream.size()) << message;
+
+			mocks::MockNotificationSubscriber sub;
+			stream.replay(sub);
+			EXPECT_TRUE(sub.contains(entityInfo.entity().SignerPublicKey)) << message;
+		}
+
+		auto CreateBlockTestContext() {
+			return TestContext<disruptor::BlockConsumer>(CreateBlockNotificationRecordingConsumer);
+		}
+
+		auto CreateTransactionTestContext() {
+			return TestContext<disruptor::TransactionConsumer>(CreateTransactionNotificationRecordingConsumer);
+		}
+
+		auto CreateMultipleBlockElements(std::vector<std::unique_ptr<model::Block>>& blocks) {
+			blocks.push_back(test::GenerateBlockWithTransactions(1, Height(246)));
+			blocks.push_back(test::GenerateBlockWithTransactions(0, Height(247)));
+			blocks.push_back(test::GenerateBlockWithTransactions(3, Height(248)));
+			blocks.push_back(test::GenerateBlockWithTransactions(2, Height(249)));
+			return test::CreateBlockElements({ blocks[0].get(), blocks[1].get(), blocks[2].get(), blocks[3].get() });
+		}
+	}
+
+	// region block
+
+	TEST(BLOCK_TEST_CLASS, CanProcessZeroEntities) {
+		// Arrange:
+		auto context = CreateBlockTestContext();
+
+		// Assert:
+		test::AssertPassthroughForEmptyInput(context.Consumer);
+		EXPECT_EQ(0u, context.pPublisher->numPublishCalls());
+	}
+
+	TEST(BLOCK_TEST_CLASS, RecordsNotificationsForAllEntities) {
+		// Arrange:
+		std::vector<std::unique_ptr<model::Block>> blocks;
+		auto elements = CreateMultipleBlockElements(blocks);
+		auto context = CreateBlockTestContext();
+
+		// Act:
+		auto result = context.Consumer(elements);
+
+		// Assert:
+		test::AssertContinued(result);
+		EXPECT_EQ(10u, context.pPublisher->numPublishCalls());
+
+		model::WeakEntityInfos entityInfos;
+		for (const auto& element : elements)
+			model::ExtractEntityInfos(element, entityInfos);
+
+		ASSERT_EQ(10u, entityInfos.size());
+		for (auto i = 0u; i < entityInfos.size(); ++i)
+			AssertRecorded(entityInfos[i], "entity at " + std::to_string(i));
+	}
+
+	TEST(BLOCK_TEST_CLASS, DoesNotRecordNotificationsForEntityThatCannotBePublished) {
+		// Arrange:
+		std::vector<std::unique_ptr<model::Block>> blocks;
+		auto elements = CreateMultipleBlockElements(blocks);
+		auto context = CreateBlockTestContext();
+		context.pPublisher->setFailingHash(elements[2].Transactions[1].EntityHash);
+
+		// Act:
+		auto result = context.Consumer(elements);
+
+		// Assert: only the failing entity is not recorded
+		test::AssertContinued(result);
+		EXPECT_EQ(10u, context.pPublisher->numPublishCalls());
+
+		EXPECT_FALSE(!!elements[2].Transactions[1].OptionalNotifications);
+		EXPECT_TRUE(!!elements[2].Transactions[0].OptionalNotifications);
+		EXPECT_TRUE(!!elements[2].Transactions[2].OptionalNotifications);
+		EXPECT_TRUE(!!elements[2].OptionalNotifications);
+	}
+
+	// endregion
+
+	// region transaction
+
+	TEST(TRANSACTION_TEST_CLASS, CanProcessZeroEntities) {
+		// Arrange:
+		auto context = CreateTransactionTestContext();
+
+		// Assert:
+		test::AssertPassthroughForEmptyInput(context.Consumer);
+		EXPECT_EQ(0u, context.pPublisher->numPublishCalls());
+	}
+
+	TEST(TRANSACTION_TEST_CLASS, RecordsNotificationsForAllNonSkippedEntities) {
+		// Arrange:
+		auto elements = test::CreateTransactionElements(4);
+		elements[0].ResultSeverity = disruptor::ConsumerResultSeverity::Neutral;
+		elements[2].ResultSeverity = disruptor::ConsumerResultSeverity::Failure;
+		auto context = CreateTransactionTestContext();
+
+		// Act:
+		auto result = context.Consumer(elements);
+
+		// Assert:
+		test::AssertContinued(result);
+		EXPECT_EQ(2u, context.pPublisher->numPublishCalls());
+
+		EXPECT_FALSE(!!elements[0].OptionalNotifications);
+		EXPECT_TRUE(!!elements[1].OptionalNotifications);
+		EXPECT_FALSE(!!elements[2].OptionalNotifications);
+		EXPECT_TRUE(!!elements[3].OptionalNotifications);
+
+		model::WeakEntityInfos entityInfos;
+		std::vector<size_t> entityInfoElementIndexes;
+		ExtractEntityInfos(elements, entityInfos, entityInfoElementIndexes);
+
+		ASSERT_EQ(2u, entityInfos.size());
+		for (auto i = 0u; i < entityInfos.size(); ++i)
+			AssertRecorded(entityInfos[i], "entity at " + std::to_string(i));
+	}
+
+	TEST(TRANSACTION_TEST_CLASS, DoesNotRecordNotificationsForEntityThatCannotBePublished) {
+		// Arrange:
+		auto elements = test::CreateTransactionElements(3);
+		auto context = CreateTransactionTestContext();
+		context.pPublisher->setFailingHash(elements[1].EntityHash);
+
+		// Act:
+		auto result = context.Consumer(elements);
+
+		// Assert:
+		test::AssertContinued(result);
+		EXPECT_EQ(3u, context.pPublisher->numPublishCalls());
+
+		EXPECT_TRUE(!!elements[0].OptionalNotifications);
+		EXPECT_FALSE(!!elements[1].OptionalNotifications);
+		EXPECT_TRUE(!!elements[2].OptionalNotifications);
+	}
+
+	// endregion
+}}
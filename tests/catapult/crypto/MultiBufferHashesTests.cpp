@@ -0,0 +1,206 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/crypto/MultiBufferHashes.h"
+#include "catapult/crypto/Hashes.h"
+#include "catapult/utils/HexParser.h"
+#include "tests/test/nodeps/Conversions.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace crypto {
+
+#define TEST_CLASS MultiBufferHashesTests
+
+	namespace {
+		// region traits
+
+		struct ScalarTraits {
+			static constexpr auto Implementation = MultiBufferSha3Implementation::Scalar;
+		};
+
+		struct Avx2Traits {
+			static constexpr auto Implementation = MultiBufferSha3Implementation::Avx2;
+		};
+
+		struct Avx512Traits {
+			static constexpr auto Implementation = MultiBufferSha3Implementation::Avx512;
+		};
+
+		// endregion
+
+		// region test utils
+
+		std::vector<Hash256> CalculateExpectedHashes(const std::vector<std::vector<uint8_t>>& buffers) {
+			std::vector<Hash256> hashes(buffers.size());
+			for (auto i = 0u; i < buffers.size(); ++i)
+				Sha3_256(buffers[i], hashes[i]);
+
+			return hashes;
+		}
+
+		std::vector<MultiBufferHashInput> CreateInputs(const std::vector<std::vector<uint8_t>>& buffers) {
+			std::vector<MultiBufferHashInput> inputs;
+			for (const auto& buffer : buffers)
+				inputs.push_back({ { RawBuffer(buffer) }, 1 });
+
+			return inputs;
+		}
+
+		template<typename TTraits>
+		std::vector<Hash256> CalculateHashes(const std::vector<MultiBufferHashInput>& inputs) {
+			std::vector<Hash256> hashes(inputs.size());
+			Sha3_256_Multi(TTraits::Implementation, inputs.data(), hashes.data(), inputs.size());
+			return hashes;
+		}
+
+		template<typename TTraits>
+		void AssertHashesOfBuffersWithSizes(const std::vector<size_t>& sizes) {
+			// Arrange:
+			std::vector<std::vector<uint8_t>> buffers;
+			for (auto size : sizes)
+				buffers.push_back(test::GenerateRandomVector(size));
+
+			// Act:
+			auto hashes = CalculateHashes<TTraits>(CreateInputs(buffers));
+
+			// Assert:
+			EXPECT_EQ(CalculateExpectedHashes(buffers), hashes);
+		}
+
+		// endregion
+	}
+
+#define IMPLEMENTATION_TEST(TEST_NAME) \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_Scalar) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ScalarTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_Avx2) { \
+		if (!IsSupported(Avx2Traits::Implementation)) \
+			return; \
+		TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<Avx2Traits>(); \
+	} \
+	TEST(TEST_CLASS, TEST_NAME##_Avx512) { \
+		if (!IsSupported(Avx512Traits::Implementation)) \
+			return; \
+		TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<Avx512Traits>(); \
+	} \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	// region implementation support
+
+	TEST(TEST_CLASS, ScalarImplementationIsAlwaysSupported) {
+		EXPECT_TRUE(IsSupported(MultiBufferSha3Implementation::Scalar));
+	}
+
+	TEST(TEST_CLASS, DefaultImplementationIsSupported) {
+		EXPECT_TRUE(IsSupported(GetDefaultMultiBufferSha3Implementation()));
+	}
+
+	// endregion
+
+	// region Sha3_256_Multi
+
+	IMPLEMENTATION_TEST(CanHashZeroInputs) {
+		// Act + Assert: no exception
+		Sha3_256_Multi(TTraits::Implementation, nullptr, nullptr, 0);
+	}
+
+	IMPLEMENTATION_TEST(EmptyInputsHaveExpectedHash) {
+		// Arrange:
+		std::vector<MultiBufferHashInput> inputs(5, MultiBufferHashInput{ {}, 0 });
+
+		// Act:
+		auto hashes = CalculateHashes<TTraits>(inputs);
+
+		// Assert:
+		auto expectedHash = utils::ParseByteArray<Hash256>("A7FFC6F8BF1ED76651C14756A061D662F580FF4DE43B49FA82D80A4B80F8434A");
+		EXPECT_EQ(std::vector<Hash256>(5, expectedHash), hashes);
+	}
+
+	IMPLEMENTATION_TEST(SampleTestVectorsHaveExpectedHashes) {
+		// Arrange: vectors taken from http://mumble.net/~campbell/hg/sha3/kat/ShortMsgKAT_SHA3-256.txt
+		std::vector<std::vector<uint8_t>> buffers{
+			test::HexStringToVector("CC"),
+			test::HexStringToVector("41FB"),
+			test::HexStringToVector("1F877C"),
+			test::HexStringToVector("C1ECFDFC"),
+			test::HexStringToVector("9F2FCC7C90DE090D6B87CD7E9718C1EA6CB21118FC2D5DE9F97E5DB6AC1E9C10")
+		};
+
+		// Act:
+		auto hashes = CalculateHashes<TTraits>(CreateInputs(buffers));
+
+		// Assert:
+		std::vector<Hash256> expectedHashes{
+			utils::ParseByteArray<Hash256>("677035391CD3701293D385F037BA32796252BB7CE180B00B582DD9B20AAAD7F0"),
+			utils::ParseByteArray<Hash256>("39F31B6E653DFCD9CAED2602FD87F61B6254F581312FB6EEEC4D7148FA2E72AA"),
+			utils::ParseByteArray<Hash256>("BC22345E4BD3F792A341CF18AC0789F1C9C966712A501B19D1B6632CCD408EC5"),
+			utils::ParseByteArray<Hash256>("C5859BE82560CC8789133F7C834A6EE628E351E504E601E8059A0667FF62C124"),
+			utils::ParseByteArray<Hash256>("2F1A5F7159E34EA19CDDC70EBF9B81F1A66DB40615D7EAD3CC1F1B954D82A3AF")
+		};
+		EXPECT_EQ(expectedHashes, hashes);
+	}
+
+	IMPLEMENTATION_TEST(CanHashInputsAroundBlockBoundaries) {
+		// Assert: 136 is the SHA3-256 rate
+		AssertHashesOfBuffersWithSizes<TTraits>({ 1, 135, 136, 137, 271, 272, 273, 1000 });
+	}
+
+	IMPLEMENTATION_TEST(CanHashInputsWithSameSize) {
+		AssertHashesOfBuffersWithSizes<TTraits>(std::vector<size_t>(8, 64));
+	}
+
+	IMPLEMENTATION_TEST(CanHashInputsWithDifferentSizes) {
+		// Assert: number of inputs is not a multiple of any lockstep width
+		std::vector<size_t> sizes;
+		for (auto i = 0u; i < 21; ++i)
+			sizes.push_back(test::Random() % 700);
+
+		AssertHashesOfBuffersWithSizes<TTraits>(sizes);
+	}
+
+	IMPLEMENTATION_TEST(CanHashInputsComposedOfMultipleBuffers) {
+		// Arrange:
+		std::vector<std::vector<uint8_t>> buffers;
+		std::vector<MultiBufferHashInput> inputs;
+		for (auto i = 0u; i < 11; ++i)
+			buffers.push_back(test::GenerateRandomVector(100 + 50 * i));
+
+		for (const auto& buffer : buffers) {
+			// - split buffer into four parts, including an empty one
+			auto splitSize = buffer.size() / 3;
+			inputs.push_back({ {
+				RawBuffer(buffer.data(), splitSize),
+				RawBuffer(buffer.data() + splitSize, 0),
+				RawBuffer(buffer.data() + splitSize, splitSize),
+				RawBuffer(buffer.data() + 2 * splitSize, buffer.size() - 2 * splitSize)
+			}, 4 });
+		}
+
+		// Act:
+		auto hashes = CalculateHashes<TTraits>(inputs);
+
+		// Assert:
+		EXPECT_EQ(CalculateExpectedHashes(buffers), hashes);
+	}
+
+	// endregion
+}}
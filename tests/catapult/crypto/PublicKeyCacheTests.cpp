@@ -0,0 +1,268 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/crypto/PublicKeyCache.h"
+#include "catapult/crypto/Signer.h"
+#include "catapult/utils/RandomGenerator.h"
+#include "tests/test/nodeps/KeyTestUtils.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace crypto {
+
+#define TEST_CLASS PublicKeyCacheTests
+
+	namespace {
+		constexpr auto Default_Max_Size = utils::FileSize::FromMegabytes(4);
+		constexpr size_t Num_Shards = 16;
+
+		class PublicKeyCacheGuard {
+		public:
+			explicit PublicKeyCacheGuard(utils::FileSize maxSize = Default_Max_Size) {
+				SetPublicKeyCacheMaxSize(maxSize);
+				ClearPublicKeyCache();
+			}
+
+			~PublicKeyCacheGuard() {
+				SetPublicKeyCacheMaxSize(utils::FileSize());
+				ClearPublicKeyCache();
+			}
+		};
+
+		struct SignedData {
+		public:
+			explicit SignedData(const KeyPair& keyPair)
+					: PublicKey(keyPair.publicKey())
+					, Data(test::GenerateRandomVector(100)) {
+				Sign(keyPair, Data, Signature);
+			}
+
+		public:
+			Key PublicKey;
+			std::vector<uint8_t> Data;
+			catapult::Signature Signature;
+		};
+
+		bool Verify(const SignedData& signedData) {
+			return crypto::Verify(signedData.PublicKey, signedData.Data, signedData.Signature);
+		}
+
+		void AssertStatistics(uint64_t numHits, uint64_t numMisses, size_t numKeys) {
+			auto statistics = GetPublicKeyCacheStatistics();
+			EXPECT_EQ(numHits, statistics.NumHits);
+			EXPECT_EQ(numMisses, statistics.NumMisses);
+			EXPECT_EQ(numKeys, statistics.NumKeys);
+		}
+
+		uint64_t GetEntrySize() {
+			PublicKeyCacheGuard guard;
+			Verify(SignedData(test::GenerateKeyPair()));
+			return GetPublicKeyCacheStatistics().Size.bytes();
+		}
+
+		RandomFiller CreateRandomFiller() {
+			return [](auto* pOut, auto count) {
+				utils::LowEntropyRandomGenerator().fill(pOut, count);
+			};
+		}
+	}
+
+	// region Verify
+
+	TEST(TEST_CLASS, VerifyAddsPublicKeyToCacheOnMiss) {
+		// Arrange:
+		PublicKeyCacheGuard guard;
+		SignedData signedData(test::GenerateKeyPair());
+
+		// Act:
+		auto isVerified = Verify(signedData);
+
+		// Assert:
+		EXPECT_TRUE(isVerified);
+		AssertStatistics(0, 1, 1);
+		EXPECT_LT(0u, GetPublicKeyCacheStatistics().Size.bytes());
+	}
+
+	TEST(TEST_CLASS, VerifyUsesCachedPublicKeyOnHit) {
+		// Arrange:
+		PublicKeyCacheGuard guard;
+		auto keyPair = test::GenerateKeyPair();
+		Verify(SignedData(keyPair));
+
+		// Act:
+		auto isVerified1 = Verify(SignedData(keyPair));
+		auto isVerified2 = Verify(SignedData(keyPair));
+
+		// Assert:
+		EXPECT_TRUE(isVerified1);
+		EXPECT_TRUE(isVerified2);
+		AssertStatistics(2, 1, 1);
+	}
+
+	TEST(TEST_CLASS, VerifyRejectsInvalidSignatureWithCachedPublicKey) {
+		// Arrange:
+		PublicKeyCacheGuard guard;
+		auto keyPair = test::GenerateKeyPair();
+		Verify(SignedData(keyPair));
+
+		SignedData signedData(keyPair);
+		signedData.Data[10] ^= 0xFF;
+
+		// Act:
+		auto isVerified = Verify(signedData);
+
+		// Assert:
+		EXPECT_FALSE(isVerified);
+		AssertStatistics(1, 1, 1);
+	}
+
+	TEST(TEST_CLASS, VerifyDoesNotCacheInvalidPublicKey) {
+		// Arrange: use non-canonical public key
+		PublicKeyCacheGuard guard;
+		SignedData signedData(test::GenerateKeyPair());
+		std::memset(signedData.PublicKey.data(), 0xFF, Key::Size);
+		signedData.PublicKey[Key::Size - 1] = 0x7F;
+
+		// Act:
+		auto isVerified1 = Verify(signedData);
+		auto isVerified2 = Verify(signedData);
+
+		// Assert:
+		EXPECT_FALSE(isVerified1);
+		EXPECT_FALSE(isVerified2);
+		AssertStatistics(0, 2, 0);
+	}
+
+	// endregion
+
+	// region VerifyMulti
+
+	TEST(TEST_CLASS, VerifyMultiUsesCachedPublicKeys) {
+		// Arrange: sign ten payloads with two key pairs
+		PublicKeyCacheGuard guard;
+		auto keyPair1 = test::GenerateKeyPair();
+		auto keyPair2 = test::GenerateKeyPair();
+
+		std::vector<SignedData> signedDatas;
+		for (auto i = 0u; i < 10; ++i)
+			signedDatas.emplace_back(0 == i % 2 ? keyPair1 : keyPair2);
+
+		std::vector<SignatureInput> signatureInputs;
+		for (const auto& signedData : signedDatas)
+			signatureInputs.push_back({ signedData.PublicKey, { signedData.Data }, signedData.Signature });
+
+		// Act:
+		auto result = VerifyMulti(CreateRandomFiller(), signatureInputs.data(), signatureInputs.size());
+
+		// Assert:
+		EXPECT_TRUE(result.second);
+		AssertStatistics(8, 2, 2);
+	}
+
+	// endregion
+
+	// region size limits
+
+	TEST(TEST_CLASS, CacheIsDisabledUntilMaxSizeIsSet) {
+		// Arrange: guards disable the cache when they are destroyed
+		ClearPublicKeyCache();
+		auto keyPair = test::GenerateKeyPair();
+
+		// Act:
+		auto isVerified1 = Verify(SignedData(keyPair));
+		auto isVerified2 = Verify(SignedData(keyPair));
+
+		// Assert:
+		EXPECT_TRUE(isVerified1);
+		EXPECT_TRUE(isVerified2);
+		AssertStatistics(0, 0, 0);
+	}
+
+	TEST(TEST_CLASS, CacheCanBeDisabled) {
+		// Arrange:
+		PublicKeyCacheGuard guard(utils::FileSize::FromBytes(0));
+		auto keyPair = test::GenerateKeyPair();
+
+		// Act:
+		auto isVerified1 = Verify(SignedData(keyPair));
+		auto isVerified2 = Verify(SignedData(keyPair));
+
+		// Assert:
+		EXPECT_TRUE(isVerified1);
+		EXPECT_TRUE(isVerified2);
+		AssertStatistics(0, 0, 0);
+	}
+
+	TEST(TEST_CLASS, CacheEvictsLeastRecentlyUsedPublicKeyWhenFull) {
+		// Arrange: allow a single public key per shard
+		auto entrySize = GetEntrySize();
+		PublicKeyCacheGuard guard(utils::FileSize::FromBytes(entrySize * Num_Shards));
+
+		// - find two key pairs that map to the same shard
+		auto keyPair1 = test::GenerateKeyPair();
+		auto keyPair2 = test::GenerateKeyPair();
+		while (keyPair1.publicKey()[0] % Num_Shards != keyPair2.publicKey()[0] % Num_Shards)
+			keyPair2 = test::GenerateKeyPair();
+
+		Verify(SignedData(keyPair1));
+		Verify(SignedData(keyPair2));
+
+		// Act:
+		auto isVerified = Verify(SignedData(keyPair1));
+
+		// Assert: second key pair evicted first key pair, which was then reloaded
+		EXPECT_TRUE(isVerified);
+		AssertStatistics(0, 3, 1);
+		EXPECT_EQ(entrySize, GetPublicKeyCacheStatistics().Size.bytes());
+	}
+
+	TEST(TEST_CLASS, ReducingMaxSizeEvictsPublicKeys) {
+		// Arrange:
+		PublicKeyCacheGuard guard;
+		for (auto i = 0u; i < 5; ++i)
+			Verify(SignedData(test::GenerateKeyPair()));
+
+		// Sanity:
+		AssertStatistics(0, 5, 5);
+
+		// Act:
+		SetPublicKeyCacheMaxSize(utils::FileSize());
+
+		// Assert:
+		AssertStatistics(0, 5, 0);
+	}
+
+	TEST(TEST_CLASS, ClearRemovesPublicKeysAndResetsStatistics) {
+		// Arrange:
+		PublicKeyCacheGuard guard;
+		auto keyPair = test::GenerateKeyPair();
+		Verify(SignedData(keyPair));
+		Verify(SignedData(keyPair));
+
+		// Act:
+		ClearPublicKeyCache();
+
+		// Assert:
+		AssertStatistics(0, 0, 0);
+	}
+
+	// endregion
+}}
@@ -116,11 +116,10 @@ namespace catapult { namespace crypto {
 		}
 
 		template<typename TTraits, typename TMutator>
-		void AssertSignedPayloadsCannotBeVerifiedAsBatches(TMutator mutator) {
+		void AssertSignedPayloadsCannotBeVerifiedAsBatches(size_t count, std::unordered_set<size_t>&& failedIndexes, TMutator mutator) {
 			// Arrange:
 			DataHolder dataHolder;
-			auto signatureInputs = CreateSignatureInputs(Default_Signature_Count, dataHolder);
-			std::unordered_set<size_t> failedIndexes{ 1, 17, 58 };
+			auto signatureInputs = CreateSignatureInputs(count, dataHolder);
 			for (auto index : failedIndexes)
 				mutator(signatureInputs, index);
 
@@ -131,6 +130,15 @@ namespace catapult { namespace crypto {
 			TTraits::AssertVerifyResult(result, false, failedIndexes);
 		}
 
+		template<typename TTraits, typename TMutator>
+		void AssertSignedPayloadsCannotBeVerifiedAsBatches(TMutator mutator) {
+			AssertSignedPayloadsCannotBeVerifiedAsBatches<TTraits>(Default_Signature_Count, { 1, 17, 58 }, mutator);
+		}
+
+		void CorruptPayload(std::vector<SignatureInput>& signatureInputs, size_t index) {
+			const_cast<uint8_t*>(signatureInputs[index].Buffers[0].pData)[13] ^= 0xFF;
+		}
+
 		RandomFiller CreateRandomFiller() {
 			return [](auto* pOut, auto count) {
 				// can use low entropy source for tests
@@ -214,9 +222,25 @@ namespace catapult { namespace crypto {
 	}
 
 	VERIFY_MULTI_TEST(SignedPayloadsCannotBeVerifiedAsBatches_DifferentPayload) {
-		AssertSignedPayloadsCannotBeVerifiedAsBatches<TTraits>([](auto& signatureInputs, auto index) {
-			const_cast<uint8_t*>(signatureInputs[index].Buffers[0].pData)[13] ^= 0xFF;
-		});
+		AssertSignedPayloadsCannotBeVerifiedAsBatches<TTraits>(CorruptPayload);
+	}
+
+	VERIFY_MULTI_TEST(SignedPayloadsCannotBeVerifiedAsBatches_InvalidSignaturesNotBatchVerified) {
+		// last two signatures are not batch verified
+		AssertSignedPayloadsCannotBeVerifiedAsBatches<TTraits>(66, { 64 }, CorruptPayload);
+		AssertSignedPayloadsCannotBeVerifiedAsBatches<TTraits>(66, { 65 }, CorruptPayload);
+	}
+
+	VERIFY_MULTI_TEST(SignedPayloadsCannotBeVerifiedAsBatches_AdjacentInvalidSignatures) {
+		AssertSignedPayloadsCannotBeVerifiedAsBatches<TTraits>(Default_Signature_Count, { 31, 32, 33 }, CorruptPayload);
+	}
+
+	VERIFY_MULTI_TEST(SignedPayloadsCannotBeVerifiedAsBatches_AllInvalidSignatures) {
+		std::unordered_set<size_t> failedIndexes;
+		for (auto i = 0u; i < 70; ++i)
+			failedIndexes.insert(i);
+
+		AssertSignedPayloadsCannotBeVerifiedAsBatches<TTraits>(70, std::move(failedIndexes), CorruptPayload);
 	}
 
 	VERIFY_MULTI_TEST(SignedPayloadsCannotBeVerifiedAsBatches_PublicKeyNotOnCurve) {
@@ -26,6 +26,7 @@
 #include "catapult/deltaset/BaseSetDefaultTraits.h"
 #include "catapult/deltaset/BaseSetDelta.h"
 #include "catapult/deltaset/OrderedSet.h"
+#include "catapult/utils/FlatHashMap.h"
 #include "catapult/utils/traits/StlTraits.h"
 #include "tests/test/other/TestElement.h"
 #include "tests/TestHarness.h"
@@ -51,6 +52,11 @@ namespace catapult { namespace test {
 		std::unordered_map<std::pair<std::string, unsigned int>, TElement, MapKeyHasher>,
 		TestElementToKeyConverter<TElement>>;
 
+	template<typename TElement>
+	using FlatMapSetTraits = deltaset::MapStorageTraits<
+		utils::FlatHashMap<std::pair<std::string, unsigned int>, TElement, MapKeyHasher>,
+		TestElementToKeyConverter<TElement>>;
+
 	// endregion
 
 	// region IsMutable / IsMap
@@ -35,5 +35,6 @@ namespace catapult { namespace disruptor {
 		EXPECT_EQ(123u, options.DisruptorSize);
 		EXPECT_EQ(1u, options.ElementTraceInterval);
 		EXPECT_TRUE(options.ShouldThrowWhenFull);
+		EXPECT_EQ(ConsumerWaitStrategy::Spin_Yield_Park, options.WaitStrategy);
 	}
 }}
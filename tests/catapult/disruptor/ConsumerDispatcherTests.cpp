@@ -21,11 +21,13 @@
 
 #include "catapult/disruptor/ConsumerDispatcher.h"
 #include "catapult/model/RangeTypes.h"
+#include "tests/catapult/disruptor/test/ConsumerWaitStrategyTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/nodeps/Atomics.h"
 #include "tests/test/nodeps/Functional.h"
 #include "tests/test/other/DisruptorTestUtils.h"
 #include "tests/TestHarness.h"
+#include <thread>
 
 namespace catapult { namespace disruptor {
 
@@ -423,6 +425,60 @@ namespace catapult { namespace disruptor {
 		EXPECT_EQ(std::vector<CompletionStatus>(5, CompletionStatus::Normal), inspectedStatuses);
 	}
 
+	namespace {
+		// completion handler that throws when it is copied after throwing is enabled
+		class ThrowingCopyCompletionHandler {
+		public:
+			explicit ThrowingCopyCompletionHandler(const std::shared_ptr<bool>& pShouldThrow) : m_pShouldThrow(pShouldThrow)
+			{}
+
+			ThrowingCopyCompletionHandler(const ThrowingCopyCompletionHandler& rhs) : m_pShouldThrow(rhs.m_pShouldThrow) {
+				if (*m_pShouldThrow)
+					CATAPULT_THROW_RUNTIME_ERROR("completion handler cannot be copied");
+			}
+
+		public:
+			void operator()(DisruptorElementId, const ConsumerCompletionResult&) const
+			{}
+
+		private:
+			std::shared_ptr<bool> m_pShouldThrow;
+		};
+	}
+
+	TEST(TEST_CLASS, ProcessElementPublishesClaimedPositionWhenElementCannotBeCreated) {
+		// Arrange:
+		auto ranges = test::PrepareRanges(3);
+		auto expectedHeights = GetExpectedHeights(ranges);
+		CollectedHeights collectedHeights;
+		CollectedHeights inspectedHeights;
+		std::vector<CompletionStatus> inspectedStatuses;
+
+		ConsumerDispatcher dispatcher(
+				Test_Dispatcher_Options,
+				{ CreateConsumer(collectedHeights) },
+				CreateCollectingInspector(inspectedHeights, inspectedStatuses));
+
+		auto pShouldThrow = std::make_shared<bool>(false);
+		ProcessingCompleteFunc throwingProcessingComplete = ThrowingCopyCompletionHandler(pShouldThrow);
+		*pShouldThrow = true;
+
+		// Act: second element cannot be created, but its position must not block the third element
+		dispatcher.processElement(ConsumerInput(std::move(ranges[0])));
+		EXPECT_THROW(dispatcher.processElement(ConsumerInput(std::move(ranges[1])), throwingProcessingComplete), catapult_runtime_error);
+		dispatcher.processElement(ConsumerInput(std::move(ranges[2])));
+		WAIT_FOR_VALUE_EXPR(2u, inspectedHeights.size());
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		// Assert: abandoned element was neither consumed nor inspected
+		std::vector<Heights> expectedProcessedHeights{ expectedHeights[0], expectedHeights[2] };
+		EXPECT_EQ(2u, dispatcher.numAddedElements());
+		EXPECT_EQ(0u, dispatcher.numActiveElements());
+		EXPECT_EQ(expectedProcessedHeights, collectedHeights.get());
+		EXPECT_EQ(expectedProcessedHeights, inspectedHeights.get());
+		EXPECT_EQ(std::vector<CompletionStatus>(2, CompletionStatus::Normal), inspectedStatuses);
+	}
+
 	TEST(TEST_CLASS, CanConsumeAndInspectAllElementsWithMultipleConsumers) {
 		// Arrange:
 		auto ranges = test::PrepareRanges(5);
@@ -458,6 +514,66 @@ namespace catapult { namespace disruptor {
 
 	// endregion
 
+	// region multiple producers
+
+	TEST(TEST_CLASS, CanProcessElementsFromMultipleProducers) {
+		// Arrange:
+		constexpr auto Num_Producers = 8u;
+		constexpr auto Num_Elements_Per_Producer = 50u;
+		std::vector<Height> consumedHeights;
+		std::vector<Height> inspectedHeights;
+
+		ConsumerDispatcher dispatcher(
+				Test_Dispatcher_Options,
+				{
+					CreateNoOpConsumer(),
+					[&consumedHeights](const auto& input) {
+						consumedHeights.push_back(input.blocks()[0].Block.Height);
+						return ConsumerResult::Continue();
+					}
+				},
+				[&inspectedHeights](const auto& input, const auto&) {
+					inspectedHeights.push_back(input.blocks()[0].Block.Height);
+				});
+
+		// Act: tag each block with its producer (high bits) and its index within the producer (low bits)
+		std::vector<std::thread> threads;
+		for (auto i = 0u; i < Num_Producers; ++i) {
+			threads.emplace_back([&dispatcher, i]() {
+				for (auto j = 0u; j < Num_Elements_Per_Producer; ++j) {
+					auto pBlock = test::GenerateEmptyRandomBlock();
+					pBlock->Height = Height(i * 1000 + j);
+					dispatcher.processElement(ConsumerInput(model::BlockRange::FromEntity(std::move(pBlock))));
+				}
+			});
+		}
+
+		for (auto& thread : threads)
+			thread.join();
+
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		// Assert: all elements were processed by all consumers in the same order
+		EXPECT_EQ(Num_Producers * Num_Elements_Per_Producer, dispatcher.numAddedElements());
+		ASSERT_EQ(Num_Producers * Num_Elements_Per_Producer, consumedHeights.size());
+		EXPECT_EQ(consumedHeights, inspectedHeights);
+
+		// - elements from each producer were processed in the order they were added
+		std::vector<std::vector<Height>> producerHeights(Num_Producers);
+		for (auto height : consumedHeights)
+			producerHeights[height.unwrap() / 1000].push_back(height);
+
+		for (auto i = 0u; i < Num_Producers; ++i) {
+			std::vector<Height> expectedHeights;
+			for (auto j = 0u; j < Num_Elements_Per_Producer; ++j)
+				expectedHeights.push_back(Height(i * 1000 + j));
+
+			EXPECT_EQ(expectedHeights, producerHeights[i]) << "producer " << i;
+		}
+	}
+
+	// endregion
+
 	// region element marking
 
 	namespace {
@@ -733,4 +849,69 @@ namespace catapult { namespace disruptor {
 	}
 
 	// endregion
+
+	// region wait strategies
+
+	namespace {
+		ConsumerDispatcherOptions CreateOptions(ConsumerWaitStrategy waitStrategy) {
+			auto options = Test_Dispatcher_Options;
+			options.WaitStrategy = waitStrategy;
+			return options;
+		}
+	}
+
+	WAIT_STRATEGY_TEST(CanConsumeAndInspectAllElementsWithIdleConsumers) {
+		// Arrange:
+		auto ranges = test::PrepareRanges(6);
+		auto expectedHeights = GetExpectedHeights(ranges);
+		CollectedHeights collectedHeights[3];
+		CollectedHeights inspectedHeights;
+		std::vector<CompletionStatus> inspectedStatuses;
+
+		ConsumerDispatcher dispatcher(
+				CreateOptions(WaitStrategy),
+				{
+					CreateConsumer(collectedHeights[0]),
+					CreateConsumer(collectedHeights[1]),
+					CreateConsumer(collectedHeights[2])
+				},
+				CreateCollectingInspector(inspectedHeights, inspectedStatuses));
+
+		// Act: push elements in batches separated by pauses so that consumers become idle between batches
+		for (auto i = 0u; i < ranges.size(); i += 2) {
+			test::Pause();
+			dispatcher.processElement(ConsumerInput(std::move(ranges[i])));
+			dispatcher.processElement(ConsumerInput(std::move(ranges[i + 1])));
+			WAIT_FOR_VALUE_EXPR(i + 2, inspectedHeights.size());
+		}
+
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		// Assert:
+		EXPECT_EQ(6u, dispatcher.numAddedElements());
+		EXPECT_EQ(expectedHeights, collectedHeights[0].get());
+		EXPECT_EQ(expectedHeights, collectedHeights[1].get());
+		EXPECT_EQ(expectedHeights, collectedHeights[2].get());
+		EXPECT_EQ(expectedHeights, inspectedHeights.get());
+		EXPECT_EQ(std::vector<CompletionStatus>(6, CompletionStatus::Normal), inspectedStatuses);
+	}
+
+	WAIT_STRATEGY_TEST(ShutdownStopsIdleConsumers) {
+		// Arrange:
+		ConsumerDispatcher dispatcher(
+				CreateOptions(WaitStrategy),
+				{ CreateNoOpConsumer(), CreateNoOpConsumer(), CreateNoOpConsumer() });
+
+		// - give the consumers time to become idle
+		test::Pause();
+
+		// Act:
+		dispatcher.shutdown();
+
+		// Assert:
+		EXPECT_EQ(3u, dispatcher.size());
+		EXPECT_FALSE(dispatcher.isRunning());
+	}
+
+	// endregion
 }}
@@ -0,0 +1,127 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/disruptor/ConsumerWaiter.h"
+#include "tests/catapult/disruptor/test/ConsumerWaitStrategyTestUtils.h"
+#include "tests/TestHarness.h"
+#include <thread>
+
+namespace catapult { namespace disruptor {
+
+#define TEST_CLASS ConsumerWaiterTests
+
+	// region create
+
+	WAIT_STRATEGY_TEST(CanCreateWaiter) {
+		// Act:
+		auto pWaiter = CreateConsumerWaiter(WaitStrategy);
+
+		// Assert:
+		EXPECT_TRUE(!!pWaiter);
+	}
+
+	TEST(TEST_CLASS, CannotCreateWaiterWithUnknownStrategy) {
+		// Act + Assert:
+		EXPECT_THROW(CreateConsumerWaiter(static_cast<ConsumerWaitStrategy>(123)), catapult_invalid_argument);
+	}
+
+	// endregion
+
+	// region wait + notify
+
+	WAIT_STRATEGY_TEST(WaitReturnsWhenReady) {
+		// Arrange:
+		auto pWaiter = CreateConsumerWaiter(WaitStrategy);
+
+		// - wait enough times for the waiter to exhaust any spinning phase (timed backoff sleeps, so use fewer waits)
+		auto numExpectedWaits = ConsumerWaitStrategy::Timed_Backoff == WaitStrategy ? 10u : 2000u;
+
+		// Act:
+		auto numWaits = 0u;
+		for (auto i = 0u; i < numExpectedWaits; ++i) {
+			pWaiter->wait([]() { return true; });
+			++numWaits;
+		}
+
+		// Assert:
+		EXPECT_EQ(numExpectedWaits, numWaits);
+	}
+
+	WAIT_STRATEGY_TEST(NotifyWakesUpIdleWaiter) {
+		// Arrange:
+		auto pWaiter = CreateConsumerWaiter(WaitStrategy);
+		std::atomic_bool isReady(false);
+		std::atomic_bool isComplete(false);
+		auto isReadyPredicate = [&isReady]() { return isReady.load(); };
+
+		std::thread thread([&waiter = *pWaiter, &isReadyPredicate, &isComplete]() {
+			while (!isReadyPredicate())
+				waiter.wait(isReadyPredicate);
+
+			isComplete = true;
+		});
+
+		// - give the waiter time to become idle
+		test::Pause();
+
+		// Act:
+		isReady = true;
+		pWaiter->notify();
+		WAIT_FOR(isComplete);
+		thread.join();
+
+		// Assert:
+		EXPECT_TRUE(isComplete);
+	}
+
+	TEST(TEST_CLASS, SpinYieldParkWaiterBlocksUntilNotified) {
+		// Arrange:
+		auto pWaiter = CreateConsumerWaiter(ConsumerWaitStrategy::Spin_Yield_Park);
+		std::atomic_bool isReady(false);
+		std::atomic<size_t> numWaits(0);
+
+		std::thread thread([&waiter = *pWaiter, &isReady, &numWaits]() {
+			auto isReadyPredicate = [&isReady]() { return isReady.load(); };
+			while (!isReadyPredicate()) {
+				waiter.wait(isReadyPredicate);
+				++numWaits;
+			}
+		});
+
+		// - wait until the waiter stops spinning, at which point it is parked
+		test::Pause();
+		auto numWaitsBeforeReady = numWaits.load();
+		test::Pause();
+
+		// Sanity: the waiter is parked
+		EXPECT_EQ(numWaitsBeforeReady, numWaits);
+
+		// Act:
+		isReady = true;
+		pWaiter->notify();
+		thread.join();
+
+		// Assert: the parked wait returned
+		EXPECT_EQ(numWaitsBeforeReady + 1, numWaits);
+	}
+
+	// endregion
+}}
@@ -46,4 +46,10 @@ namespace catapult { namespace disruptor {
 		EXPECT_EQ(100u, barrier.level());
 		EXPECT_EQ(2u, barrier.position());
 	}
+
+	TEST(TEST_CLASS, BarrierOccupiesWholeCacheLine) {
+		// Assert:
+		EXPECT_EQ(Cache_Line_Size, alignof(DisruptorBarrier));
+		EXPECT_EQ(Cache_Line_Size, sizeof(DisruptorBarrier));
+	}
 }}
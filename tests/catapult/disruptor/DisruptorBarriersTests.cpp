@@ -68,4 +68,13 @@ namespace catapult { namespace disruptor {
 			EXPECT_EQ(i, barriers[i].level());
 		}
 	}
+
+	TEST(TEST_CLASS, BarriersDoNotShareCacheLines) {
+		// Arrange+Act:
+		DisruptorBarriers barriers(10);
+
+		// Assert:
+		for (auto i = 0u; i < 10; ++i)
+			EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(&barriers[i]) % Cache_Line_Size) << "barrier " << i;
+	}
 }}
@@ -106,6 +106,26 @@ namespace catapult { namespace disruptor {
 		test::AssertAborted(element.completionResult(), 9, static_cast<ConsumerResultSeverity>(8), 7);
 	}
 
+	TEST(TEST_CLASS, CanAbandonDisruptorElement) {
+		// Arrange:
+		test::EntitiesVector entities;
+		auto numHandlerCalls = 0u;
+		auto element = DisruptorElement(test::BlockTraits::CreateInput(3, entities), 17, [&numHandlerCalls](auto, auto) {
+			++numHandlerCalls;
+		});
+
+		// Act:
+		element.abandon(7);
+		element.markProcessingComplete();
+
+		// Assert: input and completion handler were released
+		test::AssertEmptyInput(element.input());
+		EXPECT_EQ(0u, element.id());
+		EXPECT_TRUE(element.isSkipped());
+		test::AssertAborted(element.completionResult(), 0, ConsumerResultSeverity::Failure, 7);
+		EXPECT_EQ(0u, numHandlerCalls);
+	}
+
 	TEST(TEST_CLASS, CanOutputDisruptorElement) {
 		// Arrange:
 		auto pTransaction1 = test::GenerateRandomTransaction();
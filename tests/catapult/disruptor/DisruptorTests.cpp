@@ -25,6 +25,8 @@
 #include "tests/test/nodeps/Waits.h"
 #include "tests/test/other/DisruptorTestUtils.h"
 #include "tests/TestHarness.h"
+#include <set>
+#include <thread>
 
 namespace catapult { namespace disruptor {
 
@@ -206,4 +208,94 @@ namespace catapult { namespace disruptor {
 				EXPECT_TRUE(disruptor.isSkipped(i));
 		}
 	}
+
+	TEST(TEST_CLASS, CanClaimConsecutivePositions) {
+		// Arrange:
+		Disruptor disruptor(16);
+
+		// Act:
+		std::vector<PositionType> positions;
+		for (auto i = 0u; i < 3; ++i) {
+			PositionType position;
+			EXPECT_TRUE(disruptor.tryClaim(0, position));
+			positions.push_back(position);
+		}
+
+		// Assert: claiming does not add elements
+		EXPECT_EQ(std::vector<PositionType>({ 0, 1, 2 }), positions);
+		EXPECT_EQ(0u, disruptor.size());
+		EXPECT_EQ(0u, disruptor.added());
+	}
+
+	TEST(TEST_CLASS, CannotClaimPositionWhenSlowestConsumerIsTooFarBehind) {
+		// Arrange: claim all positions that are available while the slowest consumer is at position 0
+		Disruptor disruptor(16);
+		PositionType position;
+		for (auto i = 0u; i < 15; ++i)
+			disruptor.tryClaim(0, position);
+
+		// Act + Assert:
+		EXPECT_FALSE(disruptor.tryClaim(0, position));
+
+		// - advancing the slowest consumer frees a position
+		EXPECT_TRUE(disruptor.tryClaim(1, position));
+		EXPECT_EQ(15u, position);
+		EXPECT_FALSE(disruptor.tryClaim(1, position));
+	}
+
+	TEST(TEST_CLASS, EmplaceStoresElementAtClaimedPosition) {
+		// Arrange:
+		Disruptor disruptor(16);
+		PositionType position1;
+		PositionType position2;
+		disruptor.tryClaim(0, position1);
+		disruptor.tryClaim(0, position2);
+
+		auto pBlock = test::GenerateEmptyRandomBlock();
+		pBlock->Height = Height(123);
+
+		// Act: fill the second position before the first one
+		auto id = disruptor.emplace(position2, ConsumerInput(model::BlockRange::FromEntity(std::move(pBlock))), [](auto, auto) {});
+
+		// Assert:
+		EXPECT_EQ(1u, disruptor.size());
+		EXPECT_EQ(1u, disruptor.added());
+		EXPECT_EQ(2u, id);
+		EXPECT_EQ(2u, disruptor.elementAt(position2).id());
+		EXPECT_EQ(Height(123), disruptor.elementAt(position2).input().blocks()[0].Block.Height);
+	}
+
+	TEST(TEST_CLASS, ConcurrentClaimsReturnUniquePositions) {
+		// Arrange:
+		constexpr auto Num_Producers = 8u;
+		constexpr auto Num_Claims_Per_Producer = 1000u;
+		Disruptor disruptor(Num_Producers * Num_Claims_Per_Producer + 2);
+		std::vector<std::vector<PositionType>> producerPositions(Num_Producers);
+
+		// Act:
+		std::vector<std::thread> threads;
+		for (auto i = 0u; i < Num_Producers; ++i) {
+			threads.emplace_back([&disruptor, &positions = producerPositions[i]]() {
+				for (auto j = 0u; j < Num_Claims_Per_Producer; ++j) {
+					PositionType position;
+					if (disruptor.tryClaim(0, position))
+						positions.push_back(position);
+				}
+			});
+		}
+
+		for (auto& thread : threads)
+			thread.join();
+
+		// Assert: all positions were claimed exactly once
+		std::set<PositionType> positions;
+		for (const auto& claimedPositions : producerPositions) {
+			EXPECT_EQ(Num_Claims_Per_Producer, claimedPositions.size());
+			positions.insert(claimedPositions.cbegin(), claimedPositions.cend());
+		}
+
+		EXPECT_EQ(Num_Producers * Num_Claims_Per_Producer, positions.size());
+		EXPECT_EQ(0u, *positions.cbegin());
+		EXPECT_EQ(Num_Producers * Num_Claims_Per_Producer - 1, *positions.crbegin());
+	}
 }}
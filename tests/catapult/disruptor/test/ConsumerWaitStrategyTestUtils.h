@@ -0,0 +1,32 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/disruptor/ConsumerDispatcherOptions.h"
+#include "tests/TestHarness.h"
+
+/// Adds tests named \a TEST_NAME for all consumer wait strategies (passed as WaitStrategy template argument).
+#define WAIT_STRATEGY_TEST(TEST_NAME) \
+	template<ConsumerWaitStrategy WaitStrategy> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_BusySpin) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ConsumerWaitStrategy::Busy_Spin>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_SpinYieldPark) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ConsumerWaitStrategy::Spin_Yield_Park>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_TimedBackoff) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ConsumerWaitStrategy::Timed_Backoff>(); } \
+	template<ConsumerWaitStrategy WaitStrategy> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
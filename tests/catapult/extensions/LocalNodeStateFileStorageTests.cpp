@@ -41,6 +41,7 @@
 #include "tests/test/nodeps/Filesystem.h"
 #include "tests/test/plugins/PluginManagerFactory.h"
 #include "tests/TestHarness.h"
+#include <fstream>
 
 namespace catapult { namespace extensions {
 
@@ -301,8 +302,9 @@ namespace catapult { namespace extensions {
 			EXPECT_EQ(expectedView.sub<cache::AccountStateCache>().size(), actualView.sub<cache::AccountStateCache>().size());
 			EXPECT_EQ(expectedView.sub<cache::BlockStatisticCache>().size(), actualView.sub<cache::BlockStatisticCache>().size());
 
-			EXPECT_EQ(3u, test::CountFilesAndDirectories(stateDirectory.path()));
-			for (const auto* supplementalFilename : { "supplemental.dat", "AccountStateCache.dat", "BlockStatisticCache.dat" })
+			EXPECT_EQ(4u, test::CountFilesAndDirectories(stateDirectory.path()));
+			auto supplementalFilenames = { "supplemental.dat", "manifest.dat", "AccountStateCache.dat", "BlockStatisticCache.dat" };
+			for (const auto* supplementalFilename : supplementalFilenames)
 				EXPECT_TRUE(std::filesystem::exists(stateDirectory.file(supplementalFilename))) << supplementalFilename;
 		}
 	}
@@ -317,6 +319,78 @@ namespace catapult { namespace extensions {
 
 	// endregion
 
+	// region LoadStateFromDirectory - verification
+
+	namespace {
+		void OverwriteFileByte(const std::string& filename, int64_t offset, uint8_t value) {
+			std::fstream file(filename, std::ios::in | std::ios::out | std::ios::binary);
+			file.seekp(offset, 0 > offset ? std::ios::end : std::ios::beg);
+			file.put(static_cast<char>(value));
+		}
+
+		template<typename TModify>
+		void RunLoadModifiedCompleteStateTest(TModify modify, bool shouldLoad) {
+			// Arrange: seed and save the cache state with rocks disabled
+			test::TempDirectoryGuard tempDir;
+			auto stateDirectory = config::CatapultDirectory(tempDir.name() + "/zstate");
+			auto blockChainConfig = model::BlockChainConfiguration::Uninitialized();
+			auto originalCache = test::CoreSystemCacheFactory::Create(blockChainConfig);
+			PrepareAndSaveCompleteState(stateDirectory, originalCache);
+
+			// - modify the saved state
+			modify(stateDirectory);
+
+			test::LocalNodeTestState loadedState(
+					blockChainConfig,
+					stateDirectory.str(),
+					test::CoreSystemCacheFactory::Create(blockChainConfig));
+			auto pluginManager = test::CreatePluginManager();
+
+			// Act + Assert:
+			if (shouldLoad) {
+				auto heights = LoadStateFromDirectory(stateDirectory, loadedState.ref(), pluginManager);
+				AssertPreparedData(heights, loadedState.ref());
+				EXPECT_EQ(Block_Cache_Size, loadedState.ref().Cache.createView().sub<cache::BlockStatisticCache>().size());
+			} else {
+				EXPECT_THROW(LoadStateFromDirectory(stateDirectory, loadedState.ref(), pluginManager), catapult_runtime_error);
+
+				// - no sub cache was modified, including ones with valid state files
+				auto cacheView = loadedState.ref().Cache.createView();
+				EXPECT_EQ(0u, cacheView.sub<cache::AccountStateCache>().size());
+				EXPECT_EQ(0u, cacheView.sub<cache::BlockStatisticCache>().size());
+				EXPECT_EQ(Height(0), cacheView.height());
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, CanLoadCompleteStateWithoutManifest) {
+		RunLoadModifiedCompleteStateTest([](const auto& stateDirectory) {
+			ASSERT_TRUE(std::filesystem::remove(stateDirectory.file("manifest.dat")));
+		}, true);
+	}
+
+	TEST(TEST_CLASS, CannotLoadCompleteStateWithUnsupportedManifestVersion) {
+		RunLoadModifiedCompleteStateTest([](const auto& stateDirectory) {
+			OverwriteFileByte(stateDirectory.file("manifest.dat"), 0, 0xFF);
+		}, false);
+	}
+
+	TEST(TEST_CLASS, CannotLoadCompleteStateWhenStateFileIsTruncated) {
+		RunLoadModifiedCompleteStateTest([](const auto& stateDirectory) {
+			auto filename = stateDirectory.file("BlockStatisticCache.dat");
+			std::filesystem::resize_file(filename, std::filesystem::file_size(filename) - 1);
+		}, false);
+	}
+
+	TEST(TEST_CLASS, CannotLoadCompleteStateWhenStateFileIsCorrupt) {
+		RunLoadModifiedCompleteStateTest([](const auto& stateDirectory) {
+			// corrupt the last byte, which is part of the last block statistic and does not affect parsing
+			OverwriteFileByte(stateDirectory.file("BlockStatisticCache.dat"), -1, 0xFF);
+		}, false);
+	}
+
+	// endregion
+
 	// region LoadStateFromDirectory / LocalNodeStateSerializer (CatapultCacheDelta)
 
 	namespace {
@@ -369,8 +443,9 @@ namespace catapult { namespace extensions {
 			EXPECT_EQ(expectedAccountStateCache.highValueAccounts().addresses(), actualAccountStateCache.highValueAccounts().addresses());
 			EXPECT_EQ(expectedView.sub<cache::BlockStatisticCache>().size(), actualView.sub<cache::BlockStatisticCache>().size());
 
-			EXPECT_EQ(3u, test::CountFilesAndDirectories(stateDirectory.path()));
-			for (const auto* supplementalFilename : { "supplemental.dat", "AccountStateCache_summary.dat", "BlockStatisticCache.dat" })
+			EXPECT_EQ(4u, test::CountFilesAndDirectories(stateDirectory.path()));
+			auto supplementalFilenames = { "supplemental.dat", "manifest.dat", "AccountStateCache_summary.dat", "BlockStatisticCache.dat" };
+			for (const auto* supplementalFilename : supplementalFilenames)
 				EXPECT_TRUE(std::filesystem::exists(stateDirectory.file(supplementalFilename))) << supplementalFilename;
 		}
 	}
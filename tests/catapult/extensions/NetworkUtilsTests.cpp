@@ -54,6 +54,7 @@ namespace catapult { namespace extensions {
 			config.Node.ConnectTimeout = utils::TimeSpan::FromSeconds(11);
 			config.Node.SocketWorkingBufferSize = utils::FileSize::FromBytes(512);
 			config.Node.SocketWorkingBufferSensitivity = 987;
+			config.Node.SocketWriteCoalescingSize = utils::FileSize::FromKilobytes(3);
 			config.Node.MaxPacketDataSize = utils::FileSize::FromKilobytes(12);
 			config.Node.ListenInterface = listenInterface;
 
@@ -132,6 +133,7 @@ namespace catapult { namespace extensions {
 		EXPECT_EQ(utils::TimeSpan::FromSeconds(11), settings.Timeout);
 		EXPECT_EQ(utils::FileSize::FromBytes(512), settings.SocketWorkingBufferSize);
 		EXPECT_EQ(987u, settings.SocketWorkingBufferSensitivity);
+		EXPECT_EQ(utils::FileSize::FromKilobytes(3), settings.SocketWriteCoalescingSize);
 		EXPECT_EQ(utils::FileSize::FromKilobytes(12), settings.MaxPacketDataSize);
 		EXPECT_EQ(ionet::IpProtocol::IPv6, settings.OutgoingProtocols);
 
@@ -153,6 +155,7 @@ namespace catapult { namespace extensions {
 		// Assert:
 		EXPECT_EQ(512u, settings.PacketSocketOptions.WorkingBufferSize);
 		EXPECT_EQ(987u, settings.PacketSocketOptions.WorkingBufferSensitivity);
+		EXPECT_EQ(3u * 1024, settings.PacketSocketOptions.WriteCoalescingSize);
 		EXPECT_EQ(12u * 1024, settings.PacketSocketOptions.MaxPacketDataSize);
 
 		EXPECT_EQ(17u, settings.MaxActiveConnections);
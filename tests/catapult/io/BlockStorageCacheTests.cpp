@@ -487,6 +487,241 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region block element cache
+
+	namespace {
+		constexpr auto Large_Cache_Size = utils::FileSize::FromMegabytes(1);
+
+		auto CreateBlockStorageCache(utils::FileSize maxCacheSize) {
+			return std::make_unique<BlockStorageCache>(
+					mocks::CreateMemoryBlockStorage(Delegation_Chain_Size),
+					mocks::CreateMemoryBlockStorage(0),
+					maxCacheSize);
+		}
+
+		utils::FileSize GetBlockElementSize() {
+			// all blocks after nemesis generated by CreateMemoryBlockStorage have the same size
+			auto pCache = CreateBlockStorageCache(Large_Cache_Size);
+			pCache->view().loadBlockElement(Height(2));
+			return pCache->statistics().Size;
+		}
+
+		void AssertStatistics(const BlockStorageCache& cache, uint64_t numHits, uint64_t numMisses, size_t numBlockElements) {
+			auto statistics = cache.statistics();
+			EXPECT_EQ(numHits, statistics.NumHits);
+			EXPECT_EQ(numMisses, statistics.NumMisses);
+			EXPECT_EQ(numBlockElements, statistics.NumBlockElements);
+		}
+	}
+
+	TEST(TEST_CLASS, CacheIsInitiallyEmpty) {
+		// Act:
+		auto pCache = CreateBlockStorageCache(Large_Cache_Size);
+
+		// Assert:
+		AssertStatistics(*pCache, 0, 0, 0);
+		EXPECT_EQ(utils::FileSize(), pCache->statistics().Size);
+	}
+
+	TEST(TEST_CLASS, LoadBlockElementAddsBlockElementToCacheWhenEnabled) {
+		// Arrange:
+		auto pCache = CreateBlockStorageCache(Large_Cache_Size);
+
+		// Act:
+		auto pBlockElement1 = pCache->view().loadBlockElement(Height(5));
+		auto pBlockElement2 = pCache->view().loadBlockElement(Height(5));
+
+		// Assert:
+		EXPECT_EQ(pBlockElement1.get(), pBlockElement2.get());
+		AssertStatistics(*pCache, 1, 1, 1);
+		EXPECT_LT(utils::FileSize(), pCache->statistics().Size);
+	}
+
+	TEST(TEST_CLASS, LoadBlockElementDoesNotAddBlockElementToCacheWhenDisabled) {
+		// Arrange:
+		auto pCache = CreateBlockStorageCache(utils::FileSize());
+
+		// Act:
+		auto pBlockElement1 = pCache->view().loadBlockElement(Height(5));
+		auto pBlockElement2 = pCache->view().loadBlockElement(Height(5));
+
+		// Assert:
+		test::AssertEqual(*pBlockElement1, *pBlockElement2);
+		AssertStatistics(*pCache, 0, 2, 0);
+	}
+
+	TEST(TEST_CLASS, LoadBlockElementAtChainHeightIsAlwaysServedFromCache) {
+		// Arrange:
+		auto pCache = CreateBlockStorageCache(utils::FileSize());
+
+		// Act:
+		auto pBlockElement1 = pCache->view().loadBlockElement(Height(Delegation_Chain_Size));
+		auto pBlockElement2 = pCache->view().loadBlockElement(Height(Delegation_Chain_Size));
+
+		// Assert: lookups at chain height are not counted
+		EXPECT_EQ(pBlockElement1.get(), pBlockElement2.get());
+		AssertStatistics(*pCache, 0, 0, 0);
+	}
+
+	TEST(TEST_CLASS, LoadBlockCanBeServedFromCache) {
+		// Arrange:
+		auto pCache = CreateBlockStorageCache(Large_Cache_Size);
+		auto pBlockElement = pCache->view().loadBlockElement(Height(5));
+
+		// Act:
+		auto pBlock = pCache->view().loadBlock(Height(5));
+
+		// Assert:
+		EXPECT_EQ(&pBlockElement->Block, pBlock.get());
+		AssertStatistics(*pCache, 1, 1, 1);
+	}
+
+	TEST(TEST_CLASS, LoadBlockDoesNotAddBlockToCache) {
+		// Arrange:
+		auto pCache = CreateBlockStorageCache(Large_Cache_Size);
+
+		// Act:
+		pCache->view().loadBlock(Height(5));
+		pCache->view().loadBlock(Height(5));
+
+		// Assert:
+		AssertStatistics(*pCache, 0, 2, 0);
+	}
+
+	TEST(TEST_CLASS, CacheEvictsLeastRecentlyUsedBlockElementsWhenFull) {
+		// Arrange: allow two block elements to be cached
+		auto blockElementSize = GetBlockElementSize();
+		auto pCache = CreateBlockStorageCache(utils::FileSize::FromBytes(2 * blockElementSize.bytes()));
+
+		pCache->view().loadBlockElement(Height(3));
+		pCache->view().loadBlockElement(Height(4));
+		pCache->view().loadBlockElement(Height(3));
+
+		// Act:
+		pCache->view().loadBlockElement(Height(5));
+
+		// Assert: least recently used block element (4) was evicted
+		AssertStatistics(*pCache, 1, 3, 2);
+		EXPECT_EQ(utils::FileSize::FromBytes(2 * blockElementSize.bytes()), pCache->statistics().Size);
+
+		pCache->view().loadBlockElement(Height(3));
+		pCache->view().loadBlockElement(Height(5));
+		AssertStatistics(*pCache, 3, 3, 2);
+
+		pCache->view().loadBlockElement(Height(4));
+		AssertStatistics(*pCache, 3, 4, 2);
+	}
+
+	TEST(TEST_CLASS, SaveBlocksDoesNotAddBlockElementsToCacheWhenCommitIsNotCalled) {
+		// Arrange:
+		auto pCache = CreateBlockStorageCache(Large_Cache_Size);
+		auto blockElements = GenerateBlockElements(3);
+
+		// Act:
+		pCache->modifier().saveBlocks(blockElements.second);
+
+		// Assert:
+		AssertStatistics(*pCache, 0, 0, 0);
+	}
+
+	TEST(TEST_CLASS, SaveBlocksAddsCopiesOfBlockElementsToCacheWhenCommitIsCalled) {
+		// Arrange:
+		auto pCache = CreateBlockStorageCache(Large_Cache_Size);
+		auto blockElements = GenerateBlockElements(3);
+		for (auto& blockElement : blockElements.second)
+			blockElement.OptionalStatement = test::GenerateRandomStatements({ 1, 2 });
+
+		// Act:
+		{
+			auto modifier = pCache->modifier();
+			modifier.saveBlocks(blockElements.second);
+			modifier.commit();
+		}
+
+		// Assert:
+		AssertStatistics(*pCache, 0, 0, 3);
+
+		for (auto i = 0u; i < blockElements.second.size(); ++i) {
+			const auto& blockElement = blockElements.second[i];
+			auto pCachedBlockElement = pCache->view().loadBlockElement(blockElement.Block.Height);
+
+			// - statements are not cached because they are not loaded by loadBlockElement
+			EXPECT_NE(&blockElement.Block, &pCachedBlockElement->Block) << i;
+			EXPECT_FALSE(!!pCachedBlockElement->OptionalStatement) << i;
+
+			auto blockElementWithoutStatement = blockElement;
+			blockElementWithoutStatement.OptionalStatement.reset();
+			test::AssertEqual(blockElementWithoutStatement, *pCachedBlockElement);
+		}
+
+		// - lookup of last block element is served at chain height and is not counted
+		AssertStatistics(*pCache, 2, 0, 3);
+	}
+
+	TEST(TEST_CLASS, SaveBlocksDoesNotAddBlockElementsToCacheWhenDisabled) {
+		// Arrange:
+		auto pCache = CreateBlockStorageCache(utils::FileSize());
+		auto blockElements = GenerateBlockElements(3);
+
+		// Act:
+		{
+			auto modifier = pCache->modifier();
+			modifier.saveBlocks(blockElements.second);
+			modifier.commit();
+		}
+
+		// Assert: block element at chain height was loaded from storage
+		AssertStatistics(*pCache, 0, 0, 0);
+		EXPECT_EQ(utils::FileSize(), pCache->statistics().Size);
+
+		const auto& lastBlockElement = blockElements.second.back();
+		EXPECT_EQ(lastBlockElement.Block.Height, pCache->view().chainHeight());
+		test::AssertEqual(lastBlockElement, *pCache->view().loadBlockElement(lastBlockElement.Block.Height));
+
+		auto pBlockElement = pCache->view().loadBlockElement(blockElements.second[0].Block.Height);
+		test::AssertEqual(blockElements.second[0], *pBlockElement);
+		AssertStatistics(*pCache, 0, 1, 0);
+	}
+
+	TEST(TEST_CLASS, DropBlocksAfterRemovesBlockElementsFromCacheWhenCommitIsCalled) {
+		// Arrange: cache block elements at heights 5 to 7
+		auto pCache = CreateBlockStorageCache(Large_Cache_Size);
+		for (auto height = Height(5); height <= Height(7); height = height + Height(1))
+			pCache->view().loadBlockElement(height);
+
+		auto pNewBlock = test::GenerateBlockWithTransactions(5, Height(6));
+		auto newBlockElement = test::CreateBlockElementForSaveTests(*pNewBlock);
+
+		// Act:
+		{
+			auto modifier = pCache->modifier();
+			modifier.dropBlocksAfter(Height(5));
+			modifier.saveBlock(newBlockElement);
+			modifier.commit();
+		}
+
+		// Assert: 7 was removed and 6 was replaced
+		AssertStatistics(*pCache, 0, 3, 2);
+		test::AssertEqual(newBlockElement, *pCache->view().loadBlockElement(Height(6)));
+		EXPECT_EQ(Height(6), pCache->view().chainHeight());
+		AssertStatistics(*pCache, 0, 3, 2);
+	}
+
+	TEST(TEST_CLASS, DropBlocksAfterDoesNotRemoveBlockElementsFromCacheWhenCommitIsNotCalled) {
+		// Arrange:
+		auto pCache = CreateBlockStorageCache(Large_Cache_Size);
+		for (auto height = Height(5); height <= Height(7); height = height + Height(1))
+			pCache->view().loadBlockElement(height);
+
+		// Act:
+		pCache->modifier().dropBlocksAfter(Height(5));
+
+		// Assert:
+		AssertStatistics(*pCache, 0, 3, 3);
+	}
+
+	// endregion
+
 	// region synchronization
 
 	namespace {
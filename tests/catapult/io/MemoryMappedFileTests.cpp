@@ -0,0 +1,110 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/MemoryMappedFile.h"
+#include "catapult/io/RawFile.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS MemoryMappedFileTests
+
+	namespace {
+		auto WriteRandomVectorToFile(const std::string& pathname, size_t size) {
+			auto data = test::GenerateRandomVector(size);
+			RawFile file(pathname, OpenMode::Read_Write);
+			file.write(data);
+			return data;
+		}
+	}
+
+	TEST(TEST_CLASS, CannotMapNonexistentFile) {
+		// Arrange:
+		test::TempFileGuard guard("test.dat");
+
+		// Act + Assert:
+		EXPECT_THROW(MemoryMappedFile(guard.name()), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CanMapEmptyFile) {
+		// Arrange:
+		test::TempFileGuard guard("test.dat");
+		WriteRandomVectorToFile(guard.name(), 0);
+
+		// Act:
+		MemoryMappedFile mappedFile(guard.name());
+
+		// Assert:
+		EXPECT_FALSE(!!mappedFile.data());
+		EXPECT_EQ(0u, mappedFile.size());
+		EXPECT_EQ(0u, mappedFile.buffer().Size);
+	}
+
+	TEST(TEST_CLASS, CanMapFile) {
+		// Arrange:
+		test::TempFileGuard guard("test.dat");
+		auto data = WriteRandomVectorToFile(guard.name(), 1234);
+
+		// Act:
+		MemoryMappedFile mappedFile(guard.name());
+
+		// Assert:
+		ASSERT_EQ(1234u, mappedFile.size());
+		EXPECT_EQ_MEMORY(data.data(), mappedFile.data(), data.size());
+
+		EXPECT_EQ(mappedFile.data(), mappedFile.buffer().pData);
+		EXPECT_EQ(1234u, mappedFile.buffer().Size);
+	}
+
+	TEST(TEST_CLASS, MappingIsNotExtendedWhenFileIsAppended) {
+		// Arrange:
+		test::TempFileGuard guard("test.dat");
+		auto data = WriteRandomVectorToFile(guard.name(), 1234);
+		MemoryMappedFile mappedFile(guard.name());
+
+		// Act:
+		{
+			RawFile file(guard.name(), OpenMode::Read_Append);
+			file.seek(file.size());
+			file.write(test::GenerateRandomVector(100));
+		}
+
+		// Assert:
+		ASSERT_EQ(1234u, mappedFile.size());
+		EXPECT_EQ_MEMORY(data.data(), mappedFile.data(), data.size());
+	}
+
+	TEST(TEST_CLASS, MappingRemainsValidWhenFileIsRemoved) {
+		// Arrange:
+		test::TempFileGuard guard("test.dat");
+		auto data = WriteRandomVectorToFile(guard.name(), 1234);
+		MemoryMappedFile mappedFile(guard.name());
+
+		// Act:
+		std::filesystem::remove(guard.name());
+
+		// Assert:
+		EXPECT_FALSE(std::filesystem::exists(guard.name()));
+		ASSERT_EQ(1234u, mappedFile.size());
+		EXPECT_EQ_MEMORY(data.data(), mappedFile.data(), data.size());
+	}
+}}
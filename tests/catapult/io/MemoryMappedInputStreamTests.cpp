@@ -0,0 +1,147 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/MemoryMappedInputStream.h"
+#include "catapult/io/BufferedFileStream.h"
+#include "tests/catapult/io/test/StreamTests.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS MemoryMappedInputStreamTests
+
+	// region basic stream tests
+
+	namespace {
+		class MemoryMappedInputStreamContext {
+		public:
+			explicit MemoryMappedInputStreamContext(const char* name) : m_guard(name)
+			{}
+
+			auto outputStream() const {
+				return std::make_unique<BufferedOutputFileStream>(RawFile(m_guard.name(), OpenMode::Read_Write));
+			}
+
+			auto inputStream() const {
+				return std::make_unique<MemoryMappedInputStream>(m_guard.name());
+			}
+
+		private:
+			test::TempFileGuard m_guard;
+		};
+
+		void WriteToFile(const std::string& pathname, const std::vector<uint8_t>& data) {
+			RawFile file(pathname, OpenMode::Read_Write);
+			file.write(data);
+		}
+	}
+
+	DEFINE_STREAM_TESTS(MemoryMappedInputStreamContext)
+
+	// endregion
+
+	// region constructor
+
+	TEST(TEST_CLASS, CannotCreateStreamAroundNonexistentFile) {
+		// Arrange:
+		test::TempFileGuard guard("test.dat");
+
+		// Act + Assert:
+		EXPECT_THROW(MemoryMappedInputStream(guard.name()), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CanCreateStreamAroundFile) {
+		// Arrange:
+		test::TempFileGuard guard("test.dat");
+		auto data = test::GenerateRandomVector(123);
+		WriteToFile(guard.name(), data);
+
+		// Act:
+		MemoryMappedInputStream stream(guard.name());
+
+		// Assert: buffer exposes the whole file
+		ASSERT_EQ(123u, stream.buffer().Size);
+		EXPECT_EQ_MEMORY(data.data(), stream.buffer().pData, data.size());
+		EXPECT_EQ(0u, stream.position());
+		EXPECT_FALSE(stream.eof());
+	}
+
+	// endregion
+
+	// region read
+
+	TEST(TEST_CLASS, ReadAdvancesPositionWithoutChangingBuffer) {
+		// Arrange:
+		test::TempFileGuard guard("test.dat");
+		auto data = test::GenerateRandomVector(123);
+		WriteToFile(guard.name(), data);
+		MemoryMappedInputStream stream(guard.name());
+
+		// Act:
+		std::vector<uint8_t> part(100);
+		stream.read(part);
+
+		// Assert:
+		EXPECT_EQ(100u, stream.position());
+		EXPECT_FALSE(stream.eof());
+		EXPECT_EQ_MEMORY(data.data(), part.data(), part.size());
+
+		EXPECT_EQ(123u, stream.buffer().Size);
+		EXPECT_EQ_MEMORY(data.data(), stream.buffer().pData, data.size());
+	}
+
+	TEST(TEST_CLASS, CanReadToEof) {
+		// Arrange:
+		test::TempFileGuard guard("test.dat");
+		auto data = test::GenerateRandomVector(123);
+		WriteToFile(guard.name(), data);
+		MemoryMappedInputStream stream(guard.name());
+
+		// Act:
+		std::vector<uint8_t> part1(100);
+		std::vector<uint8_t> part2(23);
+		stream.read(part1);
+		stream.read(part2);
+
+		// Assert:
+		EXPECT_EQ(123u, stream.position());
+		EXPECT_TRUE(stream.eof());
+		EXPECT_EQ_MEMORY(data.data(), part1.data(), part1.size());
+		EXPECT_EQ_MEMORY(data.data() + 100, part2.data(), part2.size());
+	}
+
+	TEST(TEST_CLASS, CannotReadPastEof) {
+		// Arrange:
+		test::TempFileGuard guard("test.dat");
+		WriteToFile(guard.name(), test::GenerateRandomVector(123));
+		MemoryMappedInputStream stream(guard.name());
+
+		std::vector<uint8_t> part(100);
+		stream.read(part);
+
+		// Act + Assert:
+		EXPECT_THROW(stream.read(part), catapult_file_io_error);
+		EXPECT_EQ(100u, stream.position());
+	}
+
+	// endregion
+}}
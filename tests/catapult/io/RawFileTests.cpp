@@ -248,6 +248,116 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region readAt
+
+	TEST(TEST_CLASS, ReadAtReturnsProperDataWithoutChangingPosition) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		auto inputData = WriteRandomVectorToFile(guard);
+		RawFile rawFile(guard.name(), OpenMode::Read_Only);
+		rawFile.seek(10ull);
+
+		// Act:
+		auto outputData = std::vector<uint8_t>(50);
+		rawFile.readAt(23, outputData);
+
+		// Assert:
+		EXPECT_TRUE(std::equal(inputData.cbegin() + 23, inputData.cbegin() + 73, outputData.cbegin(), outputData.cend()));
+		EXPECT_EQ(inputData.size(), rawFile.size());
+		EXPECT_EQ(10ull, rawFile.position());
+	}
+
+	TEST(TEST_CLASS, ReadAtCanReadAllData) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		auto inputData = WriteRandomVectorToFile(guard);
+		RawFile rawFile(guard.name(), OpenMode::Read_Only);
+
+		// Act:
+		auto outputData = std::vector<uint8_t>(Default_Bytes_Written);
+		rawFile.readAt(0, outputData);
+
+		// Assert:
+		EXPECT_EQ(inputData, outputData);
+		EXPECT_EQ(0ull, rawFile.position());
+	}
+
+	TEST(TEST_CLASS, ReadAtThrowsOnOobRead) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		WriteRandomVectorToFile(guard);
+		RawFile rawFile(guard.name(), OpenMode::Read_Only);
+
+		// Act + Assert:
+		auto outputData = std::vector<uint8_t>(24);
+		EXPECT_THROW(rawFile.readAt(Default_Bytes_Written - 23, outputData), catapult_file_io_error);
+		EXPECT_THROW(rawFile.readAt(Default_Bytes_Written + 1, outputData), catapult_file_io_error);
+	}
+
+	// endregion
+
+	// region truncate
+
+	TEST(TEST_CLASS, TruncateShrinksFileAndAdjustsPosition) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		auto inputData = test::GenerateRandomVector(Default_Bytes_Written);
+		RawFile rawFile(guard.name(), OpenMode::Read_Write);
+		rawFile.write(inputData);
+
+		// Act:
+		rawFile.truncate(50);
+
+		// Assert:
+		EXPECT_EQ(50ull, rawFile.size());
+		EXPECT_EQ(50ull, rawFile.position());
+
+		auto outputData = std::vector<uint8_t>(50);
+		rawFile.readAt(0, outputData);
+		EXPECT_TRUE(std::equal(inputData.cbegin(), inputData.cbegin() + 50, outputData.cbegin(), outputData.cend()));
+	}
+
+	TEST(TEST_CLASS, TruncateDoesNotChangePositionBeforeNewEnd) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		auto inputData = test::GenerateRandomVector(Default_Bytes_Written);
+		RawFile rawFile(guard.name(), OpenMode::Read_Write);
+		rawFile.write(inputData);
+		rawFile.seek(10ull);
+
+		// Act:
+		rawFile.truncate(50);
+
+		// Assert:
+		EXPECT_EQ(50ull, rawFile.size());
+		EXPECT_EQ(10ull, rawFile.position());
+	}
+
+	TEST(TEST_CLASS, TruncatedFileCanBeAppended) {
+		// Arrange:
+		TempFileGuard guard("test.dat");
+		auto inputData1 = test::GenerateRandomVector(Default_Bytes_Written);
+		auto inputData2 = test::GenerateRandomVector(Default_Bytes_Written);
+		{
+			RawFile rawFile(guard.name(), OpenMode::Read_Write);
+			rawFile.write(inputData1);
+			rawFile.truncate(50);
+			rawFile.write(inputData2);
+		}
+
+		// Act:
+		RawFile rawFile(guard.name(), OpenMode::Read_Only);
+		auto outputData = std::vector<uint8_t>(50 + Default_Bytes_Written);
+		rawFile.read(outputData);
+
+		// Assert:
+		EXPECT_EQ(50ull + Default_Bytes_Written, rawFile.size());
+		EXPECT_TRUE(std::equal(inputData1.cbegin(), inputData1.cbegin() + 50, outputData.cbegin(), outputData.cbegin() + 50));
+		EXPECT_TRUE(std::equal(inputData2.cbegin(), inputData2.cend(), outputData.cbegin() + 50, outputData.cend()));
+	}
+
+	// endregion
+
 	// region write
 
 	WRITING_TRAITS_BASED_TEST(WriteAltersSizeAndPosition) {
@@ -0,0 +1,541 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/SegmentedBlockStorage.h"
+#include "tests/test/core/BlockStorageTests.h"
+#include "tests/test/core/StorageTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/TestHarness.h"
+#include <filesystem>
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS SegmentedBlockStorageTests
+
+	namespace {
+		constexpr auto Segment_Index_Entry_Size = sizeof(SegmentedBlockStorage::SegmentIndexEntry);
+
+		struct SegmentedTraits {
+			using Guard = test::TempDirectoryGuard;
+			using StorageType = SegmentedBlockStorage;
+
+			static std::unique_ptr<StorageType> OpenStorage(const std::string& destination) {
+				return std::make_unique<StorageType>(destination);
+			}
+
+			static std::unique_ptr<StorageType> PrepareStorage(const std::string& destination, Height height = Height()) {
+				test::PrepareStorage(destination);
+				if (Height() != height)
+					test::FakeHeight(destination, height.unwrap());
+
+				return OpenStorage(destination);
+			}
+		};
+
+		uint64_t GetFileSize(const std::string& path) {
+			return RawFile(path, OpenMode::Read_Only, LockMode::None).size();
+		}
+
+		std::string GetSegmentDataPath(const std::string& directory, const std::string& segmentName = "00000") {
+			return directory + "/" + segmentName + "/segment.dat";
+		}
+
+		std::string GetSegmentIndexPath(const std::string& directory, const std::string& segmentName = "00000") {
+			return directory + "/" + segmentName + "/segment.index.dat";
+		}
+
+		std::vector<model::BlockElement> SaveBlocks(
+				BlockStorage& storage,
+				std::vector<std::unique_ptr<model::Block>>& blocks,
+				Height startHeight,
+				Height endHeight) {
+			std::vector<model::BlockElement> blockElements;
+			for (auto height = startHeight; height <= endHeight; height = height + Height(1)) {
+				blocks.push_back(test::GenerateBlockWithTransactions(5, height));
+				blockElements.push_back(test::CreateBlockElementForSaveTests(*blocks.back()));
+				blockElements.back().OptionalStatement = test::GenerateRandomStatements({ 3, 5, 7 });
+				storage.saveBlock(blockElements.back());
+			}
+
+			return blockElements;
+		}
+
+		void AssertStorage(const BlockStorage& storage, const std::vector<model::BlockElement>& blockElements) {
+			for (const auto& blockElement : blockElements) {
+				auto pBlockElement = test::LoadBlockElementWithStatements(storage, blockElement.Block.Height);
+				test::AssertEqual(blockElement, *pBlockElement);
+			}
+		}
+	}
+
+	DEFINE_BLOCK_STORAGE_TESTS(SegmentedTraits)
+	DEFINE_PRUNABLE_BLOCK_STORAGE_TESTS(SegmentedTraits)
+
+	// region modes
+
+	TEST(TEST_CLASS, HashIndexCanBeDisabled) {
+		// Arrange: prepare a directory without a hashes file
+		test::TempDirectoryGuard tempDir;
+		SegmentedBlockStorage storage(tempDir.name(), FileBlockStorageMode::None);
+
+		// - save a block
+		auto pBlock = test::GenerateBlockWithTransactions(5, Height(1));
+		auto blockElement = test::CreateBlockElementForSaveTests(*pBlock);
+		storage.saveBlock(blockElement);
+
+		// Act:
+		auto pStorageBlockElement = storage.loadBlockElement(Height(1));
+
+		// Assert: hashes are not present
+		EXPECT_THROW(storage.loadHashesFrom(Height(1), 100), catapult_invalid_argument);
+		test::AssertEqual(blockElement, *pStorageBlockElement);
+	}
+
+	// endregion
+
+	// region folder management
+
+	TEST(TEST_CLASS, PurgeDoesNotDeleteDataDirectory) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		SegmentedBlockStorage storage(tempDir.name());
+
+		// Act:
+		storage.purge();
+
+		// Assert:
+		EXPECT_TRUE(std::filesystem::exists(tempDir.name()));
+	}
+
+	TEST(TEST_CLASS, SaveBlockAppendsToSegmentFiles) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pStorage = SegmentedTraits::PrepareStorage(tempDir.name());
+
+		// Act:
+		std::vector<std::unique_ptr<model::Block>> blocks;
+		SaveBlocks(*pStorage, blocks, Height(2), Height(5));
+
+		// Assert: no per block files were created
+		for (auto height : { 2u, 3u, 4u, 5u }) {
+			EXPECT_FALSE(std::filesystem::exists(tempDir.name() + "/00000/0000" + std::to_string(height) + ".dat")) << height;
+			EXPECT_FALSE(std::filesystem::exists(tempDir.name() + "/00000/0000" + std::to_string(height) + ".stmt")) << height;
+		}
+
+		// - index contains (unset) entries for heights zero and one
+		EXPECT_EQ(6 * Segment_Index_Entry_Size, GetFileSize(GetSegmentIndexPath(tempDir.name())));
+		EXPECT_LT(0u, GetFileSize(GetSegmentDataPath(tempDir.name())));
+	}
+
+	// endregion
+
+	// region disk persistence
+
+	TEST(TEST_CLASS, CanReadSavedBlocksAcrossDifferentStorageInstances) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		std::vector<std::unique_ptr<model::Block>> blocks;
+		std::vector<model::BlockElement> blockElements;
+		{
+			auto pStorage = SegmentedTraits::PrepareStorage(tempDir.name());
+			blockElements = SaveBlocks(*pStorage, blocks, Height(2), Height(5));
+		}
+
+		// Act:
+		SegmentedBlockStorage storage(tempDir.name());
+
+		// Assert:
+		EXPECT_EQ(Height(5), storage.chainHeight());
+		AssertStorage(storage, blockElements);
+	}
+
+	TEST(TEST_CLASS, CanReadBlocksSavedByFileBlockStorage) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		std::vector<std::unique_ptr<model::Block>> blocks;
+		std::vector<model::BlockElement> blockElements;
+		{
+			test::PrepareStorage(tempDir.name());
+			FileBlockStorage legacyStorage(tempDir.name());
+			blockElements = SaveBlocks(legacyStorage, blocks, Height(2), Height(5));
+		}
+
+		// Act:
+		SegmentedBlockStorage storage(tempDir.name());
+
+		// Assert:
+		EXPECT_EQ(Height(5), storage.chainHeight());
+		AssertStorage(storage, blockElements);
+		EXPECT_FALSE(std::filesystem::exists(GetSegmentIndexPath(tempDir.name())));
+	}
+
+	TEST(TEST_CLASS, CanContinueChainSavedByFileBlockStorage) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		std::vector<std::unique_ptr<model::Block>> blocks;
+		std::vector<model::BlockElement> blockElements;
+		{
+			test::PrepareStorage(tempDir.name());
+			FileBlockStorage legacyStorage(tempDir.name());
+			blockElements = SaveBlocks(legacyStorage, blocks, Height(2), Height(3));
+		}
+
+		SegmentedBlockStorage storage(tempDir.name());
+
+		// Act:
+		auto newBlockElements = SaveBlocks(storage, blocks, Height(4), Height(5));
+
+		// Assert:
+		EXPECT_EQ(Height(5), storage.chainHeight());
+		AssertStorage(storage, blockElements);
+		AssertStorage(storage, newBlockElements);
+		EXPECT_EQ(6 * Segment_Index_Entry_Size, GetFileSize(GetSegmentIndexPath(tempDir.name())));
+	}
+
+	// endregion
+
+	// region migrateLegacyBlocks
+
+	namespace {
+		void AssertCanMigrateLegacyBlocks(LegacyBlockFilesAction legacyBlockFilesAction, bool shouldRemoveLegacyFiles) {
+			// Arrange: save blocks 2-3 in per-block files and blocks 4-5 in segment files
+			test::TempDirectoryGuard tempDir;
+			std::vector<std::unique_ptr<model::Block>> blocks;
+			std::vector<model::BlockElement> blockElements;
+			{
+				test::PrepareStorage(tempDir.name());
+				FileBlockStorage legacyStorage(tempDir.name());
+				blockElements = SaveBlocks(legacyStorage, blocks, Height(2), Height(3));
+			}
+
+			SegmentedBlockStorage storage(tempDir.name());
+			auto newBlockElements = SaveBlocks(storage, blocks, Height(4), Height(5));
+
+			// Act:
+			auto numMigratedBlocks = storage.migrateLegacyBlocks(legacyBlockFilesAction);
+
+			// Assert: nemesis and blocks 2-3 were migrated
+			EXPECT_EQ(3u, numMigratedBlocks);
+			EXPECT_EQ(Height(5), storage.chainHeight());
+			AssertStorage(storage, blockElements);
+			AssertStorage(storage, newBlockElements);
+
+			for (auto height : { 1u, 2u, 3u }) {
+				auto legacyBlockPath = tempDir.name() + "/00000/0000" + std::to_string(height) + ".dat";
+				EXPECT_EQ(!shouldRemoveLegacyFiles, std::filesystem::exists(legacyBlockPath)) << height;
+			}
+
+			// - no blocks are left to migrate
+			EXPECT_EQ(0u, storage.migrateLegacyBlocks(legacyBlockFilesAction));
+		}
+	}
+
+	TEST(TEST_CLASS, MigrateLegacyBlocksCopiesBlocksIntoSegmentFiles_Keep) {
+		AssertCanMigrateLegacyBlocks(LegacyBlockFilesAction::Keep, false);
+	}
+
+	TEST(TEST_CLASS, MigrateLegacyBlocksCopiesBlocksIntoSegmentFiles_Remove) {
+		AssertCanMigrateLegacyBlocks(LegacyBlockFilesAction::Remove, true);
+	}
+
+	TEST(TEST_CLASS, CanSaveBlocksAfterMigratingLegacyBlocks) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		std::vector<std::unique_ptr<model::Block>> blocks;
+		std::vector<model::BlockElement> blockElements;
+		{
+			test::PrepareStorage(tempDir.name());
+			FileBlockStorage legacyStorage(tempDir.name());
+			blockElements = SaveBlocks(legacyStorage, blocks, Height(2), Height(3));
+		}
+
+		SegmentedBlockStorage storage(tempDir.name());
+		SaveBlocks(storage, blocks, Height(4), Height(5));
+		storage.migrateLegacyBlocks(LegacyBlockFilesAction::Remove);
+
+		// Act: migrated blocks are stored after block 5, so they must not be overwritten
+		storage.dropBlocksAfter(Height(4));
+		auto newBlockElements = SaveBlocks(storage, blocks, Height(5), Height(7));
+
+		// Assert:
+		EXPECT_EQ(Height(7), storage.chainHeight());
+		AssertStorage(storage, blockElements);
+		AssertStorage(storage, newBlockElements);
+	}
+
+	// endregion
+
+	// region tail truncation
+
+	TEST(TEST_CLASS, DropBlocksAfterTruncatesSegmentFiles) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pStorage = SegmentedTraits::PrepareStorage(tempDir.name());
+
+		std::vector<std::unique_ptr<model::Block>> blocks;
+		auto blockElements = SaveBlocks(*pStorage, blocks, Height(2), Height(3));
+		auto expectedDataSize = GetFileSize(GetSegmentDataPath(tempDir.name()));
+		SaveBlocks(*pStorage, blocks, Height(4), Height(7));
+
+		// Act:
+		pStorage->dropBlocksAfter(Height(3));
+
+		// Assert:
+		EXPECT_EQ(Height(3), pStorage->chainHeight());
+		EXPECT_EQ(expectedDataSize, GetFileSize(GetSegmentDataPath(tempDir.name())));
+		EXPECT_EQ(4 * Segment_Index_Entry_Size, GetFileSize(GetSegmentIndexPath(tempDir.name())));
+		AssertStorage(*pStorage, blockElements);
+	}
+
+	TEST(TEST_CLASS, DropBlocksAfterRemovesLaterSegmentFiles) {
+		// Arrange: start close to segment boundary
+		test::TempDirectoryGuard tempDir;
+		constexpr auto Start_Height = Files_Per_Storage_Directory - 2;
+		auto pStorage = SegmentedTraits::PrepareStorage(tempDir.name(), Height(Start_Height));
+
+		std::vector<std::unique_ptr<model::Block>> blocks;
+		auto blockElements = SaveBlocks(*pStorage, blocks, Height(Start_Height), Height(Start_Height + 1));
+		SaveBlocks(*pStorage, blocks, Height(Start_Height + 2), Height(Start_Height + 4));
+
+		// Sanity:
+		EXPECT_TRUE(std::filesystem::exists(GetSegmentDataPath(tempDir.name(), "00001")));
+
+		// Act:
+		pStorage->dropBlocksAfter(Height(Start_Height + 1));
+
+		// Assert:
+		EXPECT_EQ(Height(Start_Height + 1), pStorage->chainHeight());
+		EXPECT_FALSE(std::filesystem::exists(GetSegmentDataPath(tempDir.name(), "00001")));
+		EXPECT_FALSE(std::filesystem::exists(GetSegmentIndexPath(tempDir.name(), "00001")));
+		AssertStorage(*pStorage, blockElements);
+	}
+
+	TEST(TEST_CLASS, SaveBlockOverwritesDataLeftByInterruptedSave) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		std::vector<std::unique_ptr<model::Block>> blocks;
+		std::vector<model::BlockElement> blockElements;
+		{
+			auto pStorage = SegmentedTraits::PrepareStorage(tempDir.name());
+			blockElements = SaveBlocks(*pStorage, blocks, Height(2), Height(3));
+		}
+
+		// - simulate an interrupted save by appending some data without updating chain height
+		auto dataSize = GetFileSize(GetSegmentDataPath(tempDir.name()));
+		{
+			RawFile file(GetSegmentDataPath(tempDir.name()), OpenMode::Read_Append);
+			file.seek(file.size());
+			file.write(test::GenerateRandomVector(123));
+		}
+
+		SegmentedBlockStorage storage(tempDir.name());
+
+		// Act:
+		auto newBlockElements = SaveBlocks(storage, blocks, Height(4), Height(4));
+
+		// Assert: unreferenced data was overwritten
+		EXPECT_EQ(Height(4), storage.chainHeight());
+		AssertStorage(storage, blockElements);
+		AssertStorage(storage, newBlockElements);
+
+		SegmentedBlockStorage::SegmentIndexEntry entry;
+		RawFile indexFile(GetSegmentIndexPath(tempDir.name()), OpenMode::Read_Only, LockMode::None);
+		indexFile.readAt(4 * Segment_Index_Entry_Size, { reinterpret_cast<uint8_t*>(&entry), Segment_Index_Entry_Size });
+
+		EXPECT_EQ(dataSize, entry.Offset);
+		EXPECT_EQ(dataSize + entry.BlockElementSize + entry.BlockStatementSize, GetFileSize(GetSegmentDataPath(tempDir.name())));
+	}
+
+	// endregion
+
+	// region memory mapping
+
+	namespace {
+		std::vector<uint8_t> CopyBlock(const model::Block& block) {
+			const auto* pBlockData = reinterpret_cast<const uint8_t*>(&block);
+			return std::vector<uint8_t>(pBlockData, pBlockData + block.Size);
+		}
+
+		void AssertBlock(const std::vector<uint8_t>& expectedBlockData, const model::Block& block) {
+			ASSERT_EQ(expectedBlockData.size(), block.Size);
+			EXPECT_EQ_MEMORY(expectedBlockData.data(), &block, block.Size);
+		}
+	}
+
+	TEST(TEST_CLASS, LoadBlockReturnsBlocksAliasingSharedSegmentData) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pStorage = SegmentedTraits::PrepareStorage(tempDir.name());
+
+		std::vector<std::unique_ptr<model::Block>> blocks;
+		SaveBlocks(*pStorage, blocks, Height(2), Height(3));
+
+		// Act:
+		auto pBlock1 = pStorage->loadBlock(Height(2));
+		auto pBlock2 = pStorage->loadBlock(Height(2));
+		auto pBlock3 = pStorage->loadBlock(Height(3));
+
+		// Assert: blocks are not copied and are separated by the distance between their offsets in the data file
+		std::vector<SegmentedBlockStorage::SegmentIndexEntry> entries(4);
+		RawFile indexFile(GetSegmentIndexPath(tempDir.name()), OpenMode::Read_Only, LockMode::None);
+		indexFile.read({ reinterpret_cast<uint8_t*>(entries.data()), entries.size() * Segment_Index_Entry_Size });
+
+		EXPECT_EQ(pBlock1.get(), pBlock2.get());
+		EXPECT_EQ(
+				entries[3].Offset - entries[2].Offset,
+				static_cast<uint64_t>(reinterpret_cast<const uint8_t*>(pBlock3.get()) - reinterpret_cast<const uint8_t*>(pBlock1.get())));
+		EXPECT_EQ(*blocks[0], *pBlock1);
+		EXPECT_EQ(*blocks[1], *pBlock3);
+	}
+
+	TEST(TEST_CLASS, SaveBlockDoesNotRemapSegmentDataOfPreviouslySavedBlocks) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pStorage = SegmentedTraits::PrepareStorage(tempDir.name());
+
+		std::vector<std::unique_ptr<model::Block>> blocks;
+		SaveBlocks(*pStorage, blocks, Height(2), Height(3));
+		auto pBlock1 = pStorage->loadBlock(Height(2));
+
+		// Act:
+		SaveBlocks(*pStorage, blocks, Height(4), Height(4));
+		auto pBlock2 = pStorage->loadBlock(Height(2));
+		auto pBlock3 = pStorage->loadBlock(Height(4));
+
+		// Assert: cached mapping was reused for the old block and the new block was mapped when it was loaded
+		EXPECT_EQ(pBlock1.get(), pBlock2.get());
+		EXPECT_EQ(*blocks[0], *pBlock2);
+		EXPECT_EQ(*blocks[2], *pBlock3);
+	}
+
+	TEST(TEST_CLASS, LoadedBlockRemainsValidAfterStorageIsPurgedAndDestroyed) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pStorage = SegmentedTraits::PrepareStorage(tempDir.name());
+
+		std::vector<std::unique_ptr<model::Block>> blocks;
+		SaveBlocks(*pStorage, blocks, Height(2), Height(3));
+		auto pBlock = pStorage->loadBlock(Height(3));
+
+		// Act:
+		pStorage->purge();
+		pStorage.reset();
+
+		// Assert:
+		EXPECT_EQ(*blocks[1], *pBlock);
+	}
+
+	TEST(TEST_CLASS, DropBlocksAfterPreservesSegmentDataReferencedByLoadedBlocks) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pStorage = SegmentedTraits::PrepareStorage(tempDir.name());
+
+		std::vector<std::unique_ptr<model::Block>> blocks;
+		auto blockElements = SaveBlocks(*pStorage, blocks, Height(2), Height(3));
+		SaveBlocks(*pStorage, blocks, Height(4), Height(7));
+		auto dataSize = GetFileSize(GetSegmentDataPath(tempDir.name()));
+
+		auto pBlock = pStorage->loadBlock(Height(5));
+		auto blockData = CopyBlock(*pBlock);
+
+		// Act:
+		pStorage->dropBlocksAfter(Height(3));
+		auto newBlockElements = SaveBlocks(*pStorage, blocks, Height(4), Height(5));
+
+		// Assert: dropped data was neither truncated nor overwritten and new blocks were saved in per-block files
+		EXPECT_EQ(Height(5), pStorage->chainHeight());
+		EXPECT_EQ(dataSize, GetFileSize(GetSegmentDataPath(tempDir.name())));
+		EXPECT_TRUE(std::filesystem::exists(tempDir.name() + "/00000/00004.dat"));
+		EXPECT_TRUE(std::filesystem::exists(tempDir.name() + "/00000/00005.dat"));
+		AssertBlock(blockData, *pBlock);
+
+		AssertStorage(*pStorage, blockElements);
+		AssertStorage(*pStorage, newBlockElements);
+	}
+
+	TEST(TEST_CLASS, SaveBlockTruncatesSegmentDataAfterLoadedBlocksAreReleased) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pStorage = SegmentedTraits::PrepareStorage(tempDir.name());
+
+		std::vector<std::unique_ptr<model::Block>> blocks;
+		auto blockElements = SaveBlocks(*pStorage, blocks, Height(2), Height(3));
+		auto retainedDataSize = GetFileSize(GetSegmentDataPath(tempDir.name()));
+		SaveBlocks(*pStorage, blocks, Height(4), Height(7));
+
+		auto pBlock = pStorage->loadBlock(Height(5));
+		pStorage->dropBlocksAfter(Height(3));
+		auto newBlockElements = SaveBlocks(*pStorage, blocks, Height(4), Height(5));
+
+		// Act:
+		pBlock.reset();
+		auto lastBlockElements = SaveBlocks(*pStorage, blocks, Height(6), Height(6));
+
+		// Assert: dropped data was truncated and blocks saved in per-block files were moved into the segment
+		std::vector<SegmentedBlockStorage::SegmentIndexEntry> entries(7);
+		RawFile indexFile(GetSegmentIndexPath(tempDir.name()), OpenMode::Read_Only, LockMode::None);
+		indexFile.read({ reinterpret_cast<uint8_t*>(entries.data()), entries.size() * Segment_Index_Entry_Size });
+
+		EXPECT_EQ(Height(6), pStorage->chainHeight());
+		EXPECT_EQ(retainedDataSize, entries[4].Offset);
+		EXPECT_EQ(
+				entries[6].Offset + entries[6].BlockElementSize + entries[6].BlockStatementSize,
+				GetFileSize(GetSegmentDataPath(tempDir.name())));
+		EXPECT_FALSE(std::filesystem::exists(tempDir.name() + "/00000/00004.dat"));
+		EXPECT_FALSE(std::filesystem::exists(tempDir.name() + "/00000/00005.dat"));
+
+		AssertStorage(*pStorage, blockElements);
+		AssertStorage(*pStorage, newBlockElements);
+		AssertStorage(*pStorage, lastBlockElements);
+	}
+
+	TEST(TEST_CLASS, DropBlocksAfterPreservesLaterSegmentDataReferencedByLoadedBlocks) {
+		// Arrange: start close to segment boundary
+		test::TempDirectoryGuard tempDir;
+		constexpr auto Start_Height = Files_Per_Storage_Directory - 2;
+		auto pStorage = SegmentedTraits::PrepareStorage(tempDir.name(), Height(Start_Height));
+
+		std::vector<std::unique_ptr<model::Block>> blocks;
+		auto blockElements = SaveBlocks(*pStorage, blocks, Height(Start_Height), Height(Start_Height + 1));
+		SaveBlocks(*pStorage, blocks, Height(Start_Height + 2), Height(Start_Height + 4));
+
+		auto pBlock = pStorage->loadBlock(Height(Start_Height + 3));
+		auto blockData = CopyBlock(*pBlock);
+
+		// Act:
+		pStorage->dropBlocksAfter(Height(Start_Height + 1));
+
+		// Assert: only index file was removed
+		EXPECT_EQ(Height(Start_Height + 1), pStorage->chainHeight());
+		EXPECT_TRUE(std::filesystem::exists(GetSegmentDataPath(tempDir.name(), "00001")));
+		EXPECT_FALSE(std::filesystem::exists(GetSegmentIndexPath(tempDir.name(), "00001")));
+		AssertBlock(blockData, *pBlock);
+
+		// - chain can be continued
+		auto newBlockElements = SaveBlocks(*pStorage, blocks, Height(Start_Height + 2), Height(Start_Height + 3));
+		AssertBlock(blockData, *pBlock);
+
+		AssertStorage(*pStorage, blockElements);
+		AssertStorage(*pStorage, newBlockElements);
+	}
+
+	// endregion
+}}
@@ -0,0 +1,154 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/ionet/PacketPayloadWriteBuffers.h"
+#include "catapult/ionet/PacketPayloadBuilder.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace ionet {
+
+#define TEST_CLASS PacketPayloadWriteBuffersTests
+
+	namespace {
+		constexpr auto Test_Packet_Type = static_cast<PacketType>(987);
+
+		struct PayloadDescriptor {
+			ionet::PacketPayload Payload;
+			std::vector<uint8_t> ExpectedBytes;
+		};
+
+		PayloadDescriptor CreatePayload(const std::vector<size_t>& bufferSizes) {
+			PacketPayloadBuilder builder(Test_Packet_Type);
+			std::vector<uint8_t> dataBytes;
+			for (auto bufferSize : bufferSizes) {
+				auto buffer = test::GenerateRandomVector(bufferSize);
+				builder.appendValues(buffer);
+				dataBytes.insert(dataBytes.end(), buffer.cbegin(), buffer.cend());
+			}
+
+			auto payload = builder.build();
+			const auto* pHeaderBytes = reinterpret_cast<const uint8_t*>(&payload.header());
+			std::vector<uint8_t> expectedBytes(pHeaderBytes, pHeaderBytes + sizeof(PacketHeader));
+			expectedBytes.insert(expectedBytes.end(), dataBytes.cbegin(), dataBytes.cend());
+			return { payload, expectedBytes };
+		}
+
+		std::vector<size_t> GetBufferSizes(const PacketPayloadWriteBuffers& writeBuffers) {
+			std::vector<size_t> bufferSizes;
+			for (const auto& buffer : writeBuffers.buffers())
+				bufferSizes.push_back(buffer.Size);
+
+			return bufferSizes;
+		}
+
+		void AssertWriteBuffers(
+				const PayloadDescriptor& descriptor,
+				const PacketPayloadWriteBuffers& writeBuffers,
+				const std::vector<size_t>& expectedBufferSizes,
+				size_t expectedNumCoalescedBytes) {
+			// Assert: buffer layout
+			EXPECT_EQ(expectedBufferSizes, GetBufferSizes(writeBuffers));
+			EXPECT_EQ(descriptor.ExpectedBytes.size(), writeBuffers.size());
+			EXPECT_EQ(expectedNumCoalescedBytes, writeBuffers.numCoalescedBytes());
+
+			// - concatenated buffers are equal to serialized payload
+			std::vector<uint8_t> writtenBytes;
+			for (const auto& buffer : writeBuffers.buffers())
+				writtenBytes.insert(writtenBytes.end(), buffer.pData, buffer.pData + buffer.Size);
+
+			EXPECT_EQ(descriptor.ExpectedBytes, writtenBytes);
+		}
+	}
+
+	TEST(TEST_CLASS, CanCreateAroundPayloadWithNoDataBuffers) {
+		// Arrange:
+		auto descriptor = CreatePayload({});
+
+		// Act:
+		PacketPayloadWriteBuffers writeBuffers(descriptor.Payload, 100);
+
+		// Assert: header is copied into a segment
+		AssertWriteBuffers(descriptor, writeBuffers, { sizeof(PacketHeader) }, sizeof(PacketHeader));
+	}
+
+	TEST(TEST_CLASS, AllBuffersAreReferencedDirectlyWhenCoalescingIsDisabled) {
+		// Arrange:
+		auto descriptor = CreatePayload({ 20, 1, 30 });
+
+		// Act:
+		PacketPayloadWriteBuffers writeBuffers(descriptor.Payload, 0);
+
+		// Assert:
+		AssertWriteBuffers(descriptor, writeBuffers, { sizeof(PacketHeader), 20, 1, 30 }, 0);
+
+		const auto& payloadBuffers = descriptor.Payload.buffers();
+		for (auto i = 0u; i < payloadBuffers.size(); ++i)
+			EXPECT_EQ(payloadBuffers[i].pData, writeBuffers.buffers()[i + 1].pData) << "buffer at " << i;
+	}
+
+	TEST(TEST_CLASS, SmallBuffersAreCoalescedIntoSingleSegment) {
+		// Arrange:
+		auto descriptor = CreatePayload({ 20, 1, 30 });
+
+		// Act:
+		PacketPayloadWriteBuffers writeBuffers(descriptor.Payload, 100);
+
+		// Assert:
+		AssertWriteBuffers(descriptor, writeBuffers, { sizeof(PacketHeader) + 51 }, sizeof(PacketHeader) + 51);
+	}
+
+	TEST(TEST_CLASS, SmallBuffersCanFillSegmentExactly) {
+		// Arrange:
+		auto descriptor = CreatePayload({ 40, 52 });
+
+		// Act:
+		PacketPayloadWriteBuffers writeBuffers(descriptor.Payload, 100);
+
+		// Assert:
+		AssertWriteBuffers(descriptor, writeBuffers, { 100 }, 100);
+	}
+
+	TEST(TEST_CLASS, NewSegmentIsStartedWhenCoalescingSizeWouldBeExceeded) {
+		// Arrange:
+		auto descriptor = CreatePayload({ 40, 40, 40, 40, 40 });
+
+		// Act:
+		PacketPayloadWriteBuffers writeBuffers(descriptor.Payload, 100);
+
+		// Assert:
+		AssertWriteBuffers(descriptor, writeBuffers, { sizeof(PacketHeader) + 80, 80, 40 }, sizeof(PacketHeader) + 200);
+	}
+
+	TEST(TEST_CLASS, LargeBuffersAreReferencedDirectly) {
+		// Arrange:
+		auto descriptor = CreatePayload({ 20, 100, 30, 40, 250, 10 });
+
+		// Act:
+		PacketPayloadWriteBuffers writeBuffers(descriptor.Payload, 100);
+
+		// Assert: buffers at least as large as the coalescing size split segments
+		AssertWriteBuffers(descriptor, writeBuffers, { sizeof(PacketHeader) + 20, 100, 70, 250, 10 }, sizeof(PacketHeader) + 100);
+
+		const auto& payloadBuffers = descriptor.Payload.buffers();
+		EXPECT_EQ(payloadBuffers[1].pData, writeBuffers.buffers()[1].pData);
+		EXPECT_EQ(payloadBuffers[4].pData, writeBuffers.buffers()[3].pData);
+	}
+}}
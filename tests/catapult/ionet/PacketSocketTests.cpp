@@ -23,6 +23,7 @@
 #include "catapult/ionet/IoTypes.h"
 #include "catapult/ionet/Node.h"
 #include "catapult/ionet/Packet.h"
+#include "catapult/ionet/PacketPayloadBuilder.h"
 #include "catapult/ionet/WorkingBuffer.h"
 #include "catapult/thread/IoThreadPool.h"
 #include "tests/test/core/ThreadPoolTestUtils.h"
@@ -46,13 +47,8 @@ namespace catapult { namespace ionet {
 			return test::BufferToPacketPayload(test::GenerateRandomPacketBuffer(1024 * 1024));
 		}
 
-		void AssertWriteSuccess(const PacketPayload& payload, const ByteBuffer& expectedPayload, uint32_t maxPacketDataSize = 0) {
-			// Arrange:
-			auto options = test::CreatePacketSocketOptions();
-			if (0 != maxPacketDataSize)
-				options.MaxPacketDataSize = maxPacketDataSize;
-
-			// - set up payloads
+		void AssertWriteSuccess(const PacketPayload& payload, const ByteBuffer& expectedPayload, const PacketSocketOptions& options) {
+			// Arrange: set up payloads
 			auto bufferSize = payload.header().Size;
 			ByteBuffer receiveBuffer(bufferSize);
 			SocketOperationCode writeCode;
@@ -73,6 +69,16 @@ namespace catapult { namespace ionet {
 			EXPECT_EQUAL_BUFFERS(expectedPayload, 0, bufferSize, receiveBuffer);
 		}
 
+		void AssertWriteSuccess(const PacketPayload& payload, const ByteBuffer& expectedPayload, uint32_t maxPacketDataSize = 0) {
+			// Arrange:
+			auto options = test::CreatePacketSocketOptions();
+			if (0 != maxPacketDataSize)
+				options.MaxPacketDataSize = maxPacketDataSize;
+
+			// Assert:
+			AssertWriteSuccess(payload, expectedPayload, options);
+		}
+
 		void AssertWriteFailure(const PacketPayload& payload, uint32_t maxPacketDataSize) {
 			// Arrange:
 			auto options = test::CreatePacketSocketOptions();
@@ -122,6 +128,49 @@ namespace catapult { namespace ionet {
 		AssertWriteSuccess(payload, packetBytes);
 	}
 
+	namespace {
+		void AssertWriteSuccessMultiBufferPayload(size_t writeCoalescingSize) {
+			// Arrange: set up a payload composed of many small buffers interspersed with a few large ones
+			PacketPayloadBuilder builder(static_cast<PacketType>(987));
+			ByteBuffer dataBytes;
+			for (auto i = 0u; i < 500; ++i) {
+				auto buffer = test::GenerateRandomVector(0 == i % 100 ? 20'000 + i : 50 + i % 7);
+				builder.appendValues(buffer);
+				dataBytes.insert(dataBytes.end(), buffer.cbegin(), buffer.cend());
+			}
+
+			auto payload = builder.build();
+			const auto* pHeaderBytes = reinterpret_cast<const uint8_t*>(&payload.header());
+			ByteBuffer packetBytes(pHeaderBytes, pHeaderBytes + sizeof(PacketHeader));
+			packetBytes.insert(packetBytes.end(), dataBytes.cbegin(), dataBytes.cend());
+
+			auto options = test::CreatePacketSocketOptions();
+			options.WriteCoalescingSize = writeCoalescingSize;
+
+			// Sanity:
+			EXPECT_EQ(500u, payload.buffers().size());
+
+			// Assert:
+			AssertWriteSuccess(payload, packetBytes, options);
+		}
+	}
+
+	TEST(TEST_CLASS, WriteSucceedsWhenSocketWriteSucceeds_MultiBufferPayload_CoalescingDisabled) {
+		AssertWriteSuccessMultiBufferPayload(0);
+	}
+
+	TEST(TEST_CLASS, WriteSucceedsWhenSocketWriteSucceeds_MultiBufferPayload_CoalescingSmallerThanBuffers) {
+		AssertWriteSuccessMultiBufferPayload(40);
+	}
+
+	TEST(TEST_CLASS, WriteSucceedsWhenSocketWriteSucceeds_MultiBufferPayload_CoalescingEnabled) {
+		AssertWriteSuccessMultiBufferPayload(16 * 1024);
+	}
+
+	TEST(TEST_CLASS, WriteSucceedsWhenSocketWriteSucceeds_MultiBufferPayload_CoalescingLargerThanPayload) {
+		AssertWriteSuccessMultiBufferPayload(1024 * 1024);
+	}
+
 	TEST(TEST_CLASS, WriteFailsWhenSocketWriteFails) {
 		// Arrange: set up payloads
 		auto payload = CreateSmallWritePayload();
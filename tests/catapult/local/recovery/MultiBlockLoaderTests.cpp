@@ -22,16 +22,18 @@
 #include "catapult/local/recovery/MultiBlockLoader.h"
 #include "catapult/config/CatapultDataDirectory.h"
 #include "catapult/extensions/LocalNodeChainScore.h"
+#include "catapult/extensions/LocalNodeStateRef.h"
 #include "catapult/extensions/NemesisBlockLoader.h"
 #include "catapult/extensions/PluginUtils.h"
 #include "catapult/io/BlockStorageCache.h"
 #include "catapult/model/BlockChainConfiguration.h"
 #include "tests/catapult/local/recovery/test/FilechainTestUtils.h"
+#include "tests/test/cache/CacheTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/ResolverTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/core/mocks/MockMemoryBlockStorage.h"
 #include "tests/test/local/BlockStateHash.h"
-#include "tests/test/local/LocalNodeTestState.h"
 #include "tests/test/local/LocalTestUtils.h"
 #include "tests/test/nodeps/Filesystem.h"
 #include "tests/test/other/mocks/MockBlockHeightCapturingNotificationObserver.h"
@@ -146,9 +148,35 @@ namespace catapult { namespace local {
 			});
 		}
 
+		class FailingBlockStorage : public mocks::MockMemoryBlockStorage {
+		public:
+			explicit FailingBlockStorage(Height failureHeight) : m_failureHeight(failureHeight)
+			{}
+
+		public:
+			std::shared_ptr<const model::BlockElement> loadBlockElement(Height height) const override {
+				if (m_failureHeight == height)
+					CATAPULT_THROW_RUNTIME_ERROR_1("simulated block element load failure", height);
+
+				return MockMemoryBlockStorage::loadBlockElement(height);
+			}
+
+		private:
+			Height m_failureHeight;
+		};
+
 		class LoadBlockChainTestContext {
+		private:
+			// use a fixed number of pool threads so that prefetch batches have a deterministic size (2 * 8 blocks)
+			static constexpr uint32_t Default_Num_Pool_Threads = 2;
+
 		public:
-			LoadBlockChainTestContext() : m_pluginManager(test::CreatePluginManager()) {
+			explicit LoadBlockChainTestContext(Height failureHeight = Height(), uint32_t numPoolThreads = Default_Num_Pool_Threads)
+					: m_numPoolThreads(numPoolThreads)
+					, m_config(test::CreatePrototypicalCatapultConfiguration())
+					, m_cache(test::CreateEmptyCatapultCache())
+					, m_storage(std::make_unique<FailingBlockStorage>(failureHeight), std::make_unique<mocks::MockMemoryBlockStorage>())
+					, m_pluginManager(test::CreatePluginManager()) {
 				AddXorResolvers(m_pluginManager);
 			}
 
@@ -161,35 +189,64 @@ namespace catapult { namespace local {
 				return m_factoryHeights;
 			}
 
+			const auto& statistics() const {
+				return m_statistics;
+			}
+
 		public:
-			void setStorageChainHeight(Height chainHeight) {
-				auto storage = m_state.ref().Storage.modifier();
+			Height cacheHeight() const {
+				return m_cache.createView().height();
+			}
+
+		public:
+			void setStorageChainHeight(Height chainHeight, Height mismatchedStateHashHeight = Height()) {
+				auto storage = m_storage.modifier();
 
 				for (auto height = Height(2); height <= chainHeight; height = height + Height(1)) {
 					auto pBlock = test::GenerateBlockWithTransactions(0, height, Timestamp(height.unwrap() * 3000));
 					pBlock->Difficulty = Difficulty(Difficulty().unwrap() + height.unwrap());
+
+					// state hash calculation is disabled, so all cache state hashes are zero
+					pBlock->StateHash = mismatchedStateHashHeight == height ? test::GenerateRandomByteArray<Hash256>() : Hash256();
 					storage.saveBlock(test::BlockToBlockElement(*pBlock));
 				}
 
 				storage.commit();
 			}
 
-			model::ChainScore load(Height startHeight) {
+			model::ChainScore load(
+					Height startHeight,
+					extensions::StateHashVerification stateHashVerification = extensions::StateHashVerification::Disabled) {
 				auto observerFactory = [this](const auto& block) {
 					this->m_factoryHeights.push_back(block.Height);
 					return std::make_unique<mocks::MockBlockHeightCapturingNotificationObserver>(this->m_observerBlockHeights);
 				};
 
-				return LoadBlockChain(observerFactory, m_pluginManager, m_state.ref(), startHeight);
+				auto pPool = test::CreateStartedIoThreadPool(m_numPoolThreads);
+				auto stateRef = extensions::LocalNodeStateRef(m_config, m_cache, m_storage, m_score);
+				return LoadBlockChain(observerFactory, m_pluginManager, stateRef, *pPool, startHeight, stateHashVerification, m_statistics);
 			}
 
 		private:
+			uint32_t m_numPoolThreads;
 			std::vector<Height> m_factoryHeights;
 			std::vector<Height> m_observerBlockHeights;
-			test::LocalNodeTestState m_state;
+			LoadStageStatistics m_statistics;
+			config::CatapultConfiguration m_config;
+			cache::CatapultCache m_cache;
+			io::BlockStorageCache m_storage;
+			extensions::LocalNodeChainScore m_score;
 			plugins::PluginManager m_pluginManager;
 		};
 
+		std::vector<Height> GenerateHeights(Height startHeight, Height endHeight) {
+			std::vector<Height> heights;
+			for (auto height = startHeight; height <= endHeight; height = height + Height(1))
+				heights.push_back(height);
+
+			return heights;
+		}
+
 		constexpr uint64_t CalculateExpectedScore(size_t height) {
 			// - nemesis difficulty is 0 and nemesis time is 0
 			// - all other blocks have a difficulty of base + height
@@ -248,6 +305,21 @@ namespace catapult { namespace local {
 		EXPECT_EQ(expectedHeights, context.factoryHeights());
 	}
 
+	TEST(TEST_CLASS, LoadBlockChainLoadsMultipleBlocksWhenStateHashVerificationIsEnabledAndStateHashesMatch) {
+		// Arrange: all cache state hashes are zero and match block state hashes
+		LoadBlockChainTestContext context;
+		context.setStorageChainHeight(Height(7));
+
+		// Act:
+		auto score = context.load(Height(2), extensions::StateHashVerification::Enabled);
+
+		// Assert:
+		auto expectedHeights = std::vector<Height>{ Height(2), Height(3), Height(4), Height(5), Height(6), Height(7) };
+		EXPECT_EQ(model::ChainScore(CalculateExpectedScore(7)), score);
+		EXPECT_EQ(expectedHeights, context.observerBlockHeights());
+		EXPECT_EQ(expectedHeights, context.factoryHeights());
+	}
+
 	TEST(TEST_CLASS, LoadBlockChainLoadsMultipleBlocksStartingAtArbitraryHeight) {
 		// Arrange: create a storage with 7 blocks
 		LoadBlockChainTestContext context;
@@ -264,6 +336,121 @@ namespace catapult { namespace local {
 		EXPECT_EQ(expectedHeights, context.factoryHeights());
 	}
 
+	TEST(TEST_CLASS, LoadBlockChainLoadsMultiplePrefetchBatches) {
+		// Arrange: 49 blocks span four prefetch batches (16 + 16 + 16 + 1)
+		LoadBlockChainTestContext context;
+		context.setStorageChainHeight(Height(50));
+
+		// Act:
+		auto score = context.load(Height(2));
+
+		// Assert:
+		auto expectedHeights = GenerateHeights(Height(2), Height(50));
+		EXPECT_EQ(model::ChainScore(CalculateExpectedScore(50)), score);
+		EXPECT_EQ(expectedHeights, context.observerBlockHeights());
+		EXPECT_EQ(expectedHeights, context.factoryHeights());
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainLoadsMultiplePrefetchBatchesWithSinglePoolThread) {
+		// Arrange: 49 blocks span seven prefetch batches (6 * 8 + 1)
+		LoadBlockChainTestContext context(Height(), 1);
+		context.setStorageChainHeight(Height(50));
+
+		// Act:
+		auto score = context.load(Height(2));
+
+		// Assert:
+		auto expectedHeights = GenerateHeights(Height(2), Height(50));
+		EXPECT_EQ(model::ChainScore(CalculateExpectedScore(50)), score);
+		EXPECT_EQ(expectedHeights, context.observerBlockHeights());
+		EXPECT_EQ(expectedHeights, context.factoryHeights());
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainCollectsLoadStageStatistics) {
+		// Arrange:
+		LoadBlockChainTestContext context;
+		context.setStorageChainHeight(Height(50));
+
+		// Act:
+		context.load(Height(5));
+
+		// Assert: all wall times are nondeterministic, so only check block counts
+		const auto& statistics = context.statistics();
+		EXPECT_EQ(46u, statistics.NumPrefetchedBlocks);
+		EXPECT_EQ(46u, statistics.NumExecutedBlocks);
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainRethrowsBlockLoadException) {
+		// Arrange: fail loading a block in the second prefetch batch
+		LoadBlockChainTestContext context(Height(25));
+		context.setStorageChainHeight(Height(50));
+
+		// Act + Assert:
+		EXPECT_THROW(context.load(Height(2)), catapult_runtime_error);
+
+		// - all blocks preceding the failed block were executed
+		auto expectedHeights = GenerateHeights(Height(2), Height(24));
+		EXPECT_EQ(expectedHeights, context.observerBlockHeights());
+		EXPECT_EQ(expectedHeights, context.factoryHeights());
+	}
+
+	namespace {
+		void AssertCanLoadBlocksSpanningStateHashBatches(uint32_t numBlocks) {
+			// Arrange: state hashes are committed and verified once every 100 blocks and at the chain height
+			LoadBlockChainTestContext context;
+			auto chainHeight = Height(numBlocks + 1);
+			context.setStorageChainHeight(chainHeight);
+
+			// Act:
+			auto score = context.load(Height(2), extensions::StateHashVerification::Enabled);
+
+			// Assert:
+			auto expectedHeights = GenerateHeights(Height(2), chainHeight);
+			EXPECT_EQ(model::ChainScore(CalculateExpectedScore(numBlocks + 1)), score);
+			EXPECT_EQ(expectedHeights, context.observerBlockHeights());
+			EXPECT_EQ(expectedHeights, context.factoryHeights());
+			EXPECT_EQ(chainHeight, context.cacheHeight());
+		}
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainLoadsSingleFullStateHashBatch) {
+		AssertCanLoadBlocksSpanningStateHashBatches(100);
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainLoadsFullStateHashBatchAndSingleBlockBatch) {
+		AssertCanLoadBlocksSpanningStateHashBatches(101);
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainLoadsMultipleStateHashBatches) {
+		AssertCanLoadBlocksSpanningStateHashBatches(250);
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainDoesNotVerifyStateHashOfBlockInsideStateHashBatch) {
+		// Arrange: 100th block (height 101) is last block in first batch, so block at height 100 is not verified
+		LoadBlockChainTestContext context;
+		context.setStorageChainHeight(Height(251), Height(100));
+
+		// Act:
+		context.load(Height(2), extensions::StateHashVerification::Enabled);
+
+		// Assert:
+		EXPECT_EQ(250u, context.observerBlockHeights().size());
+		EXPECT_EQ(Height(251), context.cacheHeight());
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainFailsWhenStateHashOfLastBlockInStateHashBatchDoesNotMatch) {
+		// Arrange: 200th block (height 201) is last block in second batch
+		LoadBlockChainTestContext context;
+		context.setStorageChainHeight(Height(251), Height(201));
+
+		// Act + Assert:
+		EXPECT_THROW(context.load(Height(2), extensions::StateHashVerification::Enabled), catapult_runtime_error);
+
+		// - only the first batch was committed
+		EXPECT_EQ(200u, context.observerBlockHeights().size());
+		EXPECT_EQ(Height(101), context.cacheHeight());
+	}
+
 	// endregion
 
 	// region LoadBlockChain - state enabled
@@ -301,7 +488,10 @@ namespace catapult { namespace local {
 		}
 
 		template<typename TAction>
-		void ExecuteWithStorage(io::BlockStorageCache& storage, TAction action) {
+		void ExecuteWithStorage(
+				io::BlockStorageCache& storage,
+				TAction action,
+				extensions::StateHashVerification stateHashVerification = extensions::StateHashVerification::Disabled) {
 			// Arrange:
 			test::TempDirectoryGuard tempDataDirectory;
 			config::CatapultDataDirectoryPreparer::Prepare(tempDataDirectory.name());
@@ -319,7 +509,8 @@ namespace catapult { namespace local {
 			ExecuteNemesis(stateRef, *pPluginManager);
 
 			// Act:
-			LoadBlockChain(observerFactory, *pPluginManager, stateRef, Height(2));
+			auto pPool = test::CreateStartedIoThreadPool();
+			LoadBlockChain(observerFactory, *pPluginManager, stateRef, *pPool, Height(2), stateHashVerification);
 
 			action(stateRef.Cache, *pPluginManager);
 		}
@@ -380,5 +571,25 @@ namespace catapult { namespace local {
 		RunLoadBlockChainTest(storage, 7);
 	}
 
+	TEST(TEST_CLASS, LoadBlockChainFailsWhenStateHashVerificationIsEnabledAndCalculatedStateHashesDoNotMatch) {
+		// Arrange: test blocks do not contain valid state hashes
+		io::BlockStorageCache storage(
+				std::make_unique<mocks::MockMemoryBlockStorage>(),
+				std::make_unique<mocks::MockMemoryBlockStorage>());
+
+		auto blocks = CreateBlocks(4);
+		{
+			auto storageModifier = storage.modifier();
+			for (const auto& pBlock : blocks)
+				storageModifier.saveBlock(test::BlockToBlockElement(*pBlock));
+
+			storageModifier.commit();
+		}
+
+		// Act + Assert:
+		auto action = [](const auto&, const auto&) {};
+		EXPECT_THROW(ExecuteWithStorage(storage, action, extensions::StateHashVerification::Enabled), catapult_runtime_error);
+	}
+
 	// endregion
 }}
@@ -49,9 +49,9 @@ namespace catapult { namespace local {
 
 		constexpr size_t GetNumExpectedCounters() {
 #ifdef __APPLE__
-			return 3;
+			return 5;
 #else
-			return 4;
+			return 6;
 #endif
 		}
 	}
@@ -78,6 +78,10 @@ namespace catapult { namespace local {
 		HasCounter(counters, "MEM SHR RSS");
 #endif
 #endif
+
+		// - check arena counters
+		HasCounter(counters, "MEM ARENA RSV");
+		HasCounter(counters, "MEM ARENA BLK");
 	}
 
 	TEST(TEST_CLASS, CountersHaveNonzeroValues) {
@@ -89,6 +93,10 @@ namespace catapult { namespace local {
 		for (const auto& counter : counters) {
 			CATAPULT_LOG(debug) << counter.id().name() << " : " << counter.value();
 
+			// - arena counters are zero when no arena has been used
+			if (0 == counter.id().name().find("MEM ARENA"))
+				continue;
+
 			// Assert:
 			EXPECT_NE(0u, counter.value()) << counter.id().name() << " has zero value";
 		}
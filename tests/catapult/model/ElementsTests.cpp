@@ -20,6 +20,7 @@
 **/
 
 #include "catapult/model/Elements.h"
+#include "catapult/model/NotificationStream.h"
 #include "catapult/utils/MemoryUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/EntityTestUtils.h"
@@ -235,6 +236,37 @@ namespace catapult { namespace model {
 		AssertEqual(element, entityInfos[3], "0");
 	}
 
+	TEST(TEST_CLASS, ExtractEntityInfos_AttachesRecordedNotificationStreams) {
+		// Arrange:
+		WeakEntityInfos entityInfos;
+		auto pBlock = test::GenerateBlockWithTransactions(3, Height(246));
+		auto element = test::BlockToBlockElement(*pBlock);
+
+		const auto& transactionElement = element.Transactions[1];
+		auto pTransactionStream = std::make_shared<NotificationStream>(
+				WeakEntityInfo(transactionElement.Transaction, transactionElement.EntityHash, element.Block));
+		element.Transactions[1].OptionalNotifications = pTransactionStream;
+
+		auto pBlockStream = std::make_shared<NotificationStream>(WeakEntityInfo(element.Block, element.EntityHash, element.Block));
+		element.OptionalNotifications = pBlockStream;
+
+		// Act:
+		ExtractEntityInfos(element, entityInfos);
+
+		// Assert:
+		ASSERT_EQ(4u, entityInfos.size());
+		EXPECT_FALSE(entityInfos[0].isNotificationStreamSet());
+		EXPECT_FALSE(entityInfos[2].isNotificationStreamSet());
+
+		ASSERT_TRUE(entityInfos[1].isNotificationStreamSet());
+		EXPECT_EQ(pTransactionStream.get(), &entityInfos[1].notificationStream());
+		EXPECT_TRUE(entityInfos[1].notificationStream().isRecordedFrom(entityInfos[1]));
+
+		ASSERT_TRUE(entityInfos[3].isNotificationStreamSet());
+		EXPECT_EQ(pBlockStream.get(), &entityInfos[3].notificationStream());
+		EXPECT_TRUE(entityInfos[3].notificationStream().isRecordedFrom(entityInfos[3]));
+	}
+
 	// endregion
 
 	// region ExtractTransactionInfos
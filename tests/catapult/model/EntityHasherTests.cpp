@@ -436,5 +436,58 @@ namespace catapult { namespace model {
 		EXPECT_NE(transactionElement.EntityHash, transactionElement.MerkleComponentHash);
 	}
 
+	// endregion
+	// region UpdateHashes (transaction elements)
+
+	namespace {
+		TransactionRegistry CreateRegistryWithCustomBuffersPlugin() {
+			auto pPlugin = mocks::CreateMockTransactionPluginWithCustomBuffers(
+					mocks::OffsetRange{ 6, 10 },
+					std::vector<mocks::OffsetRange>{ { 7, 11 }, { 12, 20 } });
+			auto registry = TransactionRegistry();
+			registry.registerPlugin(std::move(pPlugin));
+			return registry;
+		}
+	}
+
+	TEST(TEST_CLASS, UpdateHashes_CanUpdateZeroTransactionElements) {
+		// Arrange:
+		auto registry = CreateRegistryWithCustomBuffersPlugin();
+		auto generationHashSeed = test::GenerateRandomByteArray<GenerationHashSeed>();
+
+		// Act + Assert: no exception
+		UpdateHashes(registry, generationHashSeed, std::vector<TransactionElement*>());
+	}
+
+	TEST(TEST_CLASS, UpdateHashes_MultipleTransactionElementsHaveSameHashesAsSingleTransactionElement) {
+		// Arrange: use a count that is not a multiple of the number of lanes
+		auto registry = CreateRegistryWithCustomBuffersPlugin();
+		auto generationHashSeed = test::GenerateRandomByteArray<GenerationHashSeed>();
+
+		std::vector<std::unique_ptr<Transaction>> transactions;
+		std::vector<TransactionElement> expectedElements;
+		std::vector<TransactionElement> elements;
+		for (auto i = 0u; i < 11; ++i) {
+			transactions.push_back(test::GenerateRandomTransaction());
+			expectedElements.emplace_back(*transactions.back());
+			elements.emplace_back(*transactions.back());
+		}
+
+		std::vector<TransactionElement*> elementPointers;
+		for (auto i = 0u; i < elements.size(); ++i) {
+			UpdateHashes(registry, generationHashSeed, expectedElements[i]);
+			elementPointers.push_back(&elements[i]);
+		}
+
+		// Act:
+		UpdateHashes(registry, generationHashSeed, elementPointers);
+
+		// Assert:
+		for (auto i = 0u; i < elements.size(); ++i) {
+			EXPECT_EQ(expectedElements[i].EntityHash, elements[i].EntityHash) << "element " << i;
+			EXPECT_EQ(expectedElements[i].MerkleComponentHash, elements[i].MerkleComponentHash) << "element " << i;
+		}
+	}
+
 	// endregion
 }}
@@ -21,6 +21,7 @@
 
 #include "catapult/model/NotificationPublisher.h"
 #include "catapult/model/Address.h"
+#include "catapult/model/NotificationStream.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/mocks/MockNotificationSubscriber.h"
 #include "tests/test/core/mocks/MockTransaction.h"
@@ -586,6 +587,54 @@ namespace catapult { namespace model {
 
 	// endregion
 
+	// region notification stream replay
+
+	namespace {
+		void AssertReplay(PublicationMode mode, bool useMatchingHash, size_t numExpectedNotifications) {
+			// Arrange: record a single (distinguishable) notification
+			auto pTransaction = mocks::CreateMockTransaction(12);
+			auto hash = test::GenerateRandomByteArray<Hash256>();
+			auto otherHash = hash;
+
+			NotificationStream stream(WeakEntityInfo(*pTransaction, useMatchingHash ? hash : otherHash));
+			stream.append(AccountAddressNotification(test::GenerateRandomByteArray<UnresolvedAddress>()));
+
+			auto entityInfo = WeakEntityInfo(*pTransaction, hash);
+			entityInfo.setNotificationStream(stream);
+
+			auto registry = mocks::CreateDefaultTransactionRegistry(Plugin_Option_Flags);
+			auto pPub = CreateNotificationPublisher(registry, Currency_Mosaic_Id, mode);
+
+			// Act:
+			mocks::MockNotificationSubscriber sub;
+			pPub->publish(entityInfo, sub);
+
+			// Assert:
+			EXPECT_EQ(numExpectedNotifications, sub.numNotifications());
+		}
+	}
+
+	TEST(TEST_CLASS, CanReplayRecordedNotificationsWithModeAll) {
+		AssertReplay(PublicationMode::All, true, 1);
+	}
+
+	TEST(TEST_CLASS, CannotReplayNotificationsRecordedFromDifferentEntityInfoWithModeAll) {
+		// Assert: 8 raised by NotificationPublisher, 9 raised by MockTransaction::publish
+		AssertReplay(PublicationMode::All, false, 8 + 9);
+	}
+
+	TEST(TEST_CLASS, CannotReplayRecordedNotificationsWithModeBasic) {
+		// Assert: 8 raised by NotificationPublisher
+		AssertReplay(PublicationMode::Basic, true, 8);
+	}
+
+	TEST(TEST_CLASS, CannotReplayRecordedNotificationsWithModeCustom) {
+		// Assert: 9 raised by MockTransaction::publish
+		AssertReplay(PublicationMode::Custom, true, 9);
+	}
+
+	// endregion
+
 	// region other
 
 	TEST(TEST_CLASS, CannotRaiseAnyNotificationsForUnknownEntities) {
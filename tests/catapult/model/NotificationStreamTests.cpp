@@ -0,0 +1,255 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/model/NotificationStream.h"
+#include "catapult/model/Address.h"
+#include "catapult/model/NotificationPublisher.h"
+#include "catapult/model/Notifications.h"
+#include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/EntityTestUtils.h"
+#include "tests/test/core/TransactionTestUtils.h"
+#include "tests/test/core/mocks/MockNotificationSubscriber.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace model {
+
+#define TEST_CLASS NotificationStreamTests
+
+	namespace {
+		class TransferNotificationPublisher : public NotificationPublisher {
+		public:
+			explicit TransferNotificationPublisher(size_t numTransfers) : m_numTransfers(numTransfers)
+			{}
+
+		public:
+			void publish(const WeakEntityInfo& entityInfo, NotificationSubscriber& sub) const override {
+				const auto& entity = entityInfo.entity();
+				auto signerAddress = GetSignerAddress(entity);
+				sub.notify(AccountPublicKeyNotification(entity.SignerPublicKey));
+
+				for (auto i = 0u; i < m_numTransfers; ++i) {
+					auto recipient = UnresolvedAddress{ { { static_cast<uint8_t>(i + 1) } } };
+					sub.notify(BalanceTransferNotification(signerAddress, recipient, UnresolvedMosaicId(i), Amount(100 + i)));
+				}
+			}
+
+		private:
+			size_t m_numTransfers;
+		};
+
+		UnresolvedAddressSet GenerateRandomUnresolvedAddressSet(size_t count) {
+			UnresolvedAddressSet addresses;
+			for (auto i = 0u; i < count; ++i)
+				addresses.insert(test::GenerateRandomByteArray<UnresolvedAddress>());
+
+			return addresses;
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateEmptyStream) {
+		// Arrange:
+		auto pTransaction = test::GenerateRandomTransaction();
+		auto hash = test::GenerateRandomByteArray<Hash256>();
+
+		// Act:
+		NotificationStream stream(WeakEntityInfo(*pTransaction, hash));
+
+		// Assert:
+		EXPECT_EQ(0u, stream.size());
+		EXPECT_EQ(0u, stream.capacity());
+	}
+
+	// endregion
+
+	// region isRecordedFrom
+
+	TEST(TEST_CLASS, IsRecordedFromReturnsTrueOnlyForSameEntityHashAndBlockHeader) {
+		// Arrange:
+		auto pBlock = test::GenerateEmptyRandomBlock();
+		auto pTransaction = test::GenerateRandomTransaction();
+		auto pTransactionCopy = test::CopyEntity(*pTransaction);
+		auto hash = test::GenerateRandomByteArray<Hash256>();
+		auto hashCopy = hash;
+		NotificationStream stream(WeakEntityInfo(*pTransaction, hash, *pBlock));
+
+		// Act + Assert:
+		EXPECT_TRUE(stream.isRecordedFrom(WeakEntityInfo(*pTransaction, hash, *pBlock)));
+
+		EXPECT_FALSE(stream.isRecordedFrom(WeakEntityInfo()));
+		EXPECT_FALSE(stream.isRecordedFrom(WeakEntityInfo(*pTransactionCopy, hash, *pBlock)));
+		EXPECT_FALSE(stream.isRecordedFrom(WeakEntityInfo(*pTransaction, hashCopy, *pBlock)));
+		EXPECT_FALSE(stream.isRecordedFrom(WeakEntityInfo(*pTransaction, hash)));
+		EXPECT_FALSE(stream.isRecordedFrom(WeakEntityInfo(*pTransaction)));
+	}
+
+	TEST(TEST_CLASS, IsRecordedFromSupportsEntityInfosWithoutHashOrBlockHeader) {
+		// Arrange:
+		auto pTransaction = test::GenerateRandomTransaction();
+		auto hash = test::GenerateRandomByteArray<Hash256>();
+		NotificationStream stream((WeakEntityInfo(*pTransaction)));
+
+		// Act + Assert:
+		EXPECT_TRUE(stream.isRecordedFrom(WeakEntityInfo(*pTransaction)));
+		EXPECT_FALSE(stream.isRecordedFrom(WeakEntityInfo(*pTransaction, hash)));
+	}
+
+	// endregion
+
+	// region append / replay
+
+	TEST(TEST_CLASS, CannotAppendNotificationWithIncorrectSize) {
+		// Arrange:
+		auto pTransaction = test::GenerateRandomTransaction();
+		NotificationStream stream((WeakEntityInfo(*pTransaction)));
+
+		auto notification = AccountPublicKeyNotification(pTransaction->SignerPublicKey);
+		notification.Size = sizeof(Notification) - 1;
+
+		// Act + Assert:
+		EXPECT_THROW(stream.append(notification), catapult_invalid_argument);
+		EXPECT_EQ(0u, stream.size());
+	}
+
+	TEST(TEST_CLASS, CanReplayAppendedNotificationsInOrder) {
+		// Arrange:
+		auto pTransaction = test::GenerateRandomTransaction();
+		auto recipient = test::GenerateRandomByteArray<UnresolvedAddress>();
+		auto sender = GetSignerAddress(*pTransaction);
+		NotificationStream stream((WeakEntityInfo(*pTransaction)));
+
+		stream.append(AccountPublicKeyNotification(pTransaction->SignerPublicKey));
+		stream.append(BalanceTransferNotification(sender, recipient, UnresolvedMosaicId(123), Amount(234)));
+		stream.append(AccountAddressNotification(recipient));
+
+		// Act:
+		mocks::MockNotificationSubscriber sub;
+		stream.replay(sub);
+
+		// Assert:
+		EXPECT_EQ(3u, stream.size());
+		ASSERT_EQ(3u, sub.numNotifications());
+		EXPECT_EQ(Core_Register_Account_Public_Key_Notification, sub.notificationTypes()[0]);
+		EXPECT_EQ(Core_Balance_Transfer_Notification, sub.notificationTypes()[1]);
+		EXPECT_EQ(Core_Register_Account_Address_Notification, sub.notificationTypes()[2]);
+
+		EXPECT_TRUE(sub.contains(pTransaction->SignerPublicKey));
+		EXPECT_TRUE(sub.contains(sender, recipient, UnresolvedMosaicId(123), Amount(234)));
+		EXPECT_TRUE(sub.contains(UnresolvedAddress(recipient)));
+	}
+
+	TEST(TEST_CLASS, CanReplayNotificationsMultipleTimes) {
+		// Arrange:
+		auto pTransaction = test::GenerateRandomTransaction();
+		NotificationStream stream((WeakEntityInfo(*pTransaction)));
+		stream.append(AccountPublicKeyNotification(pTransaction->SignerPublicKey));
+
+		// Act:
+		mocks::MockNotificationSubscriber sub1;
+		stream.replay(sub1);
+
+		mocks::MockNotificationSubscriber sub2;
+		stream.replay(sub2);
+
+		// Assert:
+		EXPECT_EQ(sub1.notificationTypes(), sub2.notificationTypes());
+		EXPECT_TRUE(sub1.contains(pTransaction->SignerPublicKey));
+		EXPECT_TRUE(sub2.contains(pTransaction->SignerPublicKey));
+	}
+
+	TEST(TEST_CLASS, AppendDeepCopiesAddressInteractionNotification) {
+		// Arrange:
+		auto pTransaction = test::GenerateRandomTransaction();
+		auto participants = GenerateRandomUnresolvedAddressSet(5);
+		NotificationStream stream((WeakEntityInfo(*pTransaction)));
+
+		{
+			auto source = GetSignerAddress(*pTransaction);
+			auto pParticipants = std::make_unique<UnresolvedAddressSet>(participants);
+			stream.append(AddressInteractionNotification(source, pTransaction->Type, *pParticipants));
+		}
+
+		// Act:
+		mocks::MockTypedNotificationSubscriber<AddressInteractionNotification> sub;
+		stream.replay(sub);
+
+		// Assert: the recorded notification does not depend on the (destroyed) original
+		ASSERT_EQ(1u, sub.numMatchingNotifications());
+		const auto& notification = sub.matchingNotifications()[0];
+		EXPECT_EQ(GetSignerAddress(*pTransaction), notification.Source);
+		EXPECT_EQ(pTransaction->Type, notification.TransactionType);
+		EXPECT_EQ(participants, notification.ParticipantsByAddress);
+	}
+
+	TEST(TEST_CLASS, ArenaGrowsWhenNotificationsExceedSingleBlock) {
+		// Arrange:
+		auto pTransaction = test::GenerateRandomTransaction();
+		auto sender = GetSignerAddress(*pTransaction);
+		NotificationStream stream((WeakEntityInfo(*pTransaction)));
+
+		// Act:
+		for (auto i = 0u; i < 500; ++i)
+			stream.append(BalanceTransferNotification(sender, UnresolvedAddress(), UnresolvedMosaicId(i), Amount(i)));
+
+		mocks::MockNotificationSubscriber sub;
+		stream.replay(sub);
+
+		// Assert:
+		EXPECT_EQ(500u, stream.size());
+		EXPECT_LE(500u * sizeof(BalanceTransferNotification), stream.capacity());
+		ASSERT_EQ(500u, sub.numTransfers());
+		for (auto i = 0u; i < 500; ++i)
+			EXPECT_TRUE(sub.contains(sender, UnresolvedAddress(), UnresolvedMosaicId(i), Amount(i))) << i;
+	}
+
+	// endregion
+
+	// region RecordNotifications
+
+	TEST(TEST_CLASS, RecordNotificationsRecordsAllPublishedNotifications) {
+		// Arrange:
+		auto pBlock = test::GenerateEmptyRandomBlock();
+		auto pTransaction = test::GenerateRandomTransaction();
+		auto hash = test::GenerateRandomByteArray<Hash256>();
+		auto entityInfo = WeakEntityInfo(*pTransaction, hash, *pBlock);
+		TransferNotificationPublisher publisher(3);
+
+		// Act:
+		auto pStream = RecordNotifications(publisher, entityInfo);
+
+		// Assert:
+		EXPECT_EQ(4u, pStream->size());
+		EXPECT_TRUE(pStream->isRecordedFrom(entityInfo));
+
+		mocks::MockNotificationSubscriber expectedSub;
+		publisher.publish(entityInfo, expectedSub);
+
+		mocks::MockNotificationSubscriber sub;
+		pStream->replay(sub);
+
+		EXPECT_EQ(expectedSub.notificationTypes(), sub.notificationTypes());
+		EXPECT_TRUE(sub.contains(pTransaction->SignerPublicKey));
+		EXPECT_EQ(3u, sub.numTransfers());
+	}
+
+	// endregion
+}}
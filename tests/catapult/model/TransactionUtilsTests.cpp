@@ -22,6 +22,7 @@
 #include "catapult/model/TransactionUtils.h"
 #include "sdk/src/extensions/ConversionExtensions.h"
 #include "catapult/model/NotificationPublisher.h"
+#include "catapult/model/NotificationStream.h"
 #include "catapult/model/NotificationSubscriber.h"
 #include "tests/test/core/mocks/MockTransaction.h"
 #include "tests/TestHarness.h"
@@ -58,6 +59,20 @@ namespace catapult { namespace model {
 			Mode m_mode;
 		};
 
+		struct PublisherTraits {
+			static UnresolvedAddressSet ExtractAddresses(const Transaction& transaction, const NotificationPublisher& notificationPublisher) {
+				return model::ExtractAddresses(transaction, notificationPublisher);
+			}
+		};
+
+		struct StreamTraits {
+			static UnresolvedAddressSet ExtractAddresses(const Transaction& transaction, const NotificationPublisher& notificationPublisher) {
+				auto pNotificationStream = RecordNotifications(notificationPublisher, WeakEntityInfo(transaction));
+				return model::ExtractAddresses(transaction, *pNotificationStream);
+			}
+		};
+
+		template<typename TTraits>
 		void RunExtractAddressesTest(MockNotificationPublisher::Mode mode) {
 			// Arrange:
 			auto pTransaction = mocks::CreateMockTransactionWithSignerAndRecipient(
@@ -68,7 +83,7 @@ namespace catapult { namespace model {
 			MockNotificationPublisher notificationPublisher(mode);
 
 			// Act:
-			auto addresses = ExtractAddresses(*pTransaction, notificationPublisher);
+			auto addresses = TTraits::ExtractAddresses(*pTransaction, notificationPublisher);
 
 			// Assert:
 			EXPECT_EQ(2u, addresses.size());
@@ -77,15 +92,27 @@ namespace catapult { namespace model {
 		}
 	}
 
-	TEST(TEST_CLASS, ExtractAddressesExtractsAddressesFromAddressNotifications) {
-		RunExtractAddressesTest(MockNotificationPublisher::Mode::Address);
+#define EXTRACT_TRAITS_BASED_TEST(TEST_NAME) \
+	template<typename TTraits> \
+	void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_Publisher) { \
+		TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<PublisherTraits>(); \
+	} \
+	TEST(TEST_CLASS, TEST_NAME##_Stream) { \
+		TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<StreamTraits>(); \
+	} \
+	template<typename TTraits> \
+	void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	EXTRACT_TRAITS_BASED_TEST(ExtractAddressesExtractsAddressesFromAddressNotifications) {
+		RunExtractAddressesTest<TTraits>(MockNotificationPublisher::Mode::Address);
 	}
 
-	TEST(TEST_CLASS, ExtractAddressesExtractsAddressesFromPublicKeyNotifications) {
-		RunExtractAddressesTest(MockNotificationPublisher::Mode::Public_Key);
+	EXTRACT_TRAITS_BASED_TEST(ExtractAddressesExtractsAddressesFromPublicKeyNotifications) {
+		RunExtractAddressesTest<TTraits>(MockNotificationPublisher::Mode::Public_Key);
 	}
 
-	TEST(TEST_CLASS, ExtractAddressesDoesNotExtractAddressesFromOtherNotifications) {
+	EXTRACT_TRAITS_BASED_TEST(ExtractAddressesDoesNotExtractAddressesFromOtherNotifications) {
 		// Arrange:
 		auto pTransaction = mocks::CreateMockTransactionWithSignerAndRecipient(
 				test::GenerateRandomByteArray<Key>(),
@@ -94,7 +121,7 @@ namespace catapult { namespace model {
 		MockNotificationPublisher notificationPublisher(MockNotificationPublisher::Mode::Other);
 
 		// Act:
-		auto addresses = ExtractAddresses(*pTransaction, notificationPublisher);
+		auto addresses = TTraits::ExtractAddresses(*pTransaction, notificationPublisher);
 
 		// Assert:
 		EXPECT_TRUE(addresses.empty());
@@ -21,6 +21,7 @@
 
 #include "catapult/model/WeakEntityInfo.h"
 #include "catapult/model/Block.h"
+#include "catapult/model/NotificationStream.h"
 #include "catapult/utils/HexParser.h"
 #include "tests/test/nodeps/Equality.h"
 #include "tests/TestHarness.h"
@@ -42,6 +43,7 @@ namespace catapult { namespace model {
 			EXPECT_EQ(&hash, &info.hash()) << tag;
 
 			EXPECT_FALSE(info.isAssociatedBlockHeaderSet()) << tag;
+			EXPECT_FALSE(info.isNotificationStreamSet()) << tag;
 		}
 
 		template<typename TEntity>
@@ -60,6 +62,8 @@ namespace catapult { namespace model {
 
 			ASSERT_TRUE(info.isAssociatedBlockHeaderSet()) << tag;
 			EXPECT_EQ(&blockHeader, &info.associatedBlockHeader()) << tag;
+
+			EXPECT_FALSE(info.isNotificationStreamSet()) << tag;
 		}
 
 		// endregion
@@ -75,6 +79,7 @@ namespace catapult { namespace model {
 		EXPECT_FALSE(info.isSet());
 		EXPECT_FALSE(info.isHashSet());
 		EXPECT_FALSE(info.isAssociatedBlockHeaderSet());
+		EXPECT_FALSE(info.isNotificationStreamSet());
 	}
 
 	TEST(TEST_CLASS, CanCreateWeakEntityInfoAroundEntity) {
@@ -90,6 +95,7 @@ namespace catapult { namespace model {
 
 		EXPECT_FALSE(info.isHashSet());
 		EXPECT_FALSE(info.isAssociatedBlockHeaderSet());
+		EXPECT_FALSE(info.isNotificationStreamSet());
 	}
 
 	TEST(TEST_CLASS, CanCreateWeakEntityInfoAroundEntityAndHash) {
@@ -119,6 +125,30 @@ namespace catapult { namespace model {
 
 	// endregion
 
+	// region notification stream
+
+	TEST(TEST_CLASS, CanSetNotificationStream) {
+		// Arrange:
+		VerifiableEntity entity;
+		Hash256 hash;
+		BlockHeader blockHeader;
+		WeakEntityInfo info(entity, hash, blockHeader);
+		NotificationStream stream(info);
+
+		// Act:
+		info.setNotificationStream(stream);
+
+		// Assert:
+		ASSERT_TRUE(info.isNotificationStreamSet());
+		EXPECT_EQ(&stream, &info.notificationStream());
+
+		EXPECT_EQ(&entity, &info.entity());
+		EXPECT_EQ(&hash, &info.hash());
+		EXPECT_EQ(&blockHeader, &info.associatedBlockHeader());
+	}
+
+	// endregion
+
 	// region assign
 
 	TEST(TEST_CLASS, CanAssignWeakEntityInfo) {
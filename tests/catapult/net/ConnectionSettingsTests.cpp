@@ -36,6 +36,7 @@ namespace catapult { namespace net {
 		EXPECT_EQ(utils::TimeSpan::FromSeconds(10), settings.Timeout);
 		EXPECT_EQ(utils::FileSize::FromKilobytes(4), settings.SocketWorkingBufferSize);
 		EXPECT_EQ(0u, settings.SocketWorkingBufferSensitivity);
+		EXPECT_EQ(utils::FileSize::FromKilobytes(16), settings.SocketWriteCoalescingSize);
 		EXPECT_EQ(utils::FileSize::FromMegabytes(100), settings.MaxPacketDataSize);
 		EXPECT_EQ(ionet::IpProtocol::IPv4, settings.OutgoingProtocols);
 
@@ -49,6 +50,7 @@ namespace catapult { namespace net {
 		settings.Timeout = utils::TimeSpan::FromSeconds(987);
 		settings.SocketWorkingBufferSize = utils::FileSize::FromKilobytes(54);
 		settings.SocketWorkingBufferSensitivity = 123;
+		settings.SocketWriteCoalescingSize = utils::FileSize::FromKilobytes(5);
 		settings.MaxPacketDataSize = utils::FileSize::FromMegabytes(2);
 		settings.OutgoingProtocols = ionet::IpProtocol::IPv6;
 
@@ -59,6 +61,7 @@ namespace catapult { namespace net {
 		EXPECT_EQ(utils::TimeSpan::FromSeconds(987), options.AcceptHandshakeTimeout);
 		EXPECT_EQ(54u * 1024, options.WorkingBufferSize);
 		EXPECT_EQ(123u, options.WorkingBufferSensitivity);
+		EXPECT_EQ(5u * 1024, options.WriteCoalescingSize);
 		EXPECT_EQ(2u * 1024 * 1024, options.MaxPacketDataSize);
 		EXPECT_EQ(ionet::IpProtocol::IPv6, options.OutgoingProtocols);
 	}
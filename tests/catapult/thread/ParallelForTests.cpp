@@ -324,6 +324,108 @@ namespace catapult { namespace thread {
 
 	// endregion
 
+	// region ParallelForCaptureExceptions / ParallelForRethrowFirstException
+
+	namespace {
+		auto CreateThrowingItemAggregate(std::atomic<size_t>& sum, ItemType minThrowingValue) {
+			return [&sum, minThrowingValue](auto value, auto) {
+				sum += value;
+				if (value >= minThrowingValue)
+					throw std::runtime_error(std::to_string(value));
+			};
+		}
+
+		std::string GetExceptionMessage(const std::exception_ptr& pException) {
+			try {
+				std::rethrow_exception(pException);
+			} catch (const std::runtime_error& ex) {
+				return ex.what();
+			}
+		}
+	}
+
+	CONTAINER_TEST(CaptureExceptionsProcessesAllItemsWhenNoExceptionsAreThrown) {
+		// Arrange:
+		BasicTestContext<typename TTraits::ContainerType> context;
+
+		// Act:
+		std::atomic<size_t> sum(0);
+		auto exceptions = ParallelForCaptureExceptions(
+				context.pPool->ioContext(),
+				context.Items,
+				context.NumThreads,
+				CreateThrowingItemAggregate(sum, std::numeric_limits<ItemType>::max())).get();
+
+		// Assert:
+		EXPECT_EQ(context.ItemsSum, sum);
+		EXPECT_EQ(std::vector<std::exception_ptr>(context.NumItems), exceptions);
+	}
+
+	CONTAINER_TEST(CaptureExceptionsCapturesExceptionsAtItemIndexes) {
+		// Arrange:
+		BasicTestContext<typename TTraits::ContainerType> context;
+
+		// Act: throw for all odd values
+		std::atomic<size_t> sum(0);
+		auto throwingAggregate = [&sum](auto value, auto) {
+			sum += value;
+			if (1 == value % 2)
+				throw std::runtime_error(std::to_string(value));
+		};
+		auto& ioContext = context.pPool->ioContext();
+		auto exceptions = ParallelForCaptureExceptions(ioContext, context.Items, context.NumThreads, throwingAggregate).get();
+
+		// Assert: all items were processed and exceptions were captured for (and only for) items with odd values (at even indexes)
+		EXPECT_EQ(context.ItemsSum, sum);
+		ASSERT_EQ(context.NumItems, exceptions.size());
+		for (auto i = 0u; i < exceptions.size(); ++i) {
+			if (1 == i % 2) {
+				EXPECT_FALSE(!!exceptions[i]) << "i " << i;
+				continue;
+			}
+
+			ASSERT_TRUE(!!exceptions[i]) << "i " << i;
+			EXPECT_EQ(std::to_string(i + 1), GetExceptionMessage(exceptions[i])) << "i " << i;
+		}
+	}
+
+	CONTAINER_TEST(RethrowFirstExceptionDoesNotThrowWhenNoExceptionsAreThrown) {
+		// Arrange:
+		BasicTestContext<typename TTraits::ContainerType> context;
+
+		// Act:
+		std::atomic<size_t> sum(0);
+		ParallelForRethrowFirstException(
+				context.pPool->ioContext(),
+				context.Items,
+				context.NumThreads,
+				CreateThrowingItemAggregate(sum, std::numeric_limits<ItemType>::max()));
+
+		// Assert:
+		EXPECT_EQ(context.ItemsSum, sum);
+	}
+
+	CONTAINER_TEST(RethrowFirstExceptionRethrowsExceptionOfLowestItemIndexAfterAllItemsAreProcessed) {
+		// Arrange:
+		BasicTestContext<typename TTraits::ContainerType> context;
+
+		// Act: throw for all values greater than or equal to 3
+		std::atomic<size_t> sum(0);
+		std::string message;
+		try {
+			auto throwingAggregate = CreateThrowingItemAggregate(sum, 3);
+			ParallelForRethrowFirstException(context.pPool->ioContext(), context.Items, context.NumThreads, throwingAggregate);
+		} catch (const std::runtime_error& ex) {
+			message = ex.what();
+		}
+
+		// Assert: the exception of the first throwing item was rethrown after all items were processed
+		EXPECT_EQ("3", message);
+		EXPECT_EQ(context.ItemsSum, sum);
+	}
+
+	// endregion
+
 	// region ParallelFor[Partition] distributed
 
 	namespace {
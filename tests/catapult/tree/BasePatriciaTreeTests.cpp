@@ -22,6 +22,7 @@
 #include "catapult/tree/BasePatriciaTree.h"
 #include "tests/test/tree/PassThroughEncoder.h"
 #include "tests/TestHarness.h"
+#include <set>
 
 namespace catapult { namespace tree {
 
@@ -422,6 +423,400 @@ namespace catapult { namespace tree {
 
 	// endregion
 
+	// region commit (node hashes)
+
+	namespace {
+		using HashSet = std::set<Hash256>;
+
+		void AddReachableHashes(const MemoryDataSource& dataSource, const Hash256& hash, HashSet& hashes) {
+			auto node = dataSource.get(hash);
+			ASSERT_FALSE(node.empty()) << hash;
+
+			hashes.insert(hash);
+			if (!node.isBranch())
+				return;
+
+			const auto& branchNode = node.asBranchNode();
+			for (auto i = 0u; i < BranchTreeNode::Max_Links; ++i) {
+				if (branchNode.hasLink(i))
+					AddReachableHashes(dataSource, branchNode.link(i), hashes);
+			}
+		}
+
+		HashSet FindReachableHashes(const MemoryDataSource& dataSource, const Hash256& rootHash) {
+			HashSet hashes;
+			if (Hash256() != rootHash)
+				AddReachableHashes(dataSource, rootHash, hashes);
+
+			return hashes;
+		}
+
+		HashSet Difference(const HashSet& lhs, const HashSet& rhs) {
+			HashSet result;
+			std::set_difference(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend(), std::inserter(result, result.end()));
+			return result;
+		}
+
+		HashSet Union(const HashSet& lhs, const HashSet& rhs) {
+			auto result = lhs;
+			result.insert(rhs.cbegin(), rhs.cend());
+			return result;
+		}
+
+		HashSet ToSet(const std::vector<Hash256>& hashes) {
+			return HashSet(hashes.cbegin(), hashes.cend());
+		}
+
+		CommittedNodeHashes CommitWithNodeHashes(
+				MemoryBasePatriciaTree& tree,
+				const NodeLinkCounts& sharedLinkCounts = NodeLinkCounts(),
+				const HashSet& unreachableHashes = HashSet()) {
+			CommittedNodeHashes committedNodeHashes;
+			auto isUnreachable = [&unreachableHashes](const auto& hash) {
+				return unreachableHashes.cend() != unreachableHashes.find(hash);
+			};
+			tree.commit(sharedLinkCounts, isUnreachable, committedNodeHashes);
+			return committedNodeHashes;
+		}
+
+		// seeds tree with two identical leaves (same suffix and value) below different branches:
+		// { 0x11'23'45'67, 0x12'00'00'00 } and { 0x21'23'45'67, 0x22'00'00'00 }
+		void SeedTreeWithIdenticalLeaves(MemoryBasePatriciaTree& tree) {
+			auto pDeltaTree = tree.rebase();
+			pDeltaTree->set(0x11'23'45'67, "same");
+			pDeltaTree->set(0x12'00'00'00, "alpha");
+			pDeltaTree->set(0x21'23'45'67, "same");
+			pDeltaTree->set(0x22'00'00'00, "beta");
+			tree.commit();
+		}
+
+		Hash256 GetSharedLeafHash(const MemoryDataSource& dataSource, const NodeLinkCounts& sharedLinkCounts) {
+			// Sanity:
+			EXPECT_EQ(1u, sharedLinkCounts.size());
+			if (sharedLinkCounts.empty())
+				return Hash256();
+
+			EXPECT_TRUE(dataSource.get(sharedLinkCounts.cbegin()->first).isLeaf());
+			return sharedLinkCounts.cbegin()->first;
+		}
+	}
+
+	TEST(TEST_CLASS, CommitWithNodeHashesReturnsAllNodesAsReachableForFirstCommit) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		MemoryBasePatriciaTree tree(dataSource);
+
+		auto pDeltaTree = tree.rebase();
+		pDeltaTree->set(0x64'6F'00'00, "verb");
+		pDeltaTree->set(0x64'6F'67'00, "puppy");
+		pDeltaTree->set(0x68'6F'72'73, "stallion");
+
+		// Act:
+		auto committedNodeHashes = CommitWithNodeHashes(tree);
+
+		// Assert:
+		EXPECT_EQ(FindReachableHashes(dataSource, tree.root()), ToSet(committedNodeHashes.Reachable));
+		EXPECT_TRUE(committedNodeHashes.Unreachable.empty());
+		EXPECT_TRUE(committedNodeHashes.SharedLinkCounts.empty());
+
+		// Sanity:
+		EXPECT_EQ(dataSource.size(), committedNodeHashes.Reachable.size());
+	}
+
+	TEST(TEST_CLASS, CommitWithNodeHashesReturnsReplacedNodesAsUnreachable) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		MemoryBasePatriciaTree tree(dataSource);
+		SeedTreeWithFourNodes(tree);
+		auto previousRoot = tree.root();
+
+		auto pDeltaTree = tree.rebase();
+		pDeltaTree->set(0x26'54'32'10, "alpha");
+		pDeltaTree->unset(0x64'6F'67'65);
+		pDeltaTree->set(0x64'6F'00'00, "noun");
+
+		// Act:
+		auto committedNodeHashes = CommitWithNodeHashes(tree);
+
+		// Assert:
+		auto previousHashes = FindReachableHashes(dataSource, previousRoot);
+		auto hashes = FindReachableHashes(dataSource, tree.root());
+		EXPECT_EQ(Difference(hashes, previousHashes), ToSet(committedNodeHashes.Reachable));
+		EXPECT_EQ(Difference(previousHashes, hashes), ToSet(committedNodeHashes.Unreachable));
+
+		// Sanity: unchanged stallion leaf is shared by both trees
+		EXPECT_FALSE(committedNodeHashes.Reachable.empty());
+		EXPECT_FALSE(committedNodeHashes.Unreachable.empty());
+		EXPECT_LT(committedNodeHashes.Unreachable.size(), previousHashes.size());
+	}
+
+	TEST(TEST_CLASS, CommitWithNodeHashesReturnsIntermediateCheckpointNodesAsUnreachable) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		MemoryBasePatriciaTree tree(dataSource);
+		SeedTreeWithFourNodes(tree);
+		auto previousRoot = tree.root();
+
+		auto pDeltaTree = tree.rebase();
+		pDeltaTree->set(0x26'54'32'10, "alpha");
+		pDeltaTree->setCheckpoint();
+		auto intermediateRoot = pDeltaTree->root();
+
+		pDeltaTree->set(0x64'6F'67'65, "bitcoin");
+
+		// Act:
+		auto committedNodeHashes = CommitWithNodeHashes(tree);
+
+		// Assert:
+		auto previousHashes = FindReachableHashes(dataSource, previousRoot);
+		auto intermediateHashes = FindReachableHashes(dataSource, intermediateRoot);
+		auto hashes = FindReachableHashes(dataSource, tree.root());
+		EXPECT_EQ(Difference(hashes, previousHashes), ToSet(committedNodeHashes.Reachable));
+		EXPECT_EQ(Difference(Union(previousHashes, intermediateHashes), hashes), ToSet(committedNodeHashes.Unreachable));
+
+		// Sanity: intermediate root is unreachable
+		EXPECT_TRUE(ToSet(committedNodeHashes.Unreachable).count(intermediateRoot));
+	}
+
+	TEST(TEST_CLASS, CommitWithNodeHashesReturnsOnlyIntermediateCheckpointNodesAsUnreachableWhenTreeIsRestored) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		MemoryBasePatriciaTree tree(dataSource);
+		SeedTreeWithFourNodes(tree);
+		auto previousRoot = tree.root();
+
+		// - change a value and restore it in a subsequent checkpoint
+		auto pDeltaTree = tree.rebase();
+		pDeltaTree->set(0x64'6F'67'65, "bitcoin");
+		pDeltaTree->setCheckpoint();
+		auto intermediateRoot = pDeltaTree->root();
+
+		pDeltaTree->set(0x64'6F'67'65, "coin");
+
+		// Act:
+		auto committedNodeHashes = CommitWithNodeHashes(tree);
+
+		// Assert: restored nodes were never unreachable and only nodes of the intermediate checkpoint are unreachable
+		auto previousHashes = FindReachableHashes(dataSource, previousRoot);
+		auto intermediateHashes = FindReachableHashes(dataSource, intermediateRoot);
+		EXPECT_EQ(previousRoot, tree.root());
+		EXPECT_TRUE(committedNodeHashes.Reachable.empty());
+		EXPECT_EQ(Difference(intermediateHashes, previousHashes), ToSet(committedNodeHashes.Unreachable));
+	}
+
+	TEST(TEST_CLASS, CommitWithNodeHashesReturnsUncollectedUnreachableNodesAsReachableWhenRestored) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		MemoryBasePatriciaTree tree(dataSource);
+		SeedTreeWithFourNodes(tree);
+		auto previousHashes = FindReachableHashes(dataSource, tree.root());
+
+		auto pDeltaTree = tree.rebase();
+		pDeltaTree->set(0x64'6F'67'65, "bitcoin");
+		auto unreachableHashes = ToSet(CommitWithNodeHashes(tree).Unreachable);
+		pDeltaTree.reset();
+
+		// - restore the original value while the replaced nodes are still stored
+		pDeltaTree = tree.rebase();
+		pDeltaTree->set(0x64'6F'67'65, "coin");
+
+		// Act:
+		auto committedNodeHashes = CommitWithNodeHashes(tree, NodeLinkCounts(), unreachableHashes);
+
+		// Assert:
+		auto hashes = FindReachableHashes(dataSource, tree.root());
+		EXPECT_EQ(previousHashes, hashes);
+		EXPECT_EQ(unreachableHashes, ToSet(committedNodeHashes.Reachable));
+
+		// Sanity:
+		EXPECT_FALSE(unreachableHashes.empty());
+	}
+
+	TEST(TEST_CLASS, CommitWithNodeHashesReturnsAllNodesAsUnreachableWhenTreeIsCleared) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		MemoryBasePatriciaTree tree(dataSource);
+		SeedTreeWithFourNodes(tree);
+		auto previousRoot = tree.root();
+
+		auto pDeltaTree = tree.rebase();
+		for (auto key : std::initializer_list<uint32_t>{ 0x64'6F'00'00, 0x64'6F'67'00, 0x64'6F'67'65, 0x68'6F'72'73 })
+			pDeltaTree->unset(key);
+
+		// Act:
+		auto committedNodeHashes = CommitWithNodeHashes(tree);
+
+		// Assert:
+		EXPECT_EQ(Hash256(), tree.root());
+		EXPECT_TRUE(committedNodeHashes.Reachable.empty());
+		EXPECT_EQ(FindReachableHashes(dataSource, previousRoot), ToSet(committedNodeHashes.Unreachable));
+	}
+
+	TEST(TEST_CLASS, CommitWithNodeHashesReturnsNoUnreachableNodesWhenCommitIsRepeated) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		MemoryBasePatriciaTree tree(dataSource);
+		SeedTreeWithFourNodes(tree);
+
+		auto pDeltaTree = tree.rebase();
+		pDeltaTree->set(0x26'54'32'10, "alpha");
+		tree.commit();
+
+		// Act:
+		auto committedNodeHashes = CommitWithNodeHashes(tree);
+
+		// Assert: all pending nodes were already committed
+		EXPECT_TRUE(committedNodeHashes.Reachable.empty());
+		EXPECT_TRUE(committedNodeHashes.Unreachable.empty());
+		EXPECT_TRUE(committedNodeHashes.SharedLinkCounts.empty());
+	}
+
+	TEST(TEST_CLASS, CommitWithNodeHashesReturnsLinkCountsOfIdenticalLeaves) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		MemoryBasePatriciaTree tree(dataSource);
+		auto pDeltaTree = tree.rebase();
+		pDeltaTree->set(0x11'23'45'67, "same");
+		pDeltaTree->set(0x12'00'00'00, "alpha");
+		pDeltaTree->set(0x21'23'45'67, "same");
+		pDeltaTree->set(0x22'00'00'00, "beta");
+
+		// Act:
+		auto committedNodeHashes = CommitWithNodeHashes(tree);
+
+		// Assert: shared leaf is only reported once
+		auto hashes = FindReachableHashes(dataSource, tree.root());
+		EXPECT_EQ(hashes.size(), committedNodeHashes.Reachable.size());
+		EXPECT_EQ(hashes, ToSet(committedNodeHashes.Reachable));
+		EXPECT_TRUE(committedNodeHashes.Unreachable.empty());
+
+		auto sharedLeafHash = GetSharedLeafHash(dataSource, committedNodeHashes.SharedLinkCounts);
+		EXPECT_EQ(NodeLinkCounts({ { sharedLeafHash, 2u } }), committedNodeHashes.SharedLinkCounts);
+	}
+
+	TEST(TEST_CLASS, CommitWithNodeHashesDoesNotReturnIdenticalLeafAsUnreachableWhenLinkedInUnchangedSubtree) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		MemoryBasePatriciaTree tree(dataSource);
+		SeedTreeWithIdenticalLeaves(tree);
+		auto previousRoot = tree.root();
+		auto sharedLinkCounts = tree.findSharedLinkCounts();
+		auto sharedLeafHash = GetSharedLeafHash(dataSource, sharedLinkCounts);
+
+		// - collapse the second branch, which unlinks the leaf below it, but leave the first branch unchanged
+		auto pDeltaTree = tree.rebase();
+		pDeltaTree->unset(0x22'00'00'00);
+
+		// Act:
+		auto committedNodeHashes = CommitWithNodeHashes(tree, sharedLinkCounts);
+
+		// Assert:
+		auto previousHashes = FindReachableHashes(dataSource, previousRoot);
+		auto hashes = FindReachableHashes(dataSource, tree.root());
+		EXPECT_EQ(Difference(hashes, previousHashes), ToSet(committedNodeHashes.Reachable));
+		EXPECT_EQ(Difference(previousHashes, hashes), ToSet(committedNodeHashes.Unreachable));
+		EXPECT_EQ(NodeLinkCounts({ { sharedLeafHash, 1u } }), committedNodeHashes.SharedLinkCounts);
+
+		// Sanity: leaf is still reachable
+		EXPECT_TRUE(hashes.count(sharedLeafHash));
+		EXPECT_FALSE(ToSet(committedNodeHashes.Unreachable).count(sharedLeafHash));
+	}
+
+	TEST(TEST_CLASS, CommitWithNodeHashesReturnsIdenticalLeafAsUnreachableWhenAllLinksAreRemoved) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		MemoryBasePatriciaTree tree(dataSource);
+		SeedTreeWithIdenticalLeaves(tree);
+		auto previousRoot = tree.root();
+		auto sharedLinkCounts = tree.findSharedLinkCounts();
+		auto sharedLeafHash = GetSharedLeafHash(dataSource, sharedLinkCounts);
+
+		auto pDeltaTree = tree.rebase();
+		pDeltaTree->unset(0x11'23'45'67);
+		pDeltaTree->unset(0x21'23'45'67);
+
+		// Act:
+		auto committedNodeHashes = CommitWithNodeHashes(tree, sharedLinkCounts);
+
+		// Assert:
+		auto previousHashes = FindReachableHashes(dataSource, previousRoot);
+		auto hashes = FindReachableHashes(dataSource, tree.root());
+		EXPECT_EQ(Difference(hashes, previousHashes), ToSet(committedNodeHashes.Reachable));
+		EXPECT_EQ(Difference(previousHashes, hashes), ToSet(committedNodeHashes.Unreachable));
+		EXPECT_EQ(NodeLinkCounts({ { sharedLeafHash, 0u } }), committedNodeHashes.SharedLinkCounts);
+
+		// Sanity:
+		EXPECT_TRUE(ToSet(committedNodeHashes.Unreachable).count(sharedLeafHash));
+	}
+
+	TEST(TEST_CLASS, CommitWithNodeHashesFailsWhenNodeIsUnlinkedAtMorePositionsThanItIsLinked) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		MemoryBasePatriciaTree tree(dataSource);
+		SeedTreeWithIdenticalLeaves(tree);
+
+		auto pDeltaTree = tree.rebase();
+		pDeltaTree->unset(0x11'23'45'67);
+		pDeltaTree->unset(0x21'23'45'67);
+
+		// Act + Assert: shared link counts are (incorrectly) not provided
+		CommittedNodeHashes committedNodeHashes;
+		EXPECT_THROW(tree.commit(NodeLinkCounts(), [](const auto&) { return false; }, committedNodeHashes), catapult_runtime_error);
+	}
+
+	// endregion
+
+	// region findSharedLinkCounts
+
+	TEST(TEST_CLASS, FindSharedLinkCountsReturnsNoCountsForEmptyTree) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		MemoryBasePatriciaTree tree(dataSource);
+
+		// Act:
+		auto sharedLinkCounts = tree.findSharedLinkCounts();
+
+		// Assert:
+		EXPECT_TRUE(sharedLinkCounts.empty());
+	}
+
+	TEST(TEST_CLASS, FindSharedLinkCountsReturnsNoCountsWhenNoNodesAreShared) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		MemoryBasePatriciaTree tree(dataSource);
+		SeedTreeWithFourNodes(tree);
+
+		// Act:
+		auto sharedLinkCounts = tree.findSharedLinkCounts();
+
+		// Assert:
+		EXPECT_TRUE(sharedLinkCounts.empty());
+	}
+
+	TEST(TEST_CLASS, FindSharedLinkCountsReturnsCountsOfNodesLinkedAtMultiplePositions) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		MemoryBasePatriciaTree tree(dataSource);
+		auto pDeltaTree = tree.rebase();
+		pDeltaTree->set(0x11'23'45'67, "same");
+		pDeltaTree->set(0x12'00'00'00, "alpha");
+		pDeltaTree->set(0x21'23'45'67, "same");
+		pDeltaTree->set(0x22'00'00'00, "beta");
+		pDeltaTree->set(0x31'23'45'67, "same");
+		pDeltaTree->set(0x32'00'00'00, "gamma");
+		auto expectedSharedLinkCounts = CommitWithNodeHashes(tree).SharedLinkCounts;
+
+		// Act:
+		auto sharedLinkCounts = tree.findSharedLinkCounts();
+
+		// Assert:
+		auto sharedLeafHash = GetSharedLeafHash(dataSource, sharedLinkCounts);
+		EXPECT_EQ(NodeLinkCounts({ { sharedLeafHash, 3u } }), sharedLinkCounts);
+		EXPECT_EQ(expectedSharedLinkCounts, sharedLinkCounts);
+	}
+
+	// endregion
+
 	// region reset
 
 	namespace {
@@ -51,4 +51,132 @@ namespace catapult { namespace tree {
 	}
 
 	DEFINE_PATRICIA_TREE_TESTS(MemoryTraits)
+
+	// region prefetch
+
+	namespace {
+		class PrefetchRecordingDataSource : public MemoryDataSource {
+		public:
+			void prefetch(const std::vector<Hash256>& hashes) const {
+				PrefetchedHashes.push_back(hashes);
+			}
+
+		public:
+			mutable std::vector<std::vector<Hash256>> PrefetchedHashes;
+		};
+
+		using PrefetchRecordingTree = PatriciaTree<test::PassThroughEncoder, PrefetchRecordingDataSource>;
+
+		// creates a puppy tree with root branch node in \a dataSource and returns its root hash
+		Hash256 SeedPuppyTree(PrefetchRecordingDataSource& dataSource) {
+			PrefetchRecordingTree tree(dataSource);
+			tree.set(0x64'6F'00'00, "verb");
+			tree.set(0x64'6F'67'00, "puppy");
+			tree.set(0x64'6F'67'65, "coin");
+			tree.set(0x7A'6F'72'73, "stallion");
+			tree.saveAll();
+			return tree.root();
+		}
+
+		template<typename TAction>
+		void RunPrefetchTest(TAction action) {
+			// Arrange: load the tree so that no linked nodes are in memory
+			PrefetchRecordingDataSource dataSource;
+			auto rootHash = SeedPuppyTree(dataSource);
+			PrefetchRecordingTree tree(dataSource);
+			tree.tryLoad(rootHash);
+
+			// - root branch links to verb-puppy-coin branch (6) and stallion leaf (7)
+			//   verb-puppy-coin branch links to verb leaf (0) and puppy-coin branch (6)
+			//   puppy-coin branch links to puppy leaf (0) and coin leaf (6)
+			auto rootNode = dataSource.get(rootHash);
+			auto verbPuppyCoinNode = dataSource.get(rootNode.asBranchNode().link(6));
+			auto puppyCoinNode = dataSource.get(verbPuppyCoinNode.asBranchNode().link(6));
+
+			// Act + Assert:
+			action(tree, dataSource, rootNode.asBranchNode(), verbPuppyCoinNode.asBranchNode(), puppyCoinNode.asBranchNode());
+		}
+	}
+
+	TEST(TEST_CLASS, PrefetchHasNoEffectWhenTreeIsEmpty) {
+		// Arrange:
+		PrefetchRecordingDataSource dataSource;
+		PrefetchRecordingTree tree(dataSource);
+
+		// Act:
+		tree.prefetch({ 0x64'6F'67'65 });
+
+		// Assert:
+		EXPECT_TRUE(dataSource.PrefetchedHashes.empty());
+	}
+
+	TEST(TEST_CLASS, PrefetchHasNoEffectWhenNoKeysAreSpecified) {
+		RunPrefetchTest([](const auto& tree, const auto& dataSource, const auto&, const auto&, const auto&) {
+			// Act:
+			tree.prefetch({});
+
+			// Assert:
+			EXPECT_TRUE(dataSource.PrefetchedHashes.empty());
+		});
+	}
+
+	TEST(TEST_CLASS, PrefetchHasNoEffectWhenLinkedNodesAreInMemory) {
+		// Arrange: do not save the tree so that all linked nodes are in memory
+		PrefetchRecordingDataSource dataSource;
+		PrefetchRecordingTree tree(dataSource);
+		tree.set(0x64'6F'00'00, "verb");
+		tree.set(0x64'6F'67'65, "coin");
+
+		// Act:
+		tree.prefetch({ 0x64'6F'67'65 });
+
+		// Assert:
+		EXPECT_TRUE(dataSource.PrefetchedHashes.empty());
+	}
+
+	TEST(TEST_CLASS, PrefetchLoadsAllNodesAlongSingleKeyPathOneLevelAtATime) {
+		RunPrefetchTest([](const auto& tree, const auto& dataSource, const auto& root, const auto& verbPuppyCoin, const auto& puppyCoin) {
+			// Act:
+			tree.prefetch({ 0x64'6F'67'65 });
+
+			// Assert:
+			std::vector<std::vector<Hash256>> expectedPrefetchedHashes{
+				{ root.link(6) },
+				{ verbPuppyCoin.link(6) },
+				{ puppyCoin.link(6) }
+			};
+			EXPECT_EQ(expectedPrefetchedHashes, dataSource.PrefetchedHashes);
+		});
+	}
+
+	TEST(TEST_CLASS, PrefetchLoadsAllNodesAlongMultipleKeyPathsOneLevelAtATime) {
+		RunPrefetchTest([](const auto& tree, const auto& dataSource, const auto& root, const auto& verbPuppyCoin, const auto& puppyCoin) {
+			// Act:
+			tree.prefetch({ 0x7A'6F'72'73, 0x64'6F'67'65, 0x64'6F'00'00 });
+
+			// Assert:
+			std::vector<std::vector<Hash256>> expectedPrefetchedHashes{
+				{ root.link(6), root.link(7) },
+				{ verbPuppyCoin.link(0), verbPuppyCoin.link(6) },
+				{ puppyCoin.link(6) }
+			};
+			EXPECT_EQ(expectedPrefetchedHashes, dataSource.PrefetchedHashes);
+		});
+	}
+
+	TEST(TEST_CLASS, PrefetchStopsAtNodesNotMatchingKeyPath) {
+		RunPrefetchTest([](const auto& tree, const auto& dataSource, const auto& root, const auto& verbPuppyCoin, const auto&) {
+			// Act: key diverges from puppy-coin branch path
+			tree.prefetch({ 0x64'6F'68'00, 0x12'34'56'78 });
+
+			// Assert:
+			std::vector<std::vector<Hash256>> expectedPrefetchedHashes{
+				{ root.link(6) },
+				{ verbPuppyCoin.link(6) }
+			};
+			EXPECT_EQ(expectedPrefetchedHashes, dataSource.PrefetchedHashes);
+		});
+	}
+
+	// endregion
 }}
@@ -0,0 +1,263 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/ArenaMemoryResource.h"
+#include "tests/TestHarness.h"
+#include <map>
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS ArenaMemoryResourceTests
+
+	namespace {
+		bool IsAligned(const void* pData, size_t alignment) {
+			return 0 == reinterpret_cast<uintptr_t>(pData) % alignment;
+		}
+
+		void Allocate(ArenaMemoryResource& arena, size_t numBytes, size_t alignment) {
+			auto* pData = arena.allocate(numBytes, alignment);
+			EXPECT_TRUE(!!pData);
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateEmptyArena) {
+		// Act:
+		ArenaMemoryResource arena;
+
+		// Assert:
+		EXPECT_EQ(0u, arena.numAllocations());
+		EXPECT_EQ(0u, arena.size());
+		EXPECT_EQ(0u, arena.capacity());
+	}
+
+	// endregion
+
+	// region allocate
+
+	TEST(TEST_CLASS, CanAllocateFromArena) {
+		// Arrange:
+		ArenaMemoryResource arena(1024);
+
+		// Act:
+		auto* pData1 = static_cast<uint8_t*>(arena.allocate(100, 1));
+		auto* pData2 = static_cast<uint8_t*>(arena.allocate(200, 1));
+
+		// Assert: allocations are contiguous within a single block
+		EXPECT_EQ(pData1 + 100, pData2);
+		EXPECT_EQ(2u, arena.numAllocations());
+		EXPECT_EQ(300u, arena.size());
+		EXPECT_EQ(1024u, arena.capacity());
+	}
+
+	TEST(TEST_CLASS, AllocationsRespectAlignment) {
+		// Arrange:
+		ArenaMemoryResource arena(1024);
+
+		// Act + Assert:
+		for (auto alignment : { 1u, 2u, 4u, 8u, 16u, 32u, 64u }) {
+			Allocate(arena, 1, 1);
+			auto* pData = arena.allocate(3, alignment);
+			EXPECT_TRUE(IsAligned(pData, alignment)) << "alignment " << alignment;
+		}
+
+		EXPECT_EQ(14u, arena.numAllocations());
+		EXPECT_EQ(28u, arena.size());
+	}
+
+	TEST(TEST_CLASS, ArenaGrowsWithProgressivelyLargerBlocks) {
+		// Arrange:
+		ArenaMemoryResource arena(100);
+
+		// Act: exhaust the first block and spill into a second block (with twice the size)
+		Allocate(arena, 80, 1);
+		Allocate(arena, 80, 1);
+
+		// Assert:
+		EXPECT_EQ(2u, arena.numAllocations());
+		EXPECT_EQ(160u, arena.size());
+		EXPECT_EQ(300u, arena.capacity());
+	}
+
+	TEST(TEST_CLASS, CanAllocateMoreThanBlockSize) {
+		// Arrange:
+		ArenaMemoryResource arena(100);
+
+		// Act:
+		auto* pData = arena.allocate(1000, 8);
+
+		// Assert: the block is large enough to hold the aligned allocation
+		EXPECT_TRUE(IsAligned(pData, 8));
+		EXPECT_EQ(1u, arena.numAllocations());
+		EXPECT_EQ(1000u, arena.size());
+		EXPECT_EQ(1008u, arena.capacity());
+	}
+
+	TEST(TEST_CLASS, DeallocateDoesNotReclaimMemory) {
+		// Arrange:
+		ArenaMemoryResource arena(1024);
+		auto* pData = arena.allocate(100, 1);
+
+		// Act:
+		arena.deallocate(pData, 100, 1);
+
+		// Assert:
+		EXPECT_EQ(1u, arena.numAllocations());
+		EXPECT_EQ(100u, arena.size());
+		EXPECT_EQ(1024u, arena.capacity());
+	}
+
+	// endregion
+
+	// region reset
+
+	TEST(TEST_CLASS, CanResetEmptyArena) {
+		// Arrange:
+		ArenaMemoryResource arena;
+
+		// Act:
+		arena.reset();
+
+		// Assert:
+		EXPECT_EQ(0u, arena.numAllocations());
+		EXPECT_EQ(0u, arena.size());
+		EXPECT_EQ(0u, arena.capacity());
+	}
+
+	TEST(TEST_CLASS, ResetRetainsLargestBlock) {
+		// Arrange: create blocks with sizes 100, 1000 and 400
+		ArenaMemoryResource arena(100);
+		Allocate(arena, 80, 1);
+		Allocate(arena, 1000 - 1, 1);
+		Allocate(arena, 150, 1);
+		EXPECT_EQ(1500u, arena.capacity());
+
+		// Act:
+		arena.reset();
+
+		// Assert:
+		EXPECT_EQ(0u, arena.numAllocations());
+		EXPECT_EQ(0u, arena.size());
+		EXPECT_EQ(1000u, arena.capacity());
+	}
+
+	TEST(TEST_CLASS, ResetArenaReusesRetainedBlock) {
+		// Arrange:
+		ArenaMemoryResource arena(1024);
+		auto* pData1 = arena.allocate(100, 1);
+		arena.reset();
+
+		// Act:
+		auto* pData2 = arena.allocate(100, 1);
+
+		// Assert:
+		EXPECT_EQ(pData1, pData2);
+		EXPECT_EQ(1u, arena.numAllocations());
+		EXPECT_EQ(100u, arena.size());
+		EXPECT_EQ(1024u, arena.capacity());
+	}
+
+	// endregion
+
+	// region statistics
+
+	TEST(TEST_CLASS, ArenaUpdatesGlobalStatistics) {
+		// Arrange:
+		auto initialStatistics = GetArenaMemoryStatistics();
+
+		{
+			// Act: allocate from two blocks
+			ArenaMemoryResource arena(100);
+			Allocate(arena, 80, 1);
+			Allocate(arena, 80, 1);
+			auto statistics = GetArenaMemoryStatistics();
+
+			// Assert:
+			EXPECT_EQ(initialStatistics.NumReservedBytes + 300, statistics.NumReservedBytes);
+			EXPECT_EQ(initialStatistics.NumBlockAllocations + 2, statistics.NumBlockAllocations);
+
+			// Act: release the smaller block
+			arena.reset();
+			statistics = GetArenaMemoryStatistics();
+
+			// Assert:
+			EXPECT_EQ(initialStatistics.NumReservedBytes + 200, statistics.NumReservedBytes);
+		}
+
+		// Assert: all reserved memory is released on destruction but the cumulative counters are unchanged
+		auto finalStatistics = GetArenaMemoryStatistics();
+		EXPECT_EQ(initialStatistics.NumReservedBytes, finalStatistics.NumReservedBytes);
+		EXPECT_EQ(initialStatistics.NumBlockAllocations + 2, finalStatistics.NumBlockAllocations);
+	}
+
+	TEST(TEST_CLASS, AllocationsWithinBlockAreOnlyCountedByArena) {
+		// Arrange:
+		ArenaMemoryResource arena1(100);
+		ArenaMemoryResource arena2(100);
+		Allocate(arena1, 10, 1);
+		auto initialStatistics = GetArenaMemoryStatistics();
+
+		// Act:
+		Allocate(arena1, 10, 1);
+		Allocate(arena1, 10, 1);
+
+		// Assert: global statistics are not updated by allocations that fit into existing blocks
+		auto statistics = GetArenaMemoryStatistics();
+		EXPECT_EQ(initialStatistics.NumReservedBytes, statistics.NumReservedBytes);
+		EXPECT_EQ(initialStatistics.NumBlockAllocations, statistics.NumBlockAllocations);
+
+		EXPECT_EQ(3u, arena1.numAllocations());
+		EXPECT_EQ(0u, arena2.numAllocations());
+	}
+
+	// endregion
+
+	// region pmr containers
+
+	TEST(TEST_CLASS, CanBackPolymorphicContainer) {
+		// Arrange:
+		ArenaMemoryResource arena;
+		std::pmr::map<uint32_t, uint32_t> map(&arena);
+
+		// Act:
+		for (auto i = 0u; i < 100; ++i)
+			map.emplace(i, i * i);
+
+		// Assert:
+		EXPECT_EQ(100u, map.size());
+		EXPECT_EQ(49u * 49, map.find(49)->second);
+		EXPECT_EQ(100u, arena.numAllocations());
+	}
+
+	TEST(TEST_CLASS, ArenaIsOnlyEqualToItself) {
+		// Arrange:
+		ArenaMemoryResource arena1;
+		ArenaMemoryResource arena2;
+
+		// Act + Assert:
+		EXPECT_TRUE(arena1.is_equal(arena1));
+		EXPECT_FALSE(arena1.is_equal(arena2));
+		EXPECT_FALSE(arena1.is_equal(*std::pmr::new_delete_resource()));
+	}
+
+	// endregion
+}}
@@ -0,0 +1,485 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/FlatHashMap.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+#include <map>
+#include <unordered_map>
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS FlatHashMapTests
+
+	namespace {
+		using IntMap = FlatHashMap<uint32_t, std::string>;
+
+		// maps all keys into a small number of hash values in order to force long probe sequences
+		struct CollidingHasher {
+			size_t operator()(uint32_t key) const {
+				return key % 3;
+			}
+		};
+
+		using CollidingMap = FlatHashMap<uint32_t, std::string, CollidingHasher>;
+
+		template<typename TMap>
+		std::map<uint32_t, std::string> ToOrderedMap(const TMap& map) {
+			std::map<uint32_t, std::string> orderedMap;
+			for (const auto& pair : map)
+				orderedMap.emplace(pair.first, pair.second);
+
+			return orderedMap;
+		}
+
+		template<typename TMap>
+		void InsertRange(TMap& map, uint32_t first, uint32_t last) {
+			for (auto i = first; i < last; ++i)
+				map.emplace(i, std::to_string(i));
+		}
+
+		template<typename TMap>
+		void AssertContainsRange(const TMap& map, uint32_t first, uint32_t last) {
+			for (auto i = first; i < last; ++i) {
+				auto iter = map.find(i);
+				ASSERT_NE(map.cend(), iter) << i;
+				EXPECT_EQ(std::to_string(i), iter->second) << i;
+			}
+		}
+	}
+
+	// region traits
+
+	TEST(TEST_CLASS, IsDetectedAsMap) {
+		EXPECT_TRUE(traits::is_map_v<IntMap>);
+		EXPECT_TRUE(traits::is_map_v<const IntMap>);
+	}
+
+	// endregion
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateEmptyMap) {
+		// Act:
+		IntMap map;
+
+		// Assert:
+		EXPECT_TRUE(map.empty());
+		EXPECT_EQ(0u, map.size());
+		EXPECT_EQ(map.cbegin(), map.cend());
+		EXPECT_EQ(map.cend(), map.find(123));
+		EXPECT_EQ(0u, map.count(123));
+	}
+
+	// endregion
+
+	// region insert / emplace
+
+	TEST(TEST_CLASS, CanInsertElements) {
+		// Arrange:
+		IntMap map;
+
+		// Act:
+		auto result1 = map.insert(std::make_pair(1u, std::string("alpha")));
+		auto result2 = map.insert(IntMap::value_type(2, "beta"));
+		auto result3 = map.emplace(3, "gamma");
+
+		// Assert:
+		EXPECT_TRUE(result1.second);
+		EXPECT_TRUE(result2.second);
+		EXPECT_TRUE(result3.second);
+		EXPECT_EQ(1u, result1.first->first);
+		EXPECT_EQ("beta", result2.first->second);
+		EXPECT_EQ("gamma", result3.first->second);
+
+		EXPECT_EQ(3u, map.size());
+		EXPECT_EQ((std::map<uint32_t, std::string>{ { 1, "alpha" }, { 2, "beta" }, { 3, "gamma" } }), ToOrderedMap(map));
+	}
+
+	TEST(TEST_CLASS, InsertDoesNotOverwriteExistingElement) {
+		// Arrange:
+		IntMap map;
+		map.emplace(1, "alpha");
+
+		// Act:
+		auto result = map.emplace(1, "beta");
+
+		// Assert:
+		EXPECT_FALSE(result.second);
+		EXPECT_EQ("alpha", result.first->second);
+		EXPECT_EQ(1u, map.size());
+	}
+
+	TEST(TEST_CLASS, CanInsertRange) {
+		// Arrange:
+		std::map<uint32_t, std::string> source{ { 1, "alpha" }, { 2, "beta" }, { 3, "gamma" } };
+		IntMap map;
+
+		// Act:
+		map.insert(source.cbegin(), source.cend());
+
+		// Assert:
+		EXPECT_EQ(3u, map.size());
+		EXPECT_EQ(source, ToOrderedMap(map));
+	}
+
+	TEST(TEST_CLASS, SubscriptInsertsDefaultValueWhenKeyIsUnknown) {
+		// Arrange:
+		IntMap map;
+		map.emplace(1, "alpha");
+
+		// Act:
+		auto& value = map[2];
+
+		// Assert:
+		EXPECT_EQ("", value);
+		EXPECT_EQ(2u, map.size());
+	}
+
+	TEST(TEST_CLASS, SubscriptReturnsExistingValueWhenKeyIsKnown) {
+		// Arrange:
+		IntMap map;
+		map.emplace(1, "alpha");
+
+		// Act:
+		map[1] += "beta";
+
+		// Assert:
+		EXPECT_EQ("alphabeta", map.find(1)->second);
+		EXPECT_EQ(1u, map.size());
+	}
+
+	TEST(TEST_CLASS, ReferencesAreStableAcrossRehashes) {
+		// Arrange:
+		IntMap map;
+		auto& value = map.emplace(0, "zero").first->second;
+
+		// Act: force many rehashes
+		InsertRange(map, 1, 10'000);
+
+		// Assert:
+		EXPECT_EQ(10'000u, map.size());
+		EXPECT_EQ(&value, &map.find(0)->second);
+		AssertContainsRange(map, 1, 10'000);
+	}
+
+	namespace {
+		constexpr uint32_t Throwing_Key = 100;
+
+		struct ThrowingValue {
+		public:
+			explicit ThrowingValue(int value) : Value(value) {
+				if (value < 0)
+					CATAPULT_THROW_INVALID_ARGUMENT("value must not be negative");
+			}
+
+		public:
+			int Value;
+		};
+
+		// simulates an allocation failure while a new element is being indexed
+		struct ThrowingHasher {
+			size_t operator()(uint32_t key) const {
+				if (Throwing_Key == key)
+					throw std::bad_alloc();
+
+				return key;
+			}
+		};
+
+		template<typename TMap>
+		size_t CountIteratedElements(const TMap& map) {
+			size_t count = 0;
+			for (auto iter = map.cbegin(); map.cend() != iter; ++iter)
+				++count;
+
+			return count;
+		}
+	}
+
+	TEST(TEST_CLASS, EmplaceLeavesMapUnchangedWhenValueConstructorThrows) {
+		// Arrange: fill the map up to its growth threshold
+		FlatHashMap<uint32_t, ThrowingValue> map;
+		for (auto i = 0u; i < 12; ++i)
+			map.emplace(i, static_cast<int>(i));
+
+		// Act + Assert:
+		EXPECT_THROW(map.emplace(Throwing_Key, -1), catapult_invalid_argument);
+
+		// - no element was added
+		EXPECT_EQ(12u, map.size());
+		EXPECT_EQ(12u, CountIteratedElements(map));
+		EXPECT_EQ(map.cend(), map.find(Throwing_Key));
+
+		// - the map is still usable
+		EXPECT_TRUE(map.emplace(Throwing_Key, 7).second);
+		EXPECT_EQ(13u, map.size());
+		EXPECT_EQ(13u, CountIteratedElements(map));
+		EXPECT_EQ(7, map.find(Throwing_Key)->second.Value);
+	}
+
+	TEST(TEST_CLASS, EmplaceLeavesMapUnchangedWhenIndexingThrows) {
+		// Arrange: fill the map up to its growth threshold
+		FlatHashMap<uint32_t, std::string, ThrowingHasher> map;
+		InsertRange(map, 0, 12);
+
+		// Act + Assert:
+		EXPECT_THROW(map.emplace(Throwing_Key, "throwing"), std::bad_alloc);
+
+		// - no element was added and the constructed element is not reachable through iteration
+		EXPECT_EQ(12u, map.size());
+		EXPECT_EQ(12u, CountIteratedElements(map));
+		AssertContainsRange(map, 0, 12);
+
+		// - the map is still usable (and grows)
+		InsertRange(map, 12, 100);
+		EXPECT_EQ(100u, map.size());
+		EXPECT_EQ(100u, CountIteratedElements(map));
+		AssertContainsRange(map, 0, 100);
+	}
+
+	// endregion
+
+	// region find
+
+	TEST(TEST_CLASS, CanFindElementsThroughConstAndNonConstInterfaces) {
+		// Arrange:
+		IntMap map;
+		InsertRange(map, 0, 100);
+		const auto& constMap = map;
+
+		// Act:
+		auto iter = map.find(42);
+		auto constIter = constMap.find(42);
+
+		// Assert:
+		EXPECT_EQ(42u, iter->first);
+		EXPECT_EQ(&*iter, &*constIter);
+		EXPECT_EQ(map.end(), map.find(142));
+		EXPECT_EQ(constMap.cend(), constMap.find(142));
+		EXPECT_EQ(1u, map.count(42));
+		EXPECT_EQ(0u, map.count(142));
+	}
+
+	TEST(TEST_CLASS, CanModifyValuesThroughNonConstIterator) {
+		// Arrange:
+		IntMap map;
+		map.emplace(1, "alpha");
+
+		// Act:
+		map.find(1)->second = "beta";
+
+		// Assert:
+		EXPECT_EQ("beta", map.find(1)->second);
+	}
+
+	// endregion
+
+	// region erase
+
+	TEST(TEST_CLASS, CanEraseElementByKey) {
+		// Arrange:
+		IntMap map;
+		InsertRange(map, 0, 100);
+
+		// Act:
+		auto numErased1 = map.erase(42);
+		auto numErased2 = map.erase(142);
+
+		// Assert:
+		EXPECT_EQ(1u, numErased1);
+		EXPECT_EQ(0u, numErased2);
+		EXPECT_EQ(99u, map.size());
+		EXPECT_EQ(map.cend(), map.find(42));
+		AssertContainsRange(map, 0, 42);
+		AssertContainsRange(map, 43, 100);
+	}
+
+	TEST(TEST_CLASS, EraseByIteratorReturnsIteratorToNextElement) {
+		// Arrange:
+		IntMap map;
+		InsertRange(map, 0, 10);
+		auto iter = map.begin();
+		auto expectedNextKey = std::next(iter)->first;
+
+		// Act:
+		auto nextIter = map.erase(iter);
+
+		// Assert:
+		EXPECT_EQ(9u, map.size());
+		EXPECT_EQ(expectedNextKey, nextIter->first);
+	}
+
+	TEST(TEST_CLASS, CanEraseAllElementsWhileIterating) {
+		// Arrange:
+		IntMap map;
+		InsertRange(map, 0, 1000);
+
+		// Act:
+		auto numVisited = 0u;
+		for (auto iter = map.cbegin(); map.cend() != iter; ++numVisited)
+			iter = map.erase(iter);
+
+		// Assert:
+		EXPECT_EQ(1000u, numVisited);
+		EXPECT_TRUE(map.empty());
+	}
+
+	TEST(TEST_CLASS, ErasedNodesAreReused) {
+		// Arrange:
+		IntMap map;
+		InsertRange(map, 0, 10);
+		auto* pErasedValue = &map.find(5)->second;
+
+		// Act:
+		map.erase(5);
+		auto& value = map.emplace(100, "hundred").first->second;
+
+		// Assert:
+		EXPECT_EQ(pErasedValue, &value);
+		EXPECT_EQ(10u, map.size());
+	}
+
+	TEST(TEST_CLASS, EraseRepairsProbeSequences) {
+		// Arrange: all keys collide into three home slots
+		CollidingMap map;
+		InsertRange(map, 0, 300);
+
+		// Act: remove every other element
+		for (auto i = 0u; i < 300; i += 2)
+			map.erase(i);
+
+		// Assert:
+		EXPECT_EQ(150u, map.size());
+		for (auto i = 0u; i < 300; ++i)
+			EXPECT_EQ(i % 2, map.count(i)) << i;
+	}
+
+	TEST(TEST_CLASS, CanClearMap) {
+		// Arrange:
+		IntMap map;
+		InsertRange(map, 0, 100);
+
+		// Act:
+		map.clear();
+
+		// Assert:
+		EXPECT_TRUE(map.empty());
+		EXPECT_EQ(map.cbegin(), map.cend());
+		EXPECT_EQ(map.cend(), map.find(42));
+
+		// Sanity: map is reusable
+		InsertRange(map, 50, 60);
+		EXPECT_EQ(10u, map.size());
+		AssertContainsRange(map, 50, 60);
+	}
+
+	// endregion
+
+	// region copy / move / equality
+
+	TEST(TEST_CLASS, CanCopyMap) {
+		// Arrange:
+		IntMap map;
+		InsertRange(map, 0, 100);
+
+		// Act:
+		auto copy = map;
+		copy[42] = "changed";
+
+		// Assert:
+		EXPECT_EQ(100u, copy.size());
+		EXPECT_EQ("42", map.find(42)->second);
+		EXPECT_EQ("changed", copy.find(42)->second);
+	}
+
+	TEST(TEST_CLASS, CanMoveMap) {
+		// Arrange:
+		IntMap map;
+		InsertRange(map, 0, 100);
+		auto* pValue = &map.find(42)->second;
+
+		// Act:
+		auto movedMap = std::move(map);
+
+		// Assert: nodes are transferred, not copied
+		EXPECT_EQ(100u, movedMap.size());
+		EXPECT_EQ(pValue, &movedMap.find(42)->second);
+		AssertContainsRange(movedMap, 0, 100);
+	}
+
+	TEST(TEST_CLASS, EqualityDependsOnContentsNotInsertionOrder) {
+		// Arrange:
+		IntMap map1;
+		IntMap map2;
+		IntMap map3;
+		InsertRange(map1, 0, 100);
+		for (auto i = 100u; i > 0; --i)
+			map2.emplace(i - 1, std::to_string(i - 1));
+
+		InsertRange(map3, 0, 100);
+		map3[42] = "changed";
+
+		// Act + Assert:
+		EXPECT_EQ(map1, map2);
+		EXPECT_NE(map1, map3);
+		EXPECT_NE(map1, IntMap());
+	}
+
+	// endregion
+
+	// region randomized
+
+	namespace {
+		template<typename TMap>
+		void AssertRandomOperationsMatchReference() {
+			// Arrange:
+			TMap map;
+			std::unordered_map<uint32_t, std::string> referenceMap;
+
+			// Act: perform a random mix of inserts and erases over a small key space
+			for (auto i = 0u; i < 20'000; ++i) {
+				auto key = static_cast<uint32_t>(test::Random() % 1000);
+				if (0 == test::Random() % 3) {
+					EXPECT_EQ(referenceMap.erase(key), map.erase(key)) << key;
+				} else {
+					auto value = std::to_string(i);
+					EXPECT_EQ(referenceMap.emplace(key, value).second, map.emplace(key, value).second) << key;
+				}
+			}
+
+			// Assert:
+			std::map<uint32_t, std::string> expectedMap(referenceMap.cbegin(), referenceMap.cend());
+			EXPECT_EQ(referenceMap.size(), map.size());
+			EXPECT_EQ(expectedMap, ToOrderedMap(map));
+		}
+	}
+
+	TEST(TEST_CLASS, RandomOperationsMatchReferenceMap) {
+		AssertRandomOperationsMatchReference<IntMap>();
+	}
+
+	TEST(TEST_CLASS, RandomOperationsMatchReferenceMapWithCollidingHashes) {
+		AssertRandomOperationsMatchReference<CollidingMap>();
+	}
+
+	// endregion
+}}
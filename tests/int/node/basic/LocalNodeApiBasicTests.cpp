@@ -73,6 +73,9 @@ namespace catapult { namespace local {
 		EXPECT_TRUE(test::HasCounter(counters, "TX ELEM TOT")) << "service local node counters";
 		EXPECT_TRUE(test::HasCounter(counters, "UT CACHE")) << "local node counters";
 		EXPECT_TRUE(test::HasCounter(counters, "TOT CONF TXES")) << "local node counters";
+		EXPECT_TRUE(test::HasCounter(counters, "BLKCACHE HITS")) << "local node counters";
+		EXPECT_TRUE(test::HasCounter(counters, "PKCACHE HITS")) << "local node counters";
+		EXPECT_TRUE(test::HasCounter(counters, "PTGC BYTES")) << "local node counters";
 		EXPECT_TRUE(test::HasCounter(counters, "MEM CUR RSS")) << "memory counters";
 		EXPECT_TRUE(test::HasCounter(counters, "NODES")) << "node container counters";
 		EXPECT_TRUE(test::HasCounter(counters, "BAN ACT")) << "banned nodes container counters";
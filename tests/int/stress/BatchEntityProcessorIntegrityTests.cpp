@@ -0,0 +1,227 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "plugins/services/hashcache/src/cache/HashCacheStorage.h"
+#include "plugins/services/hashcache/src/plugins/MemoryHashCacheSystem.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/chain/BatchEntityProcessor.h"
+#include "catapult/extensions/ExecutionConfigurationFactory.h"
+#include "catapult/model/BlockStatementBuilder.h"
+#include "catapult/model/EntityHasher.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "tests/test/cache/CacheTestUtils.h"
+#include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/EntityTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/test/local/LocalTestUtils.h"
+#include "tests/test/local/RealTransactionFactory.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/test/nodeps/KeyTestUtils.h"
+#include "tests/test/nodeps/Nemesis.h"
+#include "tests/test/nodeps/TestConstants.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace chain {
+
+#define TEST_CLASS BatchEntityProcessorIntegrityTests
+
+	namespace {
+		constexpr auto Num_Accounts = 8u;
+		constexpr auto Initial_Balance = 1000u;
+		constexpr auto Default_Time = Timestamp(987);
+
+		uint64_t GetNumIterations() {
+			return test::GetStressIterationCount() ? 250 : 10;
+		}
+
+		// region test factories
+
+		auto CreateConfiguration() {
+			auto config = test::CreatePrototypicalBlockChainConfiguration();
+			config.EnableVerifiableState = true;
+			config.EnableVerifiableReceipts = true;
+			config.Plugins.emplace("catapult.plugins.transfer", utils::ConfigurationBag({{ "", { { "maxMessageSize", "0" } } }}));
+			return config;
+		}
+
+		std::shared_ptr<plugins::PluginManager> CreatePluginManager() {
+			// include memory hash cache system so that transaction hashes are checked and recorded by real plugins
+			auto pPluginManager = test::CreatePluginManagerWithRealPlugins(CreateConfiguration());
+			plugins::RegisterMemoryHashCacheSystem(*pPluginManager);
+			return pPluginManager;
+		}
+
+		cache::CatapultCache CreateCatapultCache(const std::string& databaseDirectory) {
+			auto cacheId = cache::HashCache::Id;
+			auto config = CreateConfiguration();
+			auto cacheConfig = cache::CacheConfiguration(databaseDirectory, cache::PatriciaTreeStorageMode::Enabled);
+
+			std::vector<std::unique_ptr<cache::SubCachePlugin>> subCaches(cacheId + 1);
+			test::CoreSystemCacheFactory::CreateSubCaches(config, cacheConfig, subCaches);
+			auto transactionCacheDuration = model::CalculateTransactionCacheDuration(config);
+			subCaches[cacheId] = test::MakeSubCachePluginWithCacheConfiguration<cache::HashCache, cache::HashCacheStorage>(
+					cacheConfig,
+					transactionCacheDuration);
+			return cache::CatapultCache(std::move(subCaches));
+		}
+
+		// endregion
+
+		// region ProcessorTestContext
+
+		struct ProcessingOutcome {
+			validators::ValidationResult Result;
+			Hash256 ReceiptsHash;
+			Hash256 StateHash;
+		};
+
+		class ProcessorTestContext {
+		public:
+			ProcessorTestContext(
+					const std::string& directoryName,
+					const std::vector<crypto::KeyPair>& keyPairs,
+					BatchEntityProcessor&& processor)
+					: m_dbDirGuard(directoryName)
+					, m_cache(CreateCatapultCache(m_dbDirGuard.name()))
+					, m_processor(std::move(processor)) {
+				// seed all accounts with equal currency balances and the first account with a harvesting balance
+				auto cacheDelta = m_cache.createDelta();
+				auto& accountStateCacheDelta = cacheDelta.sub<cache::AccountStateCache>();
+				for (const auto& keyPair : keyPairs) {
+					accountStateCacheDelta.addAccount(keyPair.publicKey(), Height(1));
+					auto accountStateIter = accountStateCacheDelta.find(keyPair.publicKey());
+					accountStateIter.get().Balances.credit(test::Default_Currency_Mosaic_Id, Amount(Initial_Balance));
+				}
+
+				auto harvesterIter = accountStateCacheDelta.find(keyPairs[0].publicKey());
+				harvesterIter.get().Balances.credit(test::Default_Harvesting_Mosaic_Id, Amount(10'000'000));
+				harvesterIter.get().ImportanceSnapshots.set(Importance(10'000'000), model::ImportanceHeight(1));
+				m_cache.commit(Height(1));
+			}
+
+		public:
+			ProcessingOutcome process(const model::BlockElement& blockElement) {
+				model::WeakEntityInfos entityInfos;
+				model::ExtractEntityInfos(blockElement, entityInfos);
+
+				auto cacheDelta = m_cache.createDelta();
+				model::BlockStatementBuilder blockStatementBuilder;
+				auto observerState = observers::ObserverState(cacheDelta, blockStatementBuilder);
+
+				const auto& block = blockElement.Block;
+				ProcessingOutcome outcome;
+				outcome.Result = m_processor(block.Height, block.Timestamp, entityInfos, observerState);
+				outcome.ReceiptsHash = model::CalculateMerkleHash(*blockStatementBuilder.build());
+				outcome.StateHash = cacheDelta.calculateStateHash(block.Height).StateHash;
+
+				if (validators::IsValidationResultSuccess(outcome.Result))
+					m_cache.commit(block.Height);
+
+				return outcome;
+			}
+
+		private:
+			test::TempDirectoryGuard m_dbDirGuard;
+			cache::CatapultCache m_cache;
+			BatchEntityProcessor m_processor;
+		};
+
+		// endregion
+
+		// region block factory
+
+		std::unique_ptr<model::Transaction> CreateTransfer(const crypto::KeyPair& sender, const Key& recipient, uint64_t amount) {
+			auto pTransaction = test::CreateTransferTransaction(sender, recipient, Amount(amount));
+			pTransaction->MaxFee = Amount(0);
+			pTransaction->Deadline = Default_Time + Timestamp(1);
+			return pTransaction;
+		}
+
+		std::unique_ptr<model::Block> CreateMixedBlock(const std::vector<crypto::KeyPair>& keyPairs, Height height) {
+			test::ConstTransactions transactions;
+			for (auto i = 0u; i < Num_Accounts; ++i) {
+				const auto& sender = keyPairs[test::RandomByte() % Num_Accounts];
+				const auto& recipient = keyPairs[test::RandomByte() % Num_Accounts];
+				auto amount = test::Random() % (2 * Initial_Balance / Num_Accounts);
+
+				switch (test::RandomByte() % 4) {
+				case 0:
+					// chained transfer (A -> B, B -> C), so the second transfer depends on the first one
+					transactions.push_back(CreateTransfer(sender, recipient.publicKey(), amount));
+					transactions.push_back(CreateTransfer(recipient, keyPairs[i].publicKey(), amount));
+					break;
+
+				case 1:
+					// transfer to a new account
+					transactions.push_back(CreateTransfer(sender, test::GenerateRandomByteArray<Key>(), amount));
+					break;
+
+				case 2:
+					// duplicate transfer, so the second transaction has the same hash as the first one
+					transactions.push_back(CreateTransfer(sender, recipient.publicKey(), amount));
+					transactions.push_back(test::CopyEntity(*transactions.back()));
+					break;
+
+				default:
+					// independent transfer (that might overspend)
+					transactions.push_back(CreateTransfer(sender, recipient.publicKey(), amount));
+					break;
+				}
+			}
+
+			auto pBlock = test::GenerateBlockWithTransactions(keyPairs[0], transactions);
+			pBlock->Height = height;
+			pBlock->Timestamp = Default_Time;
+			return pBlock;
+		}
+
+		// endregion
+	}
+
+	NO_STRESS_TEST(TEST_CLASS, ParallelProcessorProducesSameResultsAsSerialProcessorWithRealPlugins) {
+		// Arrange:
+		auto pPluginManager = CreatePluginManager();
+		auto executionConfig = extensions::CreateExecutionConfiguration(*pPluginManager);
+		auto pPool = test::CreateStartedIoThreadPool(4);
+
+		std::vector<crypto::KeyPair> keyPairs;
+		for (auto i = 0u; i < Num_Accounts; ++i)
+			keyPairs.push_back(test::GenerateKeyPair());
+
+		ProcessorTestContext serialContext("serial", keyPairs, CreateBatchEntityProcessor(executionConfig));
+		ProcessorTestContext parallelContext("parallel", keyPairs, CreateParallelBatchEntityProcessor(executionConfig, *pPool));
+
+		for (auto i = 0u; i < GetNumIterations(); ++i) {
+			auto message = "block " + std::to_string(i);
+			auto pBlock = CreateMixedBlock(keyPairs, Height(2 + i));
+			auto blockElement = test::BlockToBlockElement(*pBlock, test::GetNemesisGenerationHashSeed());
+
+			// Act:
+			auto serialOutcome = serialContext.process(blockElement);
+			auto parallelOutcome = parallelContext.process(blockElement);
+
+			// Assert: validation results, receipts and states are identical
+			EXPECT_EQ(serialOutcome.Result, parallelOutcome.Result) << message;
+			EXPECT_EQ(serialOutcome.ReceiptsHash, parallelOutcome.ReceiptsHash) << message;
+			EXPECT_EQ(serialOutcome.StateHash, parallelOutcome.StateHash) << message;
+		}
+	}
+}}
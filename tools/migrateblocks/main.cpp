@@ -0,0 +1,76 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "tools/ToolConfigurationUtils.h"
+#include "tools/ToolMain.h"
+#include "catapult/config/CatapultConfiguration.h"
+#include "catapult/io/SegmentedBlockStorage.h"
+#include "catapult/utils/StackLogger.h"
+
+namespace catapult { namespace tools { namespace migrateblocks {
+
+	namespace {
+		class MigrateBlocksTool : public Tool {
+		public:
+			std::string name() const override {
+				return "Block Storage Migration Tool";
+			}
+
+			void prepareOptions(OptionsBuilder& optionsBuilder, OptionsPositional&) override {
+				optionsBuilder("resources,r",
+						OptionsValue<std::string>(m_resourcesPath)->default_value(".."),
+						"the path to the resources directory");
+
+				optionsBuilder("removeLegacyFiles,x",
+						OptionsSwitch(),
+						"true if per-block files should be removed after migration (prevents switching back to per-block storage)");
+			}
+
+			int run(const Options& options) override {
+				auto config = LoadConfiguration(m_resourcesPath);
+				auto legacyBlockFilesAction = options["removeLegacyFiles"].as<bool>()
+						? io::LegacyBlockFilesAction::Remove
+						: io::LegacyBlockFilesAction::Keep;
+
+				// node must not be running because storage files are modified in place
+				io::SegmentedBlockStorage storage(config.User.DataDirectory);
+				CATAPULT_LOG(info) << "migrating blocks in " << config.User.DataDirectory << " up to height " << storage.chainHeight();
+
+				utils::StackLogger stackLogger("migrating blocks", utils::LogLevel::info);
+				auto numMigratedBlocks = storage.migrateLegacyBlocks(legacyBlockFilesAction);
+				CATAPULT_LOG(info) << "migrated " << numMigratedBlocks << " blocks into segment files";
+
+				if (!config.Node.EnableSegmentedBlockStorage)
+					CATAPULT_LOG(warning) << "enableSegmentedBlockStorage must be set in node configuration to use migrated blocks";
+
+				return 0;
+			}
+
+		private:
+			std::string m_resourcesPath;
+		};
+	}
+}}}
+
+int main(int argc, const char** argv) {
+	catapult::tools::migrateblocks::MigrateBlocksTool migrateBlocksTool;
+	return catapult::tools::ToolMain(argc, argv, migrateBlocksTool);
+}
@@ -0,0 +1,210 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "tools/ToolConfigurationUtils.h"
+#include "tools/ToolMain.h"
+#include "catapult/cache/CatapultCache.h"
+#include "catapult/config/CatapultDataDirectory.h"
+#include "catapult/extensions/LocalNodeChainScore.h"
+#include "catapult/extensions/LocalNodeStateFileStorage.h"
+#include "catapult/extensions/LocalNodeStateRef.h"
+#include "catapult/extensions/ProcessBootstrapper.h"
+#include "catapult/io/BlockStorageCache.h"
+#include "catapult/io/FileBlockStorage.h"
+#include "catapult/local/HostUtils.h"
+#include "catapult/utils/StackLogger.h"
+#include <algorithm>
+#include <filesystem>
+
+namespace catapult { namespace tools { namespace startupbench {
+
+	namespace {
+		struct StartupTimings {
+			uint64_t LoadPluginsMillis = 0;
+			uint64_t CreateCacheMillis = 0;
+			uint64_t LoadStateMillis = 0;
+			uint64_t TotalMillis = 0;
+		};
+
+		config::CatapultConfiguration CreateConfigurationWithDataDirectory(
+				const config::CatapultConfiguration& config,
+				const std::string& dataDirectory) {
+			auto blockChainConfig = config.BlockChain;
+			auto nodeConfig = config.Node;
+			auto loggingConfig = config.Logging;
+			auto userConfig = config.User;
+			auto extensionsConfig = config.Extensions;
+			auto inflationConfig = config.Inflation;
+
+			userConfig.DataDirectory = dataDirectory;
+			return config::CatapultConfiguration(
+					std::move(blockChainConfig),
+					std::move(nodeConfig),
+					std::move(loggingConfig),
+					std::move(userConfig),
+					std::move(extensionsConfig),
+					std::move(inflationConfig));
+		}
+
+		bool IsSameOrNestedDirectory(const std::filesystem::path& directory, const std::filesystem::path& parentDirectory) {
+			auto canonicalDirectory = std::filesystem::weakly_canonical(directory);
+			auto canonicalParentDirectory = std::filesystem::weakly_canonical(parentDirectory);
+			auto mismatch = std::mismatch(
+					canonicalParentDirectory.begin(),
+					canonicalParentDirectory.end(),
+					canonicalDirectory.begin(),
+					canonicalDirectory.end());
+			return canonicalParentDirectory.end() == mismatch.first;
+		}
+
+		std::unique_ptr<io::PrunableBlockStorage> CreateStagingBlockStorage(const config::CatapultDataDirectory& dataDirectory) {
+			auto stagingDirectory = dataDirectory.spoolDir("block_sync").str();
+			config::CatapultDirectory(stagingDirectory).create();
+			return std::make_unique<io::FileBlockStorage>(stagingDirectory, io::FileBlockStorageMode::None);
+		}
+
+		class StartupBenchmarkTool : public Tool {
+		public:
+			std::string name() const override {
+				return "Startup Benchmark Tool";
+			}
+
+			void prepareOptions(OptionsBuilder& optionsBuilder, OptionsPositional&) override {
+				optionsBuilder("resources,r",
+						OptionsValue<std::string>(m_resourcesPath)->default_value(".."),
+						"the path to the resources directory");
+				optionsBuilder("iterations,n",
+						OptionsValue<uint32_t>(m_numIterations)->default_value(1),
+						"the number of times to boot the local node state");
+				optionsBuilder("work,w",
+						OptionsValue<std::string>(m_workDirectory)->default_value("startupbench_data"),
+						"the path to the scratch directory to which the data directory is copied before each boot (CLEARED on every boot)");
+			}
+
+			int run(const Options&) override {
+				if (0 == m_numIterations)
+					CATAPULT_THROW_INVALID_ARGUMENT("number of iterations must be nonzero");
+
+				auto config = LoadConfiguration(m_resourcesPath);
+				const auto& sourceDataDirectory = config.User.DataDirectory;
+				if (!extensions::HasSerializedState(config::CatapultDataDirectory(sourceDataDirectory).dir("state"))) {
+					CATAPULT_LOG(error) << "no serialized state found in " << sourceDataDirectory;
+					return -1;
+				}
+
+				// booting opens the cache database and commits the loaded state into it (and into the spool),
+				// so NEVER boot from the data directory itself; boot from a fresh copy instead, which also makes all iterations identical
+				if (IsSameOrNestedDirectory(m_workDirectory, sourceDataDirectory)
+						|| IsSameOrNestedDirectory(sourceDataDirectory, m_workDirectory)) {
+					CATAPULT_LOG(error)
+							<< "work directory " << m_workDirectory << " must not overlap data directory " << sourceDataDirectory;
+					return -1;
+				}
+
+				auto workConfig = CreateConfigurationWithDataDirectory(config, m_workDirectory);
+				auto dataDirectory = config::CatapultDataDirectory(m_workDirectory);
+				CATAPULT_LOG(warning)
+						<< "benchmarking startup of a copy of " << sourceDataDirectory << " in " << m_workDirectory
+						<< " (" << m_numIterations << " iterations); " << m_workDirectory << " is cleared before every iteration";
+
+				StartupTimings totalTimings;
+				for (auto i = 0u; i < m_numIterations; ++i) {
+					copyDataDirectory(sourceDataDirectory);
+					auto timings = boot(workConfig, dataDirectory);
+					CATAPULT_LOG(info)
+							<< "iteration " << i + 1 << ": ready to sync in " << timings.TotalMillis << "ms"
+							<< " (load plugins " << timings.LoadPluginsMillis << "ms"
+							<< ", create cache " << timings.CreateCacheMillis << "ms"
+							<< ", load state " << timings.LoadStateMillis << "ms)";
+
+					totalTimings.LoadPluginsMillis += timings.LoadPluginsMillis;
+					totalTimings.CreateCacheMillis += timings.CreateCacheMillis;
+					totalTimings.LoadStateMillis += timings.LoadStateMillis;
+					totalTimings.TotalMillis += timings.TotalMillis;
+				}
+
+				CATAPULT_LOG(info)
+						<< "average: ready to sync in " << totalTimings.TotalMillis / m_numIterations << "ms"
+						<< " (load plugins " << totalTimings.LoadPluginsMillis / m_numIterations << "ms"
+						<< ", create cache " << totalTimings.CreateCacheMillis / m_numIterations << "ms"
+						<< ", load state " << totalTimings.LoadStateMillis / m_numIterations << "ms)";
+				return 0;
+			}
+
+		private:
+			void copyDataDirectory(const std::string& sourceDataDirectory) const {
+				utils::StackLogger stopwatch("copying data directory", utils::LogLevel::info);
+				std::filesystem::remove_all(m_workDirectory);
+				std::filesystem::copy(sourceDataDirectory, m_workDirectory, std::filesystem::copy_options::recursive);
+			}
+
+			StartupTimings boot(const config::CatapultConfiguration& config, const config::CatapultDataDirectory& dataDirectory) const {
+				StartupTimings timings;
+				utils::StackTimer totalStopwatch;
+
+				// 1. load extensions and plugins the same way as the server process (modules must be unloaded last)
+				utils::StackTimer pluginsStopwatch;
+				std::vector<plugins::PluginModule> pluginModules;
+				auto resourcesPath = (std::filesystem::path(m_resourcesPath) / "resources").generic_string();
+				auto pBootstrapper = std::make_unique<extensions::ProcessBootstrapper>(
+						config,
+						resourcesPath,
+						extensions::ProcessDisposition::Production,
+						"StartupBench");
+				pBootstrapper->loadExtensions();
+				pluginModules = local::LoadAllPlugins(*pBootstrapper);
+				timings.LoadPluginsMillis = pluginsStopwatch.millis();
+
+				// 2. create the cache, which opens the cache database when it is enabled
+				utils::StackTimer cacheStopwatch;
+				auto& pluginManager = pBootstrapper->pluginManager();
+				auto cache = pluginManager.createCache();
+				timings.CreateCacheMillis = cacheStopwatch.millis();
+
+				// 3. load the serialized state
+				utils::StackTimer stateStopwatch;
+				io::BlockChangeSubscriber* pBlockChangeSubscriber;
+				io::BlockStorageCache storage(
+						pBootstrapper->subscriptionManager().createBlockStorage(pBlockChangeSubscriber),
+						CreateStagingBlockStorage(dataDirectory),
+						config.Node.BlockStorageCacheMaxSize);
+				extensions::LocalNodeChainScore score;
+				auto stateRef = extensions::LocalNodeStateRef(config, cache, storage, score);
+				auto heights = extensions::LoadStateFromDirectory(dataDirectory.dir("state"), stateRef, pluginManager);
+				timings.LoadStateMillis = stateStopwatch.millis();
+
+				timings.TotalMillis = totalStopwatch.millis();
+				CATAPULT_LOG(debug) << "loaded state with cache height " << heights.Cache << " and storage height " << heights.Storage;
+				return timings;
+			}
+
+		private:
+			std::string m_resourcesPath;
+			uint32_t m_numIterations;
+			std::string m_workDirectory;
+		};
+	}
+}}}
+
+int main(int argc, const char** argv) {
+	catapult::tools::startupbench::StartupBenchmarkTool startupBenchmarkTool;
+	return catapult::tools::ToolMain(argc, argv, startupBenchmarkTool);
+}